@@ -15,7 +15,11 @@
 
 #define BOOST_TEST_MAIN
 
+#include <fstream>
+
 #include <boost/array.hpp>
+#include <boost/assign/list_of.hpp>
+#include <boost/filesystem.hpp>
 #include <boost/make_shared.hpp>
 #include <boost/shared_ptr.hpp>
 #include <boost/test/floating_point_comparison.hpp>
@@ -246,7 +250,9 @@ BOOST_AUTO_TEST_CASE( testAerodynamicCoefficientGenerator )
     }
 }
 
-boost::shared_ptr< HypersonicLocalInclinationAnalysis > getApolloCoefficientInterface( )
+boost::shared_ptr< HypersonicLocalInclinationAnalysis > getApolloCoefficientInterface(
+        const unsigned int numberOfThreads = 1, const std::string& coefficientCacheFile = "",
+        const bool generateCoefficientsOnDemand = false )
 {
 
     // Create test capsule.
@@ -304,7 +310,7 @@ boost::shared_ptr< HypersonicLocalInclinationAnalysis > getApolloCoefficientInte
     return boost::make_shared< HypersonicLocalInclinationAnalysis >(
                 independentVariableDataPoints, capsule, numberOfLines, numberOfPoints,
                 invertOrders, selectedMethods, PI * pow( capsule->getMiddleRadius( ), 2.0 ),
-                3.9116, momentReference );
+                3.9116, momentReference, numberOfThreads, coefficientCacheFile, generateCoefficientsOnDemand );
 }
 //! Apollo capsule test case.
 BOOST_AUTO_TEST_CASE( testApolloCapsule )
@@ -392,6 +398,132 @@ BOOST_AUTO_TEST_CASE( testApolloCapsule )
                        toleranceAerodynamicCoefficients5 );
 }
 
+//! Test multi-threaded generation of coefficients, and storage of coefficients in cache file.
+BOOST_AUTO_TEST_CASE( testCoefficientGenerationThreadsAndCacheFile )
+{
+    // Generate coefficients using single and multiple threads.
+    boost::multi_array< Vector6d, 3 > serialCoefficients =
+            getApolloCoefficientInterface( )->getAerodynamicCoefficientsTables( );
+    boost::shared_ptr< HypersonicLocalInclinationAnalysis > multiThreadedCoefficientInterface =
+            getApolloCoefficientInterface( 3 );
+    boost::multi_array< Vector6d, 3 > multiThreadedCoefficients =
+            multiThreadedCoefficientInterface->getAerodynamicCoefficientsTables( );
+
+    // Check that results are identical.
+    BOOST_CHECK_EQUAL( serialCoefficients.num_elements( ), multiThreadedCoefficients.num_elements( ) );
+    for( unsigned int i = 0; i < serialCoefficients.num_elements( ); i++ )
+    {
+        for( unsigned int j = 0; j < 6; j++ )
+        {
+            BOOST_CHECK_EQUAL( serialCoefficients.data( )[ i ]( j ), multiThreadedCoefficients.data( )[ i ]( j ) );
+        }
+    }
+
+    // Generate coefficients and write them to file.
+    const std::string cacheFile = ( boost::filesystem::temp_directory_path( ) / boost::filesystem::unique_path(
+                                        "hypersonicLocalInclinationTestCache-%%%%-%%%%-%%%%.dat" ) ).string( );
+    getApolloCoefficientInterface( 2, cacheFile );
+
+    // Modify final coefficient in file, and check that the modified coefficient is retrieved from file.
+    double modifiedCoefficient = 1.0E3;
+    {
+        std::fstream fileStream( cacheFile.c_str( ), std::ios::binary | std::ios::in | std::ios::out );
+        fileStream.seekp( -static_cast< std::streamoff >( sizeof( double ) ), std::ios::end );
+        fileStream.write( reinterpret_cast< const char* >( &modifiedCoefficient ), sizeof( double ) );
+    }
+
+    boost::multi_array< Vector6d, 3 > coefficientsFromFile =
+            getApolloCoefficientInterface( 1, cacheFile )->getAerodynamicCoefficientsTables( );
+    for( unsigned int i = 0; i < serialCoefficients.num_elements( ); i++ )
+    {
+        for( unsigned int j = 0; j < 6; j++ )
+        {
+            if( i == serialCoefficients.num_elements( ) - 1 && j == 5 )
+            {
+                BOOST_CHECK_EQUAL( coefficientsFromFile.data( )[ i ]( j ), modifiedCoefficient );
+            }
+            else
+            {
+                BOOST_CHECK_EQUAL( serialCoefficients.data( )[ i ]( j ), coefficientsFromFile.data( )[ i ]( j ) );
+            }
+        }
+    }
+
+    // Check that file is not used (and is overwritten) for different geometry.
+    boost::shared_ptr< geometric_shapes::SphereSegment > sphere
+            = boost::make_shared< geometric_shapes::SphereSegment >( 1.0 );
+    std::vector< std::vector< double > > independentVariableDataPoints =
+            multiThreadedCoefficientInterface->getDataPointsOfIndependentVariables( );
+    std::vector< std::vector< int > > analysisMethod( 2, std::vector< int >( 1, 0 ) );
+    analysisMethod[ 1 ][ 0 ] = 1;
+    HypersonicLocalInclinationAnalysis sphereAnalysis(
+                independentVariableDataPoints, sphere, std::vector< int >( 1, 11 ), std::vector< int >( 1, 11 ),
+                std::vector< bool >( 1, false ), analysisMethod, PI, 1.0, Eigen::Vector3d::Zero( ), 1, cacheFile );
+    BOOST_CHECK( sphereAnalysis.computeGeometryHash( ) != multiThreadedCoefficientInterface->computeGeometryHash( ) );
+    BOOST_CHECK_CLOSE_FRACTION( sphereAnalysis.getAerodynamicCoefficientsTables( ).data( )[ 0 ].head( 3 ).norm( ),
+                                1.0, 0.1 );
+
+    coefficientsFromFile = getApolloCoefficientInterface( 1, cacheFile )->getAerodynamicCoefficientsTables( );
+    for( unsigned int i = 0; i < serialCoefficients.num_elements( ); i++ )
+    {
+        for( unsigned int j = 0; j < 6; j++ )
+        {
+            BOOST_CHECK_EQUAL( serialCoefficients.data( )[ i ]( j ), coefficientsFromFile.data( )[ i ]( j ) );
+        }
+    }
+
+    boost::filesystem::remove( cacheFile );
+}
+
+//! Test generation of coefficients on demand.
+BOOST_AUTO_TEST_CASE( testCoefficientGenerationOnDemand )
+{
+    boost::shared_ptr< HypersonicLocalInclinationAnalysis > fullCoefficientInterface =
+            getApolloCoefficientInterface( );
+    boost::shared_ptr< HypersonicLocalInclinationAnalysis > onDemandCoefficientInterface =
+            getApolloCoefficientInterface( 1, "", true );
+
+    // Check that no coefficients are generated during construction.
+    BOOST_CHECK_EQUAL( fullCoefficientInterface->getNumberOfGeneratedDataPoints( ), 6 * 7 * 2 );
+    BOOST_CHECK_EQUAL( onDemandCoefficientInterface->getNumberOfGeneratedDataPoints( ), 0 );
+
+    // Interpolate coefficients at a number of points, and check number of generated coefficients.
+    std::vector< std::vector< double > > independentVariables;
+    independentVariables.push_back( boost::assign::list_of( 6.0 )( -12.0 * PI / 180.0 )( 0.5 * PI / 180.0 ) );
+    independentVariables.push_back( boost::assign::list_of( 7.0 )( -14.0 * PI / 180.0 )( 0.2 * PI / 180.0 ) );
+    independentVariables.push_back( boost::assign::list_of( 9.0 )( -14.0 * PI / 180.0 )( 0.2 * PI / 180.0 ) );
+    independentVariables.push_back( boost::assign::list_of( 15.0 )( -22.0 * PI / 180.0 )( 0.7 * PI / 180.0 ) );
+    std::vector< unsigned int > expectedNumberOfGeneratedDataPoints =
+            boost::assign::list_of( 8 )( 8 )( 12 )( 20 );
+
+    for( unsigned int i = 0; i < independentVariables.size( ); i++ )
+    {
+        fullCoefficientInterface->updateCurrentCoefficients( independentVariables.at( i ) );
+        onDemandCoefficientInterface->updateCurrentCoefficients( independentVariables.at( i ) );
+
+        BOOST_CHECK_EQUAL( onDemandCoefficientInterface->getNumberOfGeneratedDataPoints( ),
+                           expectedNumberOfGeneratedDataPoints.at( i ) );
+        for( unsigned int j = 0; j < 6; j++ )
+        {
+            BOOST_CHECK_CLOSE_FRACTION( onDemandCoefficientInterface->getCurrentAerodynamicCoefficients( )( j ),
+                                        fullCoefficientInterface->getCurrentAerodynamicCoefficients( )( j ),
+                                        1.0E-15 );
+        }
+    }
+
+    // Retrieve coefficients at a single data point outside of previously used cells.
+    boost::array< int, 3 > dataPointIndices = { { 0, 0, 1 } };
+    Vector6d onDemandCoefficients = onDemandCoefficientInterface->getAerodynamicCoefficientsDataPoint(
+                dataPointIndices );
+    BOOST_CHECK_EQUAL( onDemandCoefficientInterface->getNumberOfGeneratedDataPoints( ), 21 );
+    for( unsigned int j = 0; j < 6; j++ )
+    {
+        BOOST_CHECK_CLOSE_FRACTION( onDemandCoefficients( j ),
+                                    fullCoefficientInterface->getAerodynamicCoefficientsDataPoint(
+                                        dataPointIndices )( j ), 1.0E-15 );
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
@@ -0,0 +1,187 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <limits>
+
+#include <boost/bind.hpp>
+#include <boost/lambda/lambda.hpp>
+#include <boost/make_shared.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include "Tudat/Astrodynamics/Aerodynamics/customAerodynamicCoefficientInterface.h"
+#include "Tudat/Astrodynamics/Aerodynamics/exponentialAtmosphere.h"
+#include "Tudat/Astrodynamics/Aerodynamics/flightConditions.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/sphericalBodyShapeModel.h"
+#include "Tudat/Basics/testMacros.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+BOOST_AUTO_TEST_SUITE( test_flight_conditions )
+
+using namespace tudat::aerodynamics;
+
+//! Class providing the body-fixed state and aerodynamic angles of the vehicle to the aerodynamic angle calculator.
+class TestVehicleState
+{
+public:
+
+    TestVehicleState( ): bodyFixedState( Eigen::Vector6d::Zero( ) ), angleOfAttack( 0.0 ), angleOfSideslip( 0.0 ){ }
+
+    Eigen::Vector6d getBodyFixedState( ){ return bodyFixedState; }
+
+    double getAngleOfAttack( ){ return angleOfAttack; }
+
+    double getAngleOfSideslip( ){ return angleOfSideslip; }
+
+    Eigen::Vector6d bodyFixedState;
+
+    double angleOfAttack;
+
+    double angleOfSideslip;
+};
+
+//! Aerodynamic coefficients as a function of Mach number, angle of attack, angle of sideslip and altitude.
+Eigen::Vector6d getTestAerodynamicCoefficients( const std::vector< double >& independentVariables )
+{
+    double machNumber = independentVariables.at( 0 );
+    double angleOfAttack = independentVariables.at( 1 );
+    double angleOfSideslip = independentVariables.at( 2 );
+    double altitude = independentVariables.at( 3 );
+
+    Eigen::Vector6d coefficients;
+    coefficients << 0.5 + 0.1 * machNumber + 0.2 * angleOfAttack * angleOfAttack,
+            0.3 * angleOfSideslip,
+            1.2 * std::sin( angleOfAttack ) + 1.0E-6 * altitude,
+            0.01 * angleOfSideslip,
+            -0.05 * angleOfAttack + 0.001 * machNumber,
+            0.02 * angleOfSideslip * machNumber;
+    return coefficients;
+}
+
+//! Test whether flight conditions computed for a list of states are identical to those computed for each state
+//! individually.
+BOOST_AUTO_TEST_CASE( testFlightConditionsForListOfStates )
+{
+    // Create environment and vehicle models
+    boost::shared_ptr< TestVehicleState > vehicleState = boost::make_shared< TestVehicleState >( );
+    boost::shared_ptr< AtmosphereModel > atmosphereModel =
+            boost::make_shared< ExponentialAtmosphere >( 7.2E3, 290.0, 1.225, 287.0, 1.4 );
+    boost::shared_ptr< basic_astrodynamics::BodyShapeModel > shapeModel =
+            boost::make_shared< basic_astrodynamics::SphericalBodyShapeModel >( 6378.0E3 );
+    std::vector< AerodynamicCoefficientsIndependentVariables > independentVariables =
+    { mach_number_dependent, angle_of_attack_dependent, angle_of_sideslip_dependent, altitude_dependent };
+    boost::shared_ptr< AerodynamicCoefficientInterface > coefficientInterface =
+            boost::make_shared< CustomAerodynamicCoefficientInterface >(
+                &getTestAerodynamicCoefficients, 2.0, 4.0, 2.0, Eigen::Vector3d::Zero( ), independentVariables );
+    boost::shared_ptr< reference_frames::AerodynamicAngleCalculator > angleCalculator =
+            boost::make_shared< reference_frames::AerodynamicAngleCalculator >(
+                boost::bind( &TestVehicleState::getBodyFixedState, vehicleState ),
+                boost::lambda::constant( Eigen::Quaterniond( Eigen::Matrix3d::Identity( ) ) ), "Earth", true,
+                boost::bind( &TestVehicleState::getAngleOfAttack, vehicleState ),
+                boost::bind( &TestVehicleState::getAngleOfSideslip, vehicleState ),
+                boost::lambda::constant( 0.0 ) );
+    FlightConditions flightConditions( atmosphereModel, shapeModel, coefficientInterface, angleCalculator );
+
+    // Define list of states
+    const int numberOfStates = 50;
+    FlightConditionsBatchInput statesInput;
+    statesInput.bodyFixedPositions.resize( numberOfStates, 3 );
+    statesInput.airspeedBasedVelocities.resize( numberOfStates, 3 );
+    statesInput.anglesOfAttack.resize( numberOfStates );
+    statesInput.anglesOfSideslip.resize( numberOfStates );
+    for( int i = 0; i < numberOfStates; i++ )
+    {
+        double radius = 6378.0E3 + 20.0E3 + 2.0E3 * i;
+        double latitude = -1.2 + 0.05 * i;
+        double longitude = 3.0 - 0.13 * i;
+        statesInput.bodyFixedPositions.row( i ) <<
+                radius * std::cos( latitude ) * std::cos( longitude ),
+                radius * std::cos( latitude ) * std::sin( longitude ),
+                radius * std::sin( latitude );
+        statesInput.airspeedBasedVelocities.row( i ) << 7.0E3 - 50.0 * i, 200.0 + 10.0 * i, -100.0 + 3.0 * i;
+        statesInput.anglesOfAttack( i ) = 0.6 - 0.02 * i;
+        statesInput.anglesOfSideslip( i ) = 0.01 * ( i - 25 );
+    }
+
+    // Compute flight conditions for all states at once
+    const double currentTime = 1.0E4;
+    FlightConditionsBatchOutput flightConditionsOutput;
+    flightConditions.computeFlightConditionsForStates( currentTime, statesInput, flightConditionsOutput );
+
+    BOOST_CHECK_EQUAL( flightConditionsOutput.densities.rows( ), numberOfStates );
+    BOOST_CHECK_EQUAL( flightConditionsOutput.forceCoefficients.rows( ), numberOfStates );
+
+    // Compare with flight conditions computed for each state separately
+    const double tolerance = 4.0 * std::numeric_limits< double >::epsilon( );
+    for( int i = 0; i < numberOfStates; i++ )
+    {
+        vehicleState->bodyFixedState.segment( 0, 3 ) = statesInput.bodyFixedPositions.row( i ).transpose( );
+        vehicleState->bodyFixedState.segment( 3, 3 ) = statesInput.airspeedBasedVelocities.row( i ).transpose( );
+        vehicleState->angleOfAttack = statesInput.anglesOfAttack( i );
+        vehicleState->angleOfSideslip = statesInput.anglesOfSideslip( i );
+
+        flightConditions.resetCurrentTime( );
+        flightConditions.updateConditions( currentTime );
+
+        BOOST_CHECK_CLOSE_FRACTION( flightConditionsOutput.altitudes( i ), flightConditions.getCurrentAltitude( ),
+                                    tolerance );
+        BOOST_CHECK_CLOSE_FRACTION( flightConditionsOutput.latitudes( i ),
+                                    angleCalculator->getAerodynamicAngle( reference_frames::latitude_angle ), tolerance );
+        BOOST_CHECK_CLOSE_FRACTION( flightConditionsOutput.longitudes( i ),
+                                    angleCalculator->getAerodynamicAngle( reference_frames::longitude_angle ), tolerance );
+        BOOST_CHECK_CLOSE_FRACTION( flightConditionsOutput.densities( i ), flightConditions.getCurrentDensity( ),
+                                    tolerance );
+        BOOST_CHECK_CLOSE_FRACTION( flightConditionsOutput.freestreamTemperatures( i ),
+                                    flightConditions.getCurrentFreestreamTemperature( ), tolerance );
+        BOOST_CHECK_CLOSE_FRACTION( flightConditionsOutput.speedsOfSound( i ), flightConditions.getCurrentSpeedOfSound( ),
+                                    tolerance );
+        BOOST_CHECK_CLOSE_FRACTION( flightConditionsOutput.airspeeds( i ), flightConditions.getCurrentAirspeed( ),
+                                    tolerance );
+        BOOST_CHECK_CLOSE_FRACTION( flightConditionsOutput.machNumbers( i ), flightConditions.getCurrentMachNumber( ),
+                                    tolerance );
+        BOOST_CHECK_CLOSE_FRACTION( flightConditionsOutput.dynamicPressures( i ),
+                                    flightConditions.getCurrentDynamicPressure( ), tolerance );
+
+        Eigen::Vector3d forceCoefficients = flightConditionsOutput.forceCoefficients.row( i ).transpose( );
+        Eigen::Vector3d momentCoefficients = flightConditionsOutput.momentCoefficients.row( i ).transpose( );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( forceCoefficients, coefficientInterface->getCurrentForceCoefficients( ),
+                                           tolerance );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( momentCoefficients, coefficientInterface->getCurrentMomentCoefficients( ),
+                                           tolerance );
+    }
+
+    // Check that current coefficients of the interface are restored after computing flight conditions for list of states
+    Eigen::Vector3d currentForceCoefficients = coefficientInterface->getCurrentForceCoefficients( );
+    flightConditions.computeFlightConditionsForStates( currentTime, statesInput, flightConditionsOutput );
+    BOOST_CHECK_EQUAL( ( currentForceCoefficients - coefficientInterface->getCurrentForceCoefficients( ) ).norm( ), 0.0 );
+
+    // Check computation without aerodynamic coefficients, and without aerodynamic angles
+    statesInput.anglesOfAttack.resize( 0 );
+    flightConditions.computeFlightConditionsForStates( currentTime, statesInput, flightConditionsOutput, false );
+    BOOST_CHECK_EQUAL( flightConditionsOutput.forceCoefficients.rows( ), 0 );
+    BOOST_CHECK_EQUAL( flightConditionsOutput.machNumbers.rows( ), numberOfStates );
+
+    // Check that missing or inconsistent input is rejected
+    BOOST_CHECK_THROW( flightConditions.computeFlightConditionsForStates(
+                           currentTime, statesInput, flightConditionsOutput, true ), std::runtime_error );
+    statesInput.anglesOfAttack.resize( numberOfStates - 1 );
+    BOOST_CHECK_THROW( flightConditions.computeFlightConditionsForStates(
+                           currentTime, statesInput, flightConditionsOutput, false ), std::runtime_error );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
@@ -0,0 +1,191 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+
+#include <boost/test/unit_test.hpp>
+
+#include "Tudat/Astrodynamics/Aerodynamics/multiDimensionalTabulatedAtmosphere.h"
+#include "Tudat/InputOutput/basicInputOutput.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+BOOST_AUTO_TEST_SUITE( test_multi_dimensional_tabulated_atmosphere )
+
+using namespace tudat::aerodynamics;
+using mathematical_constants::PI;
+
+//! Analytical (logarithmic) density used to generate test data, which is reproduced exactly by the interpolation.
+double getTestLogarithmOfDensity( const double altitude, const double latitude, const double longitude )
+{
+    return -altitude / 7.0E3 + 0.1 * latitude + 0.05 * longitude;
+}
+
+//! Analytical (logarithmic) pressure used to generate test data, which is reproduced exactly by the interpolation.
+double getTestLogarithmOfPressure( const double altitude, const double latitude, const double longitude )
+{
+    return 11.5 - altitude / 8.0E3 - 0.2 * latitude + 0.01 * longitude;
+}
+
+//! Analytical temperature used to generate test data, which is reproduced exactly by the interpolation.
+double getTestTemperature( const double altitude, const double latitude, const double longitude )
+{
+    return 200.0 + 1.0E-3 * altitude + 10.0 * latitude - 2.0 * longitude;
+}
+
+//! Function to write file with test data on given grid.
+void writeTestFile( const std::string& fileName, const UniformTabulationGrid& altitudeGrid,
+                    const UniformTabulationGrid& latitudeGrid, const UniformTabulationGrid& longitudeGrid )
+{
+    boost::multi_array< double, 3 > densityData(
+                boost::extents[ altitudeGrid.numberOfPoints ][ latitudeGrid.numberOfPoints ][ longitudeGrid.numberOfPoints ] );
+    boost::multi_array< double, 3 > pressureData( densityData );
+    boost::multi_array< double, 3 > temperatureData( densityData );
+    for( unsigned int i = 0; i < altitudeGrid.numberOfPoints; i++ )
+    {
+        double altitude = altitudeGrid.firstValue + i * altitudeGrid.stepSize;
+        for( unsigned int j = 0; j < latitudeGrid.numberOfPoints; j++ )
+        {
+            double latitude = latitudeGrid.firstValue + j * latitudeGrid.stepSize;
+            for( unsigned int k = 0; k < longitudeGrid.numberOfPoints; k++ )
+            {
+                double longitude = longitudeGrid.firstValue + k * longitudeGrid.stepSize;
+                densityData[ i ][ j ][ k ] = std::exp( getTestLogarithmOfDensity( altitude, latitude, longitude ) );
+                pressureData[ i ][ j ][ k ] = std::exp( getTestLogarithmOfPressure( altitude, latitude, longitude ) );
+                temperatureData[ i ][ j ][ k ] = getTestTemperature( altitude, latitude, longitude );
+            }
+        }
+    }
+    writeMultiDimensionalTabulatedAtmosphereFile(
+                fileName, altitudeGrid, latitudeGrid, longitudeGrid, densityData, pressureData, temperatureData );
+}
+
+//! Test whether the tabulated atmosphere correctly interpolates data that is linear in the independent variables.
+BOOST_AUTO_TEST_CASE( testMultiDimensionalTabulatedAtmosphereInterpolation )
+{
+    const std::string tableFile = input_output::getTudatRootPath( ) +
+            "Astrodynamics/Aerodynamics/UnitTests/multiDimensionalTabulatedAtmosphereTest.dat";
+
+    UniformTabulationGrid altitudeGrid( 100.0E3, 5.0E3, 11 );
+    UniformTabulationGrid latitudeGrid( -PI / 2.0, PI / 18.0, 19 );
+    UniformTabulationGrid longitudeGrid( -PI / 3.0, PI / 6.0, 5 );
+    writeTestFile( tableFile, altitudeGrid, latitudeGrid, longitudeGrid );
+
+    MultiDimensionalTabulatedAtmosphere atmosphereModel( tableFile, 190.0, 1.3 );
+    BOOST_CHECK_EQUAL( atmosphereModel.getIndependentVariableGrids( )[ 1 ].numberOfPoints, 19 );
+    BOOST_CHECK_CLOSE_FRACTION( atmosphereModel.getIndependentVariableGrids( )[ 2 ].getLastValue( ), PI / 3.0,
+                                1.0E-15 );
+
+    // Check interpolated values inside grid
+    const double testAltitudes[ 3 ] = { 100.0E3, 123.4E3, 150.0E3 };
+    const double testLatitudes[ 3 ] = { -1.2, 0.1, PI / 2.0 };
+    const double testLongitudes[ 3 ] = { -PI / 3.0, 0.3, 0.9 };
+    for( unsigned int i = 0; i < 3; i++ )
+    {
+        for( unsigned int j = 0; j < 3; j++ )
+        {
+            for( unsigned int k = 0; k < 3; k++ )
+            {
+                double altitude = testAltitudes[ i ], latitude = testLatitudes[ j ], longitude = testLongitudes[ k ];
+                BOOST_CHECK_CLOSE_FRACTION(
+                            atmosphereModel.getDensity( altitude, longitude, latitude ),
+                            std::exp( getTestLogarithmOfDensity( altitude, latitude, longitude ) ), 1.0E-12 );
+                BOOST_CHECK_CLOSE_FRACTION(
+                            atmosphereModel.getPressure( altitude, longitude, latitude ),
+                            std::exp( getTestLogarithmOfPressure( altitude, latitude, longitude ) ), 1.0E-12 );
+                BOOST_CHECK_CLOSE_FRACTION(
+                            atmosphereModel.getTemperature( altitude, longitude, latitude ),
+                            getTestTemperature( altitude, latitude, longitude ), 1.0E-12 );
+                BOOST_CHECK_CLOSE_FRACTION(
+                            atmosphereModel.getSpeedOfSound( altitude, longitude, latitude ),
+                            std::sqrt( 1.3 * 190.0 * getTestTemperature( altitude, latitude, longitude ) ), 1.0E-12 );
+            }
+        }
+    }
+
+    // Check that independent variables outside of (non-periodic) grid are set to boundary values
+    BOOST_CHECK_EQUAL( atmosphereModel.getDensity( 200.0E3, 2.0, -2.0 ),
+                       atmosphereModel.getDensity( 150.0E3, PI / 3.0, -PI / 2.0 ) );
+    BOOST_CHECK_EQUAL( atmosphereModel.getTemperature( 50.0E3, -1.5, 1.0 ),
+                       atmosphereModel.getTemperature( 100.0E3, -PI / 3.0, 1.0 ) );
+
+    std::remove( tableFile.c_str( ) );
+}
+
+//! Test interpolation of tabulated atmosphere with periodic longitude grid.
+BOOST_AUTO_TEST_CASE( testMultiDimensionalTabulatedAtmospherePeriodicLongitude )
+{
+    const std::string tableFile = input_output::getTudatRootPath( ) +
+            "Astrodynamics/Aerodynamics/UnitTests/multiDimensionalTabulatedAtmosphereTest.dat";
+
+    UniformTabulationGrid altitudeGrid( 0.0, 10.0E3, 3 );
+    UniformTabulationGrid latitudeGrid( -PI / 4.0, PI / 4.0, 3 );
+    UniformTabulationGrid longitudeGrid( 0.0, PI / 2.0, 4 );
+    writeTestFile( tableFile, altitudeGrid, latitudeGrid, longitudeGrid );
+
+    MultiDimensionalTabulatedAtmosphere atmosphereModel( tableFile );
+
+    // Check that longitude is reduced to grid range
+    BOOST_CHECK_CLOSE_FRACTION( atmosphereModel.getDensity( 5.0E3, 0.3 - 2.0 * PI, 0.1 ),
+                                std::exp( getTestLogarithmOfDensity( 5.0E3, 0.1, 0.3 ) ), 1.0E-12 );
+    BOOST_CHECK_CLOSE_FRACTION( atmosphereModel.getTemperature( 5.0E3, 1.0 + 4.0 * PI, 0.1 ),
+                                getTestTemperature( 5.0E3, 0.1, 1.0 ), 1.0E-12 );
+
+    // Check interpolation between last and first longitude
+    double lastLongitude = 3.0 * PI / 2.0;
+    double upperFraction = 0.25;
+    double expectedTemperature =
+            ( 1.0 - upperFraction ) * getTestTemperature( 5.0E3, 0.1, lastLongitude ) +
+            upperFraction * getTestTemperature( 5.0E3, 0.1, 0.0 );
+    BOOST_CHECK_CLOSE_FRACTION( atmosphereModel.getTemperature( 5.0E3, lastLongitude + upperFraction * PI / 2.0, 0.1 ),
+                                expectedTemperature, 1.0E-12 );
+    BOOST_CHECK_CLOSE_FRACTION( atmosphereModel.getTemperature( 5.0E3, -( 1.0 - upperFraction ) * PI / 2.0, 0.1 ),
+                                expectedTemperature, 1.0E-12 );
+
+    std::remove( tableFile.c_str( ) );
+}
+
+//! Test whether invalid input is rejected.
+BOOST_AUTO_TEST_CASE( testMultiDimensionalTabulatedAtmosphereInvalidInput )
+{
+    const std::string tableFile = input_output::getTudatRootPath( ) +
+            "Astrodynamics/Aerodynamics/UnitTests/multiDimensionalTabulatedAtmosphereTest.dat";
+
+    // Check that data inconsistent with grid is rejected
+    boost::multi_array< double, 3 > data( boost::extents[ 2 ][ 2 ][ 3 ] );
+    std::fill( data.data( ), data.data( ) + data.num_elements( ), 1.0 );
+    BOOST_CHECK_THROW( writeMultiDimensionalTabulatedAtmosphereFile(
+                           tableFile, UniformTabulationGrid( ), UniformTabulationGrid( ), UniformTabulationGrid( ),
+                           data, data, data ), std::runtime_error );
+
+    // Check that missing file, or file with invalid contents, is rejected
+    std::remove( tableFile.c_str( ) );
+    BOOST_CHECK_THROW( MultiDimensionalTabulatedAtmosphere atmosphereModel( tableFile ), std::runtime_error );
+    {
+        std::ofstream invalidFile( tableFile.c_str( ) );
+        invalidFile << "This is not an atmosphere table, but it is long enough to contain a header, if it were one." << std::endl;
+    }
+    BOOST_CHECK_THROW( MultiDimensionalTabulatedAtmosphere atmosphereModel( tableFile ), std::runtime_error );
+
+    std::remove( tableFile.c_str( ) );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
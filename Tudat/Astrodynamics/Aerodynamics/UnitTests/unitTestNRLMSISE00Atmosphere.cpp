@@ -22,6 +22,7 @@
 
 #include <boost/assign/list_of.hpp>
 #include <boost/bind.hpp>
+#include <boost/make_shared.hpp>
 #include <boost/test/unit_test.hpp>
 
 #include "Tudat/Astrodynamics/Aerodynamics/nrlmsise00Atmosphere.h"
@@ -174,6 +175,66 @@ BOOST_AUTO_TEST_CASE( testNRLMSISE00AtmosphereTestHashing )
     BOOST_CHECK_EQUAL(density3, density4);
 }
 
+//! Perform test of cache of multiple previous evaluations, and of evaluation at multiple points.
+BOOST_AUTO_TEST_CASE( testNRLMSISE00AtmosphereTestPropertiesCache )
+{
+    // Create the model, storing the three most recent evaluations
+    NRLMSISE00Atmosphere model( boost::bind( &function, _1, _2, _3, _4, false, false ) );
+    model.setPropertiesCacheSize( 3 );
+    BOOST_CHECK_EQUAL( model.getPropertiesCacheSize( ), 3 );
+
+    // Compute densities at three different altitudes
+    data = gen_data;
+    std::vector< double > input = gen_input;
+    std::vector< double > altitudes = boost::assign::list_of( input[ 0 ] )( input[ 0 ] + 1.0E3 )( input[ 0 ] + 2.0E3 );
+    std::vector< double > nominalDensities;
+    for( unsigned int i = 0; i < altitudes.size( ); i++ )
+    {
+        nominalDensities.push_back( model.getDensity( altitudes.at( i ), input[ 1 ], input[ 2 ], input[ 3 ] ) );
+    }
+
+    // Change F10.7, and check that all three (cached) points are not recomputed, in any order.
+    data.f107 = 180.0;
+    for( int i = altitudes.size( ) - 1; i >= 0; i-- )
+    {
+        BOOST_CHECK_EQUAL( model.getDensity( altitudes.at( i ), input[ 1 ], input[ 2 ], input[ 3 ] ),
+                           nominalDensities.at( i ) );
+    }
+
+    // Evaluate model at new point, which removes least recently computed (first) point from cache
+    model.getDensity( input[ 0 ] + 3.0E3, input[ 1 ], input[ 2 ], input[ 3 ] );
+    BOOST_CHECK_PREDICATE( std::not_equal_to< double >( ),
+                           ( model.getDensity( altitudes.at( 0 ), input[ 1 ], input[ 2 ], input[ 3 ] ) )
+                           ( nominalDensities.at( 0 ) ) );
+
+    // Check that evaluation at multiple points is consistent with evaluation at single points
+    model.resetHashKey( );
+    std::vector< double > longitudes( altitudes.size( ), input[ 1 ] );
+    std::vector< double > latitudes( altitudes.size( ), input[ 2 ] );
+    std::vector< double > times( altitudes.size( ), input[ 3 ] );
+    std::vector< double > densities = model.getDensitiesAtPoints( altitudes, longitudes, latitudes, times );
+    std::vector< tudat::aerodynamics::NRLMSISE00Properties > properties =
+            model.getPropertiesAtPoints( altitudes, longitudes, latitudes, times );
+    BOOST_CHECK_EQUAL( densities.size( ), altitudes.size( ) );
+    BOOST_CHECK_EQUAL( properties.size( ), altitudes.size( ) );
+    for( unsigned int i = 0; i < altitudes.size( ); i++ )
+    {
+        model.resetHashKey( );
+        BOOST_CHECK_EQUAL( densities.at( i ),
+                           model.getDensity( altitudes.at( i ), input[ 1 ], input[ 2 ], input[ 3 ] ) );
+        BOOST_CHECK_EQUAL( properties.at( i ).density, densities.at( i ) );
+        BOOST_CHECK_EQUAL( properties.at( i ).temperature,
+                           model.getTemperature( altitudes.at( i ), input[ 1 ], input[ 2 ], input[ 3 ] ) );
+        BOOST_CHECK_EQUAL( properties.at( i ).speedOfSound,
+                           model.getSpeedOfSound( altitudes.at( i ), input[ 1 ], input[ 2 ], input[ 3 ] ) );
+    }
+
+    // Check that inconsistent input is rejected
+    times.pop_back( );
+    BOOST_CHECK_THROW( model.getDensitiesAtPoints( altitudes, longitudes, latitudes, times ), std::runtime_error );
+    BOOST_CHECK_THROW( model.setPropertiesCacheSize( 0 ), std::runtime_error );
+}
+
 //! Perform NRLMSISE-00 test 1
 //  Check values for 11 output parameters on against (hardcoded) values
 //  obtained from the similar nrlmsise-test.c program.
@@ -1122,6 +1183,95 @@ BOOST_AUTO_TEST_CASE( test_nrlmise_InputFunction_with_adjustment )
     BOOST_CHECK_CLOSE_FRACTION(verificationData[5]*1000 , computedDensity , 1E-11);
 }
 
+//! Test NRLMSISE-00 input calculator, using solar activity table, against input function using solar activity map.
+BOOST_AUTO_TEST_CASE( test_nrlmise_InputCalculator )
+{
+    using namespace tudat::aerodynamics;
+    using namespace tudat::input_output::solar_activity;
+
+    // find space weather files
+    std::string cppPath( __FILE__ );
+    std::string folder = cppPath.substr( 0, cppPath.find_last_of("/\\")+1);
+    std::vector< std::string > spaceWeatherFiles = { "swAtmosTestNoAdjust.txt", "swAtmosTestWithAdjust.txt" };
+
+    double altitude     = 400.0E3 ;
+    double longitude    = -70.0 * PI / 180.0  ;
+    double latitude     = 60.0 * PI / 180.0  ;
+
+    // Define test times: several times on a number of subsequent days, and on the test day of the above tests.
+    std::vector< double > testTimes;
+    double initialTime = tudat::basic_astrodynamics::convertJulianDayToSecondsSinceEpoch(
+                tudat::basic_astrodynamics::convertCalendarDateToJulianDay< double >( 1957, 10, 2, 0, 0, 0.0 ),
+                tudat::basic_astrodynamics::JULIAN_DAY_ON_J2000 );
+    for( unsigned int i = 0; i < 40; i++ )
+    {
+        testTimes.push_back( initialTime + static_cast< double >( i ) * 7.3 * 3600.0 );
+    }
+    testTimes.push_back( tudat::basic_astrodynamics::convertJulianDayToSecondsSinceEpoch(
+                             tudat::basic_astrodynamics::convertCalendarDateToJulianDay< double >(
+                                 2030, 6, 21, 8, 3, 20.0 ), tudat::basic_astrodynamics::JULIAN_DAY_ON_J2000 ) );
+
+    for( unsigned int i = 0; i < spaceWeatherFiles.size( ); i++ )
+    {
+        std::string spaceWeatherFilePath = folder + spaceWeatherFiles.at( i );
+        SolarActivityDataMap solarActivityData = readSolarActivityData( spaceWeatherFilePath );
+        boost::shared_ptr< SolarActivityTable > solarActivityTable =
+                boost::make_shared< SolarActivityTable >( readSolarActivityTable( spaceWeatherFilePath ) );
+
+        NRLMSISE00InputCalculator inputCalculator( solarActivityTable );
+
+        // Create atmosphere models using input function, and using input calculator (updating input in place)
+        boost::function< NRLMSISE00Input (double,double,double,double) > inputFunction =
+                boost::bind(&nrlmsiseInputFunction,_1,_2,_3,_4, solarActivityData , false , TUDAT_NAN );
+        NRLMSISE00Atmosphere atmosphereModel( inputFunction );
+        NRLMSISE00Atmosphere tableAtmosphereModel(
+                    NRLMSISE00Atmosphere::NRLMSISE00InputFunction( ), true,
+                    boost::bind( &NRLMSISE00InputCalculator::updateInput,
+                                 boost::make_shared< NRLMSISE00InputCalculator >( solarActivityTable ),
+                                 _1, _2, _3, _4, _5 ) );
+
+        // Check that input and density are identical
+        NRLMSISE00Input calculatedInput;
+        for( unsigned int j = 0; j < testTimes.size( ); j++ )
+        {
+            NRLMSISE00Input expectedInput = inputFunction( altitude, longitude, latitude, testTimes.at( j ) );
+            inputCalculator.updateInput( calculatedInput, altitude, longitude, latitude, testTimes.at( j ) );
+
+            BOOST_CHECK_EQUAL( calculatedInput.year, expectedInput.year );
+            BOOST_CHECK_EQUAL( calculatedInput.dayOfTheYear, expectedInput.dayOfTheYear );
+            BOOST_CHECK_EQUAL( calculatedInput.secondOfTheDay, expectedInput.secondOfTheDay );
+            BOOST_CHECK_EQUAL( calculatedInput.localSolarTime, expectedInput.localSolarTime );
+            BOOST_CHECK_EQUAL( calculatedInput.f107, expectedInput.f107 );
+            BOOST_CHECK_EQUAL( calculatedInput.f107a, expectedInput.f107a );
+            BOOST_CHECK_EQUAL( calculatedInput.apDaily, expectedInput.apDaily );
+            BOOST_CHECK( calculatedInput.apVector == expectedInput.apVector );
+
+            BOOST_CHECK_EQUAL( tableAtmosphereModel.getDensity( altitude, longitude, latitude, testTimes.at( j ) ),
+                               atmosphereModel.getDensity( altitude, longitude, latitude, testTimes.at( j ) ) );
+        }
+
+        // Create model from input calculator, and independent copy of it; evaluate copy in reverse order of test times.
+        NRLMSISE00Atmosphere calculatorAtmosphereModel( boost::make_shared< NRLMSISE00InputCalculator >( solarActivityTable ) );
+        boost::shared_ptr< NRLMSISE00Atmosphere > copiedAtmosphereModel =
+                boost::dynamic_pointer_cast< NRLMSISE00Atmosphere >( calculatorAtmosphereModel.createIndependentCopy( ) );
+        BOOST_CHECK( copiedAtmosphereModel != NULL );
+        BOOST_CHECK( copiedAtmosphereModel->getInputCalculator( ) != calculatorAtmosphereModel.getInputCalculator( ) );
+        BOOST_CHECK( copiedAtmosphereModel->getInputCalculator( )->getSolarActivityTable( ) == solarActivityTable );
+        for( unsigned int j = 0; j < testTimes.size( ); j++ )
+        {
+            const double forwardTime = testTimes.at( j );
+            const double backwardTime = testTimes.at( testTimes.size( ) - 1 - j );
+            BOOST_CHECK_EQUAL( calculatorAtmosphereModel.getDensity( altitude, longitude, latitude, forwardTime ),
+                               atmosphereModel.getDensity( altitude, longitude, latitude, forwardTime ) );
+            BOOST_CHECK_EQUAL( copiedAtmosphereModel->getDensity( altitude, longitude, latitude, backwardTime ),
+                               atmosphereModel.getDensity( altitude, longitude, latitude, backwardTime ) );
+        }
+
+        // Check that missing data is detected
+        BOOST_CHECK_THROW( inputCalculator.getInput( altitude, longitude, latitude, 0.0 ), std::runtime_error );
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
@@ -0,0 +1,181 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <cmath>
+#include <vector>
+
+#include <boost/assign/list_of.hpp>
+#include <boost/bind.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/make_shared.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include "Tudat/Astrodynamics/Aerodynamics/tabulatedNRLMSISE00Atmosphere.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+BOOST_AUTO_TEST_SUITE( test_tabulated_nrlmsise00_atmosphere )
+
+using namespace tudat::aerodynamics;
+using mathematical_constants::PI;
+
+//! Function to create the grid on which the NRLMSISE00 model is tabulated in the tests.
+std::vector< std::vector< double > > getTestGrid( )
+{
+    std::vector< std::vector< double > > grid;
+    grid.push_back( boost::assign::list_of( 200.0E3 )( 250.0E3 )( 300.0E3 ) );
+    grid.push_back( boost::assign::list_of( -30.0 * PI / 180.0 )( 0.0 )( 30.0 * PI / 180.0 ) );
+    grid.push_back( boost::assign::list_of( 6.0 )( 12.0 )( 18.0 ) );
+    grid.push_back( boost::assign::list_of( 100.0 )( 150.0 )( 200.0 ) );
+    grid.push_back( boost::assign::list_of( 4.0 )( 15.0 )( 50.0 ) );
+    return grid;
+}
+
+//! Function to set the input of the NRLMSISE00 model consistently with the tabulation grid.
+void setTestInput( const boost::shared_ptr< NRLMSISE00Input > input, const int dayOfTheYear,
+                   const double localSolarTime, const double solarFlux, const double geomagneticIndex )
+{
+    input->dayOfTheYear = dayOfTheYear;
+    input->secondOfTheDay = localSolarTime * 3600.0;
+    input->localSolarTime = localSolarTime;
+    input->f107 = solarFlux;
+    input->f107a = solarFlux;
+    input->apDaily = geomagneticIndex;
+    input->apVector = std::vector< double >( 7, geomagneticIndex );
+}
+
+//! Test whether the tabulated model reproduces the NRLMSISE00 model at the nodes of the grid, and is
+//! consistent with it between nodes.
+BOOST_AUTO_TEST_CASE( testTabulatedNRLMSISE00AtmosphereNodes )
+{
+    const int dayOfTheYear = 172;
+    std::vector< std::vector< double > > grid = getTestGrid( );
+
+    // Create full and tabulated models, using the same (modifiable) input.
+    boost::shared_ptr< NRLMSISE00Input > input = boost::make_shared< NRLMSISE00Input >( );
+    NRLMSISE00Atmosphere::NRLMSISE00InputFunction inputFunction =
+            boost::bind( &getFixedNRLMSISE00Input, _1, _2, _3, _4, input );
+    NRLMSISE00Atmosphere nrlmsise00Model( inputFunction );
+    TabulatedNRLMSISE00Atmosphere tabulatedModel( inputFunction, grid, dayOfTheYear );
+
+    // Compare models at (a subset of) the grid nodes
+    double time = 0.0;
+    for( unsigned int i = 0; i < grid.at( 0 ).size( ); i++ )
+    {
+        for( unsigned int j = 0; j < grid.at( 1 ).size( ); j++ )
+        {
+            for( unsigned int k = 0; k < grid.at( 2 ).size( ); k++ )
+            {
+                setTestInput( input, dayOfTheYear, grid[ 2 ][ k ], grid[ 3 ][ i % 3 ], grid[ 4 ][ j % 3 ] );
+
+                // Modify time to force recomputation of properties
+                time += 1.0;
+                nrlmsise00Model.resetHashKey( );
+                BOOST_CHECK_CLOSE_FRACTION( tabulatedModel.getDensity( grid[ 0 ][ i ], 0.0, grid[ 1 ][ j ], time ),
+                                            nrlmsise00Model.getDensity( grid[ 0 ][ i ], 0.0, grid[ 1 ][ j ], time ),
+                                            1.0E-12 );
+                BOOST_CHECK_CLOSE_FRACTION( tabulatedModel.getTemperature( grid[ 0 ][ i ], 0.0, grid[ 1 ][ j ], time ),
+                                            nrlmsise00Model.getTemperature( grid[ 0 ][ i ], 0.0, grid[ 1 ][ j ], time ),
+                                            1.0E-12 );
+                BOOST_CHECK_CLOSE_FRACTION( tabulatedModel.getPressure( grid[ 0 ][ i ], 0.0, grid[ 1 ][ j ], time ),
+                                            nrlmsise00Model.getPressure( grid[ 0 ][ i ], 0.0, grid[ 1 ][ j ], time ),
+                                            1.0E-12 );
+                BOOST_CHECK_CLOSE_FRACTION( tabulatedModel.getSpeedOfSound( grid[ 0 ][ i ], 0.0, grid[ 1 ][ j ], time ),
+                                            nrlmsise00Model.getSpeedOfSound( grid[ 0 ][ i ], 0.0, grid[ 1 ][ j ], time ),
+                                            1.0E-12 );
+            }
+        }
+    }
+
+    // Check that independent variables outside of grid are set to boundary values.
+    time += 1.0;
+    setTestInput( input, dayOfTheYear, 23.0, 250.0, 1.0 );
+    double densityOutsideGrid = tabulatedModel.getDensity( 400.0E3, 0.0, PI / 2.0, time );
+    time += 1.0;
+    setTestInput( input, dayOfTheYear, 18.0, 200.0, 4.0 );
+    BOOST_CHECK_EQUAL( densityOutsideGrid, tabulatedModel.getDensity( 300.0E3, 0.0, 30.0 * PI / 180.0, time ) );
+
+    // Check maximum error for grid with single cell, which is evaluated at the cell centre only.
+    std::vector< std::vector< double > > singleCellGrid = grid;
+    for( unsigned int i = 0; i < singleCellGrid.size( ); i++ )
+    {
+        singleCellGrid[ i ].pop_back( );
+    }
+    TabulatedNRLMSISE00Atmosphere singleCellTabulatedModel( inputFunction, singleCellGrid, dayOfTheYear );
+
+    time += 1.0;
+    setTestInput( input, dayOfTheYear, 9.0, 125.0, 9.5 );
+    nrlmsise00Model.resetHashKey( );
+    double expectedMaximumError = std::fabs(
+                singleCellTabulatedModel.getDensity( 225.0E3, 0.0, -15.0 * PI / 180.0, time ) /
+                nrlmsise00Model.getDensity( 225.0E3, 0.0, -15.0 * PI / 180.0, time ) - 1.0 );
+    BOOST_CHECK_CLOSE_FRACTION( singleCellTabulatedModel.computeMaximumRelativeDensityError( ),
+                                expectedMaximumError, 1.0E-12 );
+    BOOST_CHECK( singleCellTabulatedModel.computeMaximumRelativeDensityError( ) > 0.0 );
+}
+
+//! Test whether tables are correctly stored to, and retrieved from, a binary file.
+BOOST_AUTO_TEST_CASE( testTabulatedNRLMSISE00AtmosphereCacheFile )
+{
+    const int dayOfTheYear = 80;
+    const std::string cacheFile = ( boost::filesystem::temp_directory_path( ) / boost::filesystem::unique_path(
+                                        "tabulatedNRLMSISE00TestCache-%%%%-%%%%-%%%%.dat" ) ).string( );
+
+    boost::shared_ptr< NRLMSISE00Input > input = boost::make_shared< NRLMSISE00Input >( );
+    setTestInput( input, dayOfTheYear, 10.0, 130.0, 12.0 );
+    NRLMSISE00Atmosphere::NRLMSISE00InputFunction inputFunction =
+            boost::bind( &getFixedNRLMSISE00Input, _1, _2, _3, _4, input );
+
+    // Create tables, and write them to file; then create model from file.
+    TabulatedNRLMSISE00Atmosphere generatedModel( inputFunction, getTestGrid( ), dayOfTheYear, cacheFile );
+    TabulatedNRLMSISE00Atmosphere modelFromFile( inputFunction, getTestGrid( ), dayOfTheYear, cacheFile );
+
+    // Check that models are identical
+    BOOST_CHECK_EQUAL( generatedModel.getDensity( 234.0E3, 0.0, 0.1, 0.0 ),
+                       modelFromFile.getDensity( 234.0E3, 0.0, 0.1, 0.0 ) );
+    BOOST_CHECK_EQUAL( generatedModel.getTemperature( 234.0E3, 0.0, 0.1, 0.0 ),
+                       modelFromFile.getTemperature( 234.0E3, 0.0, 0.1, 0.0 ) );
+    BOOST_CHECK_EQUAL( generatedModel.getPressure( 234.0E3, 0.0, 0.1, 0.0 ),
+                       modelFromFile.getPressure( 234.0E3, 0.0, 0.1, 0.0 ) );
+
+    // Check that tables are regenerated (and file is overwritten) for incompatible day of the year, or grid.
+    std::vector< std::vector< double > > modifiedGrid = getTestGrid( );
+    modifiedGrid[ 0 ][ 1 ] += 1.0;
+    for( unsigned int i = 0; i < 2; i++ )
+    {
+        const int currentDayOfTheYear = ( i == 0 ) ? ( dayOfTheYear + 1 ) : dayOfTheYear;
+        const std::vector< std::vector< double > > currentGrid = ( i == 0 ) ? getTestGrid( ) : modifiedGrid;
+
+        TabulatedNRLMSISE00Atmosphere regeneratedModel( inputFunction, currentGrid, currentDayOfTheYear, cacheFile );
+        TabulatedNRLMSISE00Atmosphere modelWithoutFile( inputFunction, currentGrid, currentDayOfTheYear );
+        TabulatedNRLMSISE00Atmosphere regeneratedModelFromFile(
+                    inputFunction, currentGrid, currentDayOfTheYear, cacheFile );
+
+        BOOST_CHECK( regeneratedModel.getDensity( 234.0E3, 0.0, 0.1, 0.0 ) !=
+                     generatedModel.getDensity( 234.0E3, 0.0, 0.1, 0.0 ) );
+        BOOST_CHECK_EQUAL( regeneratedModel.getDensity( 234.0E3, 0.0, 0.1, 0.0 ),
+                           modelWithoutFile.getDensity( 234.0E3, 0.0, 0.1, 0.0 ) );
+        BOOST_CHECK_EQUAL( regeneratedModelFromFile.getDensity( 234.0E3, 0.0, 0.1, 0.0 ),
+                           modelWithoutFile.getDensity( 234.0E3, 0.0, 0.1, 0.0 ) );
+    }
+
+    boost::filesystem::remove( cacheFile );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
@@ -16,8 +16,9 @@
 #ifndef TUDAT_AERODYNAMIC_COEFFICIENT_INTERFACE_H
 #define TUDAT_AERODYNAMIC_COEFFICIENT_INTERFACE_H
 
-#include <vector>
 #include <map>
+#include <stdexcept>
+#include <vector>
 
 #include <boost/shared_ptr.hpp>
 #include <Eigen/Core>
@@ -374,9 +375,38 @@ public:
         }
     }
 
+    //! Function to create a copy of the coefficient interface that can be evaluated independently of this object.
+    /*!
+     * Function to create a copy of the coefficient interface that can be evaluated independently of this object (e.g. on
+     * a different thread), sharing all data that is not modified when evaluating the coefficients, but with its own
+     * current coefficients and control surface increment interfaces. By default, this function throws an error; it is
+     * overridden by derived classes for which such a copy is supported.
+     * \return Copy of the coefficient interface that can be evaluated independently of this object.
+     */
+    virtual boost::shared_ptr< AerodynamicCoefficientInterface > createIndependentCopy( )
+    {
+        throw std::runtime_error(
+                    "Error, creating an independent copy of this aerodynamic coefficient interface type is not supported." );
+    }
 
 protected:
 
+    //! Function to replace the control surface increment interfaces by independent copies.
+    /*!
+     * Function to replace the control surface increment interfaces by independent copies, to be called on a copy of
+     * this object created by createIndependentCopy (after which the control surfaces are no longer shared with the
+     * original object).
+     */
+    void createIndependentControlSurfaceIncrements( )
+    {
+        for( std::map< std::string, boost::shared_ptr< ControlSurfaceIncrementAerodynamicInterface > >::iterator
+             controlSurfaceIterator = controlSurfaceIncrementInterfaces_.begin( );
+             controlSurfaceIterator != controlSurfaceIncrementInterfaces_.end( ); controlSurfaceIterator++ )
+        {
+            controlSurfaceIterator->second = controlSurfaceIterator->second->createIndependentCopy( );
+        }
+    }
+
     //! The current force coefficients.
     /*!
      * The force coefficients at the current flight condition.
@@ -12,6 +12,8 @@
 #ifndef TUDAT_ATMOSPHERE_MODEL_H
 #define TUDAT_ATMOSPHERE_MODEL_H
 
+#include <stdexcept>
+
 #include <boost/shared_ptr.hpp>
 
 #include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
@@ -106,6 +108,18 @@ public:
         windModel_ = windModel;
     }
 
+    //! Function to create a copy of the atmosphere model that can be evaluated independently of this object.
+    /*!
+     * Function to create a copy of the atmosphere model that can be evaluated independently of this object (e.g. on a
+     * different thread), sharing all data that is not modified when evaluating the model, as well as the wind model. By
+     * default, this function throws an error; it is overridden by derived classes for which such a copy is supported.
+     * \return Copy of the atmosphere model that can be evaluated independently of this object.
+     */
+    virtual boost::shared_ptr< AtmosphereModel > createIndependentCopy( )
+    {
+        throw std::runtime_error( "Error, creating an independent copy of this atmosphere model type is not supported." );
+    }
+
 protected:
 
     //! Model describing the wind velocity vector of the atmosphere
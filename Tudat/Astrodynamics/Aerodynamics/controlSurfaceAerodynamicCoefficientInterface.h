@@ -11,10 +11,13 @@
 #ifndef TUDAT_CONTROLSURFACEAERODYNAMICCOEFFICIENTINTERFACE_H
 #define TUDAT_CONTROLSURFACEAERODYNAMICCOEFFICIENTINTERFACE_H
 
+#include <stdexcept>
 #include <vector>
 
 #include <boost/function.hpp>
 #include <boost/bind.hpp>
+#include <boost/make_shared.hpp>
+#include <boost/shared_ptr.hpp>
 
 #include <Eigen/Core>
 
@@ -165,6 +168,20 @@ public:
     {
         return numberOfIndependentVariables_;
     }
+
+    //! Function to create a copy of the control surface interface that can be evaluated independently of this object.
+    /*!
+     *  Function to create a copy of the control surface interface that can be evaluated independently of this object
+     *  (e.g. on a different thread), with its own current coefficient increments. By default, this function throws an
+     *  error; it is overridden by derived classes for which such a copy is supported.
+     *  eturn Copy of the control surface interface that can be evaluated independently of this object.
+     */
+    virtual boost::shared_ptr< ControlSurfaceIncrementAerodynamicInterface > createIndependentCopy( )
+    {
+        throw std::runtime_error(
+                    "Error, creating an independent copy of this control surface aerodynamic interface type is not supported." );
+    }
+
 protected:
 
 
@@ -257,6 +274,19 @@ public:
         currentMomentCoefficients_ = currentCoefficients.segment( 3, 3 );
     }
 
+    //! Function to create a copy of the control surface interface that can be evaluated independently of this object.
+    /*!
+     *  Function to create a copy of the control surface interface that can be evaluated independently of this object,
+     *  with its own current coefficient increments. The coefficient function is shared with the copy, and must therefore
+     *  be safe to evaluate concurrently when the copies are used on different threads (as is the case for the tabulated
+     *  increments created by createTabulatedControlSurfaceIncrementAerodynamicCoefficientInterface).
+     *  eturn Copy of the control surface interface that can be evaluated independently of this object.
+     */
+    boost::shared_ptr< ControlSurfaceIncrementAerodynamicInterface > createIndependentCopy( )
+    {
+        return boost::make_shared< CustomControlSurfaceIncrementAerodynamicInterface >( *this );
+    }
+
 protected:
 
     //! Function returning the concatenated aerodynamic force and moment coefficient increments as function of the set of
@@ -171,6 +171,23 @@ public:
         coefficientFunction_ = boost::lambda::constant( constantCoefficients );
     }
 
+    //! Function to create a copy of the coefficient interface that can be evaluated independently of this object.
+    /*!
+     *  Function to create a copy of the coefficient interface that can be evaluated independently of this object, with
+     *  its own current coefficients and copies of the control surface increment interfaces. The coefficient function is
+     *  shared with the copy, and must therefore be safe to evaluate concurrently when the copies are used on different
+     *  threads. This is the case for constant coefficients and for the tabulated coefficients created by
+     *  createAerodynamicCoefficientInterface.
+     *  \return Copy of the coefficient interface that can be evaluated independently of this object.
+     */
+    boost::shared_ptr< AerodynamicCoefficientInterface > createIndependentCopy( )
+    {
+        boost::shared_ptr< CustomAerodynamicCoefficientInterface > copiedInterface =
+                boost::make_shared< CustomAerodynamicCoefficientInterface >( *this );
+        copiedInterface->createIndependentControlSurfaceIncrements( );
+        return copiedInterface;
+    }
+
 private:
 
     //! Function returning the concatenated aerodynamic force and moment coefficients as function of
@@ -17,6 +17,7 @@
 #ifndef TUDAT_EXPONENTIAL_ATMOSPHERE_H
 #define TUDAT_EXPONENTIAL_ATMOSPHERE_H
 
+#include <boost/make_shared.hpp>
 #include <boost/shared_ptr.hpp>
 
 #include <cmath>
@@ -209,6 +210,16 @@ public:
                     specificGasConstant_ );
     }
 
+    //! Function to create a copy of the atmosphere model that can be evaluated independently of this object.
+    /*!
+     * Function to create a copy of the atmosphere model that can be evaluated independently of this object.
+     * \return Copy of the atmosphere model, with the same properties.
+     */
+    boost::shared_ptr< AtmosphereModel > createIndependentCopy( )
+    {
+        return boost::make_shared< ExponentialAtmosphere >( *this );
+    }
+
 protected:
 
 private:
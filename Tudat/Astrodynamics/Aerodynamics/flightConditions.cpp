@@ -16,6 +16,7 @@
 #include "Tudat/Astrodynamics/Aerodynamics/flightConditions.h"
 #include "Tudat/Astrodynamics/Aerodynamics/standardAtmosphere.h"
 #include "Tudat/Astrodynamics/BasicAstrodynamics/oblateSpheroidBodyShapeModel.h"
+#include "Tudat/Mathematics/BasicMathematics/coordinateConversions.h"
 #include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
 
 namespace tudat
@@ -121,6 +122,123 @@ void FlightConditions::updateConditions( const double currentTime )
     }
 }
 
+//! Function to compute the flight conditions for a list of vehicle states at a single time.
+void FlightConditions::computeFlightConditionsForStates(
+        const double currentTime,
+        const FlightConditionsBatchInput& statesInput,
+        FlightConditionsBatchOutput& flightConditionsOutput,
+        const bool computeAerodynamicCoefficients )
+{
+    const int numberOfStates = statesInput.bodyFixedPositions.rows( );
+    if( statesInput.airspeedBasedVelocities.rows( ) != numberOfStates )
+    {
+        throw std::runtime_error( "Error when computing flight conditions for list of states, number of positions and "
+                                  "velocities is inconsistent" );
+    }
+
+    if( ( statesInput.anglesOfAttack.rows( ) != 0 && statesInput.anglesOfAttack.rows( ) != numberOfStates ) ||
+            ( statesInput.anglesOfSideslip.rows( ) != 0 && statesInput.anglesOfSideslip.rows( ) != numberOfStates ) )
+    {
+        throw std::runtime_error( "Error when computing flight conditions for list of states, number of aerodynamic "
+                                  "angles is inconsistent" );
+    }
+
+    // Compute position-dependent quantities and atmospheric properties.
+    flightConditionsOutput.altitudes.resize( numberOfStates );
+    flightConditionsOutput.latitudes.resize( numberOfStates );
+    flightConditionsOutput.longitudes.resize( numberOfStates );
+    flightConditionsOutput.densities.resize( numberOfStates );
+    flightConditionsOutput.freestreamTemperatures.resize( numberOfStates );
+    flightConditionsOutput.speedsOfSound.resize( numberOfStates );
+
+    Eigen::Vector3d currentPosition;
+    Eigen::Vector3d sphericalCoordinates;
+    double atmosphereLatitude = 0.0, atmosphereLongitude = 0.0;
+    for( int i = 0; i < numberOfStates; i++ )
+    {
+        currentPosition = statesInput.bodyFixedPositions.row( i ).transpose( );
+
+        flightConditionsOutput.altitudes( i ) = shapeModel_->getAltitude( currentPosition );
+        sphericalCoordinates = coordinate_conversions::convertCartesianToSpherical< double >( currentPosition );
+        flightConditionsOutput.latitudes( i ) = mathematical_constants::PI / 2.0 - sphericalCoordinates( 1 );
+        flightConditionsOutput.longitudes( i ) = sphericalCoordinates( 2 );
+
+        if( updateLatitudeAndLongitudeForAtmosphere_ )
+        {
+            atmosphereLatitude = flightConditionsOutput.latitudes( i );
+            atmosphereLongitude = flightConditionsOutput.longitudes( i );
+        }
+
+        flightConditionsOutput.densities( i ) = atmosphereModel_->getDensity(
+                    flightConditionsOutput.altitudes( i ), atmosphereLongitude, atmosphereLatitude, currentTime );
+        flightConditionsOutput.freestreamTemperatures( i ) = atmosphereModel_->getTemperature(
+                    flightConditionsOutput.altitudes( i ), atmosphereLongitude, atmosphereLatitude, currentTime );
+        flightConditionsOutput.speedsOfSound( i ) = atmosphereModel_->getSpeedOfSound(
+                    flightConditionsOutput.altitudes( i ), atmosphereLongitude, atmosphereLatitude, currentTime );
+    }
+
+    // Compute velocity-dependent quantities for all states at once.
+    flightConditionsOutput.airspeeds = statesInput.airspeedBasedVelocities.rowwise( ).norm( );
+    flightConditionsOutput.machNumbers =
+            flightConditionsOutput.airspeeds.cwiseQuotient( flightConditionsOutput.speedsOfSound );
+    flightConditionsOutput.dynamicPressures =
+            ( 0.5 * flightConditionsOutput.densities.array( ) * flightConditionsOutput.airspeeds.array( ) *
+              flightConditionsOutput.airspeeds.array( ) ).matrix( );
+
+    if( !computeAerodynamicCoefficients )
+    {
+        flightConditionsOutput.forceCoefficients.resize( 0, 3 );
+        flightConditionsOutput.momentCoefficients.resize( 0, 3 );
+        return;
+    }
+
+    // Compute aerodynamic coefficients for each state.
+    flightConditionsOutput.forceCoefficients.resize( numberOfStates, 3 );
+    flightConditionsOutput.momentCoefficients.resize( numberOfStates, 3 );
+
+    std::vector< double > independentVariables( aerodynamicCoefficientInterface_->getNumberOfIndependentVariables( ) );
+    std::map< std::string, std::vector< double > > controlSurfaceIndependentVariables;
+    for( int i = 0; i < numberOfStates; i++ )
+    {
+        for( unsigned int j = 0; j < independentVariables.size( ); j++ )
+        {
+            independentVariables[ j ] = getAerodynamicCoefficientIndependentVariableForState(
+                        aerodynamicCoefficientInterface_->getIndependentVariableName( j ),
+                        statesInput, flightConditionsOutput, i );
+        }
+
+        for( unsigned int j = 0; j < aerodynamicCoefficientInterface_->getNumberOfControlSurfaces( ); j++ )
+        {
+            std::string currentControlSurface = aerodynamicCoefficientInterface_->getControlSurfaceName( j );
+            std::vector< double >& currentControlSurfaceVariables =
+                    controlSurfaceIndependentVariables[ currentControlSurface ];
+            currentControlSurfaceVariables.resize(
+                        aerodynamicCoefficientInterface_->getNumberOfControlSurfaceIndependentVariables( currentControlSurface ) );
+            for( unsigned int k = 0; k < currentControlSurfaceVariables.size( ); k++ )
+            {
+                currentControlSurfaceVariables[ k ] = getAerodynamicCoefficientIndependentVariableForState(
+                            aerodynamicCoefficientInterface_->getControlSurfaceIndependentVariableName(
+                                currentControlSurface, k ), statesInput, flightConditionsOutput, i, currentControlSurface );
+            }
+        }
+
+        aerodynamicCoefficientInterface_->updateFullCurrentCoefficients(
+                    independentVariables, controlSurfaceIndependentVariables );
+        flightConditionsOutput.forceCoefficients.row( i ) =
+                aerodynamicCoefficientInterface_->getCurrentForceCoefficients( ).transpose( );
+        flightConditionsOutput.momentCoefficients.row( i ) =
+                aerodynamicCoefficientInterface_->getCurrentMomentCoefficients( ).transpose( );
+    }
+
+    // Restore coefficients at current flight conditions.
+    if( aerodynamicCoefficientIndependentVariables_.size( ) ==
+            aerodynamicCoefficientInterface_->getNumberOfIndependentVariables( ) )
+    {
+        aerodynamicCoefficientInterface_->updateFullCurrentCoefficients(
+                    aerodynamicCoefficientIndependentVariables_, controlSurfaceAerodynamicCoefficientIndependentVariables_ );
+    }
+}
+
 //! Function to (compute and) retrieve the value of an independent variable of aerodynamic coefficients
 double FlightConditions::getAerodynamicCoefficientIndependentVariable(
         const AerodynamicCoefficientsIndependentVariables independentVariableType,
@@ -187,6 +305,46 @@ double FlightConditions::getAerodynamicCoefficientIndependentVariable(
     return currentIndependentVariable;
 }
 
+//! Function to retrieve the value of an independent variable of aerodynamic coefficients for a single state of a list
+double FlightConditions::getAerodynamicCoefficientIndependentVariableForState(
+        const AerodynamicCoefficientsIndependentVariables independentVariableType,
+        const FlightConditionsBatchInput& statesInput,
+        const FlightConditionsBatchOutput& flightConditionsOutput,
+        const int stateIndex,
+        const std::string& secondaryIdentifier )
+{
+    double currentIndependentVariable;
+    switch( independentVariableType )
+    {
+    case mach_number_dependent:
+        currentIndependentVariable = flightConditionsOutput.machNumbers( stateIndex );
+        break;
+    case angle_of_attack_dependent:
+        if( statesInput.anglesOfAttack.rows( ) == 0 )
+        {
+            throw std::runtime_error( "Error, no angles of attack provided for list of states, but require angle of attack" );
+        }
+        currentIndependentVariable = statesInput.anglesOfAttack( stateIndex );
+        break;
+    case angle_of_sideslip_dependent:
+        if( statesInput.anglesOfSideslip.rows( ) == 0 )
+        {
+            throw std::runtime_error( "Error, no angles of sideslip provided for list of states, but require angle of sideslip" );
+        }
+        currentIndependentVariable = statesInput.anglesOfSideslip( stateIndex );
+        break;
+    case altitude_dependent:
+        currentIndependentVariable = flightConditionsOutput.altitudes( stateIndex );
+        break;
+    default:
+        // Remaining dependencies do not depend on vehicle state.
+        currentIndependentVariable = getAerodynamicCoefficientIndependentVariable(
+                    independentVariableType, secondaryIdentifier );
+    }
+
+    return currentIndependentVariable;
+}
+
 //! Function to update the independent variables of the aerodynamic coefficient interface
 void FlightConditions::updateAerodynamicCoefficientInput( )
 {
@@ -29,6 +29,71 @@ namespace tudat
 namespace aerodynamics
 {
 
+//! Input for the evaluation of flight conditions for a list of vehicle states, stored as structure-of-arrays.
+/*!
+ *  Input for the evaluation of flight conditions for a list of vehicle states (see
+ *  FlightConditions::computeFlightConditionsForStates), stored as structure-of-arrays: each column of the position and
+ *  velocity matrices contains a single component for all states, and each row the data of a single state.
+ */
+struct FlightConditionsBatchInput
+{
+    //! Position of the vehicle w.r.t. the central body, in the body-fixed frame of the central body (one row per state).
+    Eigen::Matrix< double, Eigen::Dynamic, 3 > bodyFixedPositions;
+
+    //! Airspeed-based velocity (i.e. including wind, if any) of the vehicle, in the body-fixed frame of the central
+    //! body (one row per state).
+    Eigen::Matrix< double, Eigen::Dynamic, 3 > airspeedBasedVelocities;
+
+    //! Angle of attack of each state (may be left empty if the aerodynamic coefficients do not depend on it).
+    Eigen::VectorXd anglesOfAttack;
+
+    //! Angle of sideslip of each state (may be left empty if the aerodynamic coefficients do not depend on it).
+    Eigen::VectorXd anglesOfSideslip;
+};
+
+//! Output of the evaluation of flight conditions for a list of vehicle states, stored as structure-of-arrays.
+/*!
+ *  Output of the evaluation of flight conditions for a list of vehicle states (see
+ *  FlightConditions::computeFlightConditionsForStates), stored as structure-of-arrays: each entry of the vectors, and
+ *  each row of the matrices, contains the data of a single state. The same object can be reused for subsequent
+ *  evaluations, in which case no memory is allocated if the number of states is unchanged.
+ */
+struct FlightConditionsBatchOutput
+{
+    //! Altitude of each state.
+    Eigen::VectorXd altitudes;
+
+    //! Latitude of each state.
+    Eigen::VectorXd latitudes;
+
+    //! Longitude of each state.
+    Eigen::VectorXd longitudes;
+
+    //! Freestream density of each state.
+    Eigen::VectorXd densities;
+
+    //! Freestream temperature of each state.
+    Eigen::VectorXd freestreamTemperatures;
+
+    //! Freestream speed of sound of each state.
+    Eigen::VectorXd speedsOfSound;
+
+    //! Airspeed of each state.
+    Eigen::VectorXd airspeeds;
+
+    //! Mach number of each state.
+    Eigen::VectorXd machNumbers;
+
+    //! Freestream dynamic pressure of each state.
+    Eigen::VectorXd dynamicPressures;
+
+    //! Aerodynamic force coefficients of each state (one row per state; empty if coefficients are not computed).
+    Eigen::Matrix< double, Eigen::Dynamic, 3 > forceCoefficients;
+
+    //! Aerodynamic moment coefficients of each state (one row per state; empty if coefficients are not computed).
+    Eigen::Matrix< double, Eigen::Dynamic, 3 > momentCoefficients;
+};
+
 //! Class for calculating aerodynamic flight characteristics of a vehicle during numerical
 //! integration.
 /*!
@@ -90,6 +155,27 @@ public:
      */
     void updateConditions( const double currentTime );
 
+    //! Function to compute the flight conditions for a list of vehicle states at a single time.
+    /*!
+     *  Function to compute the flight conditions (altitude, latitude, longitude, atmospheric properties, airspeed, Mach
+     *  number, dynamic pressure and, optionally, aerodynamic coefficients) for a list of vehicle states at a single
+     *  time, using the same atmosphere, shape and aerodynamic coefficient models as updateConditions. This function is
+     *  intended for the evaluation of many candidate states (e.g. in guidance design), and does not modify the current
+     *  flight conditions of this object. Note that, when computing the aerodynamic coefficients, the current coefficients
+     *  of the aerodynamic coefficient interface are restored to their values for the current flight conditions of this
+     *  object (if these have been computed) afterwards. The control surface deflections and custom coefficient
+     *  dependencies do not depend on the vehicle state, and are evaluated at their current values.
+     *  \param currentTime Time at which the flight conditions are to be computed.
+     *  \param statesInput Vehicle states for which the flight conditions are to be computed.
+     *  \param flightConditionsOutput Flight conditions for each state (returned by reference; resized as needed).
+     *  \param computeAerodynamicCoefficients Boolean denoting whether the aerodynamic coefficients are to be computed.
+     */
+    void computeFlightConditionsForStates(
+            const double currentTime,
+            const FlightConditionsBatchInput& statesInput,
+            FlightConditionsBatchOutput& flightConditionsOutput,
+            const bool computeAerodynamicCoefficients = true );
+
     //! Function to retrieve (and compute if necessary) the current altitude
     /*!
      * Function to retrieve (and compute if necessary) the current altitude
@@ -366,6 +452,24 @@ private:
             const AerodynamicCoefficientsIndependentVariables independentVariableType,
             const std::string& secondaryIdentifier = "" );
 
+    //! Function to retrieve the value of an independent variable of aerodynamic coefficients for a single state of a list
+    /*!
+     * Function to retrieve the value of an independent variable of aerodynamic coefficients for a single state of a
+     * list of states, for which the flight conditions have been computed by computeFlightConditionsForStates.
+     * \param independentVariableType Identifier of independent variable
+     * \param statesInput Vehicle states for which the flight conditions have been computed.
+     * \param flightConditionsOutput Flight conditions for each state.
+     * \param stateIndex Index of state for which the independent variable is to be retrieved.
+     * \param secondaryIdentifier Secondary identifier of independent variable (only used for control surface deflection).
+     * \return Value of independent variable for the requested state.
+     */
+    double getAerodynamicCoefficientIndependentVariableForState(
+            const AerodynamicCoefficientsIndependentVariables independentVariableType,
+            const FlightConditionsBatchInput& statesInput,
+            const FlightConditionsBatchOutput& flightConditionsOutput,
+            const int stateIndex,
+            const std::string& secondaryIdentifier = "" );
+
     //! Function to compute and set the current latitude and longitude
     void computeLatitudeAndLongitude( )
     {
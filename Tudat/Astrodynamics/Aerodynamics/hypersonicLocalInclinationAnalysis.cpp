@@ -13,11 +13,12 @@
  *
  */
 
+#include <algorithm>
+#include <fstream>
 #include <string>
 
 #include <boost/bind.hpp>
 #include <boost/function.hpp>
-#include <boost/lambda/lambda.hpp>
 #include <boost/make_shared.hpp>
 #include <boost/pointer_cast.hpp>
 #include <boost/shared_ptr.hpp>
@@ -29,6 +30,7 @@
 
 #include "Tudat/Astrodynamics/Aerodynamics/aerodynamics.h"
 #include "Tudat/Astrodynamics/Aerodynamics/hypersonicLocalInclinationAnalysis.h"
+#include "Tudat/Basics/parallelLoops.h"
 #include "Tudat/Mathematics/GeometricShapes/compositeSurfaceGeometry.h"
 #include "Tudat/Mathematics/GeometricShapes/surfaceGeometry.h"
 
@@ -42,6 +44,12 @@ using mathematical_constants::PI;
 
 using namespace geometric_shapes;
 
+//! Identifier written at the start of binary files containing hypersonic local inclination coefficients.
+static const char HYPERSONIC_LOCAL_INCLINATION_FILE_IDENTIFIER[ 16 ] = "TUDAT_HLIA_COEF";
+
+//! Version of format of binary files containing hypersonic local inclination coefficients.
+static const std::int32_t HYPERSONIC_LOCAL_INCLINATION_FILE_VERSION = 1;
+
 //! Returns default values of mach number for use in HypersonicLocalInclinationAnalysis.
 std::vector< double > getDefaultHypersonicLocalInclinationMachPoints(
         const std::string& machRegime )
@@ -126,13 +134,17 @@ HypersonicLocalInclinationAnalysis::HypersonicLocalInclinationAnalysis(
         const std::vector< std::vector< int > >& selectedMethods,
         const double referenceArea,
         const double referenceLength,
-        const Eigen::Vector3d& momentReferencePoint )
+        const Eigen::Vector3d& momentReferencePoint,
+        const unsigned int numberOfThreads,
+        const std::string& coefficientCacheFile,
+        const bool generateCoefficientsOnDemand )
     : AerodynamicCoefficientGenerator< 3, 6 >(
           dataPointsOfIndependentVariables, referenceLength, referenceArea, referenceLength,
           momentReferencePoint,
           boost::assign::list_of( mach_number_dependent )( angle_of_attack_dependent )
           ( angle_of_sideslip_dependent ), 1, 0 ),
-      stagnationPressureCoefficient( 2.0 ),
+      numberOfThreads_( numberOfThreads ),
+      generateCoefficientsOnDemand_( generateCoefficientsOnDemand ),
       ratioOfSpecificHeats( 1.4 ),
       selectedMethods_( selectedMethods )
 {
@@ -204,18 +216,39 @@ HypersonicLocalInclinationAnalysis::HypersonicLocalInclinationAnalysis(
         }
     }
 
-    // Allocate memory for panel inclinations and pressureCoefficient_.
+    // Store panel geometry of each part in contiguous matrices, with one column per panel.
+    panelSurfaceNormals_.resize( vehicleParts_.size( ) );
+    panelForceCoefficientContributions_.resize( vehicleParts_.size( ) );
+    panelMomentCoefficientContributions_.resize( vehicleParts_.size( ) );
     inclination_.resize( vehicleParts_.size( ) );
     pressureCoefficient_.resize( vehicleParts_.size( ) );
-    for ( unsigned int i = 0 ; i < vehicleParts_.size( ); i++ )
+    for ( unsigned int k = 0 ; k < vehicleParts_.size( ); k++ )
     {
-        inclination_[ i ].resize( vehicleParts_[ i ]->getNumberOfLines( ) );
-        pressureCoefficient_[ i ].resize( vehicleParts_[ i ]->getNumberOfLines( ) );
-        for ( int j = 0 ; j < vehicleParts_[ i ]->getNumberOfLines( ) ; j++ )
+        int numberOfPanelLines = vehicleParts_[ k ]->getNumberOfLines( ) - 1;
+        int numberOfPanelPoints = vehicleParts_[ k ]->getNumberOfPoints( ) - 1;
+        int numberOfPanels = numberOfPanelLines * numberOfPanelPoints;
+
+        panelSurfaceNormals_[ k ].resize( 3, numberOfPanels );
+        panelForceCoefficientContributions_[ k ].resize( 3, numberOfPanels );
+        panelMomentCoefficientContributions_[ k ].resize( 3, numberOfPanels );
+        for ( int i = 0 ; i < numberOfPanelLines; i++ )
         {
-            inclination_[ i ][ j ].resize( vehicleParts_[ i ]->getNumberOfPoints( ) );
-            pressureCoefficient_[ i ][ j ].resize( vehicleParts_[ i ]->getNumberOfPoints( ) );
+            for ( int j = 0 ; j < numberOfPanelPoints; j++ )
+            {
+                int panelIndex = i * numberOfPanelPoints + j;
+                Eigen::Vector3d surfaceNormal = vehicleParts_[ k ]->getPanelSurfaceNormal( i, j );
+                double panelArea = vehicleParts_[ k ]->getPanelArea( i, j );
+
+                panelSurfaceNormals_[ k ].col( panelIndex ) = surfaceNormal;
+                panelForceCoefficientContributions_[ k ].col( panelIndex ) =
+                        -panelArea * surfaceNormal / referenceArea_;
+                panelMomentCoefficientContributions_[ k ].col( panelIndex ) =
+                        -panelArea * ( vehicleParts_[ k ]->getPanelCentroid( i, j ) - momentReferencePoint_ ).
+                        cross( surfaceNormal ) / ( referenceLength_ * referenceArea_ );
+            }
         }
+        inclination_[ k ] = Eigen::VectorXd::Zero( numberOfPanels );
+        pressureCoefficient_[ k ] = Eigen::VectorXd::Zero( numberOfPanels );
     }
 
     boost::array< int, 3 > numberOfPointsPerIndependentVariables;
@@ -230,8 +263,34 @@ HypersonicLocalInclinationAnalysis::HypersonicLocalInclinationAnalysis(
     std::fill( isCoefficientGenerated_.origin( ),
                isCoefficientGenerated_.origin( ) + isCoefficientGenerated_.num_elements( ), 0 );
 
-    generateCoefficients( );
+    // Retrieve coefficients from file, or generate them.
+    bool areCoefficientsRead = false;
+    if( coefficientCacheFile != "" )
+    {
+        areCoefficientsRead = readCoefficientsFromFile( coefficientCacheFile );
+    }
+
+    if( !areCoefficientsRead )
+    {
+        if( generateCoefficientsOnDemand_ )
+        {
+            // Set coefficients to NaN, until they are generated.
+            std::fill( aerodynamicCoefficients_.origin( ),
+                       aerodynamicCoefficients_.origin( ) + aerodynamicCoefficients_.num_elements( ),
+                       Vector6d::Constant( TUDAT_NAN ) );
+        }
+        else
+        {
+            generateCoefficients( );
+            if( coefficientCacheFile != "" )
+            {
+                writeCoefficientsToFile( coefficientCacheFile );
+            }
+        }
+    }
     createInterpolator( );
+    multiLinearCoefficientInterpolator_ = boost::dynamic_pointer_cast<
+            interpolators::MultiLinearInterpolator< double, Vector6d, 3 > >( coefficientInterpolator_ );
 }
 
 //! Get aerodynamic coefficients.
@@ -248,53 +307,141 @@ Vector6d HypersonicLocalInclinationAnalysis::getAerodynamicCoefficientsDataPoint
 
 }
 
-//! Generate aerodynamic database.
-void HypersonicLocalInclinationAnalysis::generateCoefficients( )
+//! Compute the aerodynamic coefficients at current flight condition.
+void HypersonicLocalInclinationAnalysis::updateCurrentCoefficients(
+        const std::vector< double >& independentVariables )
 {
-    // Allocate variable to pass to coefficient determination for independent
-    // variable indices.
-    boost::array< int, 3 > independentVariableIndices;
-
-    // Iterate over all combinations of independent variables.
-    for ( unsigned int i = 0 ; i < dataPointsOfIndependentVariables_[ 0 ].size( ) ; i++ )
+    // Generate coefficients at corners of current interpolation cell, if required (input size is
+    // checked by base class function).
+    if( generateCoefficientsOnDemand_ && independentVariables.size( ) == 3 )
     {
-        independentVariableIndices[ 0 ] = i;
-        for ( unsigned  int j = 0 ; j < dataPointsOfIndependentVariables_[
-              1 ].size( ) ; j++ )
+        std::vector< int > nearestLowerIndices =
+                multiLinearCoefficientInterpolator_->findNearestLowerIndices( independentVariables );
+
+        boost::array< int, 3 > cornerIndices;
+        for( unsigned int i = 0; i < 8; i++ )
         {
-            independentVariableIndices[ 1 ] = j;
-            for ( unsigned  int k = 0 ; k < dataPointsOfIndependentVariables_[
-                  2 ].size( ) ; k++ )
+            for( unsigned int j = 0; j < 3; j++ )
             {
-                independentVariableIndices[ 2 ] = k;
+                cornerIndices[ j ] = nearestLowerIndices[ j ] + ( ( i >> j ) & 1 );
+            }
 
-                determineVehicleCoefficients( independentVariableIndices );
+            if( isCoefficientGenerated_( cornerIndices ) == 0 )
+            {
+                determineVehicleCoefficients( cornerIndices );
             }
         }
     }
+
+    AerodynamicCoefficientGenerator< 3, 6 >::updateCurrentCoefficients( independentVariables );
 }
 
-//! Generate aerodynamic coefficients at a single set of independent variables.
-void HypersonicLocalInclinationAnalysis::determineVehicleCoefficients(
-        const boost::array< int, 3 > independentVariableIndices )
+//! Determine inclination angles of panels on all parts.
+void HypersonicLocalInclinationAnalysis::determineInclinations( const double angleOfAttack,
+                                                                const double angleOfSideslip )
 {
-    // Declare coefficients vector and initialize to zeros.
-    Vector6d coefficients = Vector6d::Zero( );
+    computeInclinations( angleOfAttack, angleOfSideslip, inclination_ );
+}
 
-    // Loop over all vehicle parts, calculate aerodynamic coefficients and add
-    // to aerodynamicCoefficients_.
-    for ( unsigned int i = 0 ; i < vehicleParts_.size( ) ; i++ )
+//! Function to compute a hash of the vehicle geometry and analysis settings.
+std::uint64_t HypersonicLocalInclinationAnalysis::computeGeometryHash( ) const
+{
+    // Collect all data that influences the coefficients.
+    std::vector< double > hashedData;
+    hashedData.push_back( referenceArea_ );
+    hashedData.push_back( referenceLength_ );
+    hashedData.push_back( ratioOfSpecificHeats );
+    for( unsigned int i = 0; i < 3; i++ )
+    {
+        hashedData.push_back( momentReferencePoint_( i ) );
+    }
+    for( unsigned int i = 0; i < selectedMethods_.size( ); i++ )
+    {
+        for( unsigned int j = 0; j < selectedMethods_[ i ].size( ); j++ )
+        {
+            hashedData.push_back( static_cast< double >( selectedMethods_[ i ][ j ] ) );
+        }
+    }
+    for( unsigned int k = 0; k < vehicleParts_.size( ); k++ )
     {
-        coefficients += determinePartCoefficients( i, independentVariableIndices );
+        hashedData.push_back( static_cast< double >( panelSurfaceNormals_[ k ].cols( ) ) );
+        hashedData.insert( hashedData.end( ), panelSurfaceNormals_[ k ].data( ),
+                           panelSurfaceNormals_[ k ].data( ) + panelSurfaceNormals_[ k ].size( ) );
+        hashedData.insert( hashedData.end( ), panelForceCoefficientContributions_[ k ].data( ),
+                           panelForceCoefficientContributions_[ k ].data( ) +
+                           panelForceCoefficientContributions_[ k ].size( ) );
+        hashedData.insert( hashedData.end( ), panelMomentCoefficientContributions_[ k ].data( ),
+                           panelMomentCoefficientContributions_[ k ].data( ) +
+                           panelMomentCoefficientContributions_[ k ].size( ) );
     }
 
-    aerodynamicCoefficients_( independentVariableIndices ) = coefficients;
-    isCoefficientGenerated_( independentVariableIndices ) = 1;
+    // Compute FNV-1a hash of data.
+    std::uint64_t hashValue = 14695981039346656037ULL;
+    const unsigned char* hashedBytes = reinterpret_cast< const unsigned char* >( hashedData.data( ) );
+    for( std::size_t i = 0; i < hashedData.size( ) * sizeof( double ); i++ )
+    {
+        hashValue = ( hashValue ^ hashedBytes[ i ] ) * 1099511628211ULL;
+    }
+    return hashValue;
+}
+
+//! Generate aerodynamic database.
+void HypersonicLocalInclinationAnalysis::generateCoefficients( )
+{
+    unsigned int numberOfAttitudes = dataPointsOfIndependentVariables_[ 1 ].size( ) *
+            dataPointsOfIndependentVariables_[ 2 ].size( );
+
+    // Generate coefficients, with attitudes distributed dynamically over the threads.
+    std::atomic< unsigned int > nextAttitudeIndex( 0 );
+    utilities::runOnParallelThreads(
+                utilities::getNumberOfThreadsToUse( numberOfThreads_, numberOfAttitudes ),
+                boost::bind( &HypersonicLocalInclinationAnalysis::generateCoefficientsForAttitudes,
+                             this, boost::ref( nextAttitudeIndex ) ) );
 }
 
-//! Determine aerodynamic coefficients of a single vehicle part.
-Vector6d HypersonicLocalInclinationAnalysis::determinePartCoefficients(
-        const int partNumber, const boost::array< int, 3 > independentVariableIndices )
+//! Generate aerodynamic coefficients for a list of combinations of angle of attack and sideslip.
+void HypersonicLocalInclinationAnalysis::generateCoefficientsForAttitudes(
+        std::atomic< unsigned int >& nextAttitudeIndex )
+{
+    const unsigned int numberOfAnglesOfSideslip = dataPointsOfIndependentVariables_[ 2 ].size( );
+    const unsigned int numberOfAttitudes = dataPointsOfIndependentVariables_[ 1 ].size( ) * numberOfAnglesOfSideslip;
+
+    try
+    {
+        // Declare workspace for current thread.
+        std::vector< Eigen::VectorXd > inclinations = inclination_;
+        std::vector< Eigen::VectorXd > pressureCoefficients = pressureCoefficient_;
+
+        unsigned int currentAttitudeIndex;
+        while( ( currentAttitudeIndex = nextAttitudeIndex++ ) < numberOfAttitudes )
+        {
+            unsigned int angleOfAttackIndex = currentAttitudeIndex / numberOfAnglesOfSideslip;
+            unsigned int angleOfSideslipIndex = currentAttitudeIndex % numberOfAnglesOfSideslip;
+
+            // Determine panel inclinations once, and use them at all Mach numbers.
+            computeInclinations( dataPointsOfIndependentVariables_[ 1 ][ angleOfAttackIndex ],
+                                 dataPointsOfIndependentVariables_[ 2 ][ angleOfSideslipIndex ],
+                                 inclinations );
+
+            for( unsigned int i = 0; i < dataPointsOfIndependentVariables_[ 0 ].size( ); i++ )
+            {
+                aerodynamicCoefficients_[ i ][ angleOfAttackIndex ][ angleOfSideslipIndex ] =
+                        computeVehicleCoefficients( dataPointsOfIndependentVariables_[ 0 ][ i ],
+                                                    inclinations, pressureCoefficients );
+                isCoefficientGenerated_[ i ][ angleOfAttackIndex ][ angleOfSideslipIndex ] = 1;
+            }
+        }
+    }
+    catch( ... )
+    {
+        nextAttitudeIndex = numberOfAttitudes;
+        throw;
+    }
+}
+
+//! Generate aerodynamic coefficients at a single set of independent variables.
+void HypersonicLocalInclinationAnalysis::determineVehicleCoefficients(
+        const boost::array< int, 3 > independentVariableIndices )
 {
     // Declare and determine angles of attack and sideslip for analysis.
     double angleOfAttack =  dataPointsOfIndependentVariables_[ 1 ]
@@ -303,10 +450,7 @@ Vector6d HypersonicLocalInclinationAnalysis::determinePartCoefficients(
     double angleOfSideslip =  dataPointsOfIndependentVariables_[ 2 ]
             [ independentVariableIndices[ 2 ] ];
 
-    // Declare partCoefficient vector.
-    Vector6d partCoefficients = Vector6d::Zero( );
-
-    // Check whether the inclinations of the vehicle part have already been computed.
+    // Check whether the inclinations of the vehicle parts have already been computed.
     if ( previouslyComputedInclinations_.count( std::pair< double, double >(
                                                     angleOfAttack, angleOfSideslip ) ) == 0 )
     {
@@ -325,97 +469,51 @@ Vector6d HypersonicLocalInclinationAnalysis::determinePartCoefficients(
                     angleOfAttack, angleOfSideslip ) ];
     }
 
-    // Set pressureCoefficient_ array for given independent variables.
-    determinePressureCoefficients( partNumber, independentVariableIndices );
-
-    // Calculate force coefficients from pressure coefficients.
-    partCoefficients.segment( 0, 3 ) = calculateForceCoefficients( partNumber );
-
-    // Calculate moment coefficients from pressure coefficients.
-    partCoefficients.segment( 3, 3 ) = calculateMomentCoefficients( partNumber );
+    aerodynamicCoefficients_( independentVariableIndices ) = computeVehicleCoefficients(
+                dataPointsOfIndependentVariables_[ 0 ][ independentVariableIndices[ 0 ] ],
+                inclination_, pressureCoefficient_ );
+    isCoefficientGenerated_( independentVariableIndices ) = 1;
 
-    return partCoefficients;
+    // Update data used by interpolator, if it has already been created.
+    if( multiLinearCoefficientInterpolator_ != NULL )
+    {
+        multiLinearCoefficientInterpolator_->resetDependentDataPoint(
+                    independentVariableIndices, aerodynamicCoefficients_( independentVariableIndices ) );
+    }
 }
 
-//! Determine the pressure coefficients on a single vehicle part.
-void HypersonicLocalInclinationAnalysis::determinePressureCoefficients(
-        const int partNumber, const boost::array< int, 3 > independentVariableIndices )
+//! Determine aerodynamic coefficients of the vehicle from panel inclinations.
+Vector6d HypersonicLocalInclinationAnalysis::computeVehicleCoefficients(
+        const double machNumber, const std::vector< Eigen::VectorXd >& inclinations,
+        std::vector< Eigen::VectorXd >& pressureCoefficients ) const
 {
-    // Retrieve Mach number.
-    double machNumber = dataPointsOfIndependentVariables_[ 0 ]
-            [ independentVariableIndices[ 0 ] ];
-
     // Determine stagnation point pressure coefficients. Value is computed once
     // here to prevent its calculation in inner loop.
-    stagnationPressureCoefficient = computeStagnationPressure(
+    double stagnationPressureCoefficient = computeStagnationPressure(
                 machNumber, ratioOfSpecificHeats );
 
-    updateCompressionPressures( machNumber, partNumber );
-    updateExpansionPressures( machNumber, partNumber );
-}
-
-//! Determine force coefficients from pressure coefficients.
-Eigen::Vector3d HypersonicLocalInclinationAnalysis::calculateForceCoefficients(
-        const int partNumber )
-{
-    // Declare force coefficient vector and intialize to zeros.
-    Eigen::Vector3d forceCoefficients = Eigen::Vector3d::Zero( );
+    // Declare coefficients vector and initialize to zeros.
+    Vector6d coefficients = Vector6d::Zero( );
 
-    // Loop over all panels and add pressures, scaled by panel area, to force
-    // coefficients.
-    for ( int i = 0 ; i < vehicleParts_[ partNumber ]->getNumberOfLines( ) - 1 ; i++ )
+    // Loop over all vehicle parts, calculate pressure coefficients, and add force and moment
+    // coefficients, which are linear in the panel pressure coefficients.
+    for ( unsigned int i = 0 ; i < vehicleParts_.size( ) ; i++ )
     {
-        for ( int j = 0 ; j < vehicleParts_[ partNumber ]->getNumberOfPoints( ) - 1 ; j++)
-        {
-            forceCoefficients -=
-                    pressureCoefficient_[ partNumber ][ i ][ j ] *
-                    vehicleParts_[ partNumber ]->getPanelArea( i, j ) *
-                    vehicleParts_[ partNumber ]->getPanelSurfaceNormal( i, j );
-        }
-    }
-
-    // Normalize result by reference area.
-    forceCoefficients /= referenceArea_;
-
-    return forceCoefficients;
-}
-
-//! Determine moment coefficients from pressure coefficients.
-Eigen::Vector3d HypersonicLocalInclinationAnalysis::calculateMomentCoefficients(
-        const int partNumber )
-{
-    // Declare moment coefficient vector and intialize to zeros.
-    Eigen::Vector3d momentCoefficients = Eigen::Vector3d::Zero( );
+        updateCompressionPressures( machNumber, stagnationPressureCoefficient, i,
+                                    inclinations[ i ], pressureCoefficients[ i ] );
+        updateExpansionPressures( machNumber, i, inclinations[ i ], pressureCoefficients[ i ] );
 
-    // Declare moment arm for panel moment determination.
-    Eigen::Vector3d referenceDistance ;
-
-    // Loop over all panels and add moments due pressures.
-    for ( int i = 0 ; i < vehicleParts_[ partNumber ]->getNumberOfLines( ) - 1 ; i++ )
-    {
-        for ( int j = 0 ; j < vehicleParts_[ partNumber ]->getNumberOfPoints( ) - 1 ; j++ )
-        {
-            // Determine moment arm for given panel centroid.
-            referenceDistance = ( vehicleParts_[ partNumber ]->
-                                  getPanelCentroid( i, j ) -  momentReferencePoint_ );
-
-            momentCoefficients -=
-                    pressureCoefficient_[ partNumber ][ i ][ j ] *
-                    vehicleParts_[ partNumber ]->getPanelArea( i, j ) *
-                    ( referenceDistance.cross( vehicleParts_[ partNumber ]->
-                                               getPanelSurfaceNormal( i, j ) ) );
-        }
+        coefficients.segment( 0, 3 ) += panelForceCoefficientContributions_[ i ] * pressureCoefficients[ i ];
+        coefficients.segment( 3, 3 ) += panelMomentCoefficientContributions_[ i ] * pressureCoefficients[ i ];
     }
 
-    // Scale result by reference length and area.
-    momentCoefficients /= ( referenceLength_ * referenceArea_ );
-
-    return momentCoefficients;
+    return coefficients;
 }
 
-//! Determines the inclination angle of panels on a single part.
-void HypersonicLocalInclinationAnalysis::determineInclinations( const double angleOfAttack,
-                                                                const double angleOfSideslip )
+//! Determines the inclination angle of panels on all parts.
+void HypersonicLocalInclinationAnalysis::computeInclinations(
+        const double angleOfAttack, const double angleOfSideslip,
+        std::vector< Eigen::VectorXd >& inclinations ) const
 {
     // Declare free-stream velocity vector.
     Eigen::Vector3d freestreamVelocityDirection;
@@ -428,52 +526,38 @@ void HypersonicLocalInclinationAnalysis::determineInclinations( const double ang
     freestreamVelocityDirection( 1 ) = freestreamVelocityDirectionY;
     freestreamVelocityDirection( 2 ) = freestreamVelocityDirectionZ;
 
-    // Declare cosine of inclination angle.
-    double cosineOfInclination;
-
-    // Loop over all panels of given vehicle part and set inclination angles.
+    // Set inclination angles of all panels, from the cosine of the inclination angle (inner
+    // product between surface normal and free-stream direction).
+    inclinations.resize( vehicleParts_.size( ) );
     for( unsigned int k = 0; k < vehicleParts_.size( ); k++ )
     {
-        for ( int i = 0 ; i < vehicleParts_[ k ]->getNumberOfLines( ) - 1 ; i++ )
-        {
-            for ( int j = 0 ; j < vehicleParts_[ k ]->getNumberOfPoints( ) - 1 ; j++ )
-            {
-
-                // Determine cosine of inclination angle from inner product between
-                // surface normal and free-stream direction.
-                cosineOfInclination = vehicleParts_[ k ]->
-                        getPanelSurfaceNormal( i, j ).
-                        dot( freestreamVelocityDirection );
-
-                // Set inclination angle.
-                inclination_[ k ][ i ][ j ] = PI / 2.0 - acos( cosineOfInclination );
-            }
-        }
+        inclinations[ k ].noalias( ) = panelSurfaceNormals_[ k ].transpose( ) * freestreamVelocityDirection;
+        inclinations[ k ] = ( PI / 2.0 - inclinations[ k ].array( ).acos( ) ).matrix( );
     }
 }
 
-//! Determine compression pressure coefficients on all parts.
-void HypersonicLocalInclinationAnalysis::updateCompressionPressures( const double machNumber,
-                                                                     const int partNumber )
+//! Determine compression pressure coefficients on a single part.
+void HypersonicLocalInclinationAnalysis::updateCompressionPressures(
+        const double machNumber, const double stagnationPressureCoefficient, const int partNumber,
+        const Eigen::VectorXd& inclinations, Eigen::VectorXd& pressureCoefficients ) const
 {
     int method = selectedMethods_[ 0 ][ partNumber ];
 
+    // Evaluate (modified) Newtonian method for all panels at once.
+    if ( method == 0 || method == 1 )
+    {
+        double maximumPressureCoefficient = ( method == 0 ) ? 2.0 : stagnationPressureCoefficient;
+        pressureCoefficients = ( inclinations.array( ) > 0.0 ).select(
+                    maximumPressureCoefficient * inclinations.array( ).sin( ).square( ),
+                    pressureCoefficients.array( ) ).matrix( );
+        return;
+    }
+
     boost::function< double( double ) > pressureFunction;
 
-    // Switch to analyze part using correct method.
+    // Switch to analyze part using correct method ((modified) Newtonian methods are evaluated above).
     switch( method )
     {
-    case 0:
-        pressureFunction =
-                boost::bind( aerodynamics::computeNewtonianPressureCoefficient, _1 );
-        break;
-
-    case 1:
-        pressureFunction =
-                boost::bind( aerodynamics::computeModifiedNewtonianPressureCoefficient, _1,
-                             stagnationPressureCoefficient );
-        break;
-
     case 2:
         // Method currently disabled.
         break;
@@ -522,62 +606,48 @@ void HypersonicLocalInclinationAnalysis::updateCompressionPressures( const doubl
         break;
     }
 
-    for ( int i = 0 ; i < vehicleParts_[ partNumber ]->getNumberOfLines( ) - 1; i++ )
+    for ( int i = 0 ; i < inclinations.rows( ); i++ )
     {
-        for ( int j = 0 ; j < vehicleParts_[ partNumber ]->getNumberOfPoints( ) - 1 ; j++ )
+        if ( inclinations( i ) > 0 )
         {
-            if ( inclination_[ partNumber ][ i ][ j ] > 0 )
-            {
-                // If panel inclination is positive, calculate pressure coefficient.
-                pressureCoefficient_[ partNumber ][ i ][ j ] =
-                        pressureFunction( inclination_[ partNumber ][ i ][ j ] );
-            }
+            // If panel inclination is positive, calculate pressure coefficient.
+            pressureCoefficients( i ) = pressureFunction( inclinations( i ) );
         }
     }
 }
 
-//! Determines expansion pressure coefficients on all parts.
-void HypersonicLocalInclinationAnalysis::updateExpansionPressures( const double machNumber,
-                                                                   const int partNumber )
+//! Determines expansion pressure coefficients on a single part.
+void HypersonicLocalInclinationAnalysis::updateExpansionPressures(
+        const double machNumber, const int partNumber,
+        const Eigen::VectorXd& inclinations, Eigen::VectorXd& pressureCoefficients ) const
 {
     // Get analysis method of part to analyze.
     int method = selectedMethods_[ 1 ][ partNumber ];
 
     if ( method == 0 || method == 1 || method == 4 )
     {
-        boost::function< double( ) > pressureFunction;
+        // Determine (constant) pressure coefficient.
+        double constantPressureCoefficient = 0.0;
         switch( method )
         {
         case 0:
-            pressureFunction = boost::bind( &aerodynamics::computeVacuumPressureCoefficient,
-                                            machNumber, ratioOfSpecificHeats );
+            constantPressureCoefficient = aerodynamics::computeVacuumPressureCoefficient(
+                        machNumber, ratioOfSpecificHeats );
             break;
 
         case 1:
-            pressureFunction = boost::lambda::constant( 0.0 );
+            constantPressureCoefficient = 0.0;
             break;
 
         case 4:
-            pressureFunction = boost::bind( &aerodynamics::computeHighMachBasePressure,
-                                            machNumber );
+            constantPressureCoefficient = aerodynamics::computeHighMachBasePressure( machNumber );
             break;
 
         }
 
-        // Iterate over all panels on part.
-        for ( int i = 0 ; i < vehicleParts_[ partNumber ]->getNumberOfLines( ) - 1 ; i++ )
-        {
-            for ( int j = 0 ; j < vehicleParts_[ partNumber ]->getNumberOfPoints( ) - 1 ; j++ )
-            {
-                if ( inclination_[ partNumber ][ i ][ j ] <= 0 )
-                {
-                    // If panel inclination is negative, calculate pressure using
-                    // Van Dyke unified method.
-                    pressureCoefficient_[ partNumber ][ i ][ j ] =
-                            pressureFunction( );
-                }
-            }
-        }
+        // Set pressure coefficient of all panels with negative inclination at once.
+        pressureCoefficients = ( inclinations.array( ) <= 0.0 ).select(
+                    constantPressureCoefficient, pressureCoefficients.array( ) ).matrix( );
     }
 
     else if( method == 3 || method == 5 || method == 6 )
@@ -614,17 +684,12 @@ void HypersonicLocalInclinationAnalysis::updateExpansionPressures( const double
         }
 
         // Iterate over all panels on part.
-        for ( int i = 0 ; i < vehicleParts_[ partNumber ]->getNumberOfLines( ) - 1 ; i++ )
+        for ( int i = 0 ; i < inclinations.rows( ); i++ )
         {
-            for ( int j = 0 ; j < vehicleParts_[ partNumber ]->getNumberOfPoints( ) - 1 ; j++ )
+            if ( inclinations( i ) <= 0 )
             {
-                if ( inclination_[ partNumber ][ i ][ j ] <= 0 )
-                {
-                    // If panel inclination is negative, calculate pressure using
-                    // Van Dyke unified method.
-                    pressureCoefficient_[ partNumber ][ i ][ j ] =
-                            pressureFunction( inclination_[ partNumber ][ i ][ j ] );
-                }
+                // If panel inclination is negative, calculate pressure coefficient.
+                pressureCoefficients( i ) = pressureFunction( inclinations( i ) );
             }
         }
     }
@@ -637,5 +702,108 @@ void HypersonicLocalInclinationAnalysis::updateExpansionPressures( const double
     }
 }
 
+//! Function to read the aerodynamic coefficients from a binary cache file.
+bool HypersonicLocalInclinationAnalysis::readCoefficientsFromFile( const std::string& fileName )
+{
+    std::ifstream coefficientFile( fileName.c_str( ), std::ios::binary );
+    if( !coefficientFile.is_open( ) )
+    {
+        return false;
+    }
+
+    // Check file identifier and version
+    char fileIdentifier[ sizeof( HYPERSONIC_LOCAL_INCLINATION_FILE_IDENTIFIER ) ];
+    std::int32_t fileVersion = 0;
+    coefficientFile.read( fileIdentifier, sizeof( fileIdentifier ) );
+    coefficientFile.read( reinterpret_cast< char* >( &fileVersion ), sizeof( fileVersion ) );
+    if( !coefficientFile || !std::equal( fileIdentifier, fileIdentifier + sizeof( fileIdentifier ),
+                                         HYPERSONIC_LOCAL_INCLINATION_FILE_IDENTIFIER ) ||
+            fileVersion != HYPERSONIC_LOCAL_INCLINATION_FILE_VERSION )
+    {
+        throw std::runtime_error( "Error when reading hypersonic local inclination coefficients from " + fileName +
+                                  ", file is not a (compatible) coefficient file." );
+    }
+
+    // Check whether coefficients in file are computed for the same geometry and data points.
+    std::uint64_t fileGeometryHash = 0;
+    coefficientFile.read( reinterpret_cast< char* >( &fileGeometryHash ), sizeof( fileGeometryHash ) );
+    if( !coefficientFile || fileGeometryHash != computeGeometryHash( ) )
+    {
+        return false;
+    }
+
+    for( unsigned int i = 0; i < 3; i++ )
+    {
+        std::uint64_t numberOfDataPoints = 0;
+        coefficientFile.read( reinterpret_cast< char* >( &numberOfDataPoints ), sizeof( numberOfDataPoints ) );
+        if( !coefficientFile || numberOfDataPoints != dataPointsOfIndependentVariables_[ i ].size( ) )
+        {
+            return false;
+        }
+
+        std::vector< double > fileDataPoints( numberOfDataPoints );
+        coefficientFile.read( reinterpret_cast< char* >( fileDataPoints.data( ) ),
+                              numberOfDataPoints * sizeof( double ) );
+        if( !coefficientFile || fileDataPoints != dataPointsOfIndependentVariables_[ i ] )
+        {
+            return false;
+        }
+    }
+
+    // Read coefficients
+    for( unsigned int i = 0; i < aerodynamicCoefficients_.num_elements( ); i++ )
+    {
+        coefficientFile.read( reinterpret_cast< char* >( aerodynamicCoefficients_.data( )[ i ].data( ) ),
+                              6 * sizeof( double ) );
+    }
+    if( !coefficientFile )
+    {
+        throw std::runtime_error( "Error when reading hypersonic local inclination coefficients from " + fileName +
+                                  ", file is incomplete." );
+    }
+
+    std::fill( isCoefficientGenerated_.origin( ),
+               isCoefficientGenerated_.origin( ) + isCoefficientGenerated_.num_elements( ), 1 );
+    return true;
+}
+
+//! Function to write the aerodynamic coefficients to a binary cache file.
+void HypersonicLocalInclinationAnalysis::writeCoefficientsToFile( const std::string& fileName )
+{
+    std::ofstream coefficientFile( fileName.c_str( ), std::ios::binary );
+    if( !coefficientFile.is_open( ) )
+    {
+        throw std::runtime_error( "Error when writing hypersonic local inclination coefficients, could not open " +
+                                  fileName );
+    }
+
+    // Write identifier, version and key (geometry hash and data points)
+    std::uint64_t geometryHash = computeGeometryHash( );
+    coefficientFile.write( HYPERSONIC_LOCAL_INCLINATION_FILE_IDENTIFIER,
+                           sizeof( HYPERSONIC_LOCAL_INCLINATION_FILE_IDENTIFIER ) );
+    coefficientFile.write( reinterpret_cast< const char* >( &HYPERSONIC_LOCAL_INCLINATION_FILE_VERSION ),
+                           sizeof( HYPERSONIC_LOCAL_INCLINATION_FILE_VERSION ) );
+    coefficientFile.write( reinterpret_cast< const char* >( &geometryHash ), sizeof( geometryHash ) );
+    for( unsigned int i = 0; i < 3; i++ )
+    {
+        std::uint64_t numberOfDataPoints = dataPointsOfIndependentVariables_[ i ].size( );
+        coefficientFile.write( reinterpret_cast< const char* >( &numberOfDataPoints ), sizeof( numberOfDataPoints ) );
+        coefficientFile.write( reinterpret_cast< const char* >( dataPointsOfIndependentVariables_[ i ].data( ) ),
+                               numberOfDataPoints * sizeof( double ) );
+    }
+
+    // Write coefficients
+    for( unsigned int i = 0; i < aerodynamicCoefficients_.num_elements( ); i++ )
+    {
+        coefficientFile.write( reinterpret_cast< const char* >( aerodynamicCoefficients_.data( )[ i ].data( ) ),
+                               6 * sizeof( double ) );
+    }
+
+    if( !coefficientFile )
+    {
+        throw std::runtime_error( "Error when writing hypersonic local inclination coefficients to " + fileName );
+    }
+}
+
 } // namespace aerodynamics
 } // namespace tudat
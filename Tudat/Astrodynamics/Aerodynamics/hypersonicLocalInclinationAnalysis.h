@@ -18,6 +18,9 @@
 #ifndef TUDAT_HYPERSONIC_LOCAL_INCLINATION_ANALYSIS_H
 #define TUDAT_HYPERSONIC_LOCAL_INCLINATION_ANALYSIS_H
 
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
 #include <map>
 #include <string>
 #include <vector>
@@ -67,6 +70,14 @@ std::vector< double > getDefaultHypersonicLocalInclinationAngleOfSideslipPoints(
  * panel inclination determination process, a geometry with outward surface-normals is assumed.
  * The resulting coefficients are expressed in the same reference frame as that of the input
  * geometry.
+ * The coefficients at the different combinations of angle of attack and sideslip are independent,
+ * and may be generated concurrently by a number of threads. The generated coefficients can be
+ * stored in a binary cache file, from which they are retrieved in subsequent analyses of the
+ * same geometry (see computeGeometryHash) on the same grid of independent variables.
+ * Alternatively, the coefficients may be generated on demand, in which case the coefficients at
+ * the corners of a grid cell are only generated when coefficients inside this cell are first
+ * requested (by updateCurrentCoefficients or getAerodynamicCoefficientsDataPoint), after which
+ * they are stored for later use.
  */
 class HypersonicLocalInclinationAnalysis: public AerodynamicCoefficientGenerator< 3, 6 >
 {
@@ -99,6 +110,16 @@ public:
      *  and moments.
      *  \param referenceLength Reference length used to non-dimensionalize aerodynamic moments.
      *  \param momentReferencePoint Reference point wrt which aerodynamic moments are calculated.
+     *  \param numberOfThreads Number of threads used to generate the coefficients (default 1; if 0,
+     *  the number of concurrent threads supported by the hardware is used).
+     *  \param coefficientCacheFile Binary file from which the coefficients are retrieved, if it
+     *  contains coefficients for the same geometry hash and independent variable data points.
+     *  Otherwise, the coefficients are generated and written to this file. If empty (default), no
+     *  file is used.
+     *  \param generateCoefficientsOnDemand Boolean denoting whether the coefficients are generated
+     *  only when they are first needed, instead of during construction (default false). In this
+     *  case, numberOfThreads is not used, and the (incomplete) coefficients are not written to
+     *  coefficientCacheFile (although they are still read from it, if it exists).
      */
     HypersonicLocalInclinationAnalysis(
             const std::vector< std::vector< double > >& dataPointsOfIndependentVariables,
@@ -109,7 +130,10 @@ public:
             const std::vector< std::vector< int > >& selectedMethods,
             const double referenceArea,
             const double referenceLength,
-            const Eigen::Vector3d& momentReferencePoint );
+            const Eigen::Vector3d& momentReferencePoint,
+            const unsigned int numberOfThreads = 1,
+            const std::string& coefficientCacheFile = "",
+            const bool generateCoefficientsOnDemand = false );
 
     //! Default destructor.
     /*!
@@ -129,6 +153,39 @@ public:
     Eigen::Vector6d getAerodynamicCoefficientsDataPoint(
             const boost::array< int, 3 > independentVariables );
 
+    //! Compute the aerodynamic coefficients at current flight condition.
+    /*!
+     *  Compute the aerodynamic coefficients at current flight conditions (independent variables),
+     *  by interpolating the generated coefficients. If the coefficients are generated on demand,
+     *  any coefficients at the corners of the current interpolation cell that have not yet been
+     *  generated are generated first.
+     *  \param independentVariables Independent variables of force and moment coefficient
+     *  determination (Mach number, angle of attack, angle of sideslip).
+     */
+    void updateCurrentCoefficients( const std::vector< double >& independentVariables );
+
+    //! Function to return whether the coefficients are generated on demand.
+    /*!
+     *  Function to return whether the coefficients are generated on demand.
+     *  \return Boolean denoting whether the coefficients are generated on demand.
+     */
+    bool getGenerateCoefficientsOnDemand( ) const
+    {
+        return generateCoefficientsOnDemand_;
+    }
+
+    //! Function to return the number of data points at which the coefficients have been generated.
+    /*!
+     *  Function to return the number of data points at which the coefficients have been generated.
+     *  Unless the coefficients are generated on demand, this is equal to the total number of data points.
+     *  \return Number of data points at which the coefficients have been generated.
+     */
+    unsigned int getNumberOfGeneratedDataPoints( ) const
+    {
+        return std::count( isCoefficientGenerated_.data( ),
+                           isCoefficientGenerated_.data( ) + isCoefficientGenerated_.num_elements( ), true );
+    }
+
     //! Determine inclination angles of panels on a given part.
     /*!
      * Determines panel inclinations for all panels on all parts for given attitude.
@@ -161,6 +218,15 @@ public:
          return vehicleParts_[ vehicleIndex ];
      }
 
+    //! Function to compute a hash of the vehicle geometry and analysis settings.
+    /*!
+     * Function to compute a (64-bit FNV-1a) hash of the panel geometry of all vehicle parts, the
+     * selected local inclination methods and the reference quantities. Analyses with identical
+     * hashes produce identical coefficients for identical independent variables.
+     * \return Hash of the vehicle geometry and analysis settings.
+     */
+    std::uint64_t computeGeometryHash( ) const;
+
     //! Overload ostream to print class information.
     /*!
      * Overloads ostream to print class information, prints the number of lawgs geometry parts and
@@ -183,6 +249,19 @@ private:
      */
     void generateCoefficients( );
 
+    //! Generate aerodynamic coefficients for a list of combinations of angle of attack and sideslip.
+    /*!
+     * Generates aerodynamic coefficients at all Mach numbers, for combinations of angle of attack
+     * and sideslip (with index i * numberOfAnglesOfSideslip + j for the i-th angle of attack and
+     * j-th angle of sideslip). The combinations are shared between threads by means of the
+     * nextAttitudeIndex counter: each call of this function processes combinations until none are
+     * left. Panel inclinations and pressure coefficients are stored in variables local to this
+     * function, so that concurrent calls are independent. If an exception is thrown, the remaining
+     * combinations are cancelled before the exception is rethrown.
+     * \param nextAttitudeIndex Index of next combination that is to be processed (shared by threads)
+     */
+    void generateCoefficientsForAttitudes( std::atomic< unsigned int >& nextAttitudeIndex );
+
     //! Generate aerodynamic coefficients at a single set of independent variables.
     /*!
      * Generates aerodynamic coefficients at a single set of independent variables.
@@ -192,63 +271,78 @@ private:
      */
     void determineVehicleCoefficients( const boost::array< int, 3 > independentVariableIndices );
 
-    //! Determine aerodynamic coefficients for a single LaWGS part.
-    /*!
-     * Determines aerodynamic coefficients for a single LaWGS part,
-     * calls determinepressureCoefficient_ function for given vehicle part.
-     * \param partNumber Index from vehicleParts_ array for which to determine coefficients.
-     * \param independentVariableIndices Array of indices of independent variables.
-     * \return Force and moment coefficients for requested vehicle part.
-     */
-    Eigen::Vector6d determinePartCoefficients(
-            const int partNumber, const boost::array< int, 3 > independentVariableIndices );
-
-    //! Determine pressure coefficients on a given part.
-    /*!
-     * Determines pressure coefficients on a single vehicle part.
-     * Calls the updateExpansionPressures and updateCompressionPressures for given vehicle part.
-     * \param partNumber Index from vehicleParts_ array for which to determine coefficients.
-     * \param independentVariableIndices Array of indices of independent variables.
-     */
-    void determinePressureCoefficients( const int partNumber,
-                                        const boost::array< int, 3 > independentVariableIndices );
-
-    //! Determine force coefficients of a part.
+    //! Determine panel inclinations of all parts.
     /*!
-     * Sums the pressure coefficients of given part and determines force coefficients from it by
-     * non-dimensionalization with reference area.
-     * \param partNumber Index from vehicleParts_ array for which determine coefficients.
-     * \return Force coefficients for requested vehicle part.
+     * Determines panel inclinations for all panels on all parts for given attitude, from the
+     * product of the matrix of panel surface normals and the freestream direction.
+     * \param angleOfAttack Angle of attack at which to determine inclination angles.
+     * \param angleOfSideslip Angle of sideslip at which to determine inclination angles.
+     * \param inclinations Panel inclinations, per vehicle part (returned by reference).
      */
-    Eigen::Vector3d calculateForceCoefficients( const int partNumber );
+    void computeInclinations( const double angleOfAttack, const double angleOfSideslip,
+                              std::vector< Eigen::VectorXd >& inclinations ) const;
 
-    //! Determine moment coefficients of a part.
+    //! Determine aerodynamic coefficients of the vehicle from panel inclinations.
     /*!
-     * Determines the moment coefficients of a given part by summing the contributions of all
-     * panels on the part. Moment arms are taken from panel centroid to momentReferencePoint. Non-
-     * dimensionalization is performed by product of referenceLength and referenceArea.
-     * \param partNumber Index from vehicleParts_ array for which to determine coefficients.
-     * \return Moment coefficients for requested vehicle part.
+     * Determines aerodynamic coefficients of the vehicle at given Mach number and panel
+     * inclinations, by summing the coefficients of all parts.
+     * \param machNumber Mach number at which to perform analysis.
+     * \param inclinations Panel inclinations, per vehicle part.
+     * \param pressureCoefficients Panel pressure coefficients, per vehicle part (used as
+     * workspace, and modified by this function).
+     * \return Force and moment coefficients of vehicle.
      */
-    Eigen::Vector3d calculateMomentCoefficients( const int partNumber );
+    Eigen::Vector6d computeVehicleCoefficients(
+            const double machNumber, const std::vector< Eigen::VectorXd >& inclinations,
+            std::vector< Eigen::VectorXd >& pressureCoefficients ) const;
 
     //! Determine the compression pressure coefficients of a given part.
     /*!
-     * Sets the values of pressureCoefficient_ on given part and at given Mach number for which
+     * Sets the values of pressure coefficients on given part and at given Mach number for which
      * inclination > 0.
      * \param machNumber Mach number at which to perform analysis.
+     * \param stagnationPressureCoefficient Stagnation pressure coefficient for flow which has
+     * passed through a normal shock wave at machNumber.
      * \param partNumber of part from vehicleParts_ which is to be analyzed.
+     * \param inclinations Panel inclinations of part.
+     * \param pressureCoefficients Panel pressure coefficients of part (modified by this function).
      */
-    void updateCompressionPressures( const double machNumber, const int partNumber );
+    void updateCompressionPressures( const double machNumber,
+                                     const double stagnationPressureCoefficient,
+                                     const int partNumber,
+                                     const Eigen::VectorXd& inclinations,
+                                     Eigen::VectorXd& pressureCoefficients ) const;
 
     //! Determine the expansion pressure coefficients of a given part.
     /*!
-     * Determine the values of pressureCoefficient_ on given part and at given Mach number for
+     * Determine the values of pressure coefficients on given part and at given Mach number for
      * which inclination <= 0.
      * \param machNumber Mach number at which to perform analysis.
      * \param partNumber of part from vehicleParts_ which is to be analyzed.
+     * \param inclinations Panel inclinations of part.
+     * \param pressureCoefficients Panel pressure coefficients of part (modified by this function).
+     */
+    void updateExpansionPressures( const double machNumber, const int partNumber,
+                                   const Eigen::VectorXd& inclinations,
+                                   Eigen::VectorXd& pressureCoefficients ) const;
+
+    //! Function to read the aerodynamic coefficients from a binary cache file.
+    /*!
+     * Function to read the aerodynamic coefficients from a binary cache file, if it contains
+     * coefficients for the same geometry hash and independent variable data points as this object.
+     * \param fileName Name of the file from which the coefficients are to be read.
+     * \return True if the coefficients were read, false if the file does not exist or contains
+     * coefficients for a different geometry or grid.
+     */
+    bool readCoefficientsFromFile( const std::string& fileName );
+
+    //! Function to write the aerodynamic coefficients to a binary cache file.
+    /*!
+     * Function to write the aerodynamic coefficients to a binary cache file, together with the
+     * geometry hash and independent variable data points.
+     * \param fileName Name of the file to which the coefficients are to be written.
      */
-    void updateExpansionPressures( const double machNumber, const int partNumber );
+    void writeCoefficientsToFile( const std::string& fileName );
 
     //! Array of vehicle parts.
     /*!
@@ -263,40 +357,59 @@ private:
      */
     boost::multi_array< bool, 3 > isCoefficientGenerated_;
 
-    //! Three-dimensional array of panel inclination angles.
+    //! Surface normals of the panels of each vehicle part.
     /*!
-     * Three-dimensional array of panel inclination angles at current values of
-     * independent variables. Indices indicate part-line-point.
+     * Surface normals of the panels of each vehicle part, with one column per panel. The panel on
+     * line i and point j of a part is stored in column i * ( numberOfPoints - 1 ) + j.
      */
-    std::vector< std::vector< std::vector< double > > > inclination_;
+    std::vector< Eigen::Matrix3Xd > panelSurfaceNormals_;
 
-    //! Map of angle of attack and -sideslip pair and associated panel inclinations.
+    //! Contributions of the panels of each vehicle part to the force coefficients.
     /*!
-     * Map of angle of attack and -sideslip pair and associated panel inclinations.
+     * Contributions of the panels of each vehicle part to the force coefficients, per unit pressure
+     * coefficient (i.e. minus the panel area times its surface normal, divided by the reference area),
+     * with one column per panel.
      */
-    std::map< std::pair< double, double >, std::vector< std::vector< std::vector< double > > > >
-            previouslyComputedInclinations_;
+    std::vector< Eigen::Matrix3Xd > panelForceCoefficientContributions_;
 
-    //! Three-dimensional array of panel pressure coefficients.
+    //! Contributions of the panels of each vehicle part to the moment coefficients.
     /*!
-     * Three-dimensional array of panel pressure coefficients at current values
-     * of independent variables. Indices indicate part-line-point.
+     * Contributions of the panels of each vehicle part to the moment coefficients, per unit pressure
+     * coefficient (i.e. minus the panel area times the cross product of moment arm and surface
+     * normal, divided by reference area and length), with one column per panel.
      */
-    std::vector< std::vector< std::vector< double > > > pressureCoefficient_;
+    std::vector< Eigen::Matrix3Xd > panelMomentCoefficientContributions_;
+
+    //! Panel inclination angles of each part, at current values of independent variables.
+    std::vector< Eigen::VectorXd > inclination_;
 
-    //! Stagnation pressure coefficient.
+    //! Map of angle of attack and -sideslip pair and associated panel inclinations.
     /*!
-     * Stagnation pressure coefficient for flow which has passed through a
-     * normal shock wave at current Mach number.
+     * Map of angle of attack and -sideslip pair and associated panel inclinations.
      */
-    double stagnationPressureCoefficient;
+    std::map< std::pair< double, double >, std::vector< Eigen::VectorXd > >
+            previouslyComputedInclinations_;
+
+    //! Panel pressure coefficients of each part, at current values of independent variables.
+    std::vector< Eigen::VectorXd > pressureCoefficient_;
+
+    //! Number of threads used to generate the coefficients.
+    unsigned int numberOfThreads_;
+
+    //! Boolean denoting whether the coefficients are generated only when they are first needed.
+    bool generateCoefficientsOnDemand_;
+
+    //! Interpolator of coefficients (same object as coefficientInterpolator_), used to update
+    //! the interpolated data when coefficients are generated on demand.
+    boost::shared_ptr< interpolators::MultiLinearInterpolator< double, Eigen::Vector6d, 3 > >
+            multiLinearCoefficientInterpolator_;
 
     //! Ratio of specific heats.
     /*!
      * Ratio of specific heat at constant pressure to specific heat at constant pressure.
      */
     double ratioOfSpecificHeats;
-\
+
     //! Array of selected methods.
     /*!
      * Array of selected methods, first index represents compression/expansion,
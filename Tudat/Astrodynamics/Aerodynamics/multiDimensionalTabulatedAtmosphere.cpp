@@ -0,0 +1,300 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <boost/make_shared.hpp>
+
+#include "Tudat/Astrodynamics/Aerodynamics/multiDimensionalTabulatedAtmosphere.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+
+namespace tudat
+{
+
+namespace aerodynamics
+{
+
+//! Identifier written at the start of binary files containing multi-dimensional tabulated atmosphere
+static const char MULTI_DIMENSIONAL_ATMOSPHERE_FILE_IDENTIFIER[ 16 ] = "TUDAT_MDTAB_ATM";
+
+//! Version of format of binary files containing multi-dimensional tabulated atmosphere
+static const std::int32_t MULTI_DIMENSIONAL_ATMOSPHERE_FILE_VERSION = 1;
+
+//! Number of atmospheric properties stored at each grid point (logarithm of density and pressure, temperature).
+static const std::int32_t MULTI_DIMENSIONAL_ATMOSPHERE_NUMBER_OF_PROPERTIES = 3;
+
+//! Size (in bytes) of the header of binary files containing multi-dimensional tabulated atmosphere
+static const std::size_t MULTI_DIMENSIONAL_ATMOSPHERE_HEADER_SIZE =
+        sizeof( MULTI_DIMENSIONAL_ATMOSPHERE_FILE_IDENTIFIER ) + 2 * sizeof( std::int32_t ) +
+        3 * ( 2 * sizeof( double ) + sizeof( std::uint64_t ) );
+
+//! Function to find the grid cell, and position in the cell, at which a uniform grid is to be interpolated.
+/*!
+ *  Function to find the grid cell, and position in the cell, at which a uniform grid is to be interpolated. For a
+ *  non-periodic grid, values outside of the grid are set to the nearest boundary value.
+ *  \param grid Definition of the uniform grid.
+ *  \param value Value of the independent variable at which interpolation is to be performed.
+ *  \param isPeriodic Boolean denoting whether the grid is periodic (with period equal to the number of points times
+ *  the step size).
+ *  \param lowerIndex Index of the grid point at the lower boundary of the cell (returned by reference).
+ *  \param upperIndex Index of the grid point at the upper boundary of the cell (returned by reference).
+ *  \param upperFraction Fraction of the cell between the lower boundary and value (returned by reference).
+ */
+void findUniformGridInterpolationCell(
+        const UniformTabulationGrid& grid, const double value, const bool isPeriodic,
+        unsigned int& lowerIndex, unsigned int& upperIndex, double& upperFraction )
+{
+    if( isPeriodic )
+    {
+        double scaledValue = std::fmod( ( value - grid.firstValue ) / grid.stepSize,
+                                        static_cast< double >( grid.numberOfPoints ) );
+        if( scaledValue < 0.0 )
+        {
+            scaledValue += static_cast< double >( grid.numberOfPoints );
+        }
+        lowerIndex = std::min( static_cast< unsigned int >( scaledValue ), grid.numberOfPoints - 1 );
+        upperIndex = ( lowerIndex + 1 ) % grid.numberOfPoints;
+        upperFraction = scaledValue - static_cast< double >( lowerIndex );
+    }
+    else
+    {
+        double scaledValue = ( std::min( std::max( value, grid.firstValue ), grid.getLastValue( ) ) -
+                               grid.firstValue ) / grid.stepSize;
+        lowerIndex = std::min( static_cast< unsigned int >( scaledValue ), grid.numberOfPoints - 2 );
+        upperIndex = lowerIndex + 1;
+        upperFraction = std::min( scaledValue - static_cast< double >( lowerIndex ), 1.0 );
+    }
+}
+
+//! Function to write the file containing the data of a MultiDimensionalTabulatedAtmosphere.
+void writeMultiDimensionalTabulatedAtmosphereFile(
+        const std::string& fileName,
+        const UniformTabulationGrid& altitudeGrid,
+        const UniformTabulationGrid& latitudeGrid,
+        const UniformTabulationGrid& longitudeGrid,
+        const boost::multi_array< double, 3 >& densityData,
+        const boost::multi_array< double, 3 >& pressureData,
+        const boost::multi_array< double, 3 >& temperatureData )
+{
+    // Check input consistency
+    const UniformTabulationGrid grids[ 3 ] = { altitudeGrid, latitudeGrid, longitudeGrid };
+    for( unsigned int i = 0; i < 3; i++ )
+    {
+        if( grids[ i ].numberOfPoints < 2 || !( grids[ i ].stepSize > 0.0 ) )
+        {
+            throw std::runtime_error( "Error when writing multi-dimensional tabulated atmosphere, grid " +
+                                      std::to_string( i ) + " must have at least 2 points and a positive step size." );
+        }
+        if( densityData.shape( )[ i ] != grids[ i ].numberOfPoints ||
+                pressureData.shape( )[ i ] != grids[ i ].numberOfPoints ||
+                temperatureData.shape( )[ i ] != grids[ i ].numberOfPoints )
+        {
+            throw std::runtime_error( "Error when writing multi-dimensional tabulated atmosphere, size of data in dimension " +
+                                      std::to_string( i ) + " is inconsistent with grid." );
+        }
+    }
+
+    std::ofstream tableFile( fileName.c_str( ), std::ios::binary );
+    if( !tableFile.is_open( ) )
+    {
+        throw std::runtime_error( "Error when writing multi-dimensional tabulated atmosphere, could not open " + fileName );
+    }
+
+    // Write header
+    tableFile.write( MULTI_DIMENSIONAL_ATMOSPHERE_FILE_IDENTIFIER, sizeof( MULTI_DIMENSIONAL_ATMOSPHERE_FILE_IDENTIFIER ) );
+    tableFile.write( reinterpret_cast< const char* >( &MULTI_DIMENSIONAL_ATMOSPHERE_FILE_VERSION ), sizeof( std::int32_t ) );
+    tableFile.write( reinterpret_cast< const char* >( &MULTI_DIMENSIONAL_ATMOSPHERE_NUMBER_OF_PROPERTIES ),
+                     sizeof( std::int32_t ) );
+    for( unsigned int i = 0; i < 3; i++ )
+    {
+        const std::uint64_t numberOfPoints = grids[ i ].numberOfPoints;
+        tableFile.write( reinterpret_cast< const char* >( &grids[ i ].firstValue ), sizeof( double ) );
+        tableFile.write( reinterpret_cast< const char* >( &grids[ i ].stepSize ), sizeof( double ) );
+        tableFile.write( reinterpret_cast< const char* >( &numberOfPoints ), sizeof( std::uint64_t ) );
+    }
+
+    // Write data, with all properties at a single grid point stored contiguously
+    double properties[ MULTI_DIMENSIONAL_ATMOSPHERE_NUMBER_OF_PROPERTIES ];
+    for( unsigned int i = 0; i < altitudeGrid.numberOfPoints; i++ )
+    {
+        for( unsigned int j = 0; j < latitudeGrid.numberOfPoints; j++ )
+        {
+            for( unsigned int k = 0; k < longitudeGrid.numberOfPoints; k++ )
+            {
+                if( !( densityData[ i ][ j ][ k ] > 0.0 ) || !( pressureData[ i ][ j ][ k ] > 0.0 ) )
+                {
+                    throw std::runtime_error( "Error when writing multi-dimensional tabulated atmosphere, density and pressure must be positive." );
+                }
+                properties[ 0 ] = std::log( densityData[ i ][ j ][ k ] );
+                properties[ 1 ] = std::log( pressureData[ i ][ j ][ k ] );
+                properties[ 2 ] = temperatureData[ i ][ j ][ k ];
+                tableFile.write( reinterpret_cast< const char* >( properties ), sizeof( properties ) );
+            }
+        }
+    }
+
+    if( !tableFile )
+    {
+        throw std::runtime_error( "Error when writing multi-dimensional tabulated atmosphere to " + fileName );
+    }
+}
+
+//! Constructor.
+MultiDimensionalTabulatedAtmosphere::MultiDimensionalTabulatedAtmosphere(
+        const std::string& atmosphereTableFile,
+        const double specificGasConstant,
+        const double ratioOfSpecificHeats ):
+    atmosphereTableFile_( atmosphereTableFile ), specificGasConstant_( specificGasConstant ),
+    ratioOfSpecificHeats_( ratioOfSpecificHeats )
+{
+    using namespace boost::interprocess;
+
+    // Map file into memory
+    try
+    {
+        fileMapping_ = boost::make_shared< file_mapping >( atmosphereTableFile_.c_str( ), read_only );
+        mappedRegion_ = boost::make_shared< mapped_region >( *fileMapping_, read_only );
+    }
+    catch( const interprocess_exception& caughtException )
+    {
+        throw std::runtime_error( "Error when creating multi-dimensional tabulated atmosphere, could not map file " +
+                                  atmosphereTableFile_ + ": " + caughtException.what( ) );
+    }
+
+    const char* fileData = static_cast< const char* >( mappedRegion_->get_address( ) );
+    const std::size_t fileSize = mappedRegion_->get_size( );
+
+    // Check file header
+    std::int32_t fileVersion = 0, numberOfProperties = 0;
+    if( fileSize >= MULTI_DIMENSIONAL_ATMOSPHERE_HEADER_SIZE )
+    {
+        std::memcpy( &fileVersion, fileData + sizeof( MULTI_DIMENSIONAL_ATMOSPHERE_FILE_IDENTIFIER ),
+                     sizeof( std::int32_t ) );
+        std::memcpy( &numberOfProperties, fileData + sizeof( MULTI_DIMENSIONAL_ATMOSPHERE_FILE_IDENTIFIER ) +
+                     sizeof( std::int32_t ), sizeof( std::int32_t ) );
+    }
+    if( fileSize < MULTI_DIMENSIONAL_ATMOSPHERE_HEADER_SIZE ||
+            !std::equal( fileData, fileData + sizeof( MULTI_DIMENSIONAL_ATMOSPHERE_FILE_IDENTIFIER ),
+                         MULTI_DIMENSIONAL_ATMOSPHERE_FILE_IDENTIFIER ) ||
+            fileVersion != MULTI_DIMENSIONAL_ATMOSPHERE_FILE_VERSION ||
+            numberOfProperties != MULTI_DIMENSIONAL_ATMOSPHERE_NUMBER_OF_PROPERTIES )
+    {
+        throw std::runtime_error( "Error when creating multi-dimensional tabulated atmosphere, " + atmosphereTableFile_ +
+                                  " is not a (compatible) multi-dimensional tabulated atmosphere file." );
+    }
+
+    // Read grid definitions
+    const char* currentHeaderPosition = fileData + sizeof( MULTI_DIMENSIONAL_ATMOSPHERE_FILE_IDENTIFIER ) +
+            2 * sizeof( std::int32_t );
+    std::uint64_t numberOfDataPoints = MULTI_DIMENSIONAL_ATMOSPHERE_NUMBER_OF_PROPERTIES;
+    for( unsigned int i = 0; i < 3; i++ )
+    {
+        std::uint64_t numberOfPoints = 0;
+        std::memcpy( &independentVariableGrids_[ i ].firstValue, currentHeaderPosition, sizeof( double ) );
+        std::memcpy( &independentVariableGrids_[ i ].stepSize, currentHeaderPosition + sizeof( double ),
+                     sizeof( double ) );
+        std::memcpy( &numberOfPoints, currentHeaderPosition + 2 * sizeof( double ), sizeof( std::uint64_t ) );
+        currentHeaderPosition += 2 * sizeof( double ) + sizeof( std::uint64_t );
+
+        if( numberOfPoints < 2 || !( independentVariableGrids_[ i ].stepSize > 0.0 ) )
+        {
+            throw std::runtime_error( "Error when creating multi-dimensional tabulated atmosphere, grid " +
+                                      std::to_string( i ) + " in " + atmosphereTableFile_ + " is invalid." );
+        }
+        independentVariableGrids_[ i ].numberOfPoints = static_cast< unsigned int >( numberOfPoints );
+        numberOfDataPoints *= numberOfPoints;
+    }
+
+    if( fileSize != MULTI_DIMENSIONAL_ATMOSPHERE_HEADER_SIZE + numberOfDataPoints * sizeof( double ) )
+    {
+        throw std::runtime_error( "Error when creating multi-dimensional tabulated atmosphere, size of " +
+                                  atmosphereTableFile_ + " is inconsistent with its grid definition." );
+    }
+    tabulatedData_ = reinterpret_cast< const double* >( fileData + MULTI_DIMENSIONAL_ATMOSPHERE_HEADER_SIZE );
+
+    // Check whether longitude grid spans a full revolution, with a tolerance relative to the step size to allow for
+    // round-off in the tabulated step.
+    const UniformTabulationGrid& longitudeGrid = independentVariableGrids_[ 2 ];
+    isLongitudePeriodic_ = ( std::fabs( longitudeGrid.stepSize * static_cast< double >( longitudeGrid.numberOfPoints ) -
+                                        2.0 * mathematical_constants::PI ) < 1.0E-6 * longitudeGrid.stepSize );
+
+    std::fill( currentInputVariables_.begin( ), currentInputVariables_.end( ), TUDAT_NAN );
+}
+
+//! Destructor
+MultiDimensionalTabulatedAtmosphere::~MultiDimensionalTabulatedAtmosphere( ){ }
+
+//! Compute the local atmospheric properties.
+void MultiDimensionalTabulatedAtmosphere::computeProperties(
+        const double altitude, const double longitude, const double latitude )
+{
+    // Check if properties need to be recomputed
+    if( altitude == currentInputVariables_[ 0 ] && longitude == currentInputVariables_[ 1 ] &&
+            latitude == currentInputVariables_[ 2 ] )
+    {
+        return;
+    }
+    currentInputVariables_[ 0 ] = altitude;
+    currentInputVariables_[ 1 ] = longitude;
+    currentInputVariables_[ 2 ] = latitude;
+
+    // Find grid cell in each dimension
+    unsigned int lowerIndices[ 3 ], upperIndices[ 3 ];
+    double upperFractions[ 3 ];
+    findUniformGridInterpolationCell( independentVariableGrids_[ 0 ], altitude, false,
+                                      lowerIndices[ 0 ], upperIndices[ 0 ], upperFractions[ 0 ] );
+    findUniformGridInterpolationCell( independentVariableGrids_[ 1 ], latitude, false,
+                                      lowerIndices[ 1 ], upperIndices[ 1 ], upperFractions[ 1 ] );
+    findUniformGridInterpolationCell( independentVariableGrids_[ 2 ], longitude, isLongitudePeriodic_,
+                                      lowerIndices[ 2 ], upperIndices[ 2 ], upperFractions[ 2 ] );
+
+    // Perform trilinear interpolation of all properties, summing the contributions of the 8 cell corners
+    const std::size_t numberOfLatitudes = independentVariableGrids_[ 1 ].numberOfPoints;
+    const std::size_t numberOfLongitudes = independentVariableGrids_[ 2 ].numberOfPoints;
+    double interpolatedProperties[ MULTI_DIMENSIONAL_ATMOSPHERE_NUMBER_OF_PROPERTIES ] = { 0.0, 0.0, 0.0 };
+    for( unsigned int i = 0; i < 2; i++ )
+    {
+        const std::size_t altitudeIndex = ( i == 0 ) ? lowerIndices[ 0 ] : upperIndices[ 0 ];
+        const double altitudeWeight = ( i == 0 ) ? ( 1.0 - upperFractions[ 0 ] ) : upperFractions[ 0 ];
+        for( unsigned int j = 0; j < 2; j++ )
+        {
+            const std::size_t latitudeIndex = ( j == 0 ) ? lowerIndices[ 1 ] : upperIndices[ 1 ];
+            const double latitudeWeight = ( j == 0 ) ? ( 1.0 - upperFractions[ 1 ] ) : upperFractions[ 1 ];
+            for( unsigned int k = 0; k < 2; k++ )
+            {
+                const std::size_t longitudeIndex = ( k == 0 ) ? lowerIndices[ 2 ] : upperIndices[ 2 ];
+                const double weight = altitudeWeight * latitudeWeight *
+                        ( ( k == 0 ) ? ( 1.0 - upperFractions[ 2 ] ) : upperFractions[ 2 ] );
+
+                const double* currentProperties = tabulatedData_ + MULTI_DIMENSIONAL_ATMOSPHERE_NUMBER_OF_PROPERTIES *
+                        ( ( altitudeIndex * numberOfLatitudes + latitudeIndex ) * numberOfLongitudes + longitudeIndex );
+                for( int l = 0; l < MULTI_DIMENSIONAL_ATMOSPHERE_NUMBER_OF_PROPERTIES; l++ )
+                {
+                    interpolatedProperties[ l ] += weight * currentProperties[ l ];
+                }
+            }
+        }
+    }
+
+    density_ = std::exp( interpolatedProperties[ 0 ] );
+    pressure_ = std::exp( interpolatedProperties[ 1 ] );
+    temperature_ = interpolatedProperties[ 2 ];
+}
+
+} // namespace aerodynamics
+
+} // namespace tudat
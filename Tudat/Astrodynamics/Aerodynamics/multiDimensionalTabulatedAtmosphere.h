@@ -0,0 +1,299 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_MULTI_DIMENSIONAL_TABULATED_ATMOSPHERE_H
+#define TUDAT_MULTI_DIMENSIONAL_TABULATED_ATMOSPHERE_H
+
+#include <string>
+
+#include <boost/array.hpp>
+#include <boost/make_shared.hpp>
+#include <boost/multi_array.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include "Tudat/Astrodynamics/Aerodynamics/aerodynamics.h"
+#include "Tudat/Astrodynamics/Aerodynamics/atmosphereModel.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/physicalConstants.h"
+
+namespace boost
+{
+namespace interprocess
+{
+class file_mapping;
+class mapped_region;
+}
+}
+
+namespace tudat
+{
+
+namespace aerodynamics
+{
+
+//! Definition of the (uniformly spaced) values of a single independent variable of a tabulated atmosphere.
+struct UniformTabulationGrid
+{
+    //! Constructor.
+    /*!
+     * Constructor.
+     * \param firstValue Value of the independent variable at the first grid point.
+     * \param stepSize Distance between two subsequent grid points (must be positive).
+     * \param numberOfPoints Number of grid points (must be at least 2).
+     */
+    UniformTabulationGrid( const double firstValue = 0.0, const double stepSize = 1.0,
+                           const unsigned int numberOfPoints = 2 ):
+        firstValue( firstValue ), stepSize( stepSize ), numberOfPoints( numberOfPoints ){ }
+
+    //! Function to retrieve the value of the independent variable at the last grid point.
+    /*!
+     * Function to retrieve the value of the independent variable at the last grid point.
+     * \return Value of the independent variable at the last grid point.
+     */
+    double getLastValue( ) const
+    {
+        return firstValue + stepSize * static_cast< double >( numberOfPoints - 1 );
+    }
+
+    //! Value of the independent variable at the first grid point.
+    double firstValue;
+
+    //! Distance between two subsequent grid points.
+    double stepSize;
+
+    //! Number of grid points.
+    unsigned int numberOfPoints;
+};
+
+//! Function to write the file containing the data of a MultiDimensionalTabulatedAtmosphere.
+/*!
+ * Function to write the (binary) file containing the data of a MultiDimensionalTabulatedAtmosphere, from
+ * atmospheric properties given on a uniform grid of altitude, latitude and longitude (e.g. the output of a general
+ * circulation model).
+ * \param fileName Name of the file that is to be written.
+ * \param altitudeGrid Altitudes [m] at which the atmospheric properties are given.
+ * \param latitudeGrid Latitudes [rad] at which the atmospheric properties are given.
+ * \param longitudeGrid Longitudes [rad] at which the atmospheric properties are given.
+ * \param densityData Densities [kg/m^3] at each grid point, indexed as [altitude][latitude][longitude].
+ * \param pressureData Pressures [N/m^2] at each grid point, indexed as [altitude][latitude][longitude].
+ * \param temperatureData Temperatures [K] at each grid point, indexed as [altitude][latitude][longitude].
+ */
+void writeMultiDimensionalTabulatedAtmosphereFile(
+        const std::string& fileName,
+        const UniformTabulationGrid& altitudeGrid,
+        const UniformTabulationGrid& latitudeGrid,
+        const UniformTabulationGrid& longitudeGrid,
+        const boost::multi_array< double, 3 >& densityData,
+        const boost::multi_array< double, 3 >& pressureData,
+        const boost::multi_array< double, 3 >& temperatureData );
+
+//! Atmosphere model with properties tabulated on a uniform grid of altitude, latitude and longitude.
+/*!
+ *  Atmosphere model with density, pressure and temperature tabulated on a uniform grid of altitude, latitude and
+ *  longitude (for instance from the output of a general circulation model of Mars or Titan). The data is read from a
+ *  binary file (see writeMultiDimensionalTabulatedAtmosphereFile), which is memory-mapped, so that large data sets
+ *  do not need to be loaded into memory completely. Since the grid is uniform, the grid cell in which the
+ *  atmospheric properties are to be interpolated is found directly (without searching), after which trilinear
+ *  interpolation is used. Density and pressure are interpolated logarithmically (i.e. the logarithm of
+ *  these quantities is interpolated trilinearly).
+ *  If the longitude grid spans a full revolution (i.e. the step size times the number of points is 2 pi), the
+ *  longitude is treated as periodic, and interpolation between the last and first longitude is performed. Otherwise,
+ *  as for altitude and latitude, independent variables outside of the tabulated range are set to the nearest
+ *  boundary value of the grid.
+ *  The speed of sound is computed from the temperature, assuming a constant atmospheric composition.
+ */
+class MultiDimensionalTabulatedAtmosphere : public AtmosphereModel
+{
+public:
+
+    //! Constructor.
+    /*!
+     *  Constructor.
+     *  \param atmosphereTableFile Binary file containing the tabulated atmosphere, as created by
+     *  writeMultiDimensionalTabulatedAtmosphereFile.
+     *  \param specificGasConstant The constant specific gas constant of the atmosphere
+     *  \param ratioOfSpecificHeats The constant ratio of specific heats of the atmosphere
+     */
+    MultiDimensionalTabulatedAtmosphere(
+            const std::string& atmosphereTableFile,
+            const double specificGasConstant = physical_constants::SPECIFIC_GAS_CONSTANT_AIR,
+            const double ratioOfSpecificHeats = 1.4 );
+
+    //! Destructor
+    ~MultiDimensionalTabulatedAtmosphere( );
+
+    //! Get local density.
+    /*!
+     * Returns the local density of the atmosphere in kg per meter^3.
+     * \param altitude Altitude at which density is to be computed [m].
+     * \param longitude Longitude at which density is to be computed [rad].
+     * \param latitude Latitude at which density is to be computed [rad].
+     * \param time Time at which density is to be computed (not used but included for consistency with base class
+     * interface).
+     * \return Atmospheric density [kg/m^3].
+     */
+    double getDensity( const double altitude, const double longitude,
+                       const double latitude, const double time = 0.0 )
+    {
+        computeProperties( altitude, longitude, latitude );
+        return density_;
+    }
+
+    //! Get local pressure.
+    /*!
+     * Returns the local pressure of the atmosphere in Newton per meter^2.
+     * \param altitude Altitude at which pressure is to be computed [m].
+     * \param longitude Longitude at which pressure is to be computed [rad].
+     * \param latitude Latitude at which pressure is to be computed [rad].
+     * \param time Time at which pressure is to be computed (not used but included for consistency with base class
+     * interface).
+     * \return Atmospheric pressure [N/m^2].
+     */
+    double getPressure( const double altitude, const double longitude,
+                        const double latitude, const double time = 0.0 )
+    {
+        computeProperties( altitude, longitude, latitude );
+        return pressure_;
+    }
+
+    //! Get local temperature.
+    /*!
+     * Returns the local temperature of the atmosphere in Kelvin.
+     * \param altitude Altitude at which temperature is to be computed [m].
+     * \param longitude Longitude at which temperature is to be computed [rad].
+     * \param latitude Latitude at which temperature is to be computed [rad].
+     * \param time Time at which temperature is to be computed (not used but included for consistency with base
+     * class interface).
+     * \return Atmospheric temperature [K].
+     */
+    double getTemperature( const double altitude, const double longitude,
+                           const double latitude, const double time = 0.0 )
+    {
+        computeProperties( altitude, longitude, latitude );
+        return temperature_;
+    }
+
+    //! Get local speed of sound.
+    /*!
+     * Returns the local speed of sound in the atmosphere in m/s.
+     * \param altitude Altitude at which speed of sound is to be computed [m].
+     * \param longitude Longitude at which speed of sound is to be computed [rad].
+     * \param latitude Latitude at which speed of sound is to be computed [rad].
+     * \param time Time at which speed of sound is to be computed (not used but included for consistency with base
+     * class interface).
+     * \return Atmospheric speed of sound [m/s].
+     */
+    double getSpeedOfSound( const double altitude, const double longitude,
+                            const double latitude, const double time = 0.0 )
+    {
+        computeProperties( altitude, longitude, latitude );
+        return computeSpeedOfSound( temperature_, ratioOfSpecificHeats_, specificGasConstant_ );
+    }
+
+    //! Get atmosphere table file name.
+    /*!
+     * Returns atmosphere table file name.
+     * \return The atmosphere table file.
+     */
+    std::string getAtmosphereTableFile( ){ return atmosphereTableFile_; }
+
+    //! Get specific gas constant.
+    /*!
+     * Returns the specific gas constant of the atmosphere in J/(kg K), its value is assumed constant.
+     * \return Specific gas constant of the atmosphere.
+     */
+    double getSpecificGasConstant( ){ return specificGasConstant_; }
+
+    //! Get ratio of specific heats.
+    /*!
+     * Returns the ratio of specific heats of the atmosphere, its value is assumed constant.
+     * \return Ratio of specific heats of the atmosphere.
+     */
+    double getRatioOfSpecificHeats( ){ return ratioOfSpecificHeats_; }
+
+    //! Function to retrieve the grids of the independent variables.
+    /*!
+     * Function to retrieve the grids of the independent variables (altitude, latitude, longitude, in that order).
+     * \return Grids of the independent variables.
+     */
+    boost::array< UniformTabulationGrid, 3 > getIndependentVariableGrids( ){ return independentVariableGrids_; }
+
+    //! Function to create a copy of the atmosphere model that can be evaluated independently of this object.
+    /*!
+     * Function to create a copy of the atmosphere model that can be evaluated independently of this object. The
+     * (read-only) memory-mapped table is shared between the copies, the current atmospheric properties are not.
+     * \return Copy of the atmosphere model, using the same memory-mapped table.
+     */
+    boost::shared_ptr< AtmosphereModel > createIndependentCopy( )
+    {
+        return boost::make_shared< MultiDimensionalTabulatedAtmosphere >( *this );
+    }
+
+private:
+
+    //! Compute the local atmospheric properties.
+    /*!
+     * Computes the local atmospheric density, pressure and temperature by trilinear interpolation. Properties are
+     * only recomputed if any of the input variables differs from the previous call.
+     * \param altitude Altitude at which properties are to be computed [m].
+     * \param longitude Longitude at which properties are to be computed [rad].
+     * \param latitude Latitude at which properties are to be computed [rad].
+     */
+    void computeProperties( const double altitude, const double longitude, const double latitude );
+
+    //! The file name of the atmosphere table.
+    std::string atmosphereTableFile_;
+
+    //! Specific gas constant of the atmosphere, its value is assumed constant.
+    double specificGasConstant_;
+
+    //! Ratio of specific heats of the atmosphere, its value is assumed constant.
+    double ratioOfSpecificHeats_;
+
+    //! Grids of the independent variables (altitude, latitude, longitude, in that order).
+    boost::array< UniformTabulationGrid, 3 > independentVariableGrids_;
+
+    //! Boolean denoting whether the longitude grid spans a full revolution, and is treated as periodic.
+    bool isLongitudePeriodic_;
+
+    //! Object providing the mapping of the atmosphere table file into memory.
+    boost::shared_ptr< boost::interprocess::file_mapping > fileMapping_;
+
+    //! Region of memory into which the atmosphere table file is mapped.
+    boost::shared_ptr< boost::interprocess::mapped_region > mappedRegion_;
+
+    //! Pointer to the start of the tabulated data in the mapped memory.
+    /*!
+     *  Pointer to the start of the tabulated data in the mapped memory. For each grid point (indexed as
+     *  [altitude][latitude][longitude]), the logarithm of the density, the logarithm of the pressure and the
+     *  temperature are stored contiguously.
+     */
+    const double* tabulatedData_;
+
+    //! Altitude, longitude and latitude of the most recent call to computeProperties
+    boost::array< double, 3 > currentInputVariables_;
+
+    //! Current local density (kg/m3)
+    double density_;
+
+    //! Current local pressure (N/m^2)
+    double pressure_;
+
+    //! Current local temperature (K)
+    double temperature_;
+};
+
+//! Typedef for shared-pointer to MultiDimensionalTabulatedAtmosphere object.
+typedef boost::shared_ptr< MultiDimensionalTabulatedAtmosphere > MultiDimensionalTabulatedAtmospherePointer;
+
+} // namespace aerodynamics
+
+} // namespace tudat
+
+#endif // TUDAT_MULTI_DIMENSIONAL_TABULATED_ATMOSPHERE_H
@@ -8,7 +8,13 @@
  *    http://tudat.tudelft.nl/LICENSE.
  */
 
+#include <mutex>
+
+#include <boost/bind.hpp>
+#include <boost/make_shared.hpp>
+
 #include "Tudat/Astrodynamics/Aerodynamics/nrlmsise00Atmosphere.h"
+#include "Tudat/Astrodynamics/Aerodynamics/nrlmsise00InputFunctions.h"
 #include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
 
 
@@ -18,102 +24,181 @@ namespace tudat
 namespace aerodynamics
 {
 
-void NRLMSISE00Atmosphere::computeProperties(
+//! Mutex guarding calls to the NRLMSISE00 implementation, which stores intermediate results in global variables.
+static std::mutex nrlmsise00EvaluationMutex;
+
+//! Constructor using a calculator of the model input from solar activity data.
+NRLMSISE00Atmosphere::NRLMSISE00Atmosphere( const boost::shared_ptr< NRLMSISE00InputCalculator > inputCalculator,
+                                            const bool useIdealGasLaw ):
+    NRLMSISE00Atmosphere( boost::bind( &NRLMSISE00InputCalculator::getInput, inputCalculator, _1, _2, _3, _4 ),
+                          useIdealGasLaw )
+{
+    setInputCalculator( inputCalculator );
+}
+
+//! Function to create a copy of the atmosphere model that can be evaluated independently of this object.
+boost::shared_ptr< AtmosphereModel > NRLMSISE00Atmosphere::createIndependentCopy( )
+{
+    boost::shared_ptr< NRLMSISE00Atmosphere > copiedAtmosphere = boost::make_shared< NRLMSISE00Atmosphere >( *this );
+    if( inputCalculator_ != NULL )
+    {
+        copiedAtmosphere->setInputCalculator( inputCalculator_->createIndependentCopy( ) );
+    }
+    return copiedAtmosphere;
+}
+
+//! Function to set the calculator of the model input, and the input functions that use it.
+void NRLMSISE00Atmosphere::setInputCalculator( const boost::shared_ptr< NRLMSISE00InputCalculator > inputCalculator )
+{
+    if( inputCalculator == NULL )
+    {
+        throw std::runtime_error( "Error when setting NRLMSISE00 input calculator, no calculator provided" );
+    }
+
+    inputCalculator_ = inputCalculator;
+    nrlmsise00InputFunction_ =
+            boost::bind( &NRLMSISE00InputCalculator::getInput, inputCalculator_, _1, _2, _3, _4 );
+    nrlmsise00InputUpdateFunction_ =
+            boost::bind( &NRLMSISE00InputCalculator::updateInput, inputCalculator_, _1, _2, _3, _4, _5 );
+}
+
+//! Compute the local atmospheric properties.
+NRLMSISE00Properties NRLMSISE00Atmosphere::computeProperties(
         const double altitude, const double longitude,
         const double latitude, const double time )
 {
-    // Compute the hash key
-    size_t hashKey = hashFunc( altitude, longitude, latitude, time );
+    // Check if properties at current point have already been computed, starting from most recently requested point.
+    for( unsigned int i = 0; i < numberOfCachedProperties_; i++ )
+    {
+        unsigned int currentIndex = ( currentCachedPropertiesIndex_ + cachedProperties_.size( ) - i ) %
+                cachedProperties_.size( );
+        const boost::array< double, 4 >& currentIndependentVariables = cachedIndependentVariables_[ currentIndex ];
+        if( currentIndependentVariables[ 0 ] == altitude && currentIndependentVariables[ 1 ] == longitude &&
+                currentIndependentVariables[ 2 ] == latitude && currentIndependentVariables[ 3 ] == time )
+        {
+            currentCachedPropertiesIndex_ = currentIndex;
+            return cachedProperties_[ currentIndex ];
+        }
+    }
 
-    // If hash key is same do nothing
-    if (hashKey == hashKey_)
+    // Select cache entry in which to store new properties (overwriting oldest entry if cache is full).
+    currentCachedPropertiesIndex_ = nextCachedPropertiesIndex_;
+    nextCachedPropertiesIndex_ = ( nextCachedPropertiesIndex_ + 1 ) % cachedProperties_.size( );
+    if( numberOfCachedProperties_ < cachedProperties_.size( ) )
     {
-        return;
+        numberOfCachedProperties_++;
     }
-    hashKey_ = hashKey;
 
-    // Retrieve input data.
-    inputData_ = nrlmsise00InputFunction_(
-                altitude, longitude, latitude, time );
-    std::copy( inputData_.apVector.begin( ), inputData_.apVector.end( ), aph_.a );
-    std::copy( inputData_.switches.begin( ), inputData_.switches.end( ), flags_.switches);
+    boost::array< double, 4 >& independentVariables = cachedIndependentVariables_[ currentCachedPropertiesIndex_ ];
+    independentVariables[ 0 ] = altitude;
+    independentVariables[ 1 ] = longitude;
+    independentVariables[ 2 ] = latitude;
+    independentVariables[ 3 ] = time;
+    NRLMSISE00Properties& properties = cachedProperties_[ currentCachedPropertiesIndex_ ];
+
+    // Retrieve input data (in place, if possible).
+    if( !nrlmsise00InputUpdateFunction_.empty( ) )
+    {
+        nrlmsise00InputUpdateFunction_( properties.inputData, altitude, longitude, latitude, time );
+    }
+    else
+    {
+        properties.inputData = nrlmsise00InputFunction_(
+                    altitude, longitude, latitude, time );
+    }
+
+    // Copy magnetic index data (NRLMSISE00 uses at most 7 values).
+    const std::size_t numberOfApValues = std::min(
+                properties.inputData.apVector.size( ), sizeof( aph_.a ) / sizeof( aph_.a[ 0 ] ) );
+    std::copy( properties.inputData.apVector.begin( ), properties.inputData.apVector.begin( ) + numberOfApValues,
+               aph_.a );
+    std::copy( properties.inputData.switches.begin( ), properties.inputData.switches.end( ), flags_.switches);
 
     input_.g_lat  = latitude * 180.0 / mathematical_constants::PI; // rad to deg
     input_.g_long = longitude * 180.0 / mathematical_constants::PI; // rad to deg
     input_.alt    = altitude * 1.0E-3; // m to km
-    input_.year   = inputData_.year;
-    input_.doy    = inputData_.dayOfTheYear;
-    input_.sec    = inputData_.secondOfTheDay;
-    input_.lst    = inputData_.localSolarTime;
-    input_.f107   = inputData_.f107;
-    input_.f107A  = inputData_.f107a;
-    input_.ap     = inputData_.apDaily;
+    input_.year   = properties.inputData.year;
+    input_.doy    = properties.inputData.dayOfTheYear;
+    input_.sec    = properties.inputData.secondOfTheDay;
+    input_.lst    = properties.inputData.localSolarTime;
+    input_.f107   = properties.inputData.f107;
+    input_.f107A  = properties.inputData.f107a;
+    input_.ap     = properties.inputData.apDaily;
     input_.ap_a   = &aph_;
 
     // Call NRLMSISE00
-    gtd7(&input_, &flags_, &output_);
+    nrlmsise_output& output = properties.output;
+    {
+        std::lock_guard< std::mutex > nrlmsise00EvaluationLock( nrlmsise00EvaluationMutex );
+        gtd7(&input_, &flags_, &output);
+    }
 
     // Retrieve density and temperature
-    density_ = output_.d[ 5 ] * 1000.0; // GM/CM3 to kg/M3
-    temperature_ = output_.t[1];
+    properties.density = output.d[ 5 ] * 1000.0; // GM/CM3 to kg/M3
+    properties.temperature = output.t[1];
 
     // Get number densities
-    numberDensities_.resize(8);
-    numberDensities_[0] = output_.d[0] * 1.0E6 ; // HE NUMBER DENSITY    (M-3)
-    numberDensities_[1] = output_.d[1] * 1.0E6 ; // O NUMBER DENSITY     (M-3)
-    numberDensities_[2] = output_.d[2] * 1.0E6 ; // N2 NUMBER DENSITY    (M-3)
-    numberDensities_[3] = output_.d[3] * 1.0E6 ; // O2 NUMBER DENSITY    (M-3)
-    numberDensities_[4] = output_.d[4] * 1.0E6 ; // AR NUMBER DENSITY    (M-3)
-    numberDensities_[5] = output_.d[6] * 1.0E6 ; // H NUMBER DENSITY     (M-3)
-    numberDensities_[6] = output_.d[7] * 1.0E6 ; // N NUMBER DENSITY     (M-3)
-    numberDensities_[7] = output_.d[8] * 1.0E6 ; // Anomalous oxygen NUMBER DENSITY  (M-3)
+    std::vector< double >& numberDensities = properties.numberDensities;
+    numberDensities.resize(8);
+    numberDensities[0] = output.d[0] * 1.0E6 ; // HE NUMBER DENSITY    (M-3)
+    numberDensities[1] = output.d[1] * 1.0E6 ; // O NUMBER DENSITY     (M-3)
+    numberDensities[2] = output.d[2] * 1.0E6 ; // N2 NUMBER DENSITY    (M-3)
+    numberDensities[3] = output.d[3] * 1.0E6 ; // O2 NUMBER DENSITY    (M-3)
+    numberDensities[4] = output.d[4] * 1.0E6 ; // AR NUMBER DENSITY    (M-3)
+    numberDensities[5] = output.d[6] * 1.0E6 ; // H NUMBER DENSITY     (M-3)
+    numberDensities[6] = output.d[7] * 1.0E6 ; // N NUMBER DENSITY     (M-3)
+    numberDensities[7] = output.d[8] * 1.0E6 ; // Anomalous oxygen NUMBER DENSITY  (M-3)
 
     // Get average number density
     double sumOfNumberDensity = 0.0 ;
-    for( unsigned int i = 0 ; i < numberDensities_.size( ) ; i++)
+    for( unsigned int i = 0 ; i < numberDensities.size( ) ; i++)
     {
-        sumOfNumberDensity += numberDensities_[ i ];
+        sumOfNumberDensity += numberDensities[ i ];
     }
-    averageNumberDensity_ = sumOfNumberDensity / double( numberDensities_.size( ) );
+    properties.averageNumberDensity = sumOfNumberDensity / double( numberDensities.size( ) );
 
     // Mean molar mass (Thermodynamics an Engineering Approach, Michael A. Boles)
-    meanMolarMass_ = numberDensities_[0] * gasComponentProperties_.molarMassHelium;
-    meanMolarMass_ += numberDensities_[1] * gasComponentProperties_.molarMassAtomicOxygen;
-    meanMolarMass_ += numberDensities_[2] * gasComponentProperties_.molarMassNitrogen;
-    meanMolarMass_ += numberDensities_[3] * gasComponentProperties_.molarMassOxygen;
-    meanMolarMass_ += numberDensities_[4] * gasComponentProperties_.molarMassArgon;
-    meanMolarMass_ += numberDensities_[5] * gasComponentProperties_.molarMassAtomicHydrogen;
-    meanMolarMass_ += numberDensities_[6] * gasComponentProperties_.molarMassAtomicNitrogen;
-    meanMolarMass_ += numberDensities_[7] * gasComponentProperties_.molarMassOxygen;
-    meanMolarMass_ = meanMolarMass_ / sumOfNumberDensity ;
+    double meanMolarMass = numberDensities[0] * gasComponentProperties_.molarMassHelium;
+    meanMolarMass += numberDensities[1] * gasComponentProperties_.molarMassAtomicOxygen;
+    meanMolarMass += numberDensities[2] * gasComponentProperties_.molarMassNitrogen;
+    meanMolarMass += numberDensities[3] * gasComponentProperties_.molarMassOxygen;
+    meanMolarMass += numberDensities[4] * gasComponentProperties_.molarMassArgon;
+    meanMolarMass += numberDensities[5] * gasComponentProperties_.molarMassAtomicHydrogen;
+    meanMolarMass += numberDensities[6] * gasComponentProperties_.molarMassAtomicNitrogen;
+    meanMolarMass += numberDensities[7] * gasComponentProperties_.molarMassOxygen;
+    properties.meanMolarMass = meanMolarMass / sumOfNumberDensity ;
 
     // Speed of sound
-    speedOfSound_ = aerodynamics::computeSpeedOfSound(
-                temperature_, specificHeatRatio_, molarGasConstant_ / meanMolarMass_ );
+    properties.speedOfSound = aerodynamics::computeSpeedOfSound(
+                properties.temperature, specificHeatRatio_, molarGasConstant_ / properties.meanMolarMass );
 
     // Collision diameter
-    weightedAverageCollisionDiameter_ = numberDensities_[0]* gasComponentProperties_.diameterHelium ;
-    weightedAverageCollisionDiameter_ += numberDensities_[1]* gasComponentProperties_.diameterAtomicOxygen ;
-    weightedAverageCollisionDiameter_ += numberDensities_[2]* gasComponentProperties_.diameterNitrogen ;
-    weightedAverageCollisionDiameter_ += numberDensities_[3]* gasComponentProperties_.diameterOxygen ;
-    weightedAverageCollisionDiameter_ += numberDensities_[4]* gasComponentProperties_.diameterArgon ;
-    weightedAverageCollisionDiameter_ += numberDensities_[5]* gasComponentProperties_.diameterAtomicHydrogen ;
-    weightedAverageCollisionDiameter_ += numberDensities_[6]* gasComponentProperties_.diameterAtomicNitrogen ;
-    weightedAverageCollisionDiameter_ += numberDensities_[7]* gasComponentProperties_.diameterAtomicOxygen ;
-    weightedAverageCollisionDiameter_ = weightedAverageCollisionDiameter_ / sumOfNumberDensity;
+    double weightedAverageCollisionDiameter = numberDensities[0]* gasComponentProperties_.diameterHelium ;
+    weightedAverageCollisionDiameter += numberDensities[1]* gasComponentProperties_.diameterAtomicOxygen ;
+    weightedAverageCollisionDiameter += numberDensities[2]* gasComponentProperties_.diameterNitrogen ;
+    weightedAverageCollisionDiameter += numberDensities[3]* gasComponentProperties_.diameterOxygen ;
+    weightedAverageCollisionDiameter += numberDensities[4]* gasComponentProperties_.diameterArgon ;
+    weightedAverageCollisionDiameter += numberDensities[5]* gasComponentProperties_.diameterAtomicHydrogen ;
+    weightedAverageCollisionDiameter += numberDensities[6]* gasComponentProperties_.diameterAtomicNitrogen ;
+    weightedAverageCollisionDiameter += numberDensities[7]* gasComponentProperties_.diameterAtomicOxygen ;
+    properties.weightedAverageCollisionDiameter = weightedAverageCollisionDiameter / sumOfNumberDensity;
 
     // Mean free path.
-    meanFreePath_ = aerodynamics::computeMeanFreePath( weightedAverageCollisionDiameter_, averageNumberDensity_ );
+    properties.meanFreePath = aerodynamics::computeMeanFreePath(
+                properties.weightedAverageCollisionDiameter, properties.averageNumberDensity );
 
     // Calculate pressure using ideal gas law (Thermodynamics an Engineering Approach, Michael A. Boles)
     if( useIdealGasLaw_ )
     {
-        pressure_ = density_ * molarGasConstant_ * temperature_ / meanMolarMass_ ;
+        properties.pressure = properties.density * molarGasConstant_ * properties.temperature /
+                properties.meanMolarMass ;
     }
     else
     {
-        pressure_ = TUDAT_NAN;
+        properties.pressure = TUDAT_NAN;
     }
+
+    return properties;
 }
 
 //! Overloaded ostream to print class information.
@@ -149,16 +234,56 @@ NRLMSISE00Atmosphere::getFullOutput( const double altitude, const double longitu
                                      const double latitude, const double time )
 {
     // Compute the properties
-    computeProperties( altitude, longitude, latitude, time );
+    const NRLMSISE00Properties properties = computeProperties( altitude, longitude, latitude, time );
+    const nrlmsise_output& modelOutput = properties.output;
     std::pair< std::vector< double >, std::vector< double >> output;
 
     // Copy array members of struct to vectors on the pair.
     output.first = std::vector< double >(
-                output_.d, output_.d + sizeof output_.d / sizeof output_.d[ 0 ] );
+                modelOutput.d, modelOutput.d + sizeof modelOutput.d / sizeof modelOutput.d[ 0 ] );
     output.second = std::vector< double >(
-                output_.t, output_.t + sizeof output_.t / sizeof output_.t[ 0 ] );
+                modelOutput.t, modelOutput.t + sizeof modelOutput.t / sizeof modelOutput.t[ 0 ] );
     return output;
 }
 
+//! Get the atmospheric properties at a number of points.
+std::vector< NRLMSISE00Properties > NRLMSISE00Atmosphere::getPropertiesAtPoints(
+        const std::vector< double >& altitudes, const std::vector< double >& longitudes,
+        const std::vector< double >& latitudes, const std::vector< double >& times )
+{
+    if( longitudes.size( ) != altitudes.size( ) || latitudes.size( ) != altitudes.size( ) ||
+            times.size( ) != altitudes.size( ) )
+    {
+        throw std::runtime_error( "Error when computing NRLMSISE00 properties at multiple points, input sizes are inconsistent." );
+    }
+
+    std::vector< NRLMSISE00Properties > properties;
+    properties.reserve( altitudes.size( ) );
+    for( unsigned int i = 0; i < altitudes.size( ); i++ )
+    {
+        properties.push_back( computeProperties( altitudes[ i ], longitudes[ i ], latitudes[ i ], times[ i ] ) );
+    }
+    return properties;
+}
+
+//! Get the local density at a number of points.
+std::vector< double > NRLMSISE00Atmosphere::getDensitiesAtPoints(
+        const std::vector< double >& altitudes, const std::vector< double >& longitudes,
+        const std::vector< double >& latitudes, const std::vector< double >& times )
+{
+    if( longitudes.size( ) != altitudes.size( ) || latitudes.size( ) != altitudes.size( ) ||
+            times.size( ) != altitudes.size( ) )
+    {
+        throw std::runtime_error( "Error when computing NRLMSISE00 densities at multiple points, input sizes are inconsistent." );
+    }
+
+    std::vector< double > densities( altitudes.size( ) );
+    for( unsigned int i = 0; i < altitudes.size( ); i++ )
+    {
+        densities[ i ] = computeProperties( altitudes[ i ], longitudes[ i ], latitudes[ i ], times[ i ] ).density;
+    }
+    return densities;
+}
+
 }  // namespace aerodynamics
 }  // namespace tudat
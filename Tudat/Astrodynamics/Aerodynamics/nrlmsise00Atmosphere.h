@@ -15,9 +15,11 @@
 #include <utility>
 #include <cmath>
 #include <algorithm>
+#include <stdexcept>
 
+#include <boost/array.hpp>
 #include <boost/function.hpp>
-#include <boost/functional/hash.hpp>
+#include <boost/shared_ptr.hpp>
 
 #include "Tudat/Astrodynamics/BasicAstrodynamics/physicalConstants.h"
 #include "Tudat/Astrodynamics/Aerodynamics/atmosphereModel.h"
@@ -36,6 +38,8 @@ namespace tudat
 namespace aerodynamics
 {
 
+class NRLMSISE00InputCalculator;
+
 //! Gas component properties data structure
 /*!
  * This data structure contains the molar mass and collision diameter of
@@ -171,6 +175,88 @@ struct NRLMSISE00Input
     std::vector< int > switches;
 };
 
+//! Atmospheric properties computed by the NRLMSISE00 atmosphere model at a single point.
+/*!
+ * Atmospheric properties computed by the NRLMSISE00 atmosphere model at a single (altitude, longitude, latitude, time),
+ * consisting of the direct model in- and output, as well as the derived properties used by the getter functions of
+ * the NRLMSISE00Atmosphere class.
+ */
+struct NRLMSISE00Properties
+{
+    //! Default constructor, sets all properties to NaN.
+    NRLMSISE00Properties( ):
+        density( TUDAT_NAN ), temperature( TUDAT_NAN ), pressure( TUDAT_NAN ), speedOfSound( TUDAT_NAN ),
+        meanFreePath( TUDAT_NAN ), numberDensities( 8, TUDAT_NAN ), averageNumberDensity( TUDAT_NAN ),
+        weightedAverageCollisionDiameter( TUDAT_NAN ), meanMolarMass( TUDAT_NAN )
+    { }
+
+    //! Input data to NRLMSISE00 atmosphere model, as retrieved from the input function.
+    NRLMSISE00Input inputData;
+
+    //! Ouput structure of densities (9d) and temperature (2d) arrays, as computed by NRLMSISE00 (gtd7 function).
+    /*!
+     *  Ouput structure of densities (9d) and temperature (2d) arrays:
+     *      d[0] - HE NUMBER DENSITY(CM-3)
+     *      d[1] - O NUMBER DENSITY(CM-3)
+     *      d[2] - N2 NUMBER DENSITY(CM-3)
+     *      d[3] - O2 NUMBER DENSITY(CM-3)
+     *      d[4] - AR NUMBER DENSITY(CM-3)                       
+     *      d[5] - TOTAL MASS DENSITY(GM/CM3) [includes d[8] in td7d]
+     *      d[6] - H NUMBER DENSITY(CM-3)
+     *      d[7] - N NUMBER DENSITY(CM-3)
+     *      d[8] - Anomalous oxygen NUMBER DENSITY(CM-3)
+     *      t[0] - EXOSPHERIC TEMPERATURE
+     *      t[1] - TEMPERATURE AT ALT
+     * 
+     *
+     *      O, H, and N are set to zero below 72.5 km
+     *
+     *      t[0], Exospheric temperature, is set to global average for
+     *      altitudes below 120 km. The 120 km gradient is left at global
+     *      average value for altitudes below 72 km.
+     *
+     *      d[5], TOTAL MASS DENSITY, is NOT the same for subroutines GTD7 
+     *      and GTD7D
+     *
+     *        SUBROUTINE GTD7 -- d[5] is the sum of the mass densities of the
+     *        species labeled by indices 0-4 and 6-7 in output variable d.
+     *        This includes He, O, N2, O2, Ar, H, and N but does NOT include
+     *        anomalous oxygen (species index 8).
+     *
+     *        SUBROUTINE GTD7D -- d[5] is the "effective total mass density
+     *        for drag" and is the sum of the mass densities of all species
+     *        in this model, INCLUDING anomalous oxygen.
+     */
+    nrlmsise_output output;
+
+    //! Local density (kg/m3)
+    double density;
+
+    //! Local temperature (K)
+    double temperature;
+
+    //! Local pressure (Implemented with ideal gass law only!)
+    double pressure;
+
+    //! Speed of sound (m/s)
+    double speedOfSound;
+
+    //! Mean free path (m)
+    double meanFreePath;
+
+    //! Number densities of gas components (M-3), in the order He, O, N2, O2, Ar, H, N, anomalous O
+    std::vector< double > numberDensities;
+
+    //! Average number density (M-3)
+    double averageNumberDensity;
+
+    //! Weighted average of the collision diameter using the number density as weights in (M)
+    double weightedAverageCollisionDiameter;
+
+    //! Mean molar mass (kg/mole)
+    double meanMolarMass;
+};
+
 //! NRLMSISE-00 atmosphere model class.
 /*!
  *  NRLMSISE-00 atmosphere model class. This class uses the NRLMSISE00 atmosphere model to calculate atmospheric
@@ -178,6 +264,13 @@ struct NRLMSISE00Input
  *  exosphere.
  *  Currently the ideal gas law is used to compute the speed of sound.
  *  The specific heat ratio is assumed to be constant and equal to 1.4.
+ *  The properties computed for the most recently requested (altitude, longitude, latitude, time) inputs are stored in
+ *  a small cache, so that repeated evaluations at the same point (e.g. by the various getters called by the
+ *  FlightConditions, when saving dependent variables, or when computing numerical partials) do not require the
+ *  NRLMSISE00 model to be re-evaluated.
+ *  The NRLMSISE00 implementation that is used stores intermediate results in global variables, so that evaluations of
+ *  the model by different NRLMSISE00Atmosphere objects (e.g. independent copies used on different threads) are
+ *  serialized.
  */
 class NRLMSISE00Atmosphere : public AtmosphereModel
 {
@@ -190,18 +283,38 @@ class NRLMSISE00Atmosphere : public AtmosphereModel
     typedef boost::function< NRLMSISE00Input( double, double, double, double ) >
         NRLMSISE00InputFunction;
 
+    //! NRLMSISEInput update function
+    /*!
+     * Boost function that accepts (input, altitude, longitude, latitude, time ) and fills the NRLMSISEInput data
+     * (first argument, returned by reference).
+     */
+    typedef boost::function< void( NRLMSISE00Input&, double, double, double, double ) >
+        NRLMSISE00InputUpdateFunction;
+
     //! Default constructor.
     /*!
      * Default constructor.
      * \param nrlmsise00InputFunction Function which provides the NRLMSISE00 model input as a function of
      * (altitude, longitude, latitude, time ).
      * \param useIdealGasLaw Variable denoting whether to use the ideal gas law for computation of pressure.
+     * \param nrlmsise00InputUpdateFunction Function which fills an existing NRLMSISE00 model input object as a function
+     * of (altitude, longitude, latitude, time ). If provided, it is used instead of nrlmsise00InputFunction when
+     * computing the atmospheric properties, so that no new input object is created for each evaluation (in which case
+     * nrlmsise00InputFunction may be empty).
      */
     NRLMSISE00Atmosphere( const NRLMSISE00InputFunction nrlmsise00InputFunction,
-                         const bool useIdealGasLaw = true )
-        :nrlmsise00InputFunction_(nrlmsise00InputFunction)
+                         const bool useIdealGasLaw = true,
+                         const NRLMSISE00InputUpdateFunction nrlmsise00InputUpdateFunction =
+            NRLMSISE00InputUpdateFunction( ) )
+        :nrlmsise00InputFunction_(nrlmsise00InputFunction),
+          nrlmsise00InputUpdateFunction_( nrlmsise00InputUpdateFunction )
     {
-        resetHashKey( );
+        if( nrlmsise00InputFunction_.empty( ) && nrlmsise00InputUpdateFunction_.empty( ) )
+        {
+            throw std::runtime_error( "Error when creating NRLMSISE00 atmosphere, no input function provided" );
+        }
+
+        setPropertiesCacheSize( 8 );
         molarGasConstant_ = tudat::physical_constants::MOLAR_GAS_CONSTANT;
         specificHeatRatio_ = 1.4;
         GasComponentProperties gasProperties;
@@ -209,6 +322,17 @@ class NRLMSISE00Atmosphere : public AtmosphereModel
         useIdealGasLaw_ = useIdealGasLaw;
     }
 
+    //! Constructor using a calculator of the model input from solar activity data.
+    /*!
+     * Constructor using a calculator of the model input from solar activity data, which is used to fill the model input
+     * in place. An independent copy of this atmosphere model (see createIndependentCopy) uses its own copy of the
+     * input calculator.
+     * \param inputCalculator Object used to compute the NRLMSISE00 model input from solar activity data.
+     * \param useIdealGasLaw Variable denoting whether to use the ideal gas law for computation of pressure.
+     */
+    NRLMSISE00Atmosphere( const boost::shared_ptr< NRLMSISE00InputCalculator > inputCalculator,
+                          const bool useIdealGasLaw = true );
+
     //! Constructor
     /*!
      * Constructor that sets the gas component properties and specific heat ratio.
@@ -224,7 +348,7 @@ class NRLMSISE00Atmosphere : public AtmosphereModel
                          const bool useIdealGasLaw = true)
         : nrlmsise00InputFunction_(nrlmsise00InputFunction)
     {
-        resetHashKey( );
+        setPropertiesCacheSize( 8 );
         molarGasConstant_ = tudat::physical_constants::MOLAR_GAS_CONSTANT;
         specificHeatRatio_ = specificHeatRatio;
         gasComponentProperties_ = gasProperties;
@@ -240,6 +364,7 @@ class NRLMSISE00Atmosphere : public AtmosphereModel
     void setGasComponentProperties( const GasComponentProperties gasComponentProperties)
     {
         gasComponentProperties_ = gasComponentProperties;
+        resetHashKey( );
     }
 
     //! Get local density.
@@ -254,8 +379,7 @@ class NRLMSISE00Atmosphere : public AtmosphereModel
     double getDensity( const double altitude, const double longitude,
                        const double latitude, const double time )
     {
-        computeProperties( altitude, longitude, latitude, time );
-        return density_;
+        return computeProperties( altitude, longitude, latitude, time ).density;
     }
 
     //! Get local pressure.
@@ -271,15 +395,11 @@ class NRLMSISE00Atmosphere : public AtmosphereModel
     double getPressure( const double altitude, const double longitude,
                         const double latitude, const double time )
     {
-        if( useIdealGasLaw_ )
-        {
-            computeProperties( altitude, longitude, latitude, time );
-        }
-        else
+        if( !useIdealGasLaw_ )
         {
             throw std::runtime_error( "Error, non-ideal gas-law pressure-computation not yet implemented in NRLMSISE00Atmosphere." );
         }
-        return pressure_;
+        return computeProperties( altitude, longitude, latitude, time ).pressure;
     }
 
     //! Get local temperature.
@@ -294,8 +414,7 @@ class NRLMSISE00Atmosphere : public AtmosphereModel
     double getTemperature( const double altitude, const double longitude,
                            const double latitude, const double time )
     {
-        computeProperties( altitude, longitude, latitude, time );
-        return temperature_;
+        return computeProperties( altitude, longitude, latitude, time ).temperature;
     }
 
     //! Get local speed of sound.
@@ -310,8 +429,7 @@ class NRLMSISE00Atmosphere : public AtmosphereModel
     double getSpeedOfSound( const double altitude, const double longitude,
                           const double latitude, const double time )
     {
-        computeProperties(altitude, longitude, latitude, time );
-        return speedOfSound_;
+        return computeProperties( altitude, longitude, latitude, time ).speedOfSound;
     }
 
     //! Get local mean free path.
@@ -326,8 +444,7 @@ class NRLMSISE00Atmosphere : public AtmosphereModel
     double getMeanFreePath( const double altitude, const double longitude,
                           const double latitude, const double time )
     {
-        computeProperties(altitude, longitude, latitude, time );
-        return meanFreePath_;
+        return computeProperties( altitude, longitude, latitude, time ).meanFreePath;
     }
 
     //! Get local mean molar mass.
@@ -342,8 +459,7 @@ class NRLMSISE00Atmosphere : public AtmosphereModel
     double getMeanMolarMass( const double altitude, const double longitude,
                           const double latitude, const double time )
     {
-        computeProperties(altitude, longitude, latitude, time );
-        return meanMolarMass_;
+        return computeProperties( altitude, longitude, latitude, time ).meanMolarMass;
     }
 
     //! get local number density of the gas components.
@@ -358,8 +474,7 @@ class NRLMSISE00Atmosphere : public AtmosphereModel
     std::vector< double > getNumberDensities( const double altitude, const double longitude,
                                            const double latitude, const double time )
     {
-        computeProperties( altitude, longitude, latitude, time );
-        return numberDensities_;
+        return computeProperties( altitude, longitude, latitude, time ).numberDensities;
     }
 
     //! Get local average number density.
@@ -374,8 +489,7 @@ class NRLMSISE00Atmosphere : public AtmosphereModel
     double getAverageNumberDensity( const double altitude, const double longitude,
                           const double latitude, const double time )
     {
-        computeProperties(altitude, longitude, latitude, time );
-        return averageNumberDensity_;
+        return computeProperties( altitude, longitude, latitude, time ).averageNumberDensity;
     }
 
     //! Get local weighted average collision diameter.
@@ -390,8 +504,7 @@ class NRLMSISE00Atmosphere : public AtmosphereModel
     double getWeightedAverageCollisionDiameter( const double altitude, const double longitude,
                           const double latitude, const double time )
     {
-        computeProperties(altitude, longitude, latitude, time );
-        return weightedAverageCollisionDiameter_;
+        return computeProperties( altitude, longitude, latitude, time ).weightedAverageCollisionDiameter;
     }
 
     //! Get the full model output
@@ -409,74 +522,131 @@ class NRLMSISE00Atmosphere : public AtmosphereModel
         const double altitude, const double longitude,
         const double latitude, const double time );
 
+    //! Get the atmospheric properties at a number of points.
+    /*!
+     * Gets the full atmospheric properties at a list of points, with each point defined by the entries at the same
+     * index in the input vectors. Points that are already present in the cache of previously computed properties
+     * are not re-evaluated.
+     * \param altitudes Altitudes at which properties are to be computed [m].
+     * \param longitudes Longitudes at which properties are to be computed [rad].
+     * \param latitudes Latitudes at which properties are to be computed [rad].
+     * \param times Times at which properties are to be computed (seconds since J2000).
+     * \return Atmospheric properties at each of the points.
+     */
+    std::vector< NRLMSISE00Properties > getPropertiesAtPoints(
+            const std::vector< double >& altitudes, const std::vector< double >& longitudes,
+            const std::vector< double >& latitudes, const std::vector< double >& times );
+
+    //! Get the local density at a number of points.
+    /*!
+     * Gets the local density at a list of points, with each point defined by the entries at the same index in the
+     * input vectors (\sa getPropertiesAtPoints).
+     * \param altitudes Altitudes at which density is to be computed [m].
+     * \param longitudes Longitudes at which density is to be computed [rad].
+     * \param latitudes Latitudes at which density is to be computed [rad].
+     * \param times Times at which density is to be computed (seconds since J2000).
+     * \return Atmospheric densities at each of the points [kg/m^3].
+     */
+    std::vector< double > getDensitiesAtPoints(
+            const std::vector< double >& altitudes, const std::vector< double >& longitudes,
+            const std::vector< double >& latitudes, const std::vector< double >& times );
+
     //! Reset the hash key
     /*!
      * Resets the hash key, this allows re-computation even if the
      * independent parameters haven't changed. Such as in the case of
-     * changes to the model.
+     * changes to the model. All previously computed properties are
+     * removed from the cache.
      */
     void resetHashKey( )
     {
-        hashKey_ = 0;
+        numberOfCachedProperties_ = 0;
+        nextCachedPropertiesIndex_ = 0;
+        currentCachedPropertiesIndex_ = 0;
+    }
+
+    //! Function to set the number of evaluations of the model that are cached.
+    /*!
+     * Function to set the number of evaluations of the model that are cached. Calling this function clears the
+     * cache (\sa resetHashKey).
+     * \param propertiesCacheSize Number of most recent evaluations that are stored (must be at least 1).
+     */
+    void setPropertiesCacheSize( const unsigned int propertiesCacheSize )
+    {
+        if( propertiesCacheSize == 0 )
+        {
+            throw std::runtime_error( "Error, cache size of NRLMSISE00Atmosphere must be at least 1." );
+        }
+        cachedProperties_.resize( propertiesCacheSize );
+        cachedIndependentVariables_.resize( propertiesCacheSize );
+        resetHashKey( );
+    }
+
+    //! Function to get the number of evaluations of the model that are cached.
+    /*!
+     * Function to get the number of evaluations of the model that are cached.
+     * \return Number of most recent evaluations that are stored.
+     */
+    unsigned int getPropertiesCacheSize( )
+    {
+        return cachedProperties_.size( );
     }
 
     //! Function to get  Input data to NRLMSISE00 atmosphere model
     /*!
-     *  Function to get input data to NRLMSISE00 atmosphere model
+     *  Function to get input data to NRLMSISE00 atmosphere model, as used in the most recent evaluation.
      *  \return Input data to NRLMSISE00 atmosphere model
      */
     NRLMSISE00Input getNRLMSISE00Input( )
     {
-        return inputData_;
+        if( numberOfCachedProperties_ == 0 )
+        {
+            return NRLMSISE00Input( );
+        }
+        return cachedProperties_.at( currentCachedPropertiesIndex_ ).inputData;
     }
 
- private:
-
-    //! Shared pointer to solar activity function
-    NRLMSISE00InputFunction nrlmsise00InputFunction_;
-
-    //! Use the ideal gas law for the computation of the pressure.
-    bool useIdealGasLaw_;
-
-    //! Current key hash
-    size_t hashKey_;
-
-    //!  Current local density (kg/m3)
-    double density_;
-
-    //! Current local temperature (K)
-    double temperature_;
-
-    //! Current local pressure (Implemented with ideal gass law only!)
-    double pressure_;
+    //! Function to retrieve the calculator of the model input from solar activity data.
+    /*!
+     * Function to retrieve the calculator of the model input from solar activity data (NULL if the input functions
+     * were provided directly).
+     * \return Calculator of the model input from solar activity data.
+     */
+    boost::shared_ptr< NRLMSISE00InputCalculator > getInputCalculator( )
+    {
+        return inputCalculator_;
+    }
 
-    //! Current speed of sound (m/s)
-    double speedOfSound_;
+    //! Function to create a copy of the atmosphere model that can be evaluated independently of this object.
+    /*!
+     * Function to create a copy of the atmosphere model that can be evaluated independently of this object, with its
+     * own cache of computed properties. If the model was created from an NRLMSISE00InputCalculator, the copy uses an
+     * independent copy of the input calculator. Input functions that were provided directly are shared with the copy,
+     * and must therefore be safe to evaluate concurrently when the copies are used on different threads.
+     * \return Copy of the atmosphere model that can be evaluated independently of this object.
+     */
+    boost::shared_ptr< AtmosphereModel > createIndependentCopy( );
 
-    //! Current mean free path (m)
-    double meanFreePath_;
+ private:
 
+    //! Function to set the calculator of the model input, and the input functions that use it.
     /*!
-     *  Current number densities of gas components
-     *      numberDensities_[0] - HE NUMBER DENSITY     (M-3)
-     *      numberDensities_[1] - O NUMBER DENSITY      (M-3)
-     *      numberDensities_[2] - N2 NUMBER DENSITY     (M-3)
-     *      numberDensities_[3] - O2 NUMBER DENSITY     (M-3)
-     *      numberDensities_[4] - AR NUMBER DENSITY     (M-3)
-     *      numberDensities_[5] - H NUMBER DENSITY      (M-3)
-     *      numberDensities_[6] - N NUMBER DENSITY      (M-3)
-     *      numberDensities_[7] - Anomalous oxygen NUMBER DENSITY   (M-3)
+     * Function to set the calculator of the model input, and the input functions that use it.
+     * \param inputCalculator Object used to compute the NRLMSISE00 model input from solar activity data.
      */
-    std::vector< double > numberDensities_;
+    void setInputCalculator( const boost::shared_ptr< NRLMSISE00InputCalculator > inputCalculator );
 
-    //! Current average number density (M-3)
-    double averageNumberDensity_;
+    //! Calculator of the model input from solar activity data (NULL if input functions were provided directly).
+    boost::shared_ptr< NRLMSISE00InputCalculator > inputCalculator_;
 
-    //! Current weighted average of the collision diameter using the number density as weights in (M)
-    double weightedAverageCollisionDiameter_;
+    //! Shared pointer to solar activity function
+    NRLMSISE00InputFunction nrlmsise00InputFunction_;
+
+    //! Function to fill an existing input object (used instead of nrlmsise00InputFunction_ if not empty).
+    NRLMSISE00InputUpdateFunction nrlmsise00InputUpdateFunction_;
 
-    //! mean molar mass (kg/mole)
-    double meanMolarMass_;
+    //! Use the ideal gas law for the computation of the pressure.
+    bool useIdealGasLaw_;
 
     //! Data structure that contains the colision diameter
     GasComponentProperties gasComponentProperties_;
@@ -522,61 +692,20 @@ class NRLMSISE00Atmosphere : public AtmosphereModel
      */
     nrlmsise_input input_;
 
-    //! Ouput structure of densities (9d) and temperature (2d) arrays.
-    /*!
-     *  Ouput structure of densities (9d) and temperature (2d) arrays:
-     *      d[0] - HE NUMBER DENSITY(CM-3)
-     *      d[1] - O NUMBER DENSITY(CM-3)
-     *      d[2] - N2 NUMBER DENSITY(CM-3)
-     *      d[3] - O2 NUMBER DENSITY(CM-3)
-     *      d[4] - AR NUMBER DENSITY(CM-3)                       
-     *      d[5] - TOTAL MASS DENSITY(GM/CM3) [includes d[8] in td7d]
-     *      d[6] - H NUMBER DENSITY(CM-3)
-     *      d[7] - N NUMBER DENSITY(CM-3)
-     *      d[8] - Anomalous oxygen NUMBER DENSITY(CM-3)
-     *      t[0] - EXOSPHERIC TEMPERATURE
-     *      t[1] - TEMPERATURE AT ALT
-     * 
-     *
-     *      O, H, and N are set to zero below 72.5 km
-     *
-     *      t[0], Exospheric temperature, is set to global average for
-     *      altitudes below 120 km. The 120 km gradient is left at global
-     *      average value for altitudes below 72 km.
-     *
-     *      d[5], TOTAL MASS DENSITY, is NOT the same for subroutines GTD7 
-     *      and GTD7D
-     *
-     *        SUBROUTINE GTD7 -- d[5] is the sum of the mass densities of the
-     *        species labeled by indices 0-4 and 6-7 in output variable d.
-     *        This includes He, O, N2, O2, Ar, H, and N but does NOT include
-     *        anomalous oxygen (species index 8).
-     *
-     *        SUBROUTINE GTD7D -- d[5] is the "effective total mass density
-     *        for drag" and is the sum of the mass densities of all species
-     *        in this model, INCLUDING anomalous oxygen.
-     */
-    nrlmsise_output output_;
+    //! List of (altitude, longitude, latitude, time) of the most recent evaluations of the model.
+    std::vector< boost::array< double, 4 > > cachedIndependentVariables_;
 
-    //! Get Hash Key.
-    /*!
-     * Returns hash key value based on a vector of keys
-     * \param altitude Altitude [m].
-     * \param longitude Longitude [rad].
-     * \param latitude Latitude [rad].
-     * \param time time.
-     * \return hash key value.
-     */
-    size_t hashFunc( const double altitude, const double longitude,
-                     const double latitude, const double time )
-    {
-        size_t seed = 0;
-        boost::hash_combine( seed, boost::hash< double >( )( altitude ) );
-        boost::hash_combine( seed, boost::hash< double >( )( longitude ) );
-        boost::hash_combine( seed, boost::hash< double >( )( latitude ) );
-        boost::hash_combine( seed, boost::hash< double >( )( time ) );
-        return seed;
-    }
+    //! Atmospheric properties of the most recent evaluations of the model (at same index in cachedIndependentVariables_)
+    std::vector< NRLMSISE00Properties > cachedProperties_;
+
+    //! Number of entries of cachedProperties_ that contain a computed value.
+    unsigned int numberOfCachedProperties_;
+
+    //! Index in cachedProperties_ at which the next newly computed value is to be stored.
+    unsigned int nextCachedPropertiesIndex_;
+
+    //! Index in cachedProperties_ of the most recently requested value.
+    unsigned int currentCachedPropertiesIndex_;
 
     //! Compute the local atmospheric properties.
     /*!
@@ -585,12 +714,11 @@ class NRLMSISE00Atmosphere : public AtmosphereModel
     * \param longitude Longitude at which output is to be computed [rad].
     * \param latitude Latitude at which output is to be computed [rad].
     * \param time Time at which output is to be computed (seconds since J2000).
+     * \return Atmospheric properties at the requested point (copy of entry in cache, which may be overwritten by
+     * subsequent calls)
      */
-    void computeProperties( const double altitude, const double longitude,
-                            const double latitude, const double time );
-
-    //! Input data to NRLMSISE00 atmosphere model
-    NRLMSISE00Input inputData_;
+    NRLMSISE00Properties computeProperties( const double altitude, const double longitude,
+                                            const double latitude, const double time );
 };
 
 }  // namespace aerodynamics
@@ -49,13 +49,14 @@ NRLMSISE00Input nrlmsiseInputFunction( const double altitude, const double longi
     double julianDay = std::floor( julianDate - 0.5 ) + 0.5;
 
     // Check if solar activity is found for current day.
-    if( solarActivityMap.count( julianDay ) == 0 )
+    SolarActivityDataMap::const_iterator solarActivityIterator = solarActivityMap.find( julianDay );
+    if( solarActivityIterator == solarActivityMap.end( ) )
     {
         std::string errorMessage = "Solar activity data could not be found for this julian date: "
                 + std::to_string( julianDay ) + " in nrlmsiseInputFunction";
         throw std::runtime_error( errorMessage );
     }
-    SolarActivityDataPtr solarActivity = solarActivityMap.at( julianDay );
+    SolarActivityDataPtr solarActivity = solarActivityIterator->second;
 
 
     // Compute julian date at the first of januari
@@ -96,5 +97,71 @@ NRLMSISE00Input nrlmsiseInputFunction( const double altitude, const double longi
     return nrlmsiseInputData;
 }
 
+//! Function to compute the NRLMSISE00 input, filling an existing input object.
+void NRLMSISE00InputCalculator::updateInput( NRLMSISE00Input& nrlmsiseInputData,
+                                             const double altitude, const double longitude,
+                                             const double latitude, const double time )
+{
+    // Julian dates
+    double julianDate = tudat::basic_astrodynamics::convertSecondsSinceEpochToJulianDay(
+                time, basic_astrodynamics::JULIAN_DAY_ON_J2000 );
+    double julianDay = std::floor( julianDate - 0.5 ) + 0.5;
+
+    // Retrieve solar activity, if day has changed since previous call.
+    if( !( julianDay == currentJulianDay_ ) )
+    {
+        updateDailyData( julianDay );
+    }
+
+    nrlmsiseInputData.year = currentSolarActivity_->year;
+    nrlmsiseInputData.dayOfTheYear = currentSolarActivity_->dayOfTheYear;
+    nrlmsiseInputData.secondOfTheDay = time - currentDayStartTime_;
+
+    if( currentSolarActivity_->fluxQualifier == 1 )
+    { // requires adjustment
+        nrlmsiseInputData.f107 = currentSolarActivity_->solarRadioFlux107Adjusted;
+        nrlmsiseInputData.f107a = currentSolarActivity_->centered81DaySolarRadioFlux107Adjusted;
+    }
+    else
+    { // no adjustment required
+        nrlmsiseInputData.f107 = currentSolarActivity_->solarRadioFlux107Observed;
+        nrlmsiseInputData.f107a = currentSolarActivity_->centered81DaySolarRadioFlux107Observed;
+    }
+    nrlmsiseInputData.apDaily = currentSolarActivity_->planetaryEquivalentAmplitudeAverage;
+    nrlmsiseInputData.apVector.assign(
+                currentSolarActivity_->planetaryEquivalentAmplitudes,
+                currentSolarActivity_->planetaryEquivalentAmplitudes + 8 );
+
+    // Compute local solar time
+    // Hrs since begin of the day at longitude 0 (GMT) + Hrs passed at current longitude
+    if( adjustSolarTime_ )
+    {
+        nrlmsiseInputData.localSolarTime = localSolarTime_;
+    }
+    else
+    {
+        nrlmsiseInputData.localSolarTime = nrlmsiseInputData.secondOfTheDay / 3600.0
+                + longitude / ( tudat::mathematical_constants::PI / 12.0 );
+    }
+}
+
+//! Function to retrieve and store the solar activity data of a given day.
+void NRLMSISE00InputCalculator::updateDailyData( const double julianDay )
+{
+    const input_output::solar_activity::SolarActivityTableEntry* solarActivity =
+            solarActivityTable_->getEntry( julianDay );
+    if( solarActivity == NULL )
+    {
+        std::string errorMessage = "Solar activity data could not be found for this julian date: "
+                + std::to_string( julianDay ) + " in NRLMSISE00InputCalculator";
+        throw std::runtime_error( errorMessage );
+    }
+
+    currentSolarActivity_ = solarActivity;
+    currentDayStartTime_ = tudat::basic_astrodynamics::convertJulianDayToSecondsSinceEpoch(
+                julianDay, tudat::basic_astrodynamics::JULIAN_DAY_ON_J2000 );
+    currentJulianDay_ = julianDay;
+}
+
 }  // namespace aerodynamics
 }  // namespace tudat
@@ -14,8 +14,12 @@
 #include <vector>
 #include <cmath>
 
+#include <boost/make_shared.hpp>
+#include <boost/shared_ptr.hpp>
+
 #include "Tudat/Astrodynamics/Aerodynamics/nrlmsise00Atmosphere.h"
 #include "Tudat/InputOutput/solarActivityData.h"
+#include "Tudat/InputOutput/solarActivityTable.h"
 
 
 namespace tudat
@@ -44,6 +48,115 @@ NRLMSISE00Input nrlmsiseInputFunction( const double altitude, const double longi
                                        const tudat::input_output::solar_activity::SolarActivityDataMap& solarActivityMap,
                                        const bool adjustSolarTime = false, const double localSolarTime = 0.0 );
 
+//! Class to compute the input for the NRLMSISE00 model from a table of daily solar activity data.
+/*!
+ * Class to compute the input for the NRLMSISE00 model from a table of daily solar activity data, providing the same
+ * input as the nrlmsiseInputFunction function. The solar activity of a given day is retrieved from the table by direct
+ * indexing, and the values that are constant over a day (solar activity, day of the year and start time of the day)
+ * are stored for the most recently requested day, so that only the time-dependent values are recomputed for
+ * subsequent evaluations on the same day. The input can be filled into an existing NRLMSISE00Input object (see
+ * updateInput), in which case no memory is allocated.
+ */
+class NRLMSISE00InputCalculator
+{
+public:
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param solarActivityTable Table of daily solar activity data.
+     * \param adjustSolarTime Boolean denoting whether the computed local solar time should be overidden with
+     * localSolarTime input.
+     * \param localSolarTime Local solar time that is used when adjustSolarTime is set to true.
+     */
+    NRLMSISE00InputCalculator(
+            const boost::shared_ptr< input_output::solar_activity::SolarActivityTable > solarActivityTable,
+            const bool adjustSolarTime = false, const double localSolarTime = 0.0 ):
+        solarActivityTable_( solarActivityTable ), adjustSolarTime_( adjustSolarTime ),
+        localSolarTime_( localSolarTime ), currentJulianDay_( TUDAT_NAN ), currentDayStartTime_( TUDAT_NAN ),
+        currentSolarActivity_( NULL ){ }
+
+    //! Function to compute the NRLMSISE00 input, filling an existing input object.
+    /*!
+     * Function to compute the NRLMSISE00 input, filling an existing input object (the switches of the input object
+     * are not modified).
+     * \param nrlmsiseInputData Input object that is to be filled (returned by reference).
+     * \param altitude Altitude at which output is to be computed [m].
+     * \param longitude Longitude at which output is to be computed [rad].
+     * \param latitude Latitude at which output is to be computed [rad].
+     * \param time Time at which output is to be computed (seconds since J2000).
+     */
+    void updateInput( NRLMSISE00Input& nrlmsiseInputData,
+                      const double altitude, const double longitude,
+                      const double latitude, const double time );
+
+    //! Function to compute the NRLMSISE00 input.
+    /*!
+     * Function to compute the NRLMSISE00 input, returning a new input object (for use as NRLMSISE00InputFunction).
+     * \param altitude Altitude at which output is to be computed [m].
+     * \param longitude Longitude at which output is to be computed [rad].
+     * \param latitude Latitude at which output is to be computed [rad].
+     * \param time Time at which output is to be computed (seconds since J2000).
+     * \return NRLMSISE00 input at given time and position.
+     */
+    NRLMSISE00Input getInput( const double altitude, const double longitude,
+                              const double latitude, const double time )
+    {
+        NRLMSISE00Input nrlmsiseInputData;
+        updateInput( nrlmsiseInputData, altitude, longitude, latitude, time );
+        return nrlmsiseInputData;
+    }
+
+    //! Function to retrieve the table of daily solar activity data.
+    /*!
+     * Function to retrieve the table of daily solar activity data.
+     * \return Table of daily solar activity data.
+     */
+    boost::shared_ptr< input_output::solar_activity::SolarActivityTable > getSolarActivityTable( )
+    {
+        return solarActivityTable_;
+    }
+
+    //! Function to create a copy of the calculator that can be used independently of this object.
+    /*!
+     * Function to create a copy of the calculator that can be used independently of this object (e.g. on a different
+     * thread), sharing the (read-only) table of solar activity data, but not the data stored for the most recently
+     * requested day.
+     * \return Copy of the calculator that can be used independently of this object.
+     */
+    boost::shared_ptr< NRLMSISE00InputCalculator > createIndependentCopy( )
+    {
+        return boost::make_shared< NRLMSISE00InputCalculator >( solarActivityTable_, adjustSolarTime_, localSolarTime_ );
+    }
+
+private:
+
+    //! Function to retrieve and store the solar activity data of a given day.
+    /*!
+     * Function to retrieve and store the solar activity data of a given day.
+     * \param julianDay Julian day (at 00:00) for which the data is to be retrieved.
+     */
+    void updateDailyData( const double julianDay );
+
+    //! Table of daily solar activity data.
+    boost::shared_ptr< input_output::solar_activity::SolarActivityTable > solarActivityTable_;
+
+    //! Boolean denoting whether the computed local solar time should be overidden with localSolarTime_.
+    bool adjustSolarTime_;
+
+    //! Local solar time that is used when adjustSolarTime_ is set to true.
+    double localSolarTime_;
+
+    //! Julian day (at 00:00) of the most recently requested day.
+    double currentJulianDay_;
+
+    //! Time (seconds since J2000) at the start of the most recently requested day.
+    double currentDayStartTime_;
+
+    //! Solar activity data of the most recently requested day.
+    const input_output::solar_activity::SolarActivityTableEntry* currentSolarActivity_;
+};
+
 }  // namespace aerodynamics
 }  // namespace tudat
 
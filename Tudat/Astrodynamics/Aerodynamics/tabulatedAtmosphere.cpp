@@ -53,6 +53,12 @@ void TabulatedAtmosphere::initialize( const std::string& atmosphereTableFile )
         temperatureData_[ i ] = containerOfAtmosphereTableFileData( i, 3 );
     }
 
+    createInterpolators( );
+}
+
+//! Function to create the interpolators for the density, pressure and temperature from the tabulated data.
+void TabulatedAtmosphere::createInterpolators( )
+{
     using namespace interpolators;
 
     cubicSplineInterpolationForDensity_
@@ -64,5 +70,13 @@ void TabulatedAtmosphere::initialize( const std::string& atmosphereTableFile )
                 altitudeData_, temperatureData_ );
 }
 
+//! Function to create a copy of the atmosphere model that can be evaluated independently of this object.
+boost::shared_ptr< AtmosphereModel > TabulatedAtmosphere::createIndependentCopy( )
+{
+    boost::shared_ptr< TabulatedAtmosphere > copiedAtmosphere = boost::make_shared< TabulatedAtmosphere >( *this );
+    copiedAtmosphere->createInterpolators( );
+    return copiedAtmosphere;
+}
+
 } // namespace aerodynamics
 } // namespace tudat
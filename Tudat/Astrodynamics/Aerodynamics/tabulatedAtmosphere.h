@@ -172,6 +172,14 @@ public:
                     specificGasConstant_ );
     }
 
+    //! Function to create a copy of the atmosphere model that can be evaluated independently of this object.
+    /*!
+     * Function to create a copy of the atmosphere model that can be evaluated independently of this object, with its own
+     * interpolators (which store the most recent look-up position when evaluated).
+     * \return Copy of the atmosphere model, with the same tabulated data.
+     */
+    boost::shared_ptr< AtmosphereModel > createIndependentCopy( );
+
 protected:
 
 private:
@@ -183,6 +191,9 @@ private:
      */
     void initialize( const std::string& atmosphereTableFile );
 
+    //! Function to create the interpolators for the density, pressure and temperature from the tabulated data.
+    void createInterpolators( );
+
     //! The file name of the atmosphere table.
     /*!
      *  The file name of the atmosphere table. The file should contain four columns of data,
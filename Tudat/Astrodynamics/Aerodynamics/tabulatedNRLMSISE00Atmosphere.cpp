@@ -0,0 +1,430 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <stdexcept>
+
+#include <boost/bind.hpp>
+#include <boost/make_shared.hpp>
+
+#include "Tudat/Astrodynamics/Aerodynamics/tabulatedNRLMSISE00Atmosphere.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/physicalConstants.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+
+namespace tudat
+{
+
+namespace aerodynamics
+{
+
+//! Identifier written at the start of binary files containing tabulated NRLMSISE00 atmosphere
+static const char TABULATED_NRLMSISE00_FILE_IDENTIFIER[ 16 ] = "TUDAT_TNRLMSISE";
+
+//! Version of format of binary files containing tabulated NRLMSISE00 atmosphere
+static const std::int32_t TABULATED_NRLMSISE00_FILE_VERSION = 1;
+
+//! Function to return a fixed NRLMSISE00 input, irrespective of the position and time.
+NRLMSISE00Input getFixedNRLMSISE00Input( const double altitude, const double longitude,
+                                         const double latitude, const double time,
+                                         const boost::shared_ptr< NRLMSISE00Input > nrlmsise00Input )
+{
+    return *nrlmsise00Input;
+}
+
+//! Constructor.
+TabulatedNRLMSISE00Atmosphere::TabulatedNRLMSISE00Atmosphere(
+        const NRLMSISE00InputFunction nrlmsise00InputFunction,
+        const std::vector< std::vector< double > >& independentVariableGrid,
+        const int dayOfTheYear,
+        const std::string& tableCacheFile,
+        const double specificHeatRatio ):
+    nrlmsise00InputFunction_( nrlmsise00InputFunction ), independentVariableGrid_( independentVariableGrid ),
+    dayOfTheYear_( dayOfTheYear ), specificHeatRatio_( specificHeatRatio ),
+    molarGasConstant_( physical_constants::MOLAR_GAS_CONSTANT ),
+    currentIndependentVariables_( 5 )
+{
+    // Check input consistency
+    if( independentVariableGrid_.size( ) != 5 )
+    {
+        throw std::runtime_error( "Error when creating tabulated NRLMSISE00 atmosphere, grid must be provided for 5 independent variables, " +
+                                  std::to_string( independentVariableGrid_.size( ) ) + " provided." );
+    }
+    for( unsigned int i = 0; i < independentVariableGrid_.size( ); i++ )
+    {
+        if( independentVariableGrid_.at( i ).size( ) < 2 )
+        {
+            throw std::runtime_error( "Error when creating tabulated NRLMSISE00 atmosphere, grid of independent variable " +
+                                      std::to_string( i ) + " must contain at least 2 values." );
+        }
+        for( unsigned int j = 1; j < independentVariableGrid_.at( i ).size( ); j++ )
+        {
+            if( !( independentVariableGrid_.at( i ).at( j ) > independentVariableGrid_.at( i ).at( j - 1 ) ) )
+            {
+                throw std::runtime_error( "Error when creating tabulated NRLMSISE00 atmosphere, grid of independent variable " +
+                                          std::to_string( i ) + " is not in strictly ascending order." );
+            }
+        }
+    }
+
+    std::fill( currentInputVariables_.begin( ), currentInputVariables_.end( ), TUDAT_NAN );
+
+    // Create NRLMSISE00 model used for evaluation at grid nodes.
+    createTabulationModel( );
+
+    // Retrieve tables from file, or generate them.
+    bool areTablesRead = false;
+    if( tableCacheFile != "" )
+    {
+        areTablesRead = readTablesFromFile( tableCacheFile );
+    }
+
+    if( !areTablesRead )
+    {
+        generateTables( );
+        if( tableCacheFile != "" )
+        {
+            writeTablesToFile( tableCacheFile );
+        }
+    }
+
+    createInterpolators( );
+}
+
+//! Constructor using a calculator of the model input from solar activity data.
+TabulatedNRLMSISE00Atmosphere::TabulatedNRLMSISE00Atmosphere(
+        const boost::shared_ptr< NRLMSISE00InputCalculator > inputCalculator,
+        const std::vector< std::vector< double > >& independentVariableGrid,
+        const int dayOfTheYear,
+        const std::string& tableCacheFile,
+        const double specificHeatRatio ):
+    TabulatedNRLMSISE00Atmosphere(
+        boost::bind( &NRLMSISE00InputCalculator::getInput, inputCalculator, _1, _2, _3, _4 ),
+        independentVariableGrid, dayOfTheYear, tableCacheFile, specificHeatRatio )
+{
+    if( inputCalculator == NULL )
+    {
+        throw std::runtime_error( "Error when creating tabulated NRLMSISE00 atmosphere, no input calculator provided" );
+    }
+    inputCalculator_ = inputCalculator;
+}
+
+//! Function to create a copy of the atmosphere model that can be evaluated independently of this object.
+boost::shared_ptr< AtmosphereModel > TabulatedNRLMSISE00Atmosphere::createIndependentCopy( )
+{
+    // Copy tables and settings, and create models that are modified when being evaluated.
+    boost::shared_ptr< TabulatedNRLMSISE00Atmosphere > copiedAtmosphere =
+            boost::make_shared< TabulatedNRLMSISE00Atmosphere >( *this );
+    copiedAtmosphere->createTabulationModel( );
+    copiedAtmosphere->createInterpolators( );
+
+    if( inputCalculator_ != NULL )
+    {
+        copiedAtmosphere->inputCalculator_ = inputCalculator_->createIndependentCopy( );
+        copiedAtmosphere->nrlmsise00InputFunction_ = boost::bind(
+                    &NRLMSISE00InputCalculator::getInput, copiedAtmosphere->inputCalculator_, _1, _2, _3, _4 );
+    }
+    return copiedAtmosphere;
+}
+
+//! Function to create the NRLMSISE00 model (and its input) used to evaluate the model at the nodes of the grid.
+void TabulatedNRLMSISE00Atmosphere::createTabulationModel( )
+{
+    tabulationInput_ = boost::make_shared< NRLMSISE00Input >( );
+    tabulationModel_ = boost::make_shared< NRLMSISE00Atmosphere >(
+                boost::bind( &getFixedNRLMSISE00Input, _1, _2, _3, _4, tabulationInput_ ) );
+    tabulationModel_->setPropertiesCacheSize( 1 );
+}
+
+//! Function to compute the maximum relative density error of the tabulated model w.r.t. the NRLMSISE00 model.
+double TabulatedNRLMSISE00Atmosphere::computeMaximumRelativeDensityError( const unsigned int cellStride )
+{
+    if( cellStride == 0 )
+    {
+        throw std::runtime_error( "Error when computing error of tabulated NRLMSISE00 atmosphere, cell stride must be at least 1." );
+    }
+
+    const std::vector< std::vector< double > >& grid = independentVariableGrid_;
+    std::vector< double > independentVariables( 5 );
+
+    // Compare tabulated and full model at centres of (sampled) grid cells.
+    double maximumRelativeError = 0.0;
+    for( unsigned int i = 0; i < grid.at( 0 ).size( ) - 1; i += cellStride )
+    {
+        for( unsigned int j = 0; j < grid.at( 1 ).size( ) - 1; j += cellStride )
+        {
+            for( unsigned int k = 0; k < grid.at( 2 ).size( ) - 1; k += cellStride )
+            {
+                for( unsigned int l = 0; l < grid.at( 3 ).size( ) - 1; l += cellStride )
+                {
+                    for( unsigned int m = 0; m < grid.at( 4 ).size( ) - 1; m += cellStride )
+                    {
+                        independentVariables[ 0 ] = 0.5 * ( grid[ 0 ][ i ] + grid[ 0 ][ i + 1 ] );
+                        independentVariables[ 1 ] = 0.5 * ( grid[ 1 ][ j ] + grid[ 1 ][ j + 1 ] );
+                        independentVariables[ 2 ] = 0.5 * ( grid[ 2 ][ k ] + grid[ 2 ][ k + 1 ] );
+                        independentVariables[ 3 ] = 0.5 * ( grid[ 3 ][ l ] + grid[ 3 ][ l + 1 ] );
+                        independentVariables[ 4 ] = 0.5 * ( grid[ 4 ][ m ] + grid[ 4 ][ m + 1 ] );
+
+                        double nrlmsise00Density = evaluateNRLMSISE00Model( independentVariables ).density;
+                        interpolateTables( independentVariables );
+
+                        maximumRelativeError = std::max(
+                                    maximumRelativeError, std::fabs( density_ / nrlmsise00Density - 1.0 ) );
+                    }
+                }
+            }
+        }
+    }
+
+    // Reset current properties, since they no longer correspond to currentInputVariables_
+    std::fill( currentInputVariables_.begin( ), currentInputVariables_.end( ), TUDAT_NAN );
+
+    return maximumRelativeError;
+}
+
+//! Compute the local atmospheric properties.
+void TabulatedNRLMSISE00Atmosphere::computeProperties(
+        const double altitude, const double longitude,
+        const double latitude, const double time )
+{
+    // Check if properties need to be recomputed
+    if( altitude == currentInputVariables_[ 0 ] && longitude == currentInputVariables_[ 1 ] &&
+            latitude == currentInputVariables_[ 2 ] && time == currentInputVariables_[ 3 ] )
+    {
+        return;
+    }
+
+    currentInputVariables_[ 0 ] = altitude;
+    currentInputVariables_[ 1 ] = longitude;
+    currentInputVariables_[ 2 ] = latitude;
+    currentInputVariables_[ 3 ] = time;
+
+    // Retrieve solar activity and local solar time, and interpolate tables.
+    NRLMSISE00Input inputData = nrlmsise00InputFunction_( altitude, longitude, latitude, time );
+    currentIndependentVariables_[ nrlmsise00_altitude_dependent ] = altitude;
+    currentIndependentVariables_[ nrlmsise00_latitude_dependent ] = latitude;
+    currentIndependentVariables_[ nrlmsise00_local_solar_time_dependent ] = inputData.localSolarTime;
+    currentIndependentVariables_[ nrlmsise00_solar_flux_dependent ] = inputData.f107a;
+    currentIndependentVariables_[ nrlmsise00_geomagnetic_index_dependent ] = inputData.apDaily;
+
+    interpolateTables( currentIndependentVariables_ );
+}
+
+//! Function to interpolate the tables at given values of the independent variables.
+void TabulatedNRLMSISE00Atmosphere::interpolateTables( std::vector< double >& independentVariables )
+{
+    // Limit independent variables to tabulated range
+    for( unsigned int i = 0; i < independentVariables.size( ); i++ )
+    {
+        independentVariables[ i ] = std::min( std::max(
+            independentVariables[ i ], independentVariableGrid_[ i ].front( ) ), independentVariableGrid_[ i ].back( ) );
+    }
+
+    density_ = std::exp( logarithmOfDensityInterpolator_->interpolate( independentVariables ) );
+    temperature_ = temperatureInterpolator_->interpolate( independentVariables );
+    meanMolarMass_ = meanMolarMassInterpolator_->interpolate( independentVariables );
+
+    // Compute pressure using ideal gas law, and speed of sound, as in NRLMSISE00Atmosphere
+    pressure_ = density_ * molarGasConstant_ * temperature_ / meanMolarMass_;
+    speedOfSound_ = computeSpeedOfSound( temperature_, specificHeatRatio_, molarGasConstant_ / meanMolarMass_ );
+}
+
+//! Function to evaluate the NRLMSISE00 model at given values of the tabulated independent variables.
+NRLMSISE00Properties TabulatedNRLMSISE00Atmosphere::evaluateNRLMSISE00Model(
+        const std::vector< double >& independentVariables )
+{
+    // Set input, with time and longitude set such that universal time and local solar time coincide.
+    const double localSolarTime = independentVariables[ nrlmsise00_local_solar_time_dependent ];
+    tabulationInput_->dayOfTheYear = dayOfTheYear_;
+    tabulationInput_->secondOfTheDay = localSolarTime * 3600.0;
+    tabulationInput_->localSolarTime = localSolarTime;
+    tabulationInput_->f107 = independentVariables[ nrlmsise00_solar_flux_dependent ];
+    tabulationInput_->f107a = independentVariables[ nrlmsise00_solar_flux_dependent ];
+    tabulationInput_->apDaily = independentVariables[ nrlmsise00_geomagnetic_index_dependent ];
+    std::fill( tabulationInput_->apVector.begin( ), tabulationInput_->apVector.end( ),
+               independentVariables[ nrlmsise00_geomagnetic_index_dependent ] );
+
+    tabulationModel_->resetHashKey( );
+    std::vector< double > altitude( 1, independentVariables[ nrlmsise00_altitude_dependent ] );
+    std::vector< double > longitude( 1, 0.0 );
+    std::vector< double > latitude( 1, independentVariables[ nrlmsise00_latitude_dependent ] );
+    std::vector< double > time( 1, 0.0 );
+    return tabulationModel_->getPropertiesAtPoints( altitude, longitude, latitude, time ).at( 0 );
+}
+
+//! Function to compute the tables of the atmospheric properties by evaluating the NRLMSISE00 model on the grid.
+void TabulatedNRLMSISE00Atmosphere::generateTables( )
+{
+    const std::vector< std::vector< double > >& grid = independentVariableGrid_;
+    boost::array< std::size_t, 5 > tableShape;
+    for( unsigned int i = 0; i < 5; i++ )
+    {
+        tableShape[ i ] = grid.at( i ).size( );
+    }
+
+    logarithmOfDensityTable_.resize( tableShape );
+    temperatureTable_.resize( tableShape );
+    meanMolarMassTable_.resize( tableShape );
+
+    // Evaluate NRLMSISE00 model at each node of the grid.
+    std::vector< double > independentVariables( 5 );
+    for( unsigned int i = 0; i < tableShape[ 0 ]; i++ )
+    {
+        independentVariables[ 0 ] = grid[ 0 ][ i ];
+        for( unsigned int j = 0; j < tableShape[ 1 ]; j++ )
+        {
+            independentVariables[ 1 ] = grid[ 1 ][ j ];
+            for( unsigned int k = 0; k < tableShape[ 2 ]; k++ )
+            {
+                independentVariables[ 2 ] = grid[ 2 ][ k ];
+                for( unsigned int l = 0; l < tableShape[ 3 ]; l++ )
+                {
+                    independentVariables[ 3 ] = grid[ 3 ][ l ];
+                    for( unsigned int m = 0; m < tableShape[ 4 ]; m++ )
+                    {
+                        independentVariables[ 4 ] = grid[ 4 ][ m ];
+
+                        NRLMSISE00Properties properties = evaluateNRLMSISE00Model( independentVariables );
+                        logarithmOfDensityTable_[ i ][ j ][ k ][ l ][ m ] = std::log( properties.density );
+                        temperatureTable_[ i ][ j ][ k ][ l ][ m ] = properties.temperature;
+                        meanMolarMassTable_[ i ][ j ][ k ][ l ][ m ] = properties.meanMolarMass;
+                    }
+                }
+            }
+        }
+    }
+}
+
+//! Function to read the tables of the atmospheric properties from a binary file.
+bool TabulatedNRLMSISE00Atmosphere::readTablesFromFile( const std::string& fileName )
+{
+    std::ifstream tableFile( fileName.c_str( ), std::ios::binary );
+    if( !tableFile.is_open( ) )
+    {
+        return false;
+    }
+
+    // Check file identifier and version
+    char fileIdentifier[ sizeof( TABULATED_NRLMSISE00_FILE_IDENTIFIER ) ];
+    std::int32_t fileVersion = 0;
+    tableFile.read( fileIdentifier, sizeof( fileIdentifier ) );
+    tableFile.read( reinterpret_cast< char* >( &fileVersion ), sizeof( fileVersion ) );
+    if( !tableFile || !std::equal( fileIdentifier, fileIdentifier + sizeof( fileIdentifier ),
+                                   TABULATED_NRLMSISE00_FILE_IDENTIFIER ) ||
+            fileVersion != TABULATED_NRLMSISE00_FILE_VERSION )
+    {
+        throw std::runtime_error( "Error when reading tabulated NRLMSISE00 atmosphere from " + fileName +
+                                  ", file is not a (compatible) tabulated NRLMSISE00 file." );
+    }
+
+    // Check consistency of tabulated day and grid with settings of this object.
+    std::int32_t fileDayOfTheYear = 0;
+    tableFile.read( reinterpret_cast< char* >( &fileDayOfTheYear ), sizeof( fileDayOfTheYear ) );
+    bool isGridConsistent = ( fileDayOfTheYear == dayOfTheYear_ );
+
+    boost::array< std::size_t, 5 > tableShape;
+    for( unsigned int i = 0; i < 5; i++ )
+    {
+        std::uint64_t numberOfGridPoints = 0;
+        tableFile.read( reinterpret_cast< char* >( &numberOfGridPoints ), sizeof( numberOfGridPoints ) );
+        if( !tableFile || numberOfGridPoints != independentVariableGrid_.at( i ).size( ) )
+        {
+            isGridConsistent = false;
+            break;
+        }
+
+        std::vector< double > fileGrid( numberOfGridPoints );
+        tableFile.read( reinterpret_cast< char* >( fileGrid.data( ) ), numberOfGridPoints * sizeof( double ) );
+        if( fileGrid != independentVariableGrid_.at( i ) )
+        {
+            isGridConsistent = false;
+            break;
+        }
+        tableShape[ i ] = numberOfGridPoints;
+    }
+
+    // Tables in file were generated for different settings, and are to be regenerated.
+    if( !tableFile || !isGridConsistent )
+    {
+        return false;
+    }
+
+    // Read tables
+    logarithmOfDensityTable_.resize( tableShape );
+    temperatureTable_.resize( tableShape );
+    meanMolarMassTable_.resize( tableShape );
+    tableFile.read( reinterpret_cast< char* >( logarithmOfDensityTable_.data( ) ),
+                    logarithmOfDensityTable_.num_elements( ) * sizeof( double ) );
+    tableFile.read( reinterpret_cast< char* >( temperatureTable_.data( ) ),
+                    temperatureTable_.num_elements( ) * sizeof( double ) );
+    tableFile.read( reinterpret_cast< char* >( meanMolarMassTable_.data( ) ),
+                    meanMolarMassTable_.num_elements( ) * sizeof( double ) );
+    if( !tableFile )
+    {
+        throw std::runtime_error( "Error when reading tabulated NRLMSISE00 atmosphere from " + fileName +
+                                  ", file is incomplete." );
+    }
+
+    return true;
+}
+
+//! Function to write the tables of the atmospheric properties to a binary file.
+void TabulatedNRLMSISE00Atmosphere::writeTablesToFile( const std::string& fileName )
+{
+    std::ofstream tableFile( fileName.c_str( ), std::ios::binary );
+    if( !tableFile.is_open( ) )
+    {
+        throw std::runtime_error( "Error when writing tabulated NRLMSISE00 atmosphere, could not open " + fileName );
+    }
+
+    // Write file identifier, version, day of the year and grid
+    const std::int32_t fileVersion = TABULATED_NRLMSISE00_FILE_VERSION;
+    const std::int32_t fileDayOfTheYear = dayOfTheYear_;
+    tableFile.write( TABULATED_NRLMSISE00_FILE_IDENTIFIER, sizeof( TABULATED_NRLMSISE00_FILE_IDENTIFIER ) );
+    tableFile.write( reinterpret_cast< const char* >( &fileVersion ), sizeof( fileVersion ) );
+    tableFile.write( reinterpret_cast< const char* >( &fileDayOfTheYear ), sizeof( fileDayOfTheYear ) );
+    for( unsigned int i = 0; i < 5; i++ )
+    {
+        const std::uint64_t numberOfGridPoints = independentVariableGrid_.at( i ).size( );
+        tableFile.write( reinterpret_cast< const char* >( &numberOfGridPoints ), sizeof( numberOfGridPoints ) );
+        tableFile.write( reinterpret_cast< const char* >( independentVariableGrid_.at( i ).data( ) ),
+                         numberOfGridPoints * sizeof( double ) );
+    }
+
+    // Write tables
+    tableFile.write( reinterpret_cast< const char* >( logarithmOfDensityTable_.data( ) ),
+                     logarithmOfDensityTable_.num_elements( ) * sizeof( double ) );
+    tableFile.write( reinterpret_cast< const char* >( temperatureTable_.data( ) ),
+                     temperatureTable_.num_elements( ) * sizeof( double ) );
+    tableFile.write( reinterpret_cast< const char* >( meanMolarMassTable_.data( ) ),
+                     meanMolarMassTable_.num_elements( ) * sizeof( double ) );
+
+    if( !tableFile )
+    {
+        throw std::runtime_error( "Error when writing tabulated NRLMSISE00 atmosphere to " + fileName );
+    }
+}
+
+//! Function to create the interpolators of the tables, once the tables have been set.
+void TabulatedNRLMSISE00Atmosphere::createInterpolators( )
+{
+    logarithmOfDensityInterpolator_ = boost::make_shared< interpolators::MultiLinearInterpolator< double, double, 5 > >(
+                independentVariableGrid_, logarithmOfDensityTable_ );
+    temperatureInterpolator_ = boost::make_shared< interpolators::MultiLinearInterpolator< double, double, 5 > >(
+                independentVariableGrid_, temperatureTable_ );
+    meanMolarMassInterpolator_ = boost::make_shared< interpolators::MultiLinearInterpolator< double, double, 5 > >(
+                independentVariableGrid_, meanMolarMassTable_ );
+}
+
+} // namespace aerodynamics
+
+} // namespace tudat
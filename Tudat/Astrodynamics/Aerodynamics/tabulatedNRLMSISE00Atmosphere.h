@@ -0,0 +1,358 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_TABULATED_NRLMSISE00_ATMOSPHERE_H
+#define TUDAT_TABULATED_NRLMSISE00_ATMOSPHERE_H
+
+#include <string>
+#include <vector>
+
+#include <boost/array.hpp>
+#include <boost/multi_array.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include "Tudat/Astrodynamics/Aerodynamics/atmosphereModel.h"
+#include "Tudat/Astrodynamics/Aerodynamics/nrlmsise00Atmosphere.h"
+#include "Tudat/Astrodynamics/Aerodynamics/nrlmsise00InputFunctions.h"
+#include "Tudat/Mathematics/Interpolators/multiLinearInterpolator.h"
+
+namespace tudat
+{
+
+namespace aerodynamics
+{
+
+//! Independent variables of the grid on which the NRLMSISE00 model is tabulated by TabulatedNRLMSISE00Atmosphere.
+enum TabulatedNRLMSISE00IndependentVariables
+{
+    nrlmsise00_altitude_dependent = 0,
+    nrlmsise00_latitude_dependent = 1,
+    nrlmsise00_local_solar_time_dependent = 2,
+    nrlmsise00_solar_flux_dependent = 3,
+    nrlmsise00_geomagnetic_index_dependent = 4
+};
+
+//! Function to return a fixed NRLMSISE00 input, irrespective of the position and time.
+/*!
+ * Function to return a fixed NRLMSISE00 input, irrespective of the position and time. This function is used to
+ * evaluate the NRLMSISE00 model at the nodes of the grid of a TabulatedNRLMSISE00Atmosphere.
+ * \param altitude Altitude at which output is to be computed [m] (unused).
+ * \param longitude Longitude at which output is to be computed [rad] (unused).
+ * \param latitude Latitude at which output is to be computed [rad] (unused).
+ * \param time Time at which output is to be computed (seconds since J2000) (unused).
+ * \param nrlmsise00Input Input to the NRLMSISE00 model that is to be returned.
+ * \return Input to the NRLMSISE00 model (contents of nrlmsise00Input)
+ */
+NRLMSISE00Input getFixedNRLMSISE00Input( const double altitude, const double longitude,
+                                         const double latitude, const double time,
+                                         const boost::shared_ptr< NRLMSISE00Input > nrlmsise00Input );
+
+//! Atmosphere model in which the NRLMSISE00 model is pre-computed on a grid, and (multi-linearly) interpolated.
+/*!
+ *  Atmosphere model in which the NRLMSISE00 model is pre-computed on a grid, and (multi-linearly) interpolated, to
+ *  be used as a fast approximation of the NRLMSISE00Atmosphere. The model is tabulated as a function of altitude,
+ *  (geodetic) latitude, local solar time, F10.7 solar flux and daily Ap geomagnetic index (in the order of the
+ *  TabulatedNRLMSISE00IndependentVariables enum). The logarithm of the density, the temperature and the mean molar
+ *  mass are tabulated, from which the pressure (ideal gas law) and speed of sound are computed.
+ *  The local solar time, F10.7 flux and Ap index at which the table is interpolated are obtained from the same input
+ *  function as used by the NRLMSISE00Atmosphere, where the 81-day average F10.7 flux is used as solar flux. When
+ *  generating the tables, both the daily and 81-day average solar flux are set to the tabulated value.
+ *  The dependency of the atmosphere on the day of the year is not tabulated: the tables are generated for a single,
+ *  user-specified, day. Independent variables outside of the tabulated range are set to the nearest boundary value of
+ *  the grid.
+ *  Since the generation of the tables is computationally expensive, the tables may be stored in (and retrieved from)
+ *  a binary file.
+ */
+class TabulatedNRLMSISE00Atmosphere : public AtmosphereModel
+{
+public:
+
+    //! Typedef for function that provides the NRLMSISE00 input as a function of (altitude, longitude, latitude, time )
+    typedef NRLMSISE00Atmosphere::NRLMSISE00InputFunction NRLMSISE00InputFunction;
+
+    //! Constructor.
+    /*!
+     *  Constructor, retrieves the tabulated atmosphere from tableCacheFile, if it exists and contains tables for the
+     *  same grid and day of the year, or computes it (and writes it to tableCacheFile, if non-empty) otherwise.
+     *  \param nrlmsise00InputFunction Function which provides the NRLMSISE00 model input as a function of
+     *  (altitude, longitude, latitude, time ), used to retrieve local solar time, 81-day average F10.7 flux and daily
+     *  Ap index during the simulation.
+     *  \param independentVariableGrid Values of the independent variables on which the NRLMSISE00 model is to be
+     *  tabulated, in the order defined by TabulatedNRLMSISE00IndependentVariables. Altitudes in m, latitudes in rad,
+     *  local solar times in hours. Each list must contain at least two entries, in ascending order.
+     *  \param dayOfTheYear Day of the year for which the NRLMSISE00 model is tabulated.
+     *  \param tableCacheFile Binary file from which tables are retrieved, or to which they are written if the file
+     *  does not yet exist or contains tables for a different grid or day of the year (no file is used if empty).
+     *  \param specificHeatRatio Specific heat ratio used to compute the speed of sound.
+     */
+    TabulatedNRLMSISE00Atmosphere(
+            const NRLMSISE00InputFunction nrlmsise00InputFunction,
+            const std::vector< std::vector< double > >& independentVariableGrid,
+            const int dayOfTheYear,
+            const std::string& tableCacheFile = "",
+            const double specificHeatRatio = 1.4 );
+
+    //! Constructor using a calculator of the model input from solar activity data.
+    /*!
+     *  Constructor using a calculator of the model input from solar activity data, which is used to retrieve local
+     *  solar time, 81-day average F10.7 flux and daily Ap index during the simulation. An independent copy of this
+     *  atmosphere model (see createIndependentCopy) uses its own copy of the input calculator.
+     *  \param inputCalculator Object used to compute the NRLMSISE00 model input from solar activity data.
+     *  \param independentVariableGrid Values of the independent variables on which the NRLMSISE00 model is to be
+     *  tabulated (see other constructor).
+     *  \param dayOfTheYear Day of the year for which the NRLMSISE00 model is tabulated.
+     *  \param tableCacheFile Binary file from which tables are retrieved, or to which they are written (see other
+     *  constructor).
+     *  \param specificHeatRatio Specific heat ratio used to compute the speed of sound.
+     */
+    TabulatedNRLMSISE00Atmosphere(
+            const boost::shared_ptr< NRLMSISE00InputCalculator > inputCalculator,
+            const std::vector< std::vector< double > >& independentVariableGrid,
+            const int dayOfTheYear,
+            const std::string& tableCacheFile = "",
+            const double specificHeatRatio = 1.4 );
+
+    //! Destructor
+    ~TabulatedNRLMSISE00Atmosphere( ){ }
+
+    //! Get local density.
+    /*!
+     * Returns the local density of the atmosphere in kg per meter^3.
+     * \param altitude Altitude at which density is to be computed [m].
+     * \param longitude Longitude at which density is to be computed [rad].
+     * \param latitude Latitude at which density is to be computed [rad].
+     * \param time Time at which density is to be computed (seconds since J2000).
+     * \return Atmospheric density [kg/m^3].
+     */
+    double getDensity( const double altitude, const double longitude,
+                       const double latitude, const double time )
+    {
+        computeProperties( altitude, longitude, latitude, time );
+        return density_;
+    }
+
+    //! Get local pressure.
+    /*!
+     * Returns the local pressure of the atmosphere in Newton per meter^2, computed using the ideal gas law.
+     * \param altitude Altitude at which pressure is to be computed [m].
+     * \param longitude Longitude at which pressure is to be computed [rad].
+     * \param latitude Latitude at which pressure is to be computed [rad].
+     * \param time Time at which pressure is to be computed (seconds since J2000).
+     * \return Atmospheric pressure [N/m^2].
+     */
+    double getPressure( const double altitude, const double longitude,
+                        const double latitude, const double time )
+    {
+        computeProperties( altitude, longitude, latitude, time );
+        return pressure_;
+    }
+
+    //! Get local temperature.
+    /*!
+     * Returns the local temperature of the atmosphere in Kelvin.
+     * \param altitude Altitude at which temperature is to be computed [m].
+     * \param longitude Longitude at which temperature is to be computed [rad].
+     * \param latitude Latitude at which temperature is to be computed [rad].
+     * \param time Time at which temperature is to be computed (seconds since J2000).
+     * \return Atmospheric temperature [K].
+     */
+    double getTemperature( const double altitude, const double longitude,
+                           const double latitude, const double time )
+    {
+        computeProperties( altitude, longitude, latitude, time );
+        return temperature_;
+    }
+
+    //! Get local speed of sound.
+    /*!
+     * Returns the local speed of sound in m/s.
+     * \param altitude Altitude at which speed of sound is to be computed [m].
+     * \param longitude Longitude at which speed of sound is to be computed [rad].
+     * \param latitude Latitude at which speed of sound is to be computed [rad].
+     * \param time Time at which speed of sound is to be computed (seconds since J2000).
+     * \return Speed of sound [m/s].
+     */
+    double getSpeedOfSound( const double altitude, const double longitude,
+                            const double latitude, const double time )
+    {
+        computeProperties( altitude, longitude, latitude, time );
+        return speedOfSound_;
+    }
+
+    //! Function to compute the maximum relative density error of the tabulated model w.r.t. the NRLMSISE00 model.
+    /*!
+     * Function to compute the maximum relative density error of the tabulated model w.r.t. the NRLMSISE00 model, by
+     * comparing the two models at the centre of grid cells (where the interpolation error is typically largest).
+     * \param cellStride Stride with which the cells of the grid are sampled in each dimension (all cells are
+     * compared if equal to 1, every other cell in each dimension if equal to 2, etc.).
+     * \return Maximum value of the absolute relative density error at the sampled cell centres.
+     */
+    double computeMaximumRelativeDensityError( const unsigned int cellStride = 1 );
+
+    //! Function to retrieve the values of the independent variables on which the NRLMSISE00 model is tabulated.
+    /*!
+     * Function to retrieve the values of the independent variables on which the NRLMSISE00 model is tabulated.
+     * \return Values of the independent variables on which the NRLMSISE00 model is tabulated.
+     */
+    std::vector< std::vector< double > > getIndependentVariableGrid( )
+    {
+        return independentVariableGrid_;
+    }
+
+    //! Function to retrieve the day of the year for which the NRLMSISE00 model is tabulated.
+    /*!
+     * Function to retrieve the day of the year for which the NRLMSISE00 model is tabulated.
+     * \return Day of the year for which the NRLMSISE00 model is tabulated.
+     */
+    int getDayOfTheYear( )
+    {
+        return dayOfTheYear_;
+    }
+
+    //! Function to create a copy of the atmosphere model that can be evaluated independently of this object.
+    /*!
+     * Function to create a copy of the atmosphere model that can be evaluated independently of this object, with its
+     * own interpolators and NRLMSISE00 model used for tabulation. If the model was created from an
+     * NRLMSISE00InputCalculator, the copy uses an independent copy of the input calculator. An input function that was
+     * provided directly is shared with the copy, and must therefore be safe to evaluate concurrently when the copies
+     * are used on different threads.
+     * \return Copy of the atmosphere model that can be evaluated independently of this object.
+     */
+    boost::shared_ptr< AtmosphereModel > createIndependentCopy( );
+
+private:
+
+    //! Function to create the NRLMSISE00 model (and its input) used to evaluate the model at the nodes of the grid.
+    void createTabulationModel( );
+
+    //! Compute the local atmospheric properties.
+    /*!
+     * Computes the local atmospheric properties by interpolating the tables, using the NRLMSISE00 input function to
+     * determine the local solar time, F10.7 flux and Ap index. Properties are only recomputed if any of the input
+     * variables differs from the previous call.
+     * \param altitude Altitude at which output is to be computed [m].
+     * \param longitude Longitude at which output is to be computed [rad].
+     * \param latitude Latitude at which output is to be computed [rad].
+     * \param time Time at which output is to be computed (seconds since J2000).
+     */
+    void computeProperties( const double altitude, const double longitude,
+                            const double latitude, const double time );
+
+    //! Function to interpolate the tables at given values of the independent variables.
+    /*!
+     * Function to interpolate the tables at given values of the independent variables, and set the density,
+     * temperature, pressure and speed of sound member variables.
+     * \param independentVariables Values of the independent variables (in the order defined by
+     * TabulatedNRLMSISE00IndependentVariables). Values outside of the grid are set to the nearest boundary value.
+     */
+    void interpolateTables( std::vector< double >& independentVariables );
+
+    //! Function to evaluate the NRLMSISE00 model at given values of the tabulated independent variables.
+    /*!
+     * Function to evaluate the NRLMSISE00 model at given values of the tabulated independent variables.
+     * \param independentVariables Values of the independent variables (in the order defined by
+     * TabulatedNRLMSISE00IndependentVariables).
+     * \return Properties of the NRLMSISE00 model at given independent variables.
+     */
+    NRLMSISE00Properties evaluateNRLMSISE00Model( const std::vector< double >& independentVariables );
+
+    //! Function to compute the tables of the atmospheric properties by evaluating the NRLMSISE00 model on the grid.
+    void generateTables( );
+
+    //! Function to read the tables of the atmospheric properties from a binary file.
+    /*!
+     * Function to read the tables of the atmospheric properties from a binary file. No tables are read if the grid or
+     * day of the year in the file are not equal to those of this object. An exception is thrown if the file is not a
+     * (compatible) tabulated NRLMSISE00 file, or if it is incomplete.
+     * \param fileName Name of the file from which the tables are to be read.
+     * \return True if the file exists and the tables were read, false if the file could not be opened or contains
+     * tables for a different grid or day of the year.
+     */
+    bool readTablesFromFile( const std::string& fileName );
+
+    //! Function to write the tables of the atmospheric properties to a binary file.
+    /*!
+     * Function to write the tables of the atmospheric properties to a binary file.
+     * \param fileName Name of the file to which the tables are to be written.
+     */
+    void writeTablesToFile( const std::string& fileName );
+
+    //! Function to create the interpolators of the tables, once the tables have been set.
+    void createInterpolators( );
+
+    //! Function which provides the NRLMSISE00 model input as a function of (altitude, longitude, latitude, time )
+    NRLMSISE00InputFunction nrlmsise00InputFunction_;
+
+    //! Calculator of the model input from solar activity data (NULL if input function was provided directly).
+    boost::shared_ptr< NRLMSISE00InputCalculator > inputCalculator_;
+
+    //! Values of the independent variables on which the NRLMSISE00 model is tabulated.
+    std::vector< std::vector< double > > independentVariableGrid_;
+
+    //! Day of the year for which the NRLMSISE00 model is tabulated.
+    int dayOfTheYear_;
+
+    //! Specific heat ratio used to compute the speed of sound.
+    double specificHeatRatio_;
+
+    //! Molar gas constant (J/mol K)
+    double molarGasConstant_;
+
+    //! Input to NRLMSISE00 model used to evaluate the model at nodes of the grid (modified before each evaluation)
+    boost::shared_ptr< NRLMSISE00Input > tabulationInput_;
+
+    //! NRLMSISE00 model used to evaluate the model at nodes of the grid (using tabulationInput_ as input).
+    boost::shared_ptr< NRLMSISE00Atmosphere > tabulationModel_;
+
+    //! Table of the natural logarithm of the density (in kg/m^3) at the nodes of the grid.
+    boost::multi_array< double, 5 > logarithmOfDensityTable_;
+
+    //! Table of the temperature (in K) at the nodes of the grid.
+    boost::multi_array< double, 5 > temperatureTable_;
+
+    //! Table of the mean molar mass (in kg/mol) at the nodes of the grid.
+    boost::multi_array< double, 5 > meanMolarMassTable_;
+
+    //! Interpolator for natural logarithm of the density
+    boost::shared_ptr< interpolators::MultiLinearInterpolator< double, double, 5 > > logarithmOfDensityInterpolator_;
+
+    //! Interpolator for temperature
+    boost::shared_ptr< interpolators::MultiLinearInterpolator< double, double, 5 > > temperatureInterpolator_;
+
+    //! Interpolator for mean molar mass
+    boost::shared_ptr< interpolators::MultiLinearInterpolator< double, double, 5 > > meanMolarMassInterpolator_;
+
+    //! Pre-allocated vector of independent variables, used in interpolation.
+    std::vector< double > currentIndependentVariables_;
+
+    //! Input variables (altitude, longitude, latitude, time) of the most recent call to computeProperties
+    boost::array< double, 4 > currentInputVariables_;
+
+    //! Current local density (kg/m3)
+    double density_;
+
+    //! Current local temperature (K)
+    double temperature_;
+
+    //! Current local pressure (N/m^2)
+    double pressure_;
+
+    //! Current speed of sound (m/s)
+    double speedOfSound_;
+
+    //! Current mean molar mass (kg/mol)
+    double meanMolarMass_;
+};
+
+} // namespace aerodynamics
+
+} // namespace tudat
+
+#endif // TUDAT_TABULATED_NRLMSISE00_ATMOSPHERE_H
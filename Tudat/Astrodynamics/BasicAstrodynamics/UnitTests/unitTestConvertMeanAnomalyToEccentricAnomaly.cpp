@@ -429,6 +429,48 @@ BOOST_AUTO_TEST_CASE( test_convertMeanAnomalyToEccentricAnomaly_specificInitialG
                        1.0E-13 );
 }
 
+//! Test 8: Test fixed-iteration (batch) conversion against root-finder based conversion.
+BOOST_AUTO_TEST_CASE( test_convertMeanAnomaliesToEccentricAnomalies )
+{
+    // Generate random eccentricities and mean anomalies (including negative and multi-revolution values).
+    boost::mt19937 randomNumbergenerator( 42 );
+    boost::random::uniform_real_distribution< > eccentricityDistribution( 0.0, 1.0 - 1.0E-6 );
+    boost::random::uniform_real_distribution< > meanAnomalyDistribution( -10.0 * PI, 10.0 * PI );
+
+    const int numberOfSamples = 100000;
+    Eigen::VectorXd eccentricities = Eigen::VectorXd( numberOfSamples );
+    Eigen::VectorXd meanAnomalies = Eigen::VectorXd( numberOfSamples );
+    for( int i = 0; i < numberOfSamples; i++ )
+    {
+        eccentricities( i ) = eccentricityDistribution( randomNumbergenerator );
+        meanAnomalies( i ) = meanAnomalyDistribution( randomNumbergenerator );
+    }
+
+    // Include limiting cases.
+    eccentricities( 0 ) = 0.0;
+    meanAnomalies( 1 ) = 0.0;
+    meanAnomalies( 2 ) = PI;
+    eccentricities( 3 ) = 0.999999;
+    meanAnomalies( 3 ) = 1.0E-8;
+
+    Eigen::VectorXd eccentricAnomalies = convertMeanAnomaliesToEccentricAnomalies( eccentricities, meanAnomalies );
+
+    // Compare with root-finder based conversion, and check that Kepler's equation is satisfied.
+    for( int i = 0; i < numberOfSamples; i++ )
+    {
+        BOOST_CHECK_SMALL( eccentricAnomalies( i ) - convertMeanAnomalyToEccentricAnomaly(
+                               eccentricities( i ), meanAnomalies( i ) ), 1.0E-12 );
+        BOOST_CHECK_SMALL( computeKeplersFunctionForEllipticalOrbits(
+                               eccentricAnomalies( i ), eccentricities( i ),
+                               basic_mathematics::computeModulo( meanAnomalies( i ), 2.0 * PI ) ), 1.0E-14 );
+    }
+
+    // Check that invalid eccentricities are rejected.
+    eccentricities( 10 ) = 1.0;
+    BOOST_CHECK_THROW( convertMeanAnomaliesToEccentricAnomalies( eccentricities, meanAnomalies ),
+                       std::runtime_error );
+}
+
 // End Boost test suite.
 BOOST_AUTO_TEST_SUITE_END( )
 
@@ -287,5 +287,45 @@ BOOST_AUTO_TEST_CASE( testMeanAnomalyAgainstMeanMotion )
                            static_cast< double >( 5.0 * std::numeric_limits< double >::epsilon( ) ) );
     }
 }
+
+//! Test 7. Comparison of propagation of list of orbits with propagation of individual orbits.
+BOOST_AUTO_TEST_CASE( testPropagateKeplerOrbits )
+{
+    const double gravitationalParameter = 398600.4415e9;
+    const double propagationTime = 86400.0 * 3.7;
+
+    // Create list of elliptical orbits (with one hyperbolic orbit), exceeding the size of a single block.
+    const int numberOfOrbits = 150;
+    Eigen::Matrix< double, 6, Eigen::Dynamic > initialStates( 6, numberOfOrbits );
+    for( int i = 0; i < numberOfOrbits; i++ )
+    {
+        initialStates.col( i ) << 7.0E6 + 1.0E5 * i, 0.0065 * i, 0.01 * i, 0.04 * i, 0.02 * i,
+                -mathematical_constants::PI + 0.041 * i;
+    }
+    initialStates.col( 75 ) << -2.0E7, 1.3, 0.5, 1.2, 0.3, 0.4;
+
+    Eigen::Matrix< double, 6, Eigen::Dynamic > finalStates;
+    propagateKeplerOrbits( initialStates, propagationTime, gravitationalParameter, finalStates );
+    BOOST_CHECK_EQUAL( finalStates.cols( ), numberOfOrbits );
+
+    for( int i = 0; i < numberOfOrbits; i++ )
+    {
+        Eigen::Vector6d expectedFinalState = propagateKeplerOrbit< double >(
+                    initialStates.col( i ), propagationTime, gravitationalParameter );
+        for( int j = 0; j < 5; j++ )
+        {
+            BOOST_CHECK_EQUAL( finalStates( j, i ), expectedFinalState( j ) );
+        }
+        BOOST_CHECK_SMALL( basic_mathematics::computeModulo(
+                               finalStates( trueAnomalyIndex, i ) - expectedFinalState( trueAnomalyIndex ) +
+                               mathematical_constants::PI, 2.0 * mathematical_constants::PI ) -
+                           mathematical_constants::PI, 1.0E-11 );
+    }
+
+    // Check that parabolic orbits are rejected.
+    initialStates( eccentricityIndex, 100 ) = 1.0;
+    BOOST_CHECK_THROW( propagateKeplerOrbits( initialStates, propagationTime, gravitationalParameter, finalStates ),
+                       std::runtime_error );
+}
 } // namespace unit_tests
 } // namespace tudat
@@ -17,6 +17,9 @@
  *              Deep Space Maneuvers, MSc thesis report, Delft University of Technology, 2012.
  *              [unpublished so far]. Section available on tudat website (tudat.tudelft.nl)
  *              under issue #539.
+ *      Regarding the fixed-iteration (batch) solver:
+ *          Markley, F.L. Kepler Equation Solver, Celestial Mechanics and Dynamical Astronomy, 63,
+ *              101-111, 1995.
  *
  *    Notes
  *      There are known to be some issues on some systems with near-parabolic orbits that are very
@@ -36,6 +39,9 @@
 #include <boost/math/special_functions/asinh.hpp>
 
 #include <cmath>
+#include <stdexcept>
+
+#include <Eigen/Core>
 
 #include "Tudat/Mathematics/RootFinders/newtonRaphson.h"
 #include "Tudat/Mathematics/RootFinders/rootFinder.h"
@@ -283,6 +289,142 @@ ScalarType convertMeanAnomalyToEccentricAnomaly(
     return eccentricAnomaly;
 }
 
+//! Solve Kepler's equation for elliptical orbits using a fixed number of operations.
+/*!
+ * Solves Kepler's equation for elliptical orbits (0.0 <= e < 1.0), i.e. converts mean anomaly to eccentric anomaly,
+ * using a fixed sequence of operations (no root-finder objects, no heap allocation, and no data-dependent
+ * iteration count), such that it is suitable for evaluation of large numbers of anomalies in a (vectorizable) loop.
+ * The starter of Markley (1995), which solves a cubic approximation of Kepler's equation, is refined by a single
+ * fifth-order correction, after which the specified number of Newton-Raphson iterations is performed. The
+ * eccentricity is NOT checked for validity by this function. As for convertMeanAnomalyToEccentricAnomaly, the mean
+ * anomaly is automatically transformed to fit within the 0 to 2.0*PI spectrum, and the eccentric anomaly is
+ * returned in this same spectrum.
+ * \param eccentricity Eccentricity of the orbit [-].
+ * \param meanAnomaly Mean anomaly to convert to eccentric anomaly [rad].
+ * \param numberOfNewtonIterations Number of Newton-Raphson iterations performed after the fifth-order correction
+ * (default 1; the fifth-order correction alone typically attains an accuracy of 1.0E-15 rad).
+ * \return Eccentric anomaly [rad].
+ */
+template< typename ScalarType = double >
+inline ScalarType solveKeplersEquationForEllipticalOrbitWithFixedIterations(
+        const ScalarType eccentricity, const ScalarType meanAnomaly,
+        const unsigned int numberOfNewtonIterations = 1 )
+{
+    using namespace mathematical_constants;
+
+    const ScalarType pi = getPi< ScalarType >( );
+    const ScalarType twoPi = getFloatingInteger< ScalarType >( 2 ) * pi;
+    const ScalarType one = getFloatingInteger< ScalarType >( 1 );
+
+    // Set mean anomaly to region between -PI and PI (required by starter), retaining offset to 0 to 2 PI region.
+    ScalarType reducedMeanAnomaly = meanAnomaly - twoPi * std::floor( meanAnomaly / twoPi );
+    const ScalarType anomalyOffset = ( reducedMeanAnomaly > pi ) ? twoPi : getFloatingInteger< ScalarType >( 0 );
+    reducedMeanAnomaly -= anomalyOffset;
+
+    // Compute starter from cubic approximation of Kepler's equation (Markley, 1995; Eqs. 5, 9, 11, 15 and 20).
+    const ScalarType squaredPi = pi * pi;
+    const ScalarType alpha = ( 3.0 * squaredPi + 1.6 * pi * ( pi - std::fabs( reducedMeanAnomaly ) ) /
+                               ( one + eccentricity ) ) / ( squaredPi - 6.0 );
+    const ScalarType d = 3.0 * ( one - eccentricity ) + alpha * eccentricity;
+    const ScalarType q = 2.0 * alpha * d * ( one - eccentricity ) - reducedMeanAnomaly * reducedMeanAnomaly;
+    const ScalarType r = 3.0 * alpha * d * ( d - one + eccentricity ) * reducedMeanAnomaly +
+            reducedMeanAnomaly * reducedMeanAnomaly * reducedMeanAnomaly;
+    const ScalarType cubeRootTerm = std::cbrt( std::fabs( r ) + std::sqrt( q * q * q + r * r ) );
+    const ScalarType w = cubeRootTerm * cubeRootTerm;
+    ScalarType eccentricAnomaly = ( 2.0 * r * w / ( w * w + w * q + q * q ) + reducedMeanAnomaly ) / d;
+
+    // Apply fifth-order correction (Markley, 1995; Eqs. 21-29).
+    ScalarType eccentricitySine = eccentricity * std::sin( eccentricAnomaly );
+    ScalarType eccentricityCosine = eccentricity * std::cos( eccentricAnomaly );
+    ScalarType keplerFunction = eccentricAnomaly - eccentricitySine - reducedMeanAnomaly;
+    ScalarType keplerFunctionDerivative = one - eccentricityCosine;
+
+    const ScalarType thirdOrderCorrection = -keplerFunction /
+            ( keplerFunctionDerivative - 0.5 * keplerFunction * eccentricitySine / keplerFunctionDerivative );
+    const ScalarType fourthOrderCorrection = -keplerFunction /
+            ( keplerFunctionDerivative + 0.5 * thirdOrderCorrection * eccentricitySine +
+              thirdOrderCorrection * thirdOrderCorrection * eccentricityCosine / 6.0 );
+    eccentricAnomaly += -keplerFunction /
+            ( keplerFunctionDerivative + 0.5 * fourthOrderCorrection * eccentricitySine +
+              fourthOrderCorrection * fourthOrderCorrection * eccentricityCosine / 6.0 -
+              fourthOrderCorrection * fourthOrderCorrection * fourthOrderCorrection * eccentricitySine / 24.0 );
+
+    // Perform Newton-Raphson iterations.
+    for( unsigned int i = 0; i < numberOfNewtonIterations; i++ )
+    {
+        eccentricitySine = eccentricity * std::sin( eccentricAnomaly );
+        eccentricityCosine = eccentricity * std::cos( eccentricAnomaly );
+        eccentricAnomaly -= ( eccentricAnomaly - eccentricitySine - reducedMeanAnomaly ) /
+                ( one - eccentricityCosine );
+    }
+
+    return eccentricAnomaly + anomalyOffset;
+}
+
+//! Convert list of mean anomalies to eccentric anomalies.
+/*!
+ * Converts a list of mean anomalies to eccentric anomalies for elliptical orbits, for all eccentricities >= 0.0 and
+ * < 1.0, using solveKeplersEquationForEllipticalOrbitWithFixedIterations. Intended for the simultaneous conversion of
+ * large numbers of anomalies (e.g. for a catalog of objects), for which the allocation of a root finder by
+ * convertMeanAnomalyToEccentricAnomaly for each conversion is prohibitive. The eccentricities are checked prior to the
+ * conversion, which is performed without heap allocation.
+ * \param eccentricities Pointer to first entry of array of eccentricities [-].
+ * \param meanAnomalies Pointer to first entry of array of mean anomalies [rad].
+ * \param eccentricAnomalies Pointer to first entry of array to which eccentric anomalies are written [rad]; may be
+ * identical to meanAnomalies.
+ * \param numberOfAnomalies Number of entries in the arrays.
+ * \param numberOfNewtonIterations Number of Newton-Raphson iterations performed for each conversion (see
+ * solveKeplersEquationForEllipticalOrbitWithFixedIterations).
+ */
+template< typename ScalarType = double >
+void convertMeanAnomaliesToEccentricAnomalies(
+        const ScalarType* eccentricities, const ScalarType* meanAnomalies, ScalarType* eccentricAnomalies,
+        const unsigned int numberOfAnomalies, const unsigned int numberOfNewtonIterations = 1 )
+{
+    for( unsigned int i = 0; i < numberOfAnomalies; i++ )
+    {
+        if( !( eccentricities[ i ] >= mathematical_constants::getFloatingInteger< ScalarType >( 0 ) &&
+               eccentricities[ i ] < mathematical_constants::getFloatingInteger< ScalarType >( 1 ) ) )
+        {
+            throw std::runtime_error( "Invalid eccentricity. Valid range is 0.0 <= e < 1.0. Eccentricity was: " +
+                                      std::to_string( eccentricities[ i ] ) );
+        }
+    }
+
+    for( unsigned int i = 0; i < numberOfAnomalies; i++ )
+    {
+        eccentricAnomalies[ i ] = solveKeplersEquationForEllipticalOrbitWithFixedIterations< ScalarType >(
+                    eccentricities[ i ], meanAnomalies[ i ], numberOfNewtonIterations );
+    }
+}
+
+//! Convert vector of mean anomalies to eccentric anomalies.
+/*!
+ * Converts a vector of mean anomalies to eccentric anomalies for elliptical orbits, for all eccentricities >= 0.0
+ * and < 1.0 (see pointer-based convertMeanAnomaliesToEccentricAnomalies function).
+ * \param eccentricities Vector of eccentricities [-].
+ * \param meanAnomalies Vector of mean anomalies [rad].
+ * \param numberOfNewtonIterations Number of Newton-Raphson iterations performed for each conversion (see
+ * solveKeplersEquationForEllipticalOrbitWithFixedIterations).
+ * \return Vector of eccentric anomalies [rad].
+ */
+template< typename ScalarType = double >
+Eigen::Matrix< ScalarType, Eigen::Dynamic, 1 > convertMeanAnomaliesToEccentricAnomalies(
+        const Eigen::Matrix< ScalarType, Eigen::Dynamic, 1 >& eccentricities,
+        const Eigen::Matrix< ScalarType, Eigen::Dynamic, 1 >& meanAnomalies,
+        const unsigned int numberOfNewtonIterations = 1 )
+{
+    if( eccentricities.rows( ) != meanAnomalies.rows( ) )
+    {
+        throw std::runtime_error( "Error when converting mean to eccentric anomalies, input sizes are inconsistent." );
+    }
+
+    Eigen::Matrix< ScalarType, Eigen::Dynamic, 1 > eccentricAnomalies( meanAnomalies.rows( ) );
+    convertMeanAnomaliesToEccentricAnomalies< ScalarType >(
+                eccentricities.data( ), meanAnomalies.data( ), eccentricAnomalies.data( ),
+                meanAnomalies.rows( ), numberOfNewtonIterations );
+    return eccentricAnomalies;
+}
 
 //! Convert mean anomaly to hyperbolic eccentric anomaly.
 /*!
@@ -12,6 +12,8 @@
 #ifndef TUDAT_KEPLER_PROPAGATOR_H
 #define TUDAT_KEPLER_PROPAGATOR_H
 
+#include <algorithm>
+
 #include <boost/make_shared.hpp>
 
 #include <Eigen/Core>
@@ -159,6 +161,88 @@ Eigen::Matrix< ScalarType, 6, 1 > propagateKeplerOrbit(
     return finalStateInKeplerianElements;
 }
 
+//! Propagate list of Kepler orbits.
+/*!
+ * Propagates a list of Kepler orbits (e.g. of a catalog of objects orbiting the same central body) over the same
+ * propagation time. For elliptical orbits, the conversion from mean to eccentric anomaly is performed in blocks using
+ * convertMeanAnomaliesToEccentricAnomalies (without allocating a root finder per orbit, and without heap allocation),
+ * which is significantly faster than calling propagateKeplerOrbit for each orbit. Hyperbolic orbits are propagated
+ * using propagateKeplerOrbit. As for propagateKeplerOrbit, parabolic orbits and negative eccentricities result in an
+ * error, and the true anomaly is returned within the -PI to PI spectrum.
+ * \param initialStatesInKeplerianElements Initial states in classical Keplerian elements, one column per orbit
+ *          (with the same element order as propagateKeplerOrbit).
+ * \param propagationTime Propagation time.                                                     [s]
+ * \param centralBodyGravitationalParameter Gravitational parameter of central body      [m^3 s^-2]
+ * \param finalStatesInKeplerianElements Final states in classical Keplerian elements, one column per orbit (returned
+ *          by reference; resized only if its size differs from that of the initial states).
+ * \param numberOfNewtonIterations Number of Newton-Raphson iterations performed in the conversion from mean to
+ *          eccentric anomaly (see solveKeplersEquationForEllipticalOrbitWithFixedIterations).
+ */
+template< typename ScalarType = double >
+void propagateKeplerOrbits(
+        const Eigen::Matrix< ScalarType, 6, Eigen::Dynamic >& initialStatesInKeplerianElements,
+        const ScalarType propagationTime,
+        const ScalarType centralBodyGravitationalParameter,
+        Eigen::Matrix< ScalarType, 6, Eigen::Dynamic >& finalStatesInKeplerianElements,
+        const unsigned int numberOfNewtonIterations = 1 )
+{
+    // Number of orbits for which the eccentric anomalies are computed simultaneously.
+    static const int blockSize = 64;
+
+    finalStatesInKeplerianElements = initialStatesInKeplerianElements;
+
+    ScalarType eccentricities[ blockSize ];
+    ScalarType anomalies[ blockSize ];
+    bool isOrbitElliptical[ blockSize ];
+
+    const int numberOfOrbits = finalStatesInKeplerianElements.cols( );
+    for( int blockStart = 0; blockStart < numberOfOrbits; blockStart += blockSize )
+    {
+        const int currentBlockSize = std::min( blockSize, numberOfOrbits - blockStart );
+
+        // Compute mean anomalies of elliptical orbits at end of propagation; propagate other orbits directly.
+        for( int i = 0; i < currentBlockSize; i++ )
+        {
+            const int orbitIndex = blockStart + i;
+            const ScalarType eccentricity = finalStatesInKeplerianElements( eccentricityIndex, orbitIndex );
+            isOrbitElliptical[ i ] = ( eccentricity >= mathematical_constants::getFloatingInteger< ScalarType >( 0 ) &&
+                                       eccentricity < mathematical_constants::getFloatingInteger< ScalarType >( 1 ) );
+            if( isOrbitElliptical[ i ] )
+            {
+                eccentricities[ i ] = eccentricity;
+                anomalies[ i ] =
+                        convertEccentricAnomalyToMeanAnomaly< ScalarType >(
+                            convertTrueAnomalyToEccentricAnomaly< ScalarType >(
+                                finalStatesInKeplerianElements( trueAnomalyIndex, orbitIndex ), eccentricity ),
+                            eccentricity ) +
+                        convertElapsedTimeToEllipticalMeanAnomalyChange< ScalarType >(
+                            propagationTime, centralBodyGravitationalParameter,
+                            finalStatesInKeplerianElements( semiMajorAxisIndex, orbitIndex ) );
+            }
+            else
+            {
+                eccentricities[ i ] = mathematical_constants::getFloatingInteger< ScalarType >( 0 );
+                anomalies[ i ] = mathematical_constants::getFloatingInteger< ScalarType >( 0 );
+                finalStatesInKeplerianElements.col( orbitIndex ) = propagateKeplerOrbit< ScalarType >(
+                            finalStatesInKeplerianElements.col( orbitIndex ), propagationTime,
+                            centralBodyGravitationalParameter );
+            }
+        }
+
+        // Compute eccentric anomalies of block, and convert to true anomalies.
+        convertMeanAnomaliesToEccentricAnomalies< ScalarType >(
+                    eccentricities, anomalies, anomalies, currentBlockSize, numberOfNewtonIterations );
+        for( int i = 0; i < currentBlockSize; i++ )
+        {
+            if( isOrbitElliptical[ i ] )
+            {
+                finalStatesInKeplerianElements( trueAnomalyIndex, blockStart + i ) =
+                        convertEccentricAnomalyToTrueAnomaly< ScalarType >( anomalies[ i ], eccentricities[ i ] );
+            }
+        }
+    }
+}
+
 } // namespace orbital_element_conversions
 
 } // namespace tudat
@@ -234,6 +234,39 @@ BOOST_AUTO_TEST_CASE( testShortPeriodUt1CombinedCorrections )
     BOOST_CHECK_SMALL( std::fabs( ut1CorrectionTotal - ( ut1CorrectionLibration + ut1CorrectionOceanTides ) ), 1.0E-20 );
 }
 
+//! Test evaluation of short-periodic variations on a time grid, by comparing to evaluation at the individual times
+BOOST_AUTO_TEST_CASE( testShortPeriodCorrectionsOnTimeGrid )
+{
+    boost::shared_ptr< ShortPeriodEarthOrientationCorrectionCalculator< double > > ut1CorrectionCalculator =
+            getDefaultUT1CorrectionCalculator( );
+    boost::shared_ptr< ShortPeriodEarthOrientationCorrectionCalculator< Eigen::Vector2d > > polarMotionCorrectionCalculator =
+            getDefaultPolarMotionCorrectionCalculator( );
+
+    // Define time grid, spanning multiple evaluation blocks
+    std::vector< double > testTimes;
+    for( unsigned int i = 0; i < 1234; i++ )
+    {
+        testTimes.push_back( 1.0E8 + static_cast< double >( i ) * 1800.0 );
+    }
+
+    // Compute corrections on time grid
+    std::vector< double > ut1Corrections = ut1CorrectionCalculator->getCorrections( testTimes );
+    std::vector< Eigen::Vector2d > polarMotionCorrections = polarMotionCorrectionCalculator->getCorrections( testTimes );
+    BOOST_CHECK_EQUAL( ut1Corrections.size( ), testTimes.size( ) );
+    BOOST_CHECK_EQUAL( polarMotionCorrections.size( ), testTimes.size( ) );
+
+    // Compare against evaluation at individual times (tolerances are 1 ps and 1 prad, respectively)
+    for( unsigned int i = 0; i < testTimes.size( ); i++ )
+    {
+        BOOST_CHECK_SMALL( ut1Corrections.at( i ) - ut1CorrectionCalculator->getCorrections( testTimes.at( i ) ), 1.0E-12 );
+
+        Eigen::Vector2d polarMotionCorrectionDifference =
+                polarMotionCorrections.at( i ) - polarMotionCorrectionCalculator->getCorrections( testTimes.at( i ) );
+        BOOST_CHECK_SMALL( polarMotionCorrectionDifference.x( ), 1.0E-12 );
+        BOOST_CHECK_SMALL( polarMotionCorrectionDifference.y( ), 1.0E-12 );
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }
@@ -17,70 +17,6 @@ namespace tudat
 namespace earth_orientation
 {
 
-//! Function to sum all the corrcetion terms.
-template< >
-double ShortPeriodEarthOrientationCorrectionCalculator< double >::sumCorrectionTerms( const Eigen::Vector6d& arguments )
-{
-    // Initialize corrections to zero.
-    double currentCorrection = 0;
-    double tideAngle = 0.0;
-
-    // Iterate over all correction types
-    for( unsigned int i = 0; i < argumentAmplitudes_.size( ); i++ )
-    {
-        Eigen::MatrixXd currentArgumentMultipliers = argumentMultipliers_.at( i );
-        Eigen::MatrixXd currentAmplitudes = argumentAmplitudes_.at( i );
-
-        // Iterte over all libration corrections.
-        for( int i = 0; i < currentAmplitudes.rows( ); i++ )
-        {
-            // Calculate current phase angle of tide.
-            tideAngle = ( arguments.transpose( ) *
-                          currentArgumentMultipliers.block( i, 0, 1, 6 ).transpose( ) )( 0, 0 );
-
-            currentCorrection += currentAmplitudes( i, 0 ) * std::sin( tideAngle ) +
-                    currentAmplitudes( i, 1 ) * std::cos( tideAngle );
-        }
-    }
-
-
-    return currentCorrection;
-}
-
-//! Function to sum all the corrcetion terms.
-template< >
-Eigen::Vector2d ShortPeriodEarthOrientationCorrectionCalculator< Eigen::Vector2d >::sumCorrectionTerms(
-        const Eigen::Vector6d& arguments )
-{
-    // Initialize corrections to zero.
-    Eigen::Vector2d currentCorrection = Eigen::Vector2d::Zero( );
-    double tideAngle = 0.0;
-
-    // Iterate over all correction types
-    for( unsigned int i = 0; i < argumentAmplitudes_.size( ); i++ )
-    {
-        Eigen::MatrixXd currentArgumentMultipliers = argumentMultipliers_.at( i );
-        Eigen::MatrixXd currentAmplitudes = argumentAmplitudes_.at( i );
-
-        // Iterte over all libration corrections.
-        for( int i = 0; i < currentAmplitudes.rows( ); i++ )
-        {
-            // Calculate current phase angle of tide.
-            tideAngle = ( arguments.transpose( ) *
-                          currentArgumentMultipliers.block( i, 0, 1, 6 ).transpose( ) )( 0, 0 );
-
-            // Calculate and add sine and cosine terms
-            currentCorrection.x( ) += currentAmplitudes( i, 0 ) * std::sin( tideAngle ) +
-                    currentAmplitudes( i, 1 ) * std::cos( tideAngle );
-            currentCorrection.y( ) += currentAmplitudes( i, 2 ) * std::sin( tideAngle ) +
-                    currentAmplitudes( i, 3 ) * std::cos( tideAngle );
-        }
-    }
-
-
-    return currentCorrection;
-}
-
 //! Function to retrieve the default UT1 short-period correction calculator
 boost::shared_ptr< ShortPeriodEarthOrientationCorrectionCalculator< double > > getDefaultUT1CorrectionCalculator(
         const double minimumAmplitude )
@@ -38,6 +38,53 @@ namespace tudat
 namespace earth_orientation
 {
 
+//! Function to retrieve the number of components of a short period Earth orientation correction of given type.
+/*!
+ *  Function to retrieve the number of components of a short period Earth orientation correction of given type (e.g. 1 for
+ *  UT1 corrections, 2 for polar motion corrections).
+ *  \return Number of components of correction
+ */
+template< typename OutputType >
+int getNumberOfCorrectionComponents( );
+
+//! Function to retrieve the number of components of a short period Earth orientation correction of type double.
+template< >
+inline int getNumberOfCorrectionComponents< double >( )
+{
+    return 1;
+}
+
+//! Function to retrieve the number of components of a short period Earth orientation correction of type Eigen::Vector2d.
+template< >
+inline int getNumberOfCorrectionComponents< Eigen::Vector2d >( )
+{
+    return 2;
+}
+
+//! Function to convert the components of a short period Earth orientation correction to the correction of given type.
+/*!
+ *  Function to convert the components of a short period Earth orientation correction to the correction of given type.
+ *  \param correctionComponents Components of the correction
+ *  \return Correction as type OutputType
+ */
+template< typename OutputType >
+OutputType convertCorrectionComponents( const Eigen::VectorXd& correctionComponents );
+
+//! Function to convert the components of a short period Earth orientation correction to the correction of type double.
+template< >
+inline double convertCorrectionComponents< double >( const Eigen::VectorXd& correctionComponents )
+{
+    return correctionComponents( 0 );
+}
+
+//! Function to convert the components of a short period Earth orientation correction to a correction of type
+//! Eigen::Vector2d.
+template< >
+inline Eigen::Vector2d convertCorrectionComponents< Eigen::Vector2d >( const Eigen::VectorXd& correctionComponents )
+{
+    return correctionComponents;
+}
+
 //! Object to calculate the short period variations in Earth orientaion parameters
 /*!
  *  Object to calculate the short period  variations in Earth orientaion parameters, e.g. taking into account
@@ -74,12 +121,30 @@ public:
         }
 
         // Read data from files
+        const int numberOfComponents = getNumberOfCorrectionComponents< OutputType >( );
         std::pair< Eigen::MatrixXd, Eigen::MatrixXd > dataFromFile;
         for( unsigned int i = 0; i < amplitudesFiles.size( ); i++ )
         {
             dataFromFile = readAmplitudesAndFundamentalArgumentMultipliers(
                         amplitudesFiles.at( i ), argumentMultipliersFile.at( i ), minimumAmplitude );
-            argumentAmplitudes_.push_back( conversionFactor * dataFromFile.first );
+            if( dataFromFile.first.cols( ) < 2 * numberOfComponents ||
+                    dataFromFile.first.rows( ) != dataFromFile.second.rows( ) )
+            {
+                throw std::runtime_error( "Error when calling ShortPeriodEarthOrientationCorrectionCalculator, data in files " +
+                                          amplitudesFiles.at( i ) + " and " + argumentMultipliersFile.at( i ) +
+                                          " is inconsistent" );
+            }
+
+            // Split amplitudes in sine and cosine amplitudes, stored as (number of terms x number of components) matrices
+            Eigen::MatrixXd currentSineAmplitudes = Eigen::MatrixXd( dataFromFile.first.rows( ), numberOfComponents );
+            Eigen::MatrixXd currentCosineAmplitudes = Eigen::MatrixXd( dataFromFile.first.rows( ), numberOfComponents );
+            for( int j = 0; j < numberOfComponents; j++ )
+            {
+                currentSineAmplitudes.col( j ) = conversionFactor * dataFromFile.first.col( 2 * j );
+                currentCosineAmplitudes.col( j ) = conversionFactor * dataFromFile.first.col( 2 * j + 1 );
+            }
+            sineAmplitudes_.push_back( currentSineAmplitudes );
+            cosineAmplitudes_.push_back( currentCosineAmplitudes );
             argumentMultipliers_.push_back( dataFromFile.second );
         }
     }
@@ -106,20 +171,94 @@ public:
         return sumCorrectionTerms( fundamentalArguments );
     }
 
+    //! Function to obtain short period corrections on a list of times.
+    /*!
+     *  Function to obtain short period corrections on a list of times (typically a time grid used to build a table of
+     *  Earth orientation parameters). The fundamental arguments are calculated internally, after which the corrections
+     *  are evaluated for blocks of times at once (see sumCorrectionTerms).
+     *  \param ephemerisTimes Times (TDB seconds since J2000) at which corretions are to be determined
+     *  \return Short period corrections at each of the ephemerisTimes
+     */
+    std::vector< OutputType > getCorrections( const std::vector< double >& ephemerisTimes )
+    {
+        const int maximumBlockSize = 512;
+
+        std::vector< OutputType > corrections;
+        corrections.reserve( ephemerisTimes.size( ) );
+
+        Eigen::Matrix< double, 6, Eigen::Dynamic > fundamentalArguments;
+        Eigen::MatrixXd blockCorrections;
+        for( unsigned int blockStart = 0; blockStart < ephemerisTimes.size( ); blockStart += maximumBlockSize )
+        {
+            // Compute fundamental arguments for all times in current block
+            int currentBlockSize = std::min( maximumBlockSize, static_cast< int >( ephemerisTimes.size( ) - blockStart ) );
+            fundamentalArguments.resize( 6, currentBlockSize );
+            for( int i = 0; i < currentBlockSize; i++ )
+            {
+                fundamentalArguments.col( i ) = argumentFunction_( ephemerisTimes.at( blockStart + i ) );
+            }
+
+            // Compute and store corrections for current block
+            sumCorrectionTerms( fundamentalArguments, blockCorrections );
+            for( int i = 0; i < currentBlockSize; i++ )
+            {
+                corrections.push_back( convertCorrectionComponents< OutputType >( blockCorrections.col( i ) ) );
+            }
+        }
+        return corrections;
+    }
+
 private:
 
     //! Function to sum all the corrcetion terms.
     /*!
-     *  Function to sum all the corrcetion terms.
+     *  Function to sum all the corrcetion terms. For each series of variations, the phase angles of all terms are
+     *  computed in a single matrix product, after which the sines and cosines are evaluated in bulk and the terms are summed
+     *  by a matrix-vector product with the amplitudes.
      * \param arguments Values of fundamental arguments
      * \return Total correction at current fundamental arguments
      */
-    OutputType sumCorrectionTerms( const Eigen::Vector6d& arguments );
+    OutputType sumCorrectionTerms( const Eigen::Vector6d& arguments )
+    {
+        Eigen::VectorXd correctionComponents = Eigen::VectorXd::Zero( getNumberOfCorrectionComponents< OutputType >( ) );
+        Eigen::ArrayXd phaseAngles;
+        for( unsigned int i = 0; i < argumentMultipliers_.size( ); i++ )
+        {
+            phaseAngles = ( argumentMultipliers_[ i ] * arguments ).array( );
+            correctionComponents += sineAmplitudes_[ i ].transpose( ) * phaseAngles.sin( ).matrix( ) +
+                    cosineAmplitudes_[ i ].transpose( ) * phaseAngles.cos( ).matrix( );
+        }
+        return convertCorrectionComponents< OutputType >( correctionComponents );
+    }
+
+    //! Function to sum all the corrcetion terms, for a list of values of the fundamental arguments.
+    /*!
+     *  Function to sum all the corrcetion terms, for a list of values of the fundamental arguments, in the same manner as the
+     *  single-argument version of this function, with the phase angles for all terms and all arguments computed in a
+     *  single matrix product per series of variations.
+     * \param arguments Values of fundamental arguments (one column per evaluation)
+     * \param correctionComponents Components of the total correction (one column per evaluation), returned by reference
+     */
+    void sumCorrectionTerms( const Eigen::Matrix< double, 6, Eigen::Dynamic >& arguments,
+                             Eigen::MatrixXd& correctionComponents )
+    {
+        correctionComponents = Eigen::MatrixXd::Zero( getNumberOfCorrectionComponents< OutputType >( ), arguments.cols( ) );
+        Eigen::ArrayXXd phaseAngles;
+        for( unsigned int i = 0; i < argumentMultipliers_.size( ); i++ )
+        {
+            phaseAngles = ( argumentMultipliers_[ i ] * arguments ).array( );
+            correctionComponents += sineAmplitudes_[ i ].transpose( ) * phaseAngles.sin( ).matrix( ) +
+                    cosineAmplitudes_[ i ].transpose( ) * phaseAngles.cos( ).matrix( );
+        }
+    }
+
+    //! Amplitudes of sine terms of variations, per series (number of terms x number of correction components).
+    std::vector< Eigen::MatrixXd > sineAmplitudes_;
 
-    //! Amplitudes of libration-induced variations
-    std::vector< Eigen::MatrixXd > argumentAmplitudes_;
+    //! Amplitudes of cosine terms of variations, per series (number of terms x number of correction components).
+    std::vector< Eigen::MatrixXd > cosineAmplitudes_;
 
-    //! Fundamental argument multipliers of libration-induced variations.
+    //! Fundamental argument multipliers of variations, per series (number of terms x 6).
     std::vector< Eigen::MatrixXd > argumentMultipliers_;
 
     //! Fundamental argument functions associated with multipliers.
@@ -12,10 +12,14 @@
 #ifndef TUDAT_RADIATIONPRESSUREINTERFACE_H
 #define TUDAT_RADIATIONPRESSUREINTERFACE_H
 
+#include <stdexcept>
+#include <string>
 #include <vector>
 
 #include <boost/function.hpp>
 #include <boost/lambda/lambda.hpp>
+#include <boost/make_shared.hpp>
+#include <boost/shared_ptr.hpp>
 
 #include <Eigen/Core>
 
@@ -61,6 +65,8 @@ public:
      *  result in slighlty underestimted radiation pressure.
      *  \param occultingBodyRadii List of radii of the bodies causing occultations (default none).
      *  \param sourceRadius Radius of the source body (used for occultation calculations) (default 0).
+     *  \param occultingBodyNames Names of the bodies causing occultations, in the same order as occultingBodyPositions
+     *  (default none; only used to reset the position functions when copying a body map).
      */
     RadiationPressureInterface(
             const boost::function< double( ) > sourcePower,
@@ -71,7 +77,8 @@ public:
             const std::vector< boost::function< Eigen::Vector3d( ) > > occultingBodyPositions =
             std::vector< boost::function< Eigen::Vector3d( ) > >( ),
             const std::vector< double > occultingBodyRadii = std::vector< double > ( ),
-            const double sourceRadius = 0.0 ):
+            const double sourceRadius = 0.0,
+            const std::vector< std::string > occultingBodyNames = std::vector< std::string >( ) ):
         sourcePower_( sourcePower ), sourcePositionFunction_( sourcePositionFunction ),
         targetPositionFunction_( targetPositionFunction ),
         radiationPressureCoefficient_( radiationPressureCoefficient ),
@@ -80,6 +87,7 @@ public:
         occultingBodyPositions_( occultingBodyPositions ),
         occultingBodyRadii_( occultingBodyRadii ),
         sourceRadius_( sourceRadius ),
+        occultingBodyNames_( occultingBodyNames ),
         currentRadiationPressure_( TUDAT_NAN ),
         currentSolarVector_( Eigen::Vector3d::Zero( ) ),
         currentTime_( TUDAT_NAN ){ }
@@ -232,6 +240,54 @@ public:
         return sourceRadius_;
     }
 
+    //! Function to return the names of the bodies causing occultations.
+    /*!
+     *  Function to return the names of the bodies causing occultations (empty if not provided to the constructor).
+     *  \return Names of the bodies causing occultations.
+     */
+    std::vector< std::string > getOccultingBodyNames( )
+    {
+        return occultingBodyNames_;
+    }
+
+    //! Function to reset the functions returning the positions of the bodies involved.
+    /*!
+     *  Function to reset the functions returning the positions of the source, target and occulting bodies, for instance
+     *  to let an independent copy of this object (see createIndependentCopy) use the bodies of a copied body map.
+     *  \param sourcePositionFunction Function returning the current position of the source body.
+     *  \param targetPositionFunction Function returning the current position of the target body.
+     *  \param occultingBodyPositions List of functions returning the positions of the bodies causing occultations (must
+     *  be of the same size as the current list).
+     */
+    void resetPositionFunctions(
+            const boost::function< Eigen::Vector3d( ) > sourcePositionFunction,
+            const boost::function< Eigen::Vector3d( ) > targetPositionFunction,
+            const std::vector< boost::function< Eigen::Vector3d( ) > > occultingBodyPositions )
+    {
+        if( occultingBodyPositions.size( ) != occultingBodyPositions_.size( ) )
+        {
+            throw std::runtime_error(
+                        "Error when resetting radiation pressure interface position functions, inconsistent number of "
+                        "occulting bodies." );
+        }
+        sourcePositionFunction_ = sourcePositionFunction;
+        targetPositionFunction_ = targetPositionFunction;
+        occultingBodyPositions_ = occultingBodyPositions;
+    }
+
+    //! Function to create a copy of the interface that can be updated independently of this object.
+    /*!
+     *  Function to create a copy of the interface that can be updated independently of this object (e.g. on a different
+     *  thread), with its own current radiation pressure and solar vector. The functions returning the source power,
+     *  radiation pressure coefficient and body positions are shared with this object; the position functions are to be
+     *  reset (see resetPositionFunctions) when the copy is used with a different set of bodies.
+     *  \return Copy of the interface that can be updated independently of this object.
+     */
+    virtual boost::shared_ptr< RadiationPressureInterface > createIndependentCopy( )
+    {
+        return boost::make_shared< RadiationPressureInterface >( *this );
+    }
+
 
 protected:
 
@@ -262,6 +318,9 @@ protected:
     //! Radius of the source body.
     double sourceRadius_;
 
+    //! Names of the bodies causing occultations.
+    std::vector< std::string > occultingBodyNames_;
+
     //! Current radiation pressure due to source at target (in N/m^2).
     double currentRadiationPressure_;
 
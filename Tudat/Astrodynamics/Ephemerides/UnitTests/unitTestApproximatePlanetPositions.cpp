@@ -113,6 +113,51 @@ BOOST_AUTO_TEST_CASE( testCircularCoplannar )
     BOOST_CHECK_EQUAL( marsEphemeris.getReferenceFrameOrigin( ), "Sun" );
 }
 
+//! Test the batched computation of planet states against the ApproximatePlanetPositions objects.
+BOOST_AUTO_TEST_CASE( testBatchedApproximatePlanetPositions )
+{
+    using namespace ephemerides;
+
+    // Define all planets, and epochs spanning the validity interval of the ephemeris (1800-2050 AD).
+    std::vector< ApproximatePlanetPositionsBase::BodiesWithEphemerisData > bodies;
+    for( unsigned int i = 0; i <= ApproximatePlanetPositionsBase::pluto; i++ )
+    {
+        bodies.push_back( static_cast< ApproximatePlanetPositionsBase::BodiesWithEphemerisData >( i ) );
+    }
+    const double referenceJulianDate = 2455626.5;
+    const int numberOfEpochs = 250;
+    Eigen::VectorXd epochs( numberOfEpochs );
+    for( int i = 0; i < numberOfEpochs; i++ )
+    {
+        epochs( i ) = ( -75000.0 + 365.25 * static_cast< double >( i ) + 0.37 ) * physical_constants::JULIAN_DAY;
+    }
+
+    std::vector< Eigen::Matrix< double, 6, Eigen::Dynamic > > batchedStates =
+            computeApproximatePlanetCartesianStates( bodies, epochs, 1.32712440018e20, referenceJulianDate );
+    BOOST_CHECK_EQUAL( batchedStates.size( ), bodies.size( ) );
+
+    for( unsigned int j = 0; j < bodies.size( ); j++ )
+    {
+        BOOST_CHECK_EQUAL( batchedStates.at( j ).cols( ), numberOfEpochs );
+
+        // Compare against states from ephemeris object (differences due to round-off in the large
+        // mean longitudes, which are reduced in radians instead of degrees), and check that shared
+        // data is used.
+        ApproximatePlanetPositions planetEphemeris( bodies.at( j ), 1.32712440018e20, referenceJulianDate );
+        BOOST_CHECK_EQUAL( &ApproximatePlanetPositionsBase::getPlanetData( bodies.at( j ) ),
+                           &ApproximatePlanetPositionsBase::getPlanetData( bodies.at( j ) ) );
+        for( int i = 0; i < numberOfEpochs; i++ )
+        {
+            Eigen::Vector6d expectedState = planetEphemeris.getCartesianState( epochs( i ) );
+            Eigen::Vector6d stateDifference = batchedStates.at( j ).col( i ) - expectedState;
+            BOOST_CHECK_SMALL( stateDifference.segment( 0, 3 ).norm( ) / expectedState.segment( 0, 3 ).norm( ),
+                               1.0E-11 );
+            BOOST_CHECK_SMALL( stateDifference.segment( 3, 3 ).norm( ) / expectedState.segment( 3, 3 ).norm( ),
+                               1.0E-11 );
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
@@ -20,6 +20,7 @@
 #include "Tudat/Astrodynamics/Ephemerides/tabulatedEphemeris.h"
 #include "Tudat/Basics/basicTypedefs.h"
 #include "Tudat/Mathematics/Interpolators/cubicSplineInterpolator.h"
+#include "Tudat/Mathematics/Interpolators/lagrangeInterpolator.h"
 
 namespace tudat
 {
@@ -140,6 +141,55 @@ BOOST_AUTO_TEST_CASE( testTabulatedEphemeris )
 
 }
 
+//! Test the creation of independent copies of a tabulated ephemeris, which share the tabulated data.
+BOOST_AUTO_TEST_CASE( testTabulatedEphemerisIndependentCopy )
+{
+    using namespace ephemerides;
+    using namespace interpolators;
+
+    // Create tabulated ephemeris with Lagrange interpolator.
+    std::map< double, Eigen::Vector6d > marsStateHistoryMap = getStateHistoryMap(
+                boost::make_shared< ApproximatePlanetPositions >( ApproximatePlanetPositionsBase::mars ) );
+    boost::shared_ptr< OneDimensionalInterpolator< double, Eigen::Vector6d > > marsStateInterpolator =
+            boost::make_shared< LagrangeInterpolator< double, Eigen::Vector6d > >( marsStateHistoryMap, 8 );
+    boost::shared_ptr< TabulatedCartesianEphemeris< > > tabulatedEphemeris =
+            boost::make_shared< TabulatedCartesianEphemeris< > >( marsStateInterpolator, "SSB", "J2000" );
+
+    // Create copy, and check that only look-up scheme is not shared.
+    boost::shared_ptr< TabulatedCartesianEphemeris< > > copiedEphemeris =
+            boost::dynamic_pointer_cast< TabulatedCartesianEphemeris< > >( tabulatedEphemeris->createIndependentCopy( ) );
+    BOOST_CHECK( copiedEphemeris != NULL );
+    BOOST_CHECK( copiedEphemeris->getInterpolator( ) != marsStateInterpolator );
+    BOOST_CHECK( copiedEphemeris->getInterpolator( )->getLookUpScheme( ) != marsStateInterpolator->getLookUpScheme( ) );
+    BOOST_CHECK_EQUAL( copiedEphemeris->getReferenceFrameOrigin( ), "SSB" );
+    BOOST_CHECK_EQUAL( copiedEphemeris->getReferenceFrameOrientation( ), "J2000" );
+    BOOST_CHECK( copiedEphemeris->getInterpolator( )->getIndependentValues( ) ==
+                 marsStateInterpolator->getIndependentValues( ) );
+
+    // Evaluate original and copy at alternating times (including boundaries), and compare to results of new interpolator.
+    boost::shared_ptr< OneDimensionalInterpolator< double, Eigen::Vector6d > > referenceInterpolator =
+            boost::make_shared< LagrangeInterpolator< double, Eigen::Vector6d > >( marsStateHistoryMap, 8 );
+    std::vector< double > testTimes = { 1.9337E5, 9.9999E6, 5.836392E6, 1500.0, 2.0E6 };
+    for( unsigned int i = 0; i < testTimes.size( ); i++ )
+    {
+        double originalTestTime = testTimes.at( i );
+        double copyTestTime = testTimes.at( testTimes.size( ) - 1 - i );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( referenceInterpolator->interpolate( originalTestTime ),
+                                           tabulatedEphemeris->getCartesianState( originalTestTime ), 0.0 );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( referenceInterpolator->interpolate( copyTestTime ),
+                                           copiedEphemeris->getCartesianState( copyTestTime ), 0.0 );
+    }
+
+    // Check that resetting the original does not modify the copy.
+    tabulatedEphemeris->resetInterpolator(
+                boost::make_shared< CubicSplineInterpolator< double, Eigen::Vector6d > >( marsStateHistoryMap ) );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( referenceInterpolator->interpolate( 3.0E6 ),
+                                       copiedEphemeris->getCartesianState( 3.0E6 ), 0.0 );
+
+    // Check that copies of interpolators without shared data are not supported.
+    BOOST_CHECK_THROW( tabulatedEphemeris->createIndependentCopy( ), std::runtime_error );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
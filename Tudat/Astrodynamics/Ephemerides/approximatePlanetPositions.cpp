@@ -157,5 +157,95 @@ Eigen::Vector6d ApproximatePlanetPositions::getKeplerianStateFromEphemeris(
     return planetKeplerianElementsAtGivenJulianDate_;
 }
 
+//! Compute Cartesian states of multiple planets at multiple epochs.
+std::vector< Eigen::Matrix< double, 6, Eigen::Dynamic > > computeApproximatePlanetCartesianStates(
+        const std::vector< ApproximatePlanetPositionsBase::BodiesWithEphemerisData >& bodiesWithEphemerisData,
+        const Eigen::VectorXd& secondsSinceEpoch,
+        const double sunGravitationalParameter,
+        const double referenceJulianDate,
+        const unsigned int numberOfNewtonIterations )
+{
+    using std::sin;
+    using std::cos;
+    using namespace orbital_element_conversions;
+    using unit_conversions::convertDegreesToRadians;
+
+    const int numberOfEpochs = secondsSinceEpoch.rows( );
+
+    // Compute number of centuries past J2000 for each epoch.
+    Eigen::VectorXd numberOfCenturiesPastJ2000( numberOfEpochs );
+    for ( int i = 0; i < numberOfEpochs; i++ )
+    {
+        numberOfCenturiesPastJ2000( i ) = ( basic_astrodynamics::convertSecondsSinceEpochToJulianDay(
+                                                secondsSinceEpoch( i ), referenceJulianDate ) - 2451545.0 ) / 36525.0;
+    }
+
+    std::vector< Eigen::Matrix< double, 6, Eigen::Dynamic > > cartesianStates;
+    Eigen::Matrix< double, 6, Eigen::Dynamic > keplerianElements( 6, numberOfEpochs );
+    Eigen::VectorXd eccentricities( numberOfEpochs );
+    Eigen::VectorXd meanAnomalies( numberOfEpochs );
+    Eigen::VectorXd eccentricAnomalies( numberOfEpochs );
+    for ( unsigned int j = 0; j < bodiesWithEphemerisData.size( ); j++ )
+    {
+        const ApproximatePlanetPositionsDataContainer& planetData =
+                ApproximatePlanetPositionsBase::getPlanetData( bodiesWithEphemerisData.at( j ) );
+
+        // Set elements at J2000 and their rates of change (per century) in SI units, with
+        // longitude of perihelion and mean longitude in place of argument of periapsis and true
+        // anomaly.
+        Eigen::Vector6d elementsAtJ2000, elementRates;
+        elementsAtJ2000 << unit_conversions::convertAstronomicalUnitsToMeters( planetData.semiMajorAxis_ ),
+                planetData.eccentricity_,
+                convertDegreesToRadians( planetData.inclination_ ),
+                convertDegreesToRadians( planetData.longitudeOfPerihelion_ ),
+                convertDegreesToRadians( planetData.longitudeOfAscendingNode_ ),
+                convertDegreesToRadians( planetData.meanLongitude_ );
+        elementRates << unit_conversions::convertAstronomicalUnitsToMeters(
+                            planetData.rateOfChangeOfSemiMajorAxis_ ),
+                planetData.rateOfChangeOfEccentricity_,
+                convertDegreesToRadians( planetData.rateOfChangeOfInclination_ ),
+                convertDegreesToRadians( planetData.rateOfChangeOfLongitudeOfPerihelion_ ),
+                convertDegreesToRadians( planetData.rateOfChangeOfLongitudeOfAscendingNode_ ),
+                convertDegreesToRadians( planetData.rateOfChangeOfMeanLongitude_ );
+        const double additionalTermB = convertDegreesToRadians( planetData.additionalTermB_ );
+        const double additionalTermC = convertDegreesToRadians( planetData.additionalTermC_ );
+        const double additionalTermS = convertDegreesToRadians( planetData.additionalTermS_ );
+
+        // Compute elements and mean anomaly at each epoch.
+        for ( int i = 0; i < numberOfEpochs; i++ )
+        {
+            const double centuries = numberOfCenturiesPastJ2000( i );
+            keplerianElements.col( i ) = elementsAtJ2000 + elementRates * centuries;
+
+            meanAnomalies( i ) = basic_mathematics::computeModulo(
+                        keplerianElements( trueAnomalyIndex, i ) - keplerianElements( argumentOfPeriapsisIndex, i )
+                        + additionalTermB * centuries * centuries
+                        + additionalTermC * cos( planetData.additionalTermF_ * centuries )
+                        + additionalTermS * sin( planetData.additionalTermF_ * centuries ),
+                        2.0 * mathematical_constants::PI );
+            keplerianElements( argumentOfPeriapsisIndex, i ) -= keplerianElements( longitudeOfAscendingNodeIndex, i );
+        }
+
+        // Solve Kepler's equation for all epochs.
+        eccentricities = keplerianElements.row( eccentricityIndex ).transpose( );
+        convertMeanAnomaliesToEccentricAnomalies(
+                    eccentricities.data( ), meanAnomalies.data( ), eccentricAnomalies.data( ),
+                    numberOfEpochs, numberOfNewtonIterations );
+
+        // Convert to Cartesian states.
+        Eigen::Matrix< double, 6, Eigen::Dynamic > planetStates( 6, numberOfEpochs );
+        for ( int i = 0; i < numberOfEpochs; i++ )
+        {
+            keplerianElements( trueAnomalyIndex, i ) = convertEccentricAnomalyToTrueAnomaly(
+                        eccentricAnomalies( i ), eccentricities( i ) );
+            planetStates.col( i ) = convertKeplerianToCartesianElements(
+                        Eigen::Vector6d( keplerianElements.col( i ) ), sunGravitationalParameter );
+        }
+        cartesianStates.push_back( planetStates );
+    }
+
+    return cartesianStates;
+}
+
 } // namespace ephemerides
 } // namespace tudat
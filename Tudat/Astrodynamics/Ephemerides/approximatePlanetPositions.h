@@ -16,6 +16,8 @@
 #ifndef TUDAT_APPROXIMATE_PLANET_POSITIONS_H
 #define TUDAT_APPROXIMATE_PLANET_POSITIONS_H
 
+#include <vector>
+
 #include <boost/shared_ptr.hpp>
 
 #include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
@@ -82,6 +84,16 @@ public:
     Eigen::Vector6d getKeplerianStateFromEphemeris(
             const double secondsSinceEpoch );
 
+    //! Function to create a copy of the ephemeris that can be evaluated independently of this object.
+    /*!
+     * Function to create a copy of the ephemeris that can be evaluated independently of this object.
+     * \return Copy of the ephemeris that can be evaluated independently of this object.
+     */
+    boost::shared_ptr< Ephemeris > createIndependentCopy( )
+    {
+        return boost::make_shared< ApproximatePlanetPositions >( *this );
+    }
+
 protected:
 
 private:
@@ -116,6 +128,34 @@ private:
 //! Typedef for shared-pointer to ApproximatePlanetPositions object.
 typedef boost::shared_ptr< ApproximatePlanetPositions > ApproximatePlanetPositionsPointer;
 
+//! Compute Cartesian states of multiple planets at multiple epochs.
+/*!
+ * Computes the Cartesian states of multiple planets at multiple epochs, using the JPL "Approximate
+ * Positions of Major Planets" ephemeris, with results equal (to within round-off) to those of
+ * ApproximatePlanetPositions::getCartesianState. For use in mission design sweeps, in which the
+ * planet states are required at a large number of epochs: the ephemeris data is retrieved from the
+ * shared table (see ApproximatePlanetPositionsBase::getPlanetData) and converted to SI units only
+ * once per planet, the epochs are converted to centuries past J2000 only once, and Kepler's equation
+ * is solved for all epochs of a planet at once, using a fixed number of iterations (see
+ * convertMeanAnomaliesToEccentricAnomalies). Unlike ApproximatePlanetPositions::getCartesianState,
+ * this function does not modify any state, and may be called concurrently from multiple threads.
+ * \param bodiesWithEphemerisData Planets for which the states are to be computed.
+ * \param secondsSinceEpoch Epochs at which the states are to be computed, in seconds since the
+ * reference Julian date.
+ * \param sunGravitationalParameter The gravitational parameter of the Sun [m^3/s^2].
+ * \param referenceJulianDate Reference julian day w.r.t. which ephemeris is evaluated.
+ * \param numberOfNewtonIterations Number of Newton-Raphson iterations used in the solution of Kepler's
+ * equation (see solveKeplersEquationForEllipticalOrbitWithFixedIterations).
+ * \return Cartesian states of the planets (one entry per planet, in order of input), with one column
+ * per epoch.
+ */
+std::vector< Eigen::Matrix< double, 6, Eigen::Dynamic > > computeApproximatePlanetCartesianStates(
+        const std::vector< ApproximatePlanetPositionsBase::BodiesWithEphemerisData >& bodiesWithEphemerisData,
+        const Eigen::VectorXd& secondsSinceEpoch,
+        const double sunGravitationalParameter = 1.32712440018e20,
+        const double referenceJulianDate = basic_astrodynamics::JULIAN_DAY_ON_J2000,
+        const unsigned int numberOfNewtonIterations = 1 );
+
 } // namespace ephemerides
 } // namespace tudat
 
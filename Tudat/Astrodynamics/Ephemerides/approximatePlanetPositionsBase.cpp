@@ -13,6 +13,10 @@
  *
  */
 
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
 #include "Tudat/Astrodynamics/Ephemerides/approximatePlanetPositionsBase.h"
 #include "Tudat/InputOutput/basicInputOutput.h"
 
@@ -21,163 +25,159 @@ namespace tudat
 namespace ephemerides
 {
 
-//! Set planet.
-void ApproximatePlanetPositionsBase::setPlanet( BodiesWithEphemerisData bodyWithEphemerisData )
+//! Read the lines of the ephemeris data file into a container.
+void readApproximatePlanetPositionsFile( std::map< unsigned int, std::string >& containerOfDataFromEphemerisFile )
 {
-    // Check if ephemeris data has been loaded, and reload data if not.
-    if ( containerOfDataFromEphemerisFile_.size( ) == 0 )
+    // Set  path to ephemeris file in file reader.
+    std::string filePath_ = input_output::getTudatRootPath( ) +
+            "External/EphemerisData/p_elem_t2.txt";
+
+    // Open ephemeris file.
+    std::ifstream ephemerisFile_( filePath_.c_str( ) );
+    if ( ephemerisFile_.fail( ) )
     {
-        reloadData( );
+        throw std::runtime_error(
+                    "Data file could not be opened:" + filePath_ );
     }
 
-    switch ( bodyWithEphemerisData )
+    // Read the file into a container.
+    for ( int line = 1; line < 53; line++ )
     {
-    case mercury:
-
-        parseEphemerisLineData_( 18 );
-        break;
-
-    case venus:
-
-        parseEphemerisLineData_( 20 );
-        break;
-
-    case earthMoonBarycenter:
-
-        parseEphemerisLineData_( 22 );
-        break;
-
-    case mars:
-
-        parseEphemerisLineData_( 24 );
-        break;
-
-    case jupiter:
-
-        parseEphemerisLineData_( 26 );
-        parseExtraTermsEphemerisLineData_( 48 );
-        break;
+        std::string lineData;
+        getline( ephemerisFile_, lineData );
+        containerOfDataFromEphemerisFile[line] = lineData;
+        if ( ephemerisFile_.fail( ) )
+        {
+            break;
+        }
+    }
 
-    case saturn:
+    // Close file.
+    ephemerisFile_.close( );
+}
 
-        parseEphemerisLineData_( 28 );
-        parseExtraTermsEphemerisLineData_( 49 );
-        break;
+//! Parse the two lines of ephemeris data of a planet into a data container.
+void parseApproximatePlanetPositionsLineData(
+        std::map< unsigned int, std::string >& containerOfDataFromEphemerisFile,
+        const unsigned int firstLineNumber,
+        ApproximatePlanetPositionsDataContainer& approximatePlanetPositionsDataContainer )
+{
+    // Read first line of data.
+    std::istringstream ephemerisLineData( containerOfDataFromEphemerisFile[ firstLineNumber ] );
 
-    case uranus:
+    ephemerisLineData >> approximatePlanetPositionsDataContainer.planetName_;
 
-        parseEphemerisLineData_( 30 );
-        parseExtraTermsEphemerisLineData_( 50 );
-        break;
+    // Check if the line number corresponds to that for "EM Bary".
+    if ( firstLineNumber == 22 )
+    {
+        std::string earthMoonBarycenter_;
 
-    case neptune:
+        ephemerisLineData >> earthMoonBarycenter_;
+        approximatePlanetPositionsDataContainer.planetName_ += " " + earthMoonBarycenter_;
+    }
 
-        parseEphemerisLineData_( 32 );
-        parseExtraTermsEphemerisLineData_( 51 );
-        break;
+    ephemerisLineData >> approximatePlanetPositionsDataContainer.semiMajorAxis_;
+    ephemerisLineData >> approximatePlanetPositionsDataContainer.eccentricity_;
+    ephemerisLineData >> approximatePlanetPositionsDataContainer.inclination_;
+    ephemerisLineData >> approximatePlanetPositionsDataContainer.meanLongitude_;
+    ephemerisLineData >> approximatePlanetPositionsDataContainer.longitudeOfPerihelion_;
+    ephemerisLineData >> approximatePlanetPositionsDataContainer.longitudeOfAscendingNode_;
 
-    case pluto:
+    // Read second line of data.
+    ephemerisLineData.clear( );
+    ephemerisLineData.str( containerOfDataFromEphemerisFile[ firstLineNumber + 1 ] );
+
+    ephemerisLineData >> approximatePlanetPositionsDataContainer.rateOfChangeOfSemiMajorAxis_;
+    ephemerisLineData >> approximatePlanetPositionsDataContainer.rateOfChangeOfEccentricity_;
+    ephemerisLineData >> approximatePlanetPositionsDataContainer.rateOfChangeOfInclination_;
+    ephemerisLineData >> approximatePlanetPositionsDataContainer.rateOfChangeOfMeanLongitude_;
+    ephemerisLineData >> approximatePlanetPositionsDataContainer
+                         .rateOfChangeOfLongitudeOfPerihelion_;
+    ephemerisLineData >> approximatePlanetPositionsDataContainer
+                         .rateOfChangeOfLongitudeOfAscendingNode_;
+}
 
-        parseEphemerisLineData_( 34 );
-        parseExtraTermsEphemerisLineData_( 52 );
-        break;
+//! Parse the line of extra terms of ephemeris data of a planet into a data container.
+void parseApproximatePlanetPositionsExtraTermsLineData(
+        std::map< unsigned int, std::string >& containerOfDataFromEphemerisFile,
+        const unsigned int lineNumber,
+        ApproximatePlanetPositionsDataContainer& approximatePlanetPositionsDataContainer )
+{
+    std::istringstream ephemerisLineData( containerOfDataFromEphemerisFile[ lineNumber ] );
 
-    default:
-        break;
-    }
+    ephemerisLineData >> approximatePlanetPositionsDataContainer.planetName_;
+    ephemerisLineData >> approximatePlanetPositionsDataContainer.additionalTermB_;
+    ephemerisLineData >> approximatePlanetPositionsDataContainer.additionalTermC_;
+    ephemerisLineData >> approximatePlanetPositionsDataContainer.additionalTermS_;
+    ephemerisLineData >> approximatePlanetPositionsDataContainer.additionalTermF_;
 }
 
-//! Parse ephemeris line data.
-void ApproximatePlanetPositionsBase::parseEphemerisLineData_( const unsigned int& firstLineNumber )
+//! Parse the ephemeris data of all planets from the ephemeris data file.
+std::vector< ApproximatePlanetPositionsDataContainer > loadApproximatePlanetPositionsData( )
 {
-    // Parse data from container of strings using a string stream.
+    std::map< unsigned int, std::string > containerOfDataFromEphemerisFile;
+    readApproximatePlanetPositionsFile( containerOfDataFromEphemerisFile );
 
-    // Clear stringstream.
-    ephemerisLineData_.clear( );
+    // Parse data of each planet, in order of BodiesWithEphemerisData. The extra terms are only
+    // provided for the outer planets (Jupiter to Pluto).
+    std::vector< ApproximatePlanetPositionsDataContainer > planetData( 9 );
+    for ( unsigned int i = 0; i < planetData.size( ); i++ )
+    {
+        parseApproximatePlanetPositionsLineData(
+                    containerOfDataFromEphemerisFile, 18 + 2 * i, planetData[ i ] );
+        if ( i >= static_cast< unsigned int >( ApproximatePlanetPositionsBase::jupiter ) )
+        {
+            parseApproximatePlanetPositionsExtraTermsLineData(
+                        containerOfDataFromEphemerisFile, 44 + i, planetData[ i ] );
+        }
+    }
 
-    // Read first line of data.
-    ephemerisLineData_ << containerOfDataFromEphemerisFile_[ firstLineNumber ];
+    return planetData;
+}
 
-    ephemerisLineData_ >> approximatePlanetPositionsDataContainer_.planetName_;
+//! Get ephemeris data of planet.
+const ApproximatePlanetPositionsDataContainer& ApproximatePlanetPositionsBase::getPlanetData(
+        const BodiesWithEphemerisData bodyWithEphemerisData )
+{
+    // Data is parsed only once, initialization of the local static is thread-safe.
+    static const std::vector< ApproximatePlanetPositionsDataContainer > planetData =
+            loadApproximatePlanetPositionsData( );
 
-    // Check if the line number corresponds to that for "EM Bary".
-    if ( firstLineNumber == 22 )
+    if ( static_cast< unsigned int >( bodyWithEphemerisData ) >= planetData.size( ) )
     {
-        std::string earthMoonBarycenter_;
-
-        ephemerisLineData_ >> earthMoonBarycenter_;
-        approximatePlanetPositionsDataContainer_.planetName_ += " " + earthMoonBarycenter_;
+        throw std::runtime_error( "Error, no approximate planet positions data for body " +
+                                  std::to_string( bodyWithEphemerisData ) );
     }
+    return planetData[ bodyWithEphemerisData ];
+}
 
-    ephemerisLineData_ >> approximatePlanetPositionsDataContainer_.semiMajorAxis_;
-    ephemerisLineData_ >> approximatePlanetPositionsDataContainer_.eccentricity_;
-    ephemerisLineData_ >> approximatePlanetPositionsDataContainer_.inclination_;
-    ephemerisLineData_ >> approximatePlanetPositionsDataContainer_.meanLongitude_;
-    ephemerisLineData_ >> approximatePlanetPositionsDataContainer_.longitudeOfPerihelion_;
-    ephemerisLineData_ >> approximatePlanetPositionsDataContainer_.longitudeOfAscendingNode_;
-
-    // Clear stringstream.
-    ephemerisLineData_.clear( );
+//! Set planet.
+void ApproximatePlanetPositionsBase::setPlanet( BodiesWithEphemerisData bodyWithEphemerisData )
+{
+    approximatePlanetPositionsDataContainer_ = getPlanetData( bodyWithEphemerisData );
+}
 
-    // Read second line of data.
-    ephemerisLineData_ << containerOfDataFromEphemerisFile_[ firstLineNumber + 1 ];
-
-    ephemerisLineData_ >> approximatePlanetPositionsDataContainer_.rateOfChangeOfSemiMajorAxis_;
-    ephemerisLineData_ >> approximatePlanetPositionsDataContainer_.rateOfChangeOfEccentricity_;
-    ephemerisLineData_ >> approximatePlanetPositionsDataContainer_.rateOfChangeOfInclination_;
-    ephemerisLineData_ >> approximatePlanetPositionsDataContainer_.rateOfChangeOfMeanLongitude_;
-    ephemerisLineData_ >> approximatePlanetPositionsDataContainer_
-                          .rateOfChangeOfLongitudeOfPerihelion_;
-    ephemerisLineData_ >> approximatePlanetPositionsDataContainer_
-                          .rateOfChangeOfLongitudeOfAscendingNode_;
+//! Parse ephemeris line data.
+void ApproximatePlanetPositionsBase::parseEphemerisLineData_( const unsigned int& firstLineNumber )
+{
+    parseApproximatePlanetPositionsLineData(
+                containerOfDataFromEphemerisFile_, firstLineNumber,
+                approximatePlanetPositionsDataContainer_ );
 }
 
 //! Parse line data for extra terms for ephemeris.
 void ApproximatePlanetPositionsBase::parseExtraTermsEphemerisLineData_(
     const unsigned int& lineNumber )
 {
-    // Clear stringstream.
-    ephemerisLineData_.clear( );
-
-    // Read second line of data.
-    ephemerisLineData_ << containerOfDataFromEphemerisFile_[ lineNumber ];
-
-    ephemerisLineData_ >> approximatePlanetPositionsDataContainer_.planetName_;
-    ephemerisLineData_ >> approximatePlanetPositionsDataContainer_.additionalTermB_;
-    ephemerisLineData_ >> approximatePlanetPositionsDataContainer_.additionalTermC_;
-    ephemerisLineData_ >> approximatePlanetPositionsDataContainer_.additionalTermS_;
-    ephemerisLineData_ >> approximatePlanetPositionsDataContainer_.additionalTermF_;
+    parseApproximatePlanetPositionsExtraTermsLineData(
+                containerOfDataFromEphemerisFile_, lineNumber,
+                approximatePlanetPositionsDataContainer_ );
 }
 
 //! Load in ephemeris data for planets.
 void ApproximatePlanetPositionsBase::reloadData( )
 {
-    // Set  path to ephemeris file in file reader.
-    std::string filePath_ = input_output::getTudatRootPath( ) +
-            "External/EphemerisData/p_elem_t2.txt";
-
-    // Open ephemeris file.
-    std::ifstream ephemerisFile_( filePath_.c_str( ) );
-    if ( ephemerisFile_.fail( ) )
-    {
-        throw std::runtime_error(
-                    "Data file could not be opened:" + filePath_ );
-    }
-
-    // Read the file into a container.
-    for ( int line = 1; line < 53; line++ )
-    {
-        std::string lineData;
-        getline( ephemerisFile_, lineData );
-        containerOfDataFromEphemerisFile_[line] = lineData;
-        if ( ephemerisFile_.fail( ) )
-        {
-            break;
-        }
-    }
-
-    // Close file.
-    ephemerisFile_.close( );
+    readApproximatePlanetPositionsFile( containerOfDataFromEphemerisFile_ );
 }
 
 } // namespace ephemerides
@@ -19,6 +19,7 @@
 #include <cmath>
 #include <map>
 #include <string>
+#include <vector>
 
 #include <boost/shared_ptr.hpp>
 
@@ -62,8 +63,7 @@ public:
           sunGravitationalParameter( aSunGravitationalParameter ),
           julianDate_( -0.0 ),
           meanLongitudeAtGivenJulianDate_( -0.0 ),
-          numberOfCenturiesPastJ2000_( -0.0 ),
-          ephemerisLineData_( )
+          numberOfCenturiesPastJ2000_( -0.0 )
     { }
 
     //! Default destructor.
@@ -88,11 +88,23 @@ public:
      * This method opens and parses the p_elem_t2.txt ephemeris files for the planet positions.
      * The resulting data is stored in
      * ApproximatePlanetPositionsBase::containerOfDataFromEphemerisFile_ to be used in the
-     * generation of planet ephemeris. This method is automatically invoked if you call
-     * ApproximatePlanetPositionsBase::setPlanet( BodiesWithEphemerisData ).
+     * generation of planet ephemeris. Note that ApproximatePlanetPositionsBase::setPlanet(
+     * BodiesWithEphemerisData ) no longer uses this container, but retrieves the planet data from
+     * the shared table returned by getPlanetData( ).
      */
     void reloadData( );
 
+    //! Get ephemeris data of planet.
+    /*!
+     * Returns the ephemeris data of a planet from a table that is shared by all objects. The table
+     * is parsed from the p_elem_t2.txt ephemeris file upon the first call to this function, and is
+     * not modified afterwards, so that it may safely be accessed from multiple threads.
+     * \param bodyWithEphemerisData Planet.
+     * \return Ephemeris data of planet.
+     */
+    static const ApproximatePlanetPositionsDataContainer& getPlanetData(
+            const BodiesWithEphemerisData bodyWithEphemerisData );
+
     //! Returns the gravitational parameter of the Sun.
     /*!
      *  Returns the gravitational parameter of the Sun that is used in the calculations.
@@ -152,12 +164,6 @@ protected:
      */
     Eigen::Vector6d planetKeplerianElementsAtGivenJulianDate_;
 
-    //! String stream for ephemeris line data.
-    /*!
-     * String stream for ephemeris line data.
-     */
-    std::stringstream ephemerisLineData_;
-
 private:
 };
 
@@ -76,6 +76,16 @@ public:
     Eigen::Vector6d getCartesianState(
             const double secondsSinceEpoch );
 
+    //! Function to create a copy of the ephemeris that can be evaluated independently of this object.
+    /*!
+     * Function to create a copy of the ephemeris that can be evaluated independently of this object.
+     * \return Copy of the ephemeris that can be evaluated independently of this object.
+     */
+    boost::shared_ptr< Ephemeris > createIndependentCopy( )
+    {
+        return boost::make_shared< ApproximatePlanetPositionsCircularCoplanar >( *this );
+    }
+
 protected:
 
 private:
@@ -78,6 +78,16 @@ public:
         constantStateFunction_ = boost::lambda::constant( newState );
     }
 
+    //! Function to create a copy of the ephemeris that can be evaluated independently of this object.
+    /*!
+     * Function to create a copy of the ephemeris that can be evaluated independently of this object.
+     * \return Copy of the ephemeris, with the same constant state function.
+     */
+    boost::shared_ptr< Ephemeris > createIndependentCopy( )
+    {
+        return boost::make_shared< ConstantEphemeris >( *this );
+    }
+
 private:
 
     //! Time-independent state function.
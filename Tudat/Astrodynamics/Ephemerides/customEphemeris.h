@@ -55,6 +55,17 @@ public:
         return stateFunction_( seconsSinceEpoch );
     }
 
+    //! Function to create a copy of the ephemeris that can be evaluated independently of this object.
+    /*!
+     * Function to create a copy of the ephemeris that can be evaluated independently of this object. Note that the
+     * state function is shared between the copies, and must therefore not modify any shared data.
+     * \return Copy of the ephemeris, with the same state function.
+     */
+    boost::shared_ptr< Ephemeris > createIndependentCopy( )
+    {
+        return boost::make_shared< CustomEphemeris >( *this );
+    }
+
 private:
 
     //! Time-independent state function.
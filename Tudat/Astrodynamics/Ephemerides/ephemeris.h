@@ -12,7 +12,10 @@
 #ifndef TUDAT_EPHEMERIS_H
 #define TUDAT_EPHEMERIS_H
 
+#include <stdexcept>
+
 #include <boost/shared_ptr.hpp>
+#include <boost/make_shared.hpp>
 #include <boost/function.hpp>
 
 #include "Tudat/Astrodynamics/Ephemerides/ephemeris.h"
@@ -105,6 +108,18 @@ public:
         return getCartesianLongState( currentTime.getSeconds< double >( ) );
     }
 
+    //! Function to create a copy of the ephemeris that can be evaluated independently of this object.
+    /*!
+     * Function to create a copy of the ephemeris that can be evaluated independently of this object (e.g. on a different
+     * thread), sharing all data that is not modified when evaluating the ephemeris. By default, this function throws an
+     * error; it is overridden by derived classes for which such a copy is supported.
+     * \return Copy of the ephemeris that can be evaluated independently of this object.
+     */
+    virtual boost::shared_ptr< Ephemeris > createIndependentCopy( )
+    {
+        throw std::runtime_error( "Error, creating an independent copy of this ephemeris type is not supported." );
+    }
+
     //! Get state from ephemeris, with state scalar as template type.
     /*!
      * Returns state from ephemeris (state scalar as template type) at given time.
@@ -37,26 +37,29 @@ class GcrsToItrsRotationModel: public RotationalEphemeris
 {
 public:
 
-    //    //! Constructor taking interpolator providing the earth orientation angles.
-    //    /*!
-    //     *  Constructor taking interpolator providing the earth orientation angles.
-    //     *  \param anglesInterpolator Interpolator providing the earth orientation angles (dependent variable) as a function of time (independent
-    //     *  variable) The return vector of the interpolator provides the values for X-nutation correction, Y-nutation correction,
-    //     *  CIO-locator, earth orientation angle, x-component polar motion, y-component polar motion.
-    //     */
-    //    GcrsToItrsRotationModel( const boost::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::Vector6d > >
-    //                        anglesInterpolator,
-    //                        const basic_astrodynamics::TimeScales inputTimeScale  = basic_astrodynamics::tdb_scale ):
-    //        RotationalEphemeris( "GCRS", "ITRS" ), anglesCalculator_( NULL ), inputTimeScale_( inputTimeScale )
-    //    {
-    //        using namespace interpolators;
-
-    //        // Set function binding to interpolator.
-    //        functionToGetRotationAngles = boost::bind(
-    //                    static_cast< Eigen::Vector6d(
-    //                        interpolators::OneDimensionalInterpolator< double, Eigen::Vector6d >::* )( const double )>
-    //                    ( &interpolators::OneDimensionalInterpolator< double, Eigen::Vector6d >::interpolate ), anglesInterpolator, _1 );
-    //    }
+    //! Constructor taking interpolators providing the earth orientation angles and UT1.
+    /*!
+     *  Constructor taking interpolators providing the earth orientation angles and UT1 (typically created by
+     *  createInterpolatorsForItrsToGcrsAngles), so that the full earth orientation model need not be evaluated for each
+     *  call to this object, which prevents it from becoming a computational bottleneck when evaluated many times
+     *  over a limited time span.
+     *  \param anglesInterpolator Interpolator providing the earth orientation angles (dependent variable) as a function of
+     *  time (independent variable) The return vector of the interpolator provides the values for (in IERS Conventions 2010
+     *  notation): X, Y, s, xp, yp.
+     *  \param ut1Interpolator Interpolator providing UT1 as a function of time.
+     *  \param inputTimeScale Time scale in which input to this class (in getRotationToBaseFrame,
+     *  getDerivativeOfRotationFromFrame) is provided, must be equal to the time scale in which the independent variables of
+     *  the interpolators are defined.
+     */
+    GcrsToItrsRotationModel(
+            const boost::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::Vector5d > > anglesInterpolator,
+            const boost::shared_ptr< interpolators::OneDimensionalInterpolator< double, double > > ut1Interpolator,
+            const basic_astrodynamics::TimeScales inputTimeScale  = basic_astrodynamics::tdb_scale ):
+        RotationalEphemeris( "GCRS", "ITRS" ), inputTimeScale_( inputTimeScale ),
+        anglesInterpolator_( anglesInterpolator ), ut1Interpolator_( ut1Interpolator )
+    {
+        functionToGetRotationAngles = boost::bind( &GcrsToItrsRotationModel::getInterpolatedRotationAngles, this, _1 );
+    }
 
     //! Constructor taking class calculating earth orientation angles directly
     /*!
@@ -84,15 +87,22 @@ public:
     Eigen::Quaterniond getRotationToBaseFrame( const double ephemerisTime )
     {
         return earth_orientation::calculateRotationFromItrsToGcrs< double >(
-                    anglesCalculator_->getRotationAnglesFromItrsToGcrs< double >( ephemerisTime, inputTimeScale_ ),
-                    ephemerisTime );
+                    functionToGetRotationAngles( ephemerisTime ), ephemerisTime );
     }
 
     Eigen::Quaterniond getRotationToBaseFrameFromExtendedTime( const Time ephemerisTime )
     {
-        return earth_orientation::calculateRotationFromItrsToGcrs< Time >(
-                    anglesCalculator_->getRotationAnglesFromItrsToGcrs< Time >( ephemerisTime, inputTimeScale_ ),
-                    ephemerisTime );
+        // Interpolated angles are only available in double precision
+        if( anglesCalculator_ == NULL )
+        {
+            return getRotationToBaseFrame( ephemerisTime.getSeconds< double >( ) );
+        }
+        else
+        {
+            return earth_orientation::calculateRotationFromItrsToGcrs< Time >(
+                        anglesCalculator_->getRotationAnglesFromItrsToGcrs< Time >( ephemerisTime, inputTimeScale_ ),
+                        ephemerisTime );
+        }
     }
 
 
@@ -136,9 +146,41 @@ public:
         return inputTimeScale_;
     }
 
+    //! Function to retrieve the interpolator providing the earth orientation angles
+    /*!
+     * Function to retrieve the interpolator providing the earth orientation angles (NULL if angles are computed directly
+     * by the angles calculator)
+     * \return Interpolator providing the earth orientation angles
+     */
+    boost::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::Vector5d > > getAnglesInterpolator( )
+    {
+        return anglesInterpolator_;
+    }
+
+    //! Function to retrieve the interpolator providing UT1
+    /*!
+     * Function to retrieve the interpolator providing UT1 (NULL if UT1 is computed directly by the angles calculator)
+     * \return Interpolator providing UT1
+     */
+    boost::shared_ptr< interpolators::OneDimensionalInterpolator< double, double > > getUt1Interpolator( )
+    {
+        return ut1Interpolator_;
+    }
 
 private:
 
+    //! Function to retrieve the earth orientation angles and UT1 from the interpolators
+    /*!
+     * Function to retrieve the earth orientation angles and UT1 from the interpolators
+     * \param ephemerisTime Time at which the angles are to be computed
+     * \return Earth orientation angles X, Y, s, xp, yp (first) and UT1 (second)
+     */
+    std::pair< Eigen::Vector5d, double > getInterpolatedRotationAngles( const double& ephemerisTime )
+    {
+        return std::make_pair( anglesInterpolator_->interpolate( ephemerisTime ),
+                               ut1Interpolator_->interpolate( ephemerisTime ) );
+    }
+
     //! Function providing the earth orientation angles as a function of time
     /*!
      * Function providing the earth orientation angles as a function of time.
@@ -150,6 +192,12 @@ private:
     boost::shared_ptr< earth_orientation::EarthOrientationAnglesCalculator > anglesCalculator_;
 
     basic_astrodynamics::TimeScales inputTimeScale_;
+
+    //! Interpolator providing the earth orientation angles (NULL if not used)
+    boost::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::Vector5d > > anglesInterpolator_;
+
+    //! Interpolator providing UT1 (NULL if not used)
+    boost::shared_ptr< interpolators::OneDimensionalInterpolator< double, double > > ut1Interpolator_;
 };
 
 }
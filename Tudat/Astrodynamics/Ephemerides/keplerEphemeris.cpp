@@ -31,6 +31,8 @@ KeplerEphemeris::KeplerEphemeris(
         const double rootFinderMaximumNumberOfIterations ):
     Ephemeris( referenceFrameOrigin, referenceFrameOrientation ),
     initialStateInKeplerianElements_( initialStateInKeplerianElements ),
+    rootFinderAbsoluteTolerance_( rootFinderAbsoluteTolerance ),
+    rootFinderMaximumNumberOfIterations_( rootFinderMaximumNumberOfIterations ),
     epochOfInitialState_( epochOfInitialState ),
     centralBodyGravitationalParameter_( centralBodyGravitationalParameter )
 {
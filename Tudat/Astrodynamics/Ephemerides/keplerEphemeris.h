@@ -76,6 +76,20 @@ public:
     Eigen::Vector6d getCartesianState(
             const double secondsSinceEpoch );
 
+    //! Function to create a copy of the ephemeris that can be evaluated independently of this object.
+    /*!
+     * Function to create a copy of the ephemeris that can be evaluated independently of this object, with a new root
+     * finder for the conversion of mean to eccentric anomalies.
+     * \return Copy of the ephemeris that can be evaluated independently of this object.
+     */
+    boost::shared_ptr< Ephemeris > createIndependentCopy( )
+    {
+        return boost::make_shared< KeplerEphemeris >(
+                    initialStateInKeplerianElements_, epochOfInitialState_, centralBodyGravitationalParameter_,
+                    referenceFrameOrigin_, referenceFrameOrientation_, rootFinderAbsoluteTolerance_,
+                    rootFinderMaximumNumberOfIterations_ );
+    }
+
 private:
 
     //! Kepler elements at time epochOfInitialState.
@@ -99,6 +113,12 @@ private:
     //! Root finder used to convert mean to eccentric anomalies.
     boost::shared_ptr< root_finders::RootFinderCore< double > > rootFinder_;
 
+    //! Convergence tolerance for root finder used to convert mean to eccentric anomaly.
+    double rootFinderAbsoluteTolerance_;
+
+    //! Maximum iteration for root finder used to convert mean to eccentric anomaly.
+    double rootFinderMaximumNumberOfIterations_;
+
     //! Initial epoch from which propagation of Kepler orbit is performed.
     double epochOfInitialState_;
 
@@ -167,6 +167,23 @@ public:
         return singleArcEphemerides_;
     }
 
+    //! Function to create a copy of the ephemeris that can be evaluated independently of this object.
+    /*!
+     * Function to create a copy of the ephemeris that can be evaluated independently of this object, with independent
+     * copies of the constituent arc ephemerides and a new lookup scheme.
+     * \return Copy of the ephemeris that can be evaluated independently of this object.
+     */
+    boost::shared_ptr< Ephemeris > createIndependentCopy( )
+    {
+        std::map< double, boost::shared_ptr< Ephemeris > > copiedSingleArcEphemerides;
+        for( unsigned int i = 0; i < singleArcEphemerides_.size( ); i++ )
+        {
+            copiedSingleArcEphemerides[ arcStartTimes_.at( i ) ] = singleArcEphemerides_.at( i )->createIndependentCopy( );
+        }
+        return boost::make_shared< MultiArcEphemeris >(
+                    copiedSingleArcEphemerides, referenceFrameOrigin_, referenceFrameOrientation_ );
+    }
+
 
 private:
 
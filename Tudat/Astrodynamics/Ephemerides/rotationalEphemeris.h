@@ -12,9 +12,11 @@
 #ifndef TUDAT_ROTATIONAL_EPHEMERIS_H
 #define TUDAT_ROTATIONAL_EPHEMERIS_H
 
+#include <stdexcept>
 #include <string>
 
 #include <boost/function.hpp>
+#include <boost/shared_ptr.hpp>
 
 #include <Eigen/Core>
 #include <Eigen/Geometry>
@@ -436,6 +438,19 @@ public:
      */
     std::string getTargetFrameOrientation( ) { return targetFrameOrientation_; }
 
+    //! Function to create a copy of the rotational ephemeris that can be evaluated independently of this object.
+    /*!
+     * Function to create a copy of the rotational ephemeris that can be evaluated independently of this object (e.g. on
+     * a different thread). By default, this function throws an error; it is overridden by derived classes for which
+     * such a copy is supported.
+     * \return Copy of the rotational ephemeris that can be evaluated independently of this object.
+     */
+    virtual boost::shared_ptr< RotationalEphemeris > createIndependentCopy( )
+    {
+        throw std::runtime_error(
+                    "Error, creating an independent copy of this rotational ephemeris type is not supported." );
+    }
+
 protected:
 
     //! Base reference frame orientation.
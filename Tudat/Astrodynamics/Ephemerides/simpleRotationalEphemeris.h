@@ -12,6 +12,8 @@
 #ifndef TUDAT_SIMPLE_ROTATIONAL_EPHEMERIS_H
 #define TUDAT_SIMPLE_ROTATIONAL_EPHEMERIS_H
 
+#include <boost/make_shared.hpp>
+
 #include "Tudat/Astrodynamics/Ephemerides/rotationalEphemeris.h"
 #include "Tudat/Astrodynamics/ReferenceFrames/referenceFrameTransformations.h"
 
@@ -141,6 +143,16 @@ public:
     Eigen::Matrix3d getDerivativeOfRotationToTargetFrame(
             const double secondsSinceEpoch );
 
+    //! Function to create a copy of the rotational ephemeris that can be evaluated independently of this object.
+    /*!
+     * Function to create a copy of the rotational ephemeris that can be evaluated independently of this object.
+     * \return Copy of the rotational ephemeris that can be evaluated independently of this object.
+     */
+    boost::shared_ptr< RotationalEphemeris > createIndependentCopy( )
+    {
+        return boost::make_shared< SimpleRotationalEphemeris >( *this );
+    }
+
     //! Get rotation from target to base frame at initial time.
     /*!
      * Returns rotation from target to base frame at initial time.
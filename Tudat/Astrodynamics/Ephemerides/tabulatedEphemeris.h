@@ -135,6 +135,20 @@ public:
         return interpolator_;
     }
 
+    //! Function to create a copy of the ephemeris that can be evaluated independently of this object.
+    /*!
+     *  Function to create a copy of the ephemeris that can be evaluated independently of this object, using the
+     *  createIndependentCopy function of the interpolator. For interpolators that support this (e.g. Lagrange
+     *  interpolator), the tabulated data is shared between the copies, and only the look-up state is duplicated. Since
+     *  resetInterpolator replaces the interpolator of a single object only, the copies are not affected by a reset.
+     *  \return Copy of the ephemeris that can be evaluated independently of this object.
+     */
+    boost::shared_ptr< Ephemeris > createIndependentCopy( )
+    {
+        return boost::make_shared< TabulatedCartesianEphemeris< StateScalarType, TimeType > >(
+                    interpolator_->createIndependentCopy( ), referenceFrameOrigin_, referenceFrameOrientation_ );
+    }
+
     //! Function that retrieves the time interval at which this ephemeris can be safely interrogated
     /*!
      * Function that retrieves the time interval at which this ephemeris can be safely interrogated. The interval
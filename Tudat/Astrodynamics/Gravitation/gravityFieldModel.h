@@ -13,6 +13,7 @@
 #define TUDAT_GRAVITY_FIELD_MODEL_H
 
 #include <boost/shared_ptr.hpp>
+#include <boost/make_shared.hpp>
 #include <Eigen/Core>
 #include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
 
@@ -89,6 +90,18 @@ public:
         return computeGravitationalAcceleration( bodyFixedPosition, gravitationalParameter_ );
     }
 
+    //! Function to create a copy of the gravity field that can be evaluated independently of this object.
+    /*!
+     * Function to create a copy of the gravity field that can be evaluated independently of this object (e.g. on a
+     * different thread). Derived classes that store data when being evaluated, or that have additional properties,
+     * must override this function.
+     * \return Copy of the gravity field that can be evaluated independently of this object.
+     */
+    virtual boost::shared_ptr< GravityFieldModel > createIndependentCopy( )
+    {
+        return boost::make_shared< GravityFieldModel >( gravitationalParameter_ );
+    }
+
 protected:
 
     //! Gravitational parameter.
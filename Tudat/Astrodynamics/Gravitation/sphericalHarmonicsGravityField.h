@@ -282,6 +282,19 @@ public:
         return fixedReferenceFrame_;
     }
 
+    //! Function to create a copy of the gravity field that can be evaluated independently of this object.
+    /*!
+     *  Function to create a copy of the gravity field that can be evaluated independently of this object, with its own
+     *  cache object for potential calculations.
+     *  \return Copy of the gravity field that can be evaluated independently of this object.
+     */
+    virtual boost::shared_ptr< GravityFieldModel > createIndependentCopy( )
+    {
+        return boost::make_shared< SphericalHarmonicsGravityField >(
+                    gravitationalParameter_, referenceRadius_, cosineCoefficients_, sineCoefficients_,
+                    fixedReferenceFrame_ );
+    }
+
 protected:
 
     //! Reference radius of spherical harmonic field expansion
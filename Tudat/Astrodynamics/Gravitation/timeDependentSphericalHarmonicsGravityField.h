@@ -242,6 +242,19 @@ public:
         return gravityFieldVariationsSet_;
     }
 
+    //! Function to create a copy of the gravity field that can be evaluated independently of this object.
+    /*!
+     *  Function to create a copy of the gravity field that can be evaluated independently of this object. Not supported
+     *  for time-dependent gravity fields, as the gravity field variations are linked to the environment of this object;
+     *  this function throws an error.
+     *  \return Copy of the gravity field that can be evaluated independently of this object (never returned).
+     */
+    boost::shared_ptr< GravityFieldModel > createIndependentCopy( )
+    {
+        throw std::runtime_error(
+                    "Error, creating an independent copy of a time-dependent spherical harmonic gravity field is not supported." );
+    }
+
 private:
 
     //! Nominal (i.e. with zero variations) cosine coefficients.
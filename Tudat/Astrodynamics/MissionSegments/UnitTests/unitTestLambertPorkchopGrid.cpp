@@ -0,0 +1,145 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+#include <boost/bind.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Astrodynamics/BasicAstrodynamics/keplerPropagator.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/orbitalElementConversions.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/physicalConstants.h"
+#include "Tudat/Astrodynamics/MissionSegments/lambertPorkchopGrid.h"
+#include "Tudat/Astrodynamics/MissionSegments/lambertRoutines.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+//! Gravitational parameter of the Sun used in the tests.
+const double solarGravitationalParameter = 1.32712440018e20;
+
+//! Function to compute the Cartesian state on a Kepler orbit (with elements given at t=0) at a given time.
+Eigen::Vector6d computeKeplerOrbitState( const double time, const Eigen::Vector6d& initialKeplerElements )
+{
+    return orbital_element_conversions::convertKeplerianToCartesianElements(
+                orbital_element_conversions::propagateKeplerOrbit(
+                    initialKeplerElements, time, solarGravitationalParameter ),
+                solarGravitationalParameter );
+}
+
+BOOST_AUTO_TEST_SUITE( test_lambert_porkchop_grid )
+
+//! Test porkchop grid against individually solved Lambert problems, and test file input/output.
+BOOST_AUTO_TEST_CASE( testLambertPorkchopGrid )
+{
+    using namespace mission_segments;
+
+    // Define Earth- and Mars-like orbits.
+    Eigen::Vector6d departureBodyKeplerElements;
+    departureBodyKeplerElements << 1.496E11, 0.0167, 0.0, 1.8, 0.0, 0.3;
+    Eigen::Vector6d arrivalBodyKeplerElements;
+    arrivalBodyKeplerElements << 2.279E11, 0.0934, 0.0323, 5.0, 0.86, 2.1;
+
+    boost::function< Eigen::Vector6d( const double ) > departureBodyStateFunction =
+            boost::bind( &computeKeplerOrbitState, _1, departureBodyKeplerElements );
+    boost::function< Eigen::Vector6d( const double ) > arrivalBodyStateFunction =
+            boost::bind( &computeKeplerOrbitState, _1, arrivalBodyKeplerElements );
+
+    // Define departure and arrival times (including infeasible combinations).
+    std::vector< double > departureTimes, arrivalTimes;
+    for( unsigned int i = 0; i < 20; i++ )
+    {
+        departureTimes.push_back( i * 10.0 * physical_constants::JULIAN_DAY );
+    }
+    for( unsigned int i = 0; i < 23; i++ )
+    {
+        arrivalTimes.push_back( ( 150.0 + i * 15.0 ) * physical_constants::JULIAN_DAY );
+    }
+    arrivalTimes.push_back( 100.0 * physical_constants::JULIAN_DAY );
+
+    // Compute grid, using single and multiple threads.
+    LambertPorkchopGrid porkchopGrid( departureTimes, arrivalTimes, departureBodyStateFunction,
+                                      arrivalBodyStateFunction, solarGravitationalParameter );
+    LambertPorkchopGrid parallelPorkchopGrid( departureTimes, arrivalTimes, departureBodyStateFunction,
+                                              arrivalBodyStateFunction, solarGravitationalParameter, 4 );
+
+    // Compare with individual Lambert problem solutions.
+    Eigen::Vector3d velocityAtDeparture, velocityAtArrival;
+    for( unsigned int i = 0; i < departureTimes.size( ); i++ )
+    {
+        for( unsigned int j = 0; j < arrivalTimes.size( ); j++ )
+        {
+            if( arrivalTimes.at( j ) <= departureTimes.at( i ) )
+            {
+                BOOST_CHECK( std::isnan( porkchopGrid.getDepartureCharacteristicEnergies( )( i, j ) ) );
+                BOOST_CHECK( std::isnan( porkchopGrid.getArrivalExcessVelocities( )( i, j ) ) );
+                BOOST_CHECK( std::isnan( parallelPorkchopGrid.getDepartureCharacteristicEnergies( )( i, j ) ) );
+                continue;
+            }
+
+            Eigen::Vector6d departureState = departureBodyStateFunction( departureTimes.at( i ) );
+            Eigen::Vector6d arrivalState = arrivalBodyStateFunction( arrivalTimes.at( j ) );
+            solveLambertProblemIzzo( departureState.segment( 0, 3 ), arrivalState.segment( 0, 3 ),
+                                     arrivalTimes.at( j ) - departureTimes.at( i ), solarGravitationalParameter,
+                                     velocityAtDeparture, velocityAtArrival );
+
+            BOOST_CHECK_EQUAL( porkchopGrid.getDepartureCharacteristicEnergies( )( i, j ),
+                               ( velocityAtDeparture - departureState.segment( 3, 3 ) ).squaredNorm( ) );
+            BOOST_CHECK_EQUAL( porkchopGrid.getArrivalExcessVelocities( )( i, j ),
+                               ( velocityAtArrival - arrivalState.segment( 3, 3 ) ).norm( ) );
+            BOOST_CHECK_EQUAL( parallelPorkchopGrid.getDepartureCharacteristicEnergies( )( i, j ),
+                               porkchopGrid.getDepartureCharacteristicEnergies( )( i, j ) );
+            BOOST_CHECK_EQUAL( parallelPorkchopGrid.getArrivalExcessVelocities( )( i, j ),
+                               porkchopGrid.getArrivalExcessVelocities( )( i, j ) );
+        }
+    }
+
+    // Write grid to file, read it back and compare.
+    const std::string fileName = "testLambertPorkchopGrid.dat";
+    porkchopGrid.writeToFile( fileName );
+    LambertPorkchopGrid readPorkchopGrid( fileName );
+    std::remove( fileName.c_str( ) );
+
+    BOOST_CHECK( readPorkchopGrid.getDepartureTimes( ) == departureTimes );
+    BOOST_CHECK( readPorkchopGrid.getArrivalTimes( ) == arrivalTimes );
+    for( unsigned int i = 0; i < departureTimes.size( ); i++ )
+    {
+        for( unsigned int j = 0; j < arrivalTimes.size( ); j++ )
+        {
+            if( !std::isnan( porkchopGrid.getDepartureCharacteristicEnergies( )( i, j ) ) )
+            {
+                BOOST_CHECK_EQUAL( readPorkchopGrid.getDepartureCharacteristicEnergies( )( i, j ),
+                                   porkchopGrid.getDepartureCharacteristicEnergies( )( i, j ) );
+                BOOST_CHECK_EQUAL( readPorkchopGrid.getArrivalExcessVelocities( )( i, j ),
+                                   porkchopGrid.getArrivalExcessVelocities( )( i, j ) );
+            }
+            else
+            {
+                BOOST_CHECK( std::isnan( readPorkchopGrid.getDepartureCharacteristicEnergies( )( i, j ) ) );
+            }
+        }
+    }
+
+    BOOST_CHECK_THROW( LambertPorkchopGrid( "nonExistentPorkchopGrid.dat" ), std::runtime_error );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
@@ -0,0 +1,187 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <cmath>
+#include <vector>
+
+#include <boost/bind.hpp>
+#include <boost/make_shared.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Astrodynamics/BasicAstrodynamics/keplerPropagator.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/orbitalElementConversions.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/physicalConstants.h"
+#include "Tudat/Astrodynamics/MissionSegments/escapeAndCapture.h"
+#include "Tudat/Astrodynamics/MissionSegments/gravityAssist.h"
+#include "Tudat/Astrodynamics/MissionSegments/lambertRoutines.h"
+#include "Tudat/Astrodynamics/MissionSegments/multipleGravityAssistTrajectory.h"
+#include "Tudat/Astrodynamics/MissionSegments/planetStateTable.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+//! Gravitational parameter of the Sun used in the tests.
+const double sunGravitationalParameter = 1.32712440018e20;
+
+//! Function to compute the Cartesian state on a Kepler orbit (with elements given at t=0) at a given time.
+Eigen::Vector6d computeKeplerOrbitStateAtTime( const double time, const Eigen::Vector6d& initialKeplerElements )
+{
+    return orbital_element_conversions::convertKeplerianToCartesianElements(
+                orbital_element_conversions::propagateKeplerOrbit(
+                    initialKeplerElements, time, sunGravitationalParameter ),
+                sunGravitationalParameter );
+}
+
+BOOST_AUTO_TEST_SUITE( test_multiple_gravity_assist_trajectory )
+
+//! Test interpolation of planet state table.
+BOOST_AUTO_TEST_CASE( testPlanetStateTable )
+{
+    using namespace mission_segments;
+
+    Eigen::Vector6d keplerElements;
+    keplerElements << 1.496E11, 0.0167, 0.0, 1.8, 0.0, 0.3;
+    boost::function< Eigen::Vector6d( const double ) > stateFunction =
+            boost::bind( &computeKeplerOrbitStateAtTime, _1, keplerElements );
+
+    const double timeStep = physical_constants::JULIAN_DAY;
+    PlanetStateTable planetStateTable( stateFunction, 0.0, 1000.0 * timeStep, timeStep );
+    BOOST_CHECK_EQUAL( planetStateTable.getEndTime( ), 1000.0 * timeStep );
+
+    // Check tabulated states, and interpolated states between nodes.
+    for( unsigned int i = 0; i < 2000; i++ )
+    {
+        const double time = 0.5 * i * timeStep + 0.1234 * timeStep;
+        const Eigen::Vector6d interpolatedState = planetStateTable.getCartesianState( time );
+        const Eigen::Vector6d exactState = stateFunction( time );
+        BOOST_CHECK_SMALL( ( interpolatedState - exactState ).segment( 0, 3 ).norm( ), 100.0 );
+        BOOST_CHECK_SMALL( ( interpolatedState - exactState ).segment( 3, 3 ).norm( ), 5.0E-3 );
+    }
+    BOOST_CHECK_SMALL( ( planetStateTable.getCartesianState( 10.0 * timeStep ) -
+                         stateFunction( 10.0 * timeStep ) ).segment( 0, 3 ).norm( ), 1.0E-3 );
+    BOOST_CHECK_SMALL( ( planetStateTable.getCartesianState( 1000.0 * timeStep ) -
+                         stateFunction( 1000.0 * timeStep ) ).segment( 0, 3 ).norm( ), 1.0E-3 );
+
+    BOOST_CHECK_THROW( planetStateTable.getCartesianState( -1.0 ), std::runtime_error );
+    BOOST_CHECK_THROW( planetStateTable.getCartesianState( 1001.0 * timeStep ), std::runtime_error );
+}
+
+//! Test MGA trajectory evaluation against direct use of the trajectory building blocks.
+BOOST_AUTO_TEST_CASE( testMultipleGravityAssistTrajectoryEvaluator )
+{
+    using namespace mission_segments;
+
+    // Define Earth-Venus-Earth-Jupiter sequence on Kepler orbits.
+    std::vector< Eigen::Vector6d > planetKeplerElements( 4 );
+    planetKeplerElements[ 0 ] << 1.496E11, 0.0167, 0.0, 1.8, 0.0, 0.3;
+    planetKeplerElements[ 1 ] << 1.082E11, 0.0068, 0.059, 0.96, 1.34, 4.0;
+    planetKeplerElements[ 2 ] = planetKeplerElements[ 0 ];
+    planetKeplerElements[ 3 ] << 7.785E11, 0.0489, 0.0228, 4.78, 1.75, 0.6;
+    std::vector< double > planetGravitationalParameters = { 3.986004418E14, 3.24859E14, 3.986004418E14,
+                                                            1.26686534E17 };
+    std::vector< double > minimumPericenterRadii = { 6578.0E3, 6351.8E3, 6778.1E3, 600000.0E3 };
+
+    const double timeStep = physical_constants::JULIAN_DAY;
+    const double tableEndTime = 6000.0 * timeStep;
+    std::vector< boost::shared_ptr< PlanetStateTable > > planetStateTables;
+    for( unsigned int i = 0; i < planetKeplerElements.size( ); i++ )
+    {
+        planetStateTables.push_back(
+                    boost::make_shared< PlanetStateTable >(
+                        boost::bind( &computeKeplerOrbitStateAtTime, _1, planetKeplerElements[ i ] ),
+                        0.0, tableEndTime, timeStep ) );
+    }
+
+    const double departureSemiMajorAxis = 6778.0E3, captureSemiMajorAxis = 1.0E9, captureEccentricity = 0.98;
+    MultipleGravityAssistTrajectoryEvaluator trajectoryEvaluator(
+                planetStateTables, planetGravitationalParameters, minimumPericenterRadii, sunGravitationalParameter,
+                departureSemiMajorAxis, 0.0, captureSemiMajorAxis, captureEccentricity );
+    MultipleGravityAssistTrajectoryEvaluator launcherTrajectoryEvaluator(
+                planetStateTables, planetGravitationalParameters, minimumPericenterRadii, sunGravitationalParameter,
+                TUDAT_NAN, TUDAT_NAN, TUDAT_NAN, TUDAT_NAN );
+    BOOST_CHECK_EQUAL( trajectoryEvaluator.getNumberOfLegs( ), 3 );
+
+    // Define batch of decision vectors.
+    const int numberOfTrajectories = 50;
+    Eigen::MatrixXd decisionVectors( 4, numberOfTrajectories );
+    for( int i = 0; i < numberOfTrajectories; i++ )
+    {
+        decisionVectors.col( i ) << ( 100.0 + 20.0 * i ) * timeStep, ( 120.0 + 2.0 * i ) * timeStep,
+                ( 300.0 + 3.0 * i ) * timeStep, ( 900.0 + 10.0 * i ) * timeStep;
+    }
+
+    // Evaluate batch, using single and multiple threads.
+    Eigen::VectorXd totalDeltaVs = trajectoryEvaluator.computeTotalDeltaVs( decisionVectors );
+    Eigen::VectorXd parallelTotalDeltaVs = trajectoryEvaluator.computeTotalDeltaVs( decisionVectors, 4 );
+    Eigen::VectorXd launcherTotalDeltaVs = launcherTrajectoryEvaluator.computeTotalDeltaVs( decisionVectors, 3 );
+
+    for( int i = 0; i < numberOfTrajectories; i++ )
+    {
+        // Compute expected deltaV from individual building blocks.
+        Eigen::VectorXd decisionVector = decisionVectors.col( i );
+        double time = decisionVector( 0 );
+        std::vector< Eigen::Vector6d > planetStates;
+        planetStates.push_back( planetStateTables[ 0 ]->getCartesianState( time ) );
+        std::vector< Eigen::Vector3d > departureVelocities( 3 ), arrivalVelocities( 3 );
+        for( unsigned int j = 0; j < 3; j++ )
+        {
+            time += decisionVector( j + 1 );
+            planetStates.push_back( planetStateTables[ j + 1 ]->getCartesianState( time ) );
+            solveLambertProblemIzzo( planetStates[ j ].segment( 0, 3 ), planetStates[ j + 1 ].segment( 0, 3 ),
+                                     decisionVector( j + 1 ), sunGravitationalParameter,
+                                     departureVelocities[ j ], arrivalVelocities[ j ] );
+        }
+
+        const double departureExcessVelocity = ( departureVelocities[ 0 ] - planetStates[ 0 ].segment( 3, 3 ) ).norm( );
+        const double arrivalExcessVelocity = ( arrivalVelocities[ 2 ] - planetStates[ 3 ].segment( 3, 3 ) ).norm( );
+        double gravityAssistDeltaV = 0.0;
+        for( unsigned int j = 1; j < 3; j++ )
+        {
+            gravityAssistDeltaV += gravityAssist( planetGravitationalParameters[ j ], planetStates[ j ].segment( 3, 3 ),
+                                                  arrivalVelocities[ j - 1 ], departureVelocities[ j ],
+                                                  minimumPericenterRadii[ j ] );
+        }
+        const double expectedTotalDeltaV =
+                computeEscapeOrCaptureDeltaV( planetGravitationalParameters[ 0 ], departureSemiMajorAxis, 0.0,
+                                              departureExcessVelocity ) + gravityAssistDeltaV +
+                computeEscapeOrCaptureDeltaV( planetGravitationalParameters[ 3 ], captureSemiMajorAxis,
+                                              captureEccentricity, arrivalExcessVelocity );
+
+        BOOST_CHECK_CLOSE_FRACTION( totalDeltaVs( i ), expectedTotalDeltaV, 1.0E-12 );
+        BOOST_CHECK_CLOSE_FRACTION( trajectoryEvaluator.computeTotalDeltaV( decisionVector ),
+                                    expectedTotalDeltaV, 1.0E-12 );
+        BOOST_CHECK_EQUAL( parallelTotalDeltaVs( i ), totalDeltaVs( i ) );
+        BOOST_CHECK_CLOSE_FRACTION( launcherTotalDeltaVs( i ), departureExcessVelocity + gravityAssistDeltaV +
+                                    arrivalExcessVelocity, 1.0E-12 );
+    }
+
+    // Check that infeasible trajectories result in NaN, and inconsistent decision vectors in an exception.
+    Eigen::VectorXd decisionVector = decisionVectors.col( 0 );
+    decisionVector( 2 ) = -10.0 * timeStep;
+    BOOST_CHECK( std::isnan( trajectoryEvaluator.computeTotalDeltaV( decisionVector ) ) );
+    decisionVector = decisionVectors.col( 0 );
+    decisionVector( 3 ) = tableEndTime;
+    BOOST_CHECK( std::isnan( trajectoryEvaluator.computeTotalDeltaV( decisionVector ) ) );
+    BOOST_CHECK_THROW( trajectoryEvaluator.computeTotalDeltaV( Eigen::VectorXd::Zero( 3 ) ), std::runtime_error );
+    BOOST_CHECK_THROW( trajectoryEvaluator.computeTotalDeltaVs( Eigen::MatrixXd::Zero( 5, 10 ), 2 ),
+                       std::runtime_error );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
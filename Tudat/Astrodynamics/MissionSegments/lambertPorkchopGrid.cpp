@@ -0,0 +1,199 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+#include <boost/bind.hpp>
+
+#include "Tudat/Astrodynamics/MissionSegments/lambertPorkchopGrid.h"
+#include "Tudat/Astrodynamics/MissionSegments/lambertRoutines.h"
+#include "Tudat/Basics/parallelLoops.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+
+namespace tudat
+{
+namespace mission_segments
+{
+
+//! Identifier at start of binary porkchop grid files.
+static const char LAMBERT_PORKCHOP_GRID_FILE_IDENTIFIER[ 16 ] = "TUDAT_PORKCHOP";
+
+//! Version of binary porkchop grid file format.
+static const std::int32_t LAMBERT_PORKCHOP_GRID_FILE_VERSION = 1;
+
+//! Constructor, computes the grid of Lambert transfers.
+LambertPorkchopGrid::LambertPorkchopGrid(
+        const std::vector< double >& departureTimes,
+        const std::vector< double >& arrivalTimes,
+        const boost::function< Eigen::Vector6d( const double ) > departureBodyStateFunction,
+        const boost::function< Eigen::Vector6d( const double ) > arrivalBodyStateFunction,
+        const double centralBodyGravitationalParameter,
+        const unsigned int numberOfThreads ):
+    departureTimes_( departureTimes ), arrivalTimes_( arrivalTimes ),
+    departureCharacteristicEnergies_( departureTimes.size( ), arrivalTimes.size( ) ),
+    arrivalExcessVelocities_( departureTimes.size( ), arrivalTimes.size( ) )
+{
+    // Retrieve body states once for each departure and arrival time.
+    std::vector< Eigen::Vector6d > departureBodyStates( departureTimes_.size( ) );
+    for( unsigned int i = 0; i < departureTimes_.size( ); i++ )
+    {
+        departureBodyStates[ i ] = departureBodyStateFunction( departureTimes_.at( i ) );
+    }
+
+    std::vector< Eigen::Vector6d > arrivalBodyStates( arrivalTimes_.size( ) );
+    for( unsigned int i = 0; i < arrivalTimes_.size( ); i++ )
+    {
+        arrivalBodyStates[ i ] = arrivalBodyStateFunction( arrivalTimes_.at( i ) );
+    }
+
+    // Compute transfers in contiguous blocks of arrival times.
+    utilities::parallelForBlocks(
+                arrivalTimes_.size( ), numberOfThreads,
+                boost::bind( &LambertPorkchopGrid::computeTransfers, this, boost::cref( departureBodyStates ),
+                             boost::cref( arrivalBodyStates ), centralBodyGravitationalParameter, _2, _3 ) );
+}
+
+//! Constructor, reads a grid of Lambert transfers from a binary file.
+LambertPorkchopGrid::LambertPorkchopGrid( const std::string& fileName )
+{
+    std::ifstream gridFile( fileName.c_str( ), std::ios::binary );
+    if( !gridFile.is_open( ) )
+    {
+        throw std::runtime_error( "Error when reading porkchop grid, could not open " + fileName );
+    }
+
+    // Check file identifier and version
+    char fileIdentifier[ sizeof( LAMBERT_PORKCHOP_GRID_FILE_IDENTIFIER ) ];
+    std::int32_t fileVersion = 0;
+    gridFile.read( fileIdentifier, sizeof( fileIdentifier ) );
+    gridFile.read( reinterpret_cast< char* >( &fileVersion ), sizeof( fileVersion ) );
+    if( !gridFile || std::memcmp( fileIdentifier, LAMBERT_PORKCHOP_GRID_FILE_IDENTIFIER,
+                                  sizeof( fileIdentifier ) ) != 0 ||
+            fileVersion != LAMBERT_PORKCHOP_GRID_FILE_VERSION )
+    {
+        throw std::runtime_error( "Error when reading porkchop grid, " + fileName +
+                                  " is not a porkchop grid file of a supported version." );
+    }
+
+    // Read times and grids
+    std::uint64_t numberOfDepartureTimes = 0, numberOfArrivalTimes = 0;
+    gridFile.read( reinterpret_cast< char* >( &numberOfDepartureTimes ), sizeof( numberOfDepartureTimes ) );
+    gridFile.read( reinterpret_cast< char* >( &numberOfArrivalTimes ), sizeof( numberOfArrivalTimes ) );
+    if( !gridFile )
+    {
+        throw std::runtime_error( "Error when reading porkchop grid from " + fileName + ", file is incomplete." );
+    }
+
+    departureTimes_.resize( numberOfDepartureTimes );
+    arrivalTimes_.resize( numberOfArrivalTimes );
+    departureCharacteristicEnergies_.resize( numberOfDepartureTimes, numberOfArrivalTimes );
+    arrivalExcessVelocities_.resize( numberOfDepartureTimes, numberOfArrivalTimes );
+
+    gridFile.read( reinterpret_cast< char* >( departureTimes_.data( ) ), numberOfDepartureTimes * sizeof( double ) );
+    gridFile.read( reinterpret_cast< char* >( arrivalTimes_.data( ) ), numberOfArrivalTimes * sizeof( double ) );
+    gridFile.read( reinterpret_cast< char* >( departureCharacteristicEnergies_.data( ) ),
+                   departureCharacteristicEnergies_.size( ) * sizeof( double ) );
+    gridFile.read( reinterpret_cast< char* >( arrivalExcessVelocities_.data( ) ),
+                   arrivalExcessVelocities_.size( ) * sizeof( double ) );
+    if( !gridFile )
+    {
+        throw std::runtime_error( "Error when reading porkchop grid from " + fileName + ", file is incomplete." );
+    }
+}
+
+//! Function to write the grid to a binary file.
+void LambertPorkchopGrid::writeToFile( const std::string& fileName ) const
+{
+    std::ofstream gridFile( fileName.c_str( ), std::ios::binary );
+    if( !gridFile.is_open( ) )
+    {
+        throw std::runtime_error( "Error when writing porkchop grid, could not open " + fileName );
+    }
+
+    // Write file identifier, version and times
+    const std::int32_t fileVersion = LAMBERT_PORKCHOP_GRID_FILE_VERSION;
+    const std::uint64_t numberOfDepartureTimes = departureTimes_.size( );
+    const std::uint64_t numberOfArrivalTimes = arrivalTimes_.size( );
+    gridFile.write( LAMBERT_PORKCHOP_GRID_FILE_IDENTIFIER, sizeof( LAMBERT_PORKCHOP_GRID_FILE_IDENTIFIER ) );
+    gridFile.write( reinterpret_cast< const char* >( &fileVersion ), sizeof( fileVersion ) );
+    gridFile.write( reinterpret_cast< const char* >( &numberOfDepartureTimes ), sizeof( numberOfDepartureTimes ) );
+    gridFile.write( reinterpret_cast< const char* >( &numberOfArrivalTimes ), sizeof( numberOfArrivalTimes ) );
+    gridFile.write( reinterpret_cast< const char* >( departureTimes_.data( ) ),
+                    numberOfDepartureTimes * sizeof( double ) );
+    gridFile.write( reinterpret_cast< const char* >( arrivalTimes_.data( ) ),
+                    numberOfArrivalTimes * sizeof( double ) );
+
+    // Write grids
+    gridFile.write( reinterpret_cast< const char* >( departureCharacteristicEnergies_.data( ) ),
+                    departureCharacteristicEnergies_.size( ) * sizeof( double ) );
+    gridFile.write( reinterpret_cast< const char* >( arrivalExcessVelocities_.data( ) ),
+                    arrivalExcessVelocities_.size( ) * sizeof( double ) );
+
+    if( !gridFile )
+    {
+        throw std::runtime_error( "Error when writing porkchop grid to " + fileName );
+    }
+}
+
+//! Function to compute the transfers for a range of arrival times.
+void LambertPorkchopGrid::computeTransfers( const std::vector< Eigen::Vector6d >& departureBodyStates,
+                                            const std::vector< Eigen::Vector6d >& arrivalBodyStates,
+                                            const double centralBodyGravitationalParameter,
+                                            const unsigned int startArrivalIndex,
+                                            const unsigned int endArrivalIndex )
+{
+    Eigen::Vector3d velocityAtDeparture, velocityAtArrival;
+    for( unsigned int j = startArrivalIndex; j < endArrivalIndex; j++ )
+    {
+        for( unsigned int i = 0; i < departureTimes_.size( ); i++ )
+        {
+            const double timeOfFlight = arrivalTimes_[ j ] - departureTimes_[ i ];
+
+            // Set infeasible transfers to NaN
+            bool isTransferComputed = false;
+            if( timeOfFlight > 0.0 )
+            {
+                try
+                {
+                    solveLambertProblemIzzo( departureBodyStates[ i ].segment( 0, 3 ),
+                                             arrivalBodyStates[ j ].segment( 0, 3 ),
+                                             timeOfFlight, centralBodyGravitationalParameter,
+                                             velocityAtDeparture, velocityAtArrival );
+                    isTransferComputed = true;
+                }
+                catch( const std::runtime_error& )
+                {
+                    isTransferComputed = false;
+                }
+            }
+
+            if( isTransferComputed )
+            {
+                departureCharacteristicEnergies_( i, j ) =
+                        ( velocityAtDeparture - departureBodyStates[ i ].segment( 3, 3 ) ).squaredNorm( );
+                arrivalExcessVelocities_( i, j ) =
+                        ( velocityAtArrival - arrivalBodyStates[ j ].segment( 3, 3 ) ).norm( );
+            }
+            else
+            {
+                departureCharacteristicEnergies_( i, j ) = TUDAT_NAN;
+                arrivalExcessVelocities_( i, j ) = TUDAT_NAN;
+            }
+        }
+    }
+}
+
+} // namespace mission_segments
+} // namespace tudat
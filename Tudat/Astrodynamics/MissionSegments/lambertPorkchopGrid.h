@@ -0,0 +1,155 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#ifndef TUDAT_LAMBERT_PORKCHOP_GRID_H
+#define TUDAT_LAMBERT_PORKCHOP_GRID_H
+
+#include <string>
+#include <vector>
+
+#include <boost/function.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Basics/basicTypedefs.h"
+
+namespace tudat
+{
+namespace mission_segments
+{
+
+//! Class for the evaluation of a grid of Lambert transfers between two bodies (i.e. a porkchop plot).
+/*!
+ * Class for the evaluation of a grid of zero-revolution Lambert transfers between two bodies, for all combinations of
+ * a list of departure times and a list of arrival times. The states of the departure (arrival) body are retrieved
+ * once for each departure (arrival) time, prior to the evaluation of the grid, so that the number of ephemeris
+ * evaluations scales with the sum, rather than the product, of the numbers of departure and arrival times. The
+ * Lambert problems are subsequently solved using Izzo's algorithm (see solveLambertProblemIzzo), distributing the
+ * arrival times over the requested number of threads. For each transfer, the departure characteristic energy (C3)
+ * and the arrival excess velocity are stored; for grid points where the arrival time does not exceed the departure
+ * time, or where the Lambert solver fails to converge, both are set to NaN. The grid can be stored to (and read
+ * from) a compact binary file.
+ */
+class LambertPorkchopGrid
+{
+public:
+
+    //! Constructor, computes the grid of Lambert transfers.
+    /*!
+     * Constructor, computes the grid of Lambert transfers.
+     * \param departureTimes List of departure times.
+     * \param arrivalTimes List of arrival times.
+     * \param departureBodyStateFunction Function returning the Cartesian state of the departure body w.r.t. the
+     * central body, as a function of time.
+     * \param arrivalBodyStateFunction Function returning the Cartesian state of the arrival body w.r.t. the central
+     * body, as a function of time.
+     * \param centralBodyGravitationalParameter Gravitational parameter of the central body.
+     * \param numberOfThreads Number of threads that is to be used (if 0, the number of hardware threads is used). Note
+     * that the state functions are only evaluated from the calling thread.
+     */
+    LambertPorkchopGrid( const std::vector< double >& departureTimes,
+                         const std::vector< double >& arrivalTimes,
+                         const boost::function< Eigen::Vector6d( const double ) > departureBodyStateFunction,
+                         const boost::function< Eigen::Vector6d( const double ) > arrivalBodyStateFunction,
+                         const double centralBodyGravitationalParameter,
+                         const unsigned int numberOfThreads = 1 );
+
+    //! Constructor, reads a grid of Lambert transfers from a binary file.
+    /*!
+     * Constructor, reads a grid of Lambert transfers from a binary file, as written by writeToFile.
+     * \param fileName Name of the file from which the grid is to be read.
+     */
+    LambertPorkchopGrid( const std::string& fileName );
+
+    //! Function to write the grid to a binary file.
+    /*!
+     * Function to write the grid to a binary file, which contains a file identifier and version, the numbers of
+     * departure and arrival times, the departure and arrival times, and the C3 and arrival excess velocity matrices
+     * (column-major, each column corresponding to a single arrival time), all in native byte order.
+     * \param fileName Name of the file to which the grid is to be written.
+     */
+    void writeToFile( const std::string& fileName ) const;
+
+    //! Function to retrieve the list of departure times.
+    /*!
+     * Function to retrieve the list of departure times.
+     * \return List of departure times.
+     */
+    const std::vector< double >& getDepartureTimes( ) const
+    {
+        return departureTimes_;
+    }
+
+    //! Function to retrieve the list of arrival times.
+    /*!
+     * Function to retrieve the list of arrival times.
+     * \return List of arrival times.
+     */
+    const std::vector< double >& getArrivalTimes( ) const
+    {
+        return arrivalTimes_;
+    }
+
+    //! Function to retrieve the departure characteristic energies.
+    /*!
+     * Function to retrieve the departure characteristic energies (C3, the square of the departure excess velocity).
+     * \return Departure characteristic energies, with entry (i,j) corresponding to departure time i and arrival time j.
+     */
+    const Eigen::MatrixXd& getDepartureCharacteristicEnergies( ) const
+    {
+        return departureCharacteristicEnergies_;
+    }
+
+    //! Function to retrieve the arrival excess velocities.
+    /*!
+     * Function to retrieve the arrival excess velocities (magnitude of the velocity w.r.t. the arrival body).
+     * \return Arrival excess velocities, with entry (i,j) corresponding to departure time i and arrival time j.
+     */
+    const Eigen::MatrixXd& getArrivalExcessVelocities( ) const
+    {
+        return arrivalExcessVelocities_;
+    }
+
+private:
+
+    //! Function to compute the transfers for a range of arrival times.
+    /*!
+     * Function to compute the transfers for a range of arrival times (i.e. a range of columns of the grid), using the
+     * prefetched body states.
+     * \param departureBodyStates States of the departure body at the departure times.
+     * \param arrivalBodyStates States of the arrival body at the arrival times.
+     * \param centralBodyGravitationalParameter Gravitational parameter of the central body.
+     * \param startArrivalIndex Index of first arrival time for which the transfers are to be computed.
+     * \param endArrivalIndex Index after last arrival time for which the transfers are to be computed.
+     */
+    void computeTransfers( const std::vector< Eigen::Vector6d >& departureBodyStates,
+                           const std::vector< Eigen::Vector6d >& arrivalBodyStates,
+                           const double centralBodyGravitationalParameter,
+                           const unsigned int startArrivalIndex,
+                           const unsigned int endArrivalIndex );
+
+    //! List of departure times.
+    std::vector< double > departureTimes_;
+
+    //! List of arrival times.
+    std::vector< double > arrivalTimes_;
+
+    //! Departure characteristic energies, with entry (i,j) corresponding to departure time i and arrival time j.
+    Eigen::MatrixXd departureCharacteristicEnergies_;
+
+    //! Arrival excess velocities, with entry (i,j) corresponding to departure time i and arrival time j.
+    Eigen::MatrixXd arrivalExcessVelocities_;
+};
+
+} // namespace mission_segments
+} // namespace tudat
+
+#endif // TUDAT_LAMBERT_PORKCHOP_GRID_H
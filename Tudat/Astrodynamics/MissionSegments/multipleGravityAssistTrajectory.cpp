@@ -0,0 +1,183 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#include <boost/bind.hpp>
+#include <boost/make_shared.hpp>
+
+#include "Tudat/Astrodynamics/MissionSegments/escapeAndCapture.h"
+#include "Tudat/Astrodynamics/MissionSegments/gravityAssist.h"
+#include "Tudat/Astrodynamics/MissionSegments/lambertRoutines.h"
+#include "Tudat/Astrodynamics/MissionSegments/multipleGravityAssistTrajectory.h"
+#include "Tudat/Basics/parallelLoops.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+
+namespace tudat
+{
+namespace mission_segments
+{
+
+//! Constructor.
+MultipleGravityAssistTrajectoryEvaluator::MultipleGravityAssistTrajectoryEvaluator(
+        const std::vector< boost::shared_ptr< PlanetStateTable > >& planetStateTables,
+        const std::vector< double >& planetGravitationalParameters,
+        const std::vector< double >& minimumPericenterRadii,
+        const double centralBodyGravitationalParameter,
+        const double departureOrbitSemiMajorAxis,
+        const double departureOrbitEccentricity,
+        const double captureOrbitSemiMajorAxis,
+        const double captureOrbitEccentricity ):
+    planetStateTables_( planetStateTables ),
+    planetGravitationalParameters_( planetGravitationalParameters ),
+    minimumPericenterRadii_( minimumPericenterRadii ),
+    centralBodyGravitationalParameter_( centralBodyGravitationalParameter ),
+    departureOrbitSemiMajorAxis_( departureOrbitSemiMajorAxis ),
+    departureOrbitEccentricity_( departureOrbitEccentricity ),
+    captureOrbitSemiMajorAxis_( captureOrbitSemiMajorAxis ),
+    captureOrbitEccentricity_( captureOrbitEccentricity )
+{
+    if( planetStateTables_.size( ) < 2 )
+    {
+        throw std::runtime_error( "Error when creating MGA trajectory evaluator, at least two planets are required." );
+    }
+
+    if( planetGravitationalParameters_.size( ) != planetStateTables_.size( ) ||
+            minimumPericenterRadii_.size( ) != planetStateTables_.size( ) )
+    {
+        throw std::runtime_error( "Error when creating MGA trajectory evaluator, input sizes are inconsistent." );
+    }
+
+    for( unsigned int i = 0; i < planetStateTables_.size( ); i++ )
+    {
+        if( !planetStateTables_.at( i ) )
+        {
+            throw std::runtime_error( "Error when creating MGA trajectory evaluator, planet state table " +
+                                      std::to_string( i ) + " is not set." );
+        }
+    }
+}
+
+//! Function to compute the total deltaV of a single trajectory.
+double MultipleGravityAssistTrajectoryEvaluator::computeTotalDeltaV( const Eigen::VectorXd& decisionVector ) const
+{
+    return computeTotalDeltaV( decisionVector, boost::make_shared< root_finders::NewtonRaphson >( 1.0e-12, 1000 ) );
+}
+
+//! Function to compute the total deltaV of a batch of trajectories.
+Eigen::VectorXd MultipleGravityAssistTrajectoryEvaluator::computeTotalDeltaVs(
+        const Eigen::MatrixXd& decisionVectors, const unsigned int numberOfThreads ) const
+{
+    const unsigned int numberOfTrajectories = decisionVectors.cols( );
+    Eigen::VectorXd totalDeltaVs = Eigen::VectorXd::Zero( numberOfTrajectories );
+
+    // Evaluate trajectories in contiguous blocks.
+    utilities::parallelForBlocks(
+                numberOfTrajectories, numberOfThreads,
+                boost::bind( &MultipleGravityAssistTrajectoryEvaluator::computeTotalDeltaVsInRange, this,
+                             boost::cref( decisionVectors ), _2, _3, boost::ref( totalDeltaVs ) ) );
+
+    return totalDeltaVs;
+}
+
+//! Function to compute the total deltaV of a single trajectory, using a given root finder.
+double MultipleGravityAssistTrajectoryEvaluator::computeTotalDeltaV(
+        const Eigen::VectorXd& decisionVector, const root_finders::RootFinderPointer rootFinder ) const
+{
+    const unsigned int numberOfPlanets = planetStateTables_.size( );
+    if( decisionVector.rows( ) != numberOfPlanets )
+    {
+        throw std::runtime_error( "Error when evaluating MGA trajectory, decision vector has size " +
+                                  std::to_string( decisionVector.rows( ) ) + ", expected " +
+                                  std::to_string( numberOfPlanets ) );
+    }
+
+    double totalDeltaV = 0.0;
+    try
+    {
+        // Retrieve planet state at departure.
+        double currentTime = decisionVector( 0 );
+        Eigen::Vector6d currentPlanetState = planetStateTables_[ 0 ]->getCartesianState( currentTime );
+
+        Eigen::Vector3d velocityAtDeparture, velocityAtArrival, previousVelocityAtArrival;
+        for( unsigned int i = 0; i < numberOfPlanets - 1; i++ )
+        {
+            // Compute Lambert leg to next planet.
+            const double timeOfFlight = decisionVector( i + 1 );
+            if( !( timeOfFlight > 0.0 ) )
+            {
+                return TUDAT_NAN;
+            }
+            currentTime += timeOfFlight;
+            const Eigen::Vector6d nextPlanetState = planetStateTables_[ i + 1 ]->getCartesianState( currentTime );
+            solveLambertProblemIzzo( currentPlanetState.segment( 0, 3 ), nextPlanetState.segment( 0, 3 ),
+                                     timeOfFlight, centralBodyGravitationalParameter_,
+                                     velocityAtDeparture, velocityAtArrival );
+
+            // Add escape maneuver (first leg) or gravity assist (other legs).
+            if( i == 0 )
+            {
+                const double departureExcessVelocity =
+                        ( velocityAtDeparture - currentPlanetState.segment( 3, 3 ) ).norm( );
+                totalDeltaV += std::isnan( departureOrbitSemiMajorAxis_ ) ?
+                            departureExcessVelocity :
+                            computeEscapeOrCaptureDeltaV( planetGravitationalParameters_[ 0 ],
+                                                          departureOrbitSemiMajorAxis_, departureOrbitEccentricity_,
+                                                          departureExcessVelocity );
+            }
+            else
+            {
+                totalDeltaV += gravityAssist( planetGravitationalParameters_[ i ],
+                                              currentPlanetState.segment( 3, 3 ), previousVelocityAtArrival,
+                                              velocityAtDeparture, minimumPericenterRadii_[ i ], true, 1.0e-6,
+                                              rootFinder );
+            }
+
+            previousVelocityAtArrival = velocityAtArrival;
+            currentPlanetState = nextPlanetState;
+        }
+
+        // Add capture maneuver.
+        const double arrivalExcessVelocity = ( previousVelocityAtArrival - currentPlanetState.segment( 3, 3 ) ).norm( );
+        totalDeltaV += std::isnan( captureOrbitSemiMajorAxis_ ) ?
+                    arrivalExcessVelocity :
+                    computeEscapeOrCaptureDeltaV( planetGravitationalParameters_[ numberOfPlanets - 1 ],
+                                                  captureOrbitSemiMajorAxis_, captureOrbitEccentricity_,
+                                                  arrivalExcessVelocity );
+    }
+    catch( const std::runtime_error& )
+    {
+        totalDeltaV = TUDAT_NAN;
+    }
+
+    return totalDeltaV;
+}
+
+//! Function to compute the total deltaV of a range of trajectories in a batch.
+void MultipleGravityAssistTrajectoryEvaluator::computeTotalDeltaVsInRange(
+        const Eigen::MatrixXd& decisionVectors, const unsigned int startIndex, const unsigned int endIndex,
+        Eigen::VectorXd& totalDeltaVs ) const
+{
+    // Create root finder for use by this thread only.
+    root_finders::RootFinderPointer rootFinder =
+            boost::make_shared< root_finders::NewtonRaphson >( 1.0e-12, 1000 );
+    Eigen::VectorXd decisionVector( decisionVectors.rows( ) );
+    for( unsigned int i = startIndex; i < endIndex; i++ )
+    {
+        decisionVector = decisionVectors.col( i );
+        totalDeltaVs( i ) = computeTotalDeltaV( decisionVector, rootFinder );
+    }
+}
+
+} // namespace mission_segments
+} // namespace tudat
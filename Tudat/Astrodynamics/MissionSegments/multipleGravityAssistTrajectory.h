@@ -0,0 +1,153 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#ifndef TUDAT_MULTIPLE_GRAVITY_ASSIST_TRAJECTORY_H
+#define TUDAT_MULTIPLE_GRAVITY_ASSIST_TRAJECTORY_H
+
+#include <vector>
+
+#include <boost/shared_ptr.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Astrodynamics/MissionSegments/planetStateTable.h"
+#include "Tudat/Mathematics/RootFinders/rootFinder.h"
+
+namespace tudat
+{
+namespace mission_segments
+{
+
+//! Class for the evaluation of the deltaV of multiple gravity assist (MGA) trajectories.
+/*!
+ * Class for the evaluation of the total deltaV of multiple gravity assist trajectories along a given sequence of
+ * planets (e.g. Earth-Venus-Venus-Earth-Jupiter), consisting of zero-revolution Lambert legs (see
+ * solveLambertProblemIzzo) between the planets, powered gravity assists at the intermediate planets (see
+ * gravityAssist), and an escape and capture maneuver at the first and last planet, respectively (see
+ * computeEscapeOrCaptureDeltaV). A trajectory is defined by a decision vector containing the departure time, followed
+ * by the times of flight of each of the legs. The planet states are retrieved from precomputed tables (see
+ * PlanetStateTable), so that the evaluation is fast and thread-safe, and batches of decision vectors (e.g. the
+ * population of a global optimizer) can be evaluated in parallel.
+ */
+class MultipleGravityAssistTrajectoryEvaluator
+{
+public:
+
+    //! Constructor.
+    /*!
+     * Constructor.
+     * \param planetStateTables State tables of the planets in the sequence (in order of visit).
+     * \param planetGravitationalParameters Gravitational parameters of the planets in the sequence.
+     * \param minimumPericenterRadii Minimum allowable pericenter radii of the gravity assists (entries for first and
+     * last planet are not used).
+     * \param centralBodyGravitationalParameter Gravitational parameter of the central body (typically the Sun).
+     * \param departureOrbitSemiMajorAxis Semi-major axis of the parking orbit at the first planet, from which the
+     * escape maneuver starts. If NaN, the departure excess velocity (e.g. provided by the launcher) is used as deltaV.
+     * \param departureOrbitEccentricity Eccentricity of the parking orbit at the first planet.
+     * \param captureOrbitSemiMajorAxis Semi-major axis of the orbit at the last planet, into which the capture
+     * maneuver is performed. If NaN, the arrival excess velocity is used as deltaV.
+     * \param captureOrbitEccentricity Eccentricity of the orbit at the last planet.
+     */
+    MultipleGravityAssistTrajectoryEvaluator(
+            const std::vector< boost::shared_ptr< PlanetStateTable > >& planetStateTables,
+            const std::vector< double >& planetGravitationalParameters,
+            const std::vector< double >& minimumPericenterRadii,
+            const double centralBodyGravitationalParameter,
+            const double departureOrbitSemiMajorAxis,
+            const double departureOrbitEccentricity,
+            const double captureOrbitSemiMajorAxis,
+            const double captureOrbitEccentricity );
+
+    //! Function to retrieve the number of legs of the trajectory.
+    /*!
+     * Function to retrieve the number of legs of the trajectory.
+     * \return Number of legs of the trajectory (number of planets minus one).
+     */
+    unsigned int getNumberOfLegs( ) const
+    {
+        return planetStateTables_.size( ) - 1;
+    }
+
+    //! Function to compute the total deltaV of a single trajectory.
+    /*!
+     * Function to compute the total deltaV of a single trajectory. If any of the legs cannot be computed (e.g. due to
+     * a non-positive time of flight, a non-converged Lambert problem, or a time outside of the tabulated interval of
+     * the planet states), NaN is returned.
+     * \param decisionVector Decision vector, containing the departure time followed by the time of flight of each leg.
+     * \return Total deltaV of the trajectory.
+     */
+    double computeTotalDeltaV( const Eigen::VectorXd& decisionVector ) const;
+
+    //! Function to compute the total deltaV of a batch of trajectories.
+    /*!
+     * Function to compute the total deltaV of a batch of trajectories (see computeTotalDeltaV),
+     * distributing the trajectories over the requested number of threads.
+     * \param decisionVectors Decision vectors, one per column (see computeTotalDeltaV).
+     * \param numberOfThreads Number of threads that is to be used (if 0, the number of hardware threads is used).
+     * \return Total deltaV of each of the trajectories.
+     */
+    Eigen::VectorXd computeTotalDeltaVs( const Eigen::MatrixXd& decisionVectors,
+                                         const unsigned int numberOfThreads = 1 ) const;
+
+private:
+
+    //! Function to compute the total deltaV of a single trajectory, using a given root finder.
+    /*!
+     * Function to compute the total deltaV of a single trajectory, using a given root finder for the gravity assists
+     * (root finders are not shared between threads).
+     * \param decisionVector Decision vector (see public computeTotalDeltaV).
+     * \param rootFinder Root finder used in the computation of the gravity assists.
+     * \return Total deltaV of the trajectory.
+     */
+    double computeTotalDeltaV( const Eigen::VectorXd& decisionVector,
+                               const root_finders::RootFinderPointer rootFinder ) const;
+
+    //! Function to compute the total deltaV of a range of trajectories in a batch.
+    /*!
+     * Function to compute the total deltaV of a range of trajectories in a batch.
+     * \param decisionVectors Decision vectors, one per column.
+     * \param startIndex Index of first trajectory that is to be evaluated.
+     * \param endIndex Index after last trajectory that is to be evaluated.
+     * \param totalDeltaVs Total deltaV of each of the trajectories (entries in range modified by reference).
+     */
+    void computeTotalDeltaVsInRange( const Eigen::MatrixXd& decisionVectors,
+                                     const unsigned int startIndex, const unsigned int endIndex,
+                                     Eigen::VectorXd& totalDeltaVs ) const;
+
+    //! State tables of the planets in the sequence.
+    std::vector< boost::shared_ptr< PlanetStateTable > > planetStateTables_;
+
+    //! Gravitational parameters of the planets in the sequence.
+    std::vector< double > planetGravitationalParameters_;
+
+    //! Minimum allowable pericenter radii of the gravity assists.
+    std::vector< double > minimumPericenterRadii_;
+
+    //! Gravitational parameter of the central body.
+    double centralBodyGravitationalParameter_;
+
+    //! Semi-major axis of the parking orbit at the first planet.
+    double departureOrbitSemiMajorAxis_;
+
+    //! Eccentricity of the parking orbit at the first planet.
+    double departureOrbitEccentricity_;
+
+    //! Semi-major axis of the orbit at the last planet.
+    double captureOrbitSemiMajorAxis_;
+
+    //! Eccentricity of the orbit at the last planet.
+    double captureOrbitEccentricity_;
+};
+
+} // namespace mission_segments
+} // namespace tudat
+
+#endif // TUDAT_MULTIPLE_GRAVITY_ASSIST_TRAJECTORY_H
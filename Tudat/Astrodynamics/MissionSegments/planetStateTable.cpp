@@ -0,0 +1,86 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#include <cmath>
+#include <stdexcept>
+
+#include "Tudat/Astrodynamics/MissionSegments/planetStateTable.h"
+
+namespace tudat
+{
+namespace mission_segments
+{
+
+//! Constructor, evaluates the state function at the tabulation times.
+PlanetStateTable::PlanetStateTable( const boost::function< Eigen::Vector6d( const double ) > stateFunction,
+                                    const double startTime, const double endTime, const double timeStep ):
+    startTime_( startTime ), timeStep_( timeStep )
+{
+    if( !( timeStep > 0.0 ) || !( endTime > startTime ) )
+    {
+        throw std::runtime_error( "Error when creating planet state table, time step must be positive and end time "
+                                  "must exceed start time." );
+    }
+
+    const unsigned int numberOfSteps = static_cast< unsigned int >( std::ceil( ( endTime - startTime ) / timeStep ) );
+    tabulatedStates_.resize( numberOfSteps + 1 );
+    for( unsigned int i = 0; i <= numberOfSteps; i++ )
+    {
+        tabulatedStates_[ i ] = stateFunction( startTime_ + static_cast< double >( i ) * timeStep_ );
+    }
+}
+
+//! Function to retrieve the interpolated Cartesian state of the planet.
+Eigen::Vector6d PlanetStateTable::getCartesianState( const double time ) const
+{
+    // Determine interval and (normalized) position within interval.
+    const double normalizedTime = ( time - startTime_ ) / timeStep_;
+    const double numberOfIntervals = static_cast< double >( tabulatedStates_.size( ) - 1 );
+    if( !( normalizedTime >= 0.0 && normalizedTime <= numberOfIntervals ) )
+    {
+        throw std::runtime_error( "Error when retrieving state from planet state table, time " +
+                                  std::to_string( time ) + " is outside of tabulated interval." );
+    }
+
+    unsigned int intervalIndex = static_cast< unsigned int >( normalizedTime );
+    if( intervalIndex == tabulatedStates_.size( ) - 1 )
+    {
+        intervalIndex--;
+    }
+    const double s = normalizedTime - static_cast< double >( intervalIndex );
+
+    const Eigen::Vector6d& lowerState = tabulatedStates_[ intervalIndex ];
+    const Eigen::Vector6d& upperState = tabulatedStates_[ intervalIndex + 1 ];
+
+    // Compute cubic Hermite basis functions and their derivatives w.r.t. normalized time.
+    const double s2 = s * s;
+    const double s3 = s2 * s;
+    const double h00 = 2.0 * s3 - 3.0 * s2 + 1.0;
+    const double h10 = s3 - 2.0 * s2 + s;
+    const double h01 = -2.0 * s3 + 3.0 * s2;
+    const double h11 = s3 - s2;
+    const double dh00 = 6.0 * s2 - 6.0 * s;
+    const double dh10 = 3.0 * s2 - 4.0 * s + 1.0;
+    const double dh11 = 3.0 * s2 - 2.0 * s;
+
+    // Interpolate position, and compute velocity from derivative of interpolating polynomial.
+    Eigen::Vector6d interpolatedState;
+    interpolatedState.segment( 0, 3 ) =
+            h00 * lowerState.segment( 0, 3 ) + h10 * timeStep_ * lowerState.segment( 3, 3 ) +
+            h01 * upperState.segment( 0, 3 ) + h11 * timeStep_ * upperState.segment( 3, 3 );
+    interpolatedState.segment( 3, 3 ) =
+            dh00 / timeStep_ * ( lowerState.segment( 0, 3 ) - upperState.segment( 0, 3 ) ) +
+            dh10 * lowerState.segment( 3, 3 ) + dh11 * upperState.segment( 3, 3 );
+    return interpolatedState;
+}
+
+} // namespace mission_segments
+} // namespace tudat
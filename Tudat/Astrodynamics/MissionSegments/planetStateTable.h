@@ -0,0 +1,99 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#ifndef TUDAT_PLANET_STATE_TABLE_H
+#define TUDAT_PLANET_STATE_TABLE_H
+
+#include <vector>
+
+#include <boost/function.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Basics/basicTypedefs.h"
+
+namespace tudat
+{
+namespace mission_segments
+{
+
+//! Class holding the states of a planet at equidistant times, for fast retrieval during trajectory optimization.
+/*!
+ * Class holding the Cartesian states of a planet, precomputed at equidistant times from a state function (typically
+ * the getCartesianState function of an ApproximatePlanetPositions or KeplerEphemeris object), from which the state at
+ * an arbitrary time in the tabulated interval is retrieved by cubic Hermite interpolation of the position (using the
+ * tabulated velocities as derivatives), with the velocity obtained from the derivative of the interpolating
+ * polynomial. Since the nodes are equidistant, the retrieval requires no search, and since the object is not
+ * modified after construction, states may be retrieved concurrently from multiple threads (unlike e.g.
+ * ApproximatePlanetPositions, which modifies its members in getCartesianState). For planetary orbits, a time step of
+ * one day results in position and velocity errors of the order of tens of meters and mm/s, respectively, w.r.t.
+ * the original state function.
+ */
+class PlanetStateTable
+{
+public:
+
+    //! Constructor, evaluates the state function at the tabulation times.
+    /*!
+     * Constructor, evaluates the state function at the tabulation times.
+     * \param stateFunction Function returning the Cartesian state of the planet as a function of time.
+     * \param startTime Start time of the tabulated interval.
+     * \param endTime End time of the tabulated interval (rounded upwards to an integer number of time steps).
+     * \param timeStep Time step between tabulated states.
+     */
+    PlanetStateTable( const boost::function< Eigen::Vector6d( const double ) > stateFunction,
+                      const double startTime, const double endTime, const double timeStep );
+
+    //! Function to retrieve the interpolated Cartesian state of the planet.
+    /*!
+     * Function to retrieve the interpolated Cartesian state of the planet. An exception is thrown if the time is
+     * outside the tabulated interval.
+     * \param time Time at which the state is to be retrieved.
+     * \return Cartesian state of the planet at the given time.
+     */
+    Eigen::Vector6d getCartesianState( const double time ) const;
+
+    //! Function to retrieve the start time of the tabulated interval.
+    /*!
+     * Function to retrieve the start time of the tabulated interval.
+     * \return Start time of the tabulated interval.
+     */
+    double getStartTime( ) const
+    {
+        return startTime_;
+    }
+
+    //! Function to retrieve the end time of the tabulated interval.
+    /*!
+     * Function to retrieve the end time of the tabulated interval.
+     * \return End time of the tabulated interval.
+     */
+    double getEndTime( ) const
+    {
+        return startTime_ + timeStep_ * static_cast< double >( tabulatedStates_.size( ) - 1 );
+    }
+
+private:
+
+    //! Start time of the tabulated interval.
+    double startTime_;
+
+    //! Time step between tabulated states.
+    double timeStep_;
+
+    //! Tabulated Cartesian states.
+    std::vector< Eigen::Vector6d > tabulatedStates_;
+};
+
+} // namespace mission_segments
+} // namespace tudat
+
+#endif // TUDAT_PLANET_STATE_TABLE_H
@@ -69,6 +69,12 @@ BOOST_AUTO_TEST_CASE( testObservationNoiseModels )
                     "ECLIPJ2000", "IAU_Earth", initialEphemerisTime ),
                 initialEphemerisTime, 2.0 * mathematical_constants::PI /
                 ( physical_constants::JULIAN_DAY ) );
+    bodySettings[ "Moon" ]->rotationModelSettings = boost::make_shared< SimpleRotationModelSettings >(
+                "ECLIPJ2000", "IAU_Moon",
+                spice_interface::computeRotationQuaternionBetweenFrames(
+                    "ECLIPJ2000", "IAU_Moon", initialEphemerisTime ),
+                initialEphemerisTime, 2.0 * mathematical_constants::PI /
+                ( 27.3 * physical_constants::JULIAN_DAY ) );
 
     NamedBodyMap bodyMap = createBodies( bodySettings );
 
@@ -376,6 +382,95 @@ BOOST_AUTO_TEST_CASE( testObservationNoiseModels )
             }
         }
     }
+
+    // Test multi-threaded noise simulation, with reproducible noise for each observable and set of link ends.
+    {
+        // Define (arbitrary) noise properties for observables
+        std::map< ObservableType, std::pair< ContinuousBoostStatisticalDistributions, std::vector< double > > >
+                noiseDistributions;
+        noiseDistributions[ one_way_range ] = std::make_pair(
+                    normal_boost_distribution, boost::assign::list_of( -200.0 )( 2.4 ) );
+        noiseDistributions[ one_way_doppler ] = std::make_pair(
+                    normal_boost_distribution, boost::assign::list_of( -2.8E-5 )( 7.5E-8 ) );
+        noiseDistributions[ angular_position ] = std::make_pair(
+                    normal_boost_distribution, boost::assign::list_of( 3.0E-4 )( 6.3E-6 ) );
+
+        // Simulate noisy observables, using one and three threads (each with its own copy of the environment)
+        PodInputDataType singleThreadObservationsAndTimes = simulateObservationsWithNoise< double, double >(
+                    measurementSimulationInput, observationSimulators, noiseDistributions, 42.0 );
+        PodInputDataType multiThreadObservationsAndTimes = simulateObservationsConcurrently< double, double >(
+                    measurementSimulationInput, observationSettingsMap, bodyMap, "ECLIPJ2000", 3,
+                    ObservationViabilitySettingsList( ), noiseDistributions, 42.0 );
+
+        // Simulate noisy observables for single observable, for which noise must be identical to that when simulating all
+        // observables.
+        std::map< ObservableType, std::map< LinkEnds, boost::shared_ptr< ObservationSimulationTimeSettings< double > > > >
+                rangeSimulationInput;
+        rangeSimulationInput[ one_way_range ] = measurementSimulationInput.at( one_way_range );
+        PodInputDataType rangeObservationsAndTimes = simulateObservationsWithNoise< double, double >(
+                    rangeSimulationInput, observationSimulators, noiseDistributions, 42.0 );
+        for( SingleObservablePodInputType::const_iterator rangeIterator = rangeObservationsAndTimes.at( one_way_range ).begin( );
+             rangeIterator != rangeObservationsAndTimes.at( one_way_range ).end( ); rangeIterator++ )
+        {
+            Eigen::VectorXd observationDifference = rangeIterator->second.first -
+                    singleThreadObservationsAndTimes.at( one_way_range ).at( rangeIterator->first ).first;
+            BOOST_CHECK_EQUAL( observationDifference.cwiseAbs( ).maxCoeff( ), 0.0 );
+        }
+
+        // Compare noisy observations for each combination of observable/link ends
+        for( PodInputDataType::const_iterator dataIterator = multiThreadObservationsAndTimes.begin( );
+             dataIterator != multiThreadObservationsAndTimes.end( ); dataIterator++ )
+        {
+            for( SingleObservablePodInputType::const_iterator innerDataIterator = dataIterator->second.begin( );
+                 innerDataIterator != dataIterator->second.end( ); innerDataIterator++ )
+            {
+                // Check that noise is independent of number of threads
+                Eigen::VectorXd singleThreadObservations =
+                        singleThreadObservationsAndTimes.at( dataIterator->first ).at( innerDataIterator->first ).first;
+                BOOST_CHECK_EQUAL( singleThreadObservations.rows( ), innerDataIterator->second.first.rows( ) );
+                for( int i = 0; i < singleThreadObservations.rows( ); i++ )
+                {
+                    BOOST_CHECK_EQUAL( singleThreadObservations( i ), innerDataIterator->second.first( i ) );
+                }
+
+                // Compare with imposed mean and standard deviation of noise.
+                Eigen::VectorXd dataDifference = innerDataIterator->second.first -
+                        idealObservationsAndTimes.at( dataIterator->first ).at( innerDataIterator->first ).first;
+                BOOST_CHECK_CLOSE_FRACTION(
+                            computeAverageOfVectorComponents( dataDifference ),
+                            noiseDistributions.at( dataIterator->first ).second.at( 0 ), 1.0E-2 );
+                BOOST_CHECK_CLOSE_FRACTION(
+                            computeStandardDeviationOfVectorComponents( dataDifference ),
+                            noiseDistributions.at( dataIterator->first ).second.at( 1 ), 1.0E-2 );
+            }
+        }
+    }
+}
+
+//! Test whether distinct base seeds, observables and link ends give distinct noise seeds
+BOOST_AUTO_TEST_CASE( testObservationNoiseSeeds )
+{
+    LinkEnds linkEnds;
+    linkEnds[ transmitter ] = std::make_pair( "Earth", "Station1" );
+    linkEnds[ receiver ] = std::make_pair( "Mars", "" );
+
+    // Check that seed is reproducible
+    BOOST_CHECK_EQUAL( getObservationNoiseSeed( 42.0, one_way_range, linkEnds ),
+                       getObservationNoiseSeed( 42.0, one_way_range, linkEnds ) );
+
+    // Check that seeds of opposite sign, and seeds differing by a fraction, are distinguished
+    BOOST_CHECK( getObservationNoiseSeed( 42.0, one_way_range, linkEnds ) !=
+                 getObservationNoiseSeed( -42.0, one_way_range, linkEnds ) );
+    BOOST_CHECK( getObservationNoiseSeed( 42.0, one_way_range, linkEnds ) !=
+                 getObservationNoiseSeed( 42.5, one_way_range, linkEnds ) );
+
+    // Check that observable types and link ends are distinguished
+    BOOST_CHECK( getObservationNoiseSeed( 42.0, one_way_range, linkEnds ) !=
+                 getObservationNoiseSeed( 42.0, one_way_doppler, linkEnds ) );
+    LinkEnds otherLinkEnds = linkEnds;
+    otherLinkEnds[ transmitter ] = std::make_pair( "Earth", "Station2" );
+    BOOST_CHECK( getObservationNoiseSeed( 42.0, one_way_range, linkEnds ) !=
+                 getObservationNoiseSeed( 42.0, one_way_range, otherLinkEnds ) );
 }
 
 BOOST_AUTO_TEST_SUITE_END( )
@@ -91,6 +91,21 @@ public:
                                      const LinkEnds linkEnds,
                                      const LinkEndType linkEndAssociatedWithTime ) = 0;
 
+    //! Function to simulate observations between specified link ends at set of observation times, without partials.
+    /*!
+     *  Function (pure virtual) to simulate observations between specified link ends at set of observation times, without
+     *  computing the associated partials.
+     *  \param times Vector of times at which observations are performed
+     *  \param linkEnds Set of stations, S/C etc. in link, with specifiers of type of link end.
+     *  \param linkEndAssociatedWithTime Link end at which input times are valid, i.e. link end for which associated time
+     *  is kept constant (to input value)
+     *  \return Observable values, in same order as first entry of computeObservationsWithPartials output
+     */
+    virtual Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >
+    computeObservations( const std::vector< TimeType >& times,
+                         const LinkEnds linkEnds,
+                         const LinkEndType linkEndAssociatedWithTime ) = 0;
+
     //! Function (ṕure virtual) to return the object used to simulate noise-free observations
     /*!
      * Function (ṕure virtual) to return the object used to simulate noise-free observations
@@ -267,6 +282,37 @@ public:
                                utilities::createConcatenatedEigenMatrixFromMapValues( observationMatrices ) );
     }
 
+    //! Function to simulate observations between specified link ends at set of observation times, without partials.
+    /*!
+     *  Function to simulate observations between specified link ends at set of observation times, without computing the
+     *  associated partials.
+     *  \param times Vector of times at which observations are performed
+     *  \param linkEnds Set of stations, S/C etc. in link, with specifiers of type of link end.
+     *  \param linkEndAssociatedWithTime Link end at which input times are valid, i.e. link end for which associated time
+     *  is kept constant (to input value)
+     *  \return Observable values, in same order as first entry of computeObservationsWithPartials output
+     */
+    Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >
+    computeObservations( const std::vector< TimeType >& times,
+                         const LinkEnds linkEnds,
+                         const LinkEndType linkEndAssociatedWithTime )
+    {
+        std::map< TimeType, Eigen::Matrix< ObservationScalarType, ObservationSize, 1 > > observations;
+
+        // Get observation model.
+        boost::shared_ptr< ObservationModel< ObservationSize, ObservationScalarType, TimeType > > selectedObservationModel =
+                observationSimulator_->getObservationModel( linkEnds );
+
+        // Iterate over all observation times
+        for( unsigned int i = 0; i < times.size( ); i++ )
+        {
+            observations[ times[ i ] ] = selectedObservationModel->computeObservations(
+                        times[ i ], linkEndAssociatedWithTime );
+        }
+
+        return utilities::createConcatenatedEigenMatrixFromMapValues( observations );
+    }
+
     //! Function to return the full list of observation partial objects
     /*!
      * Function to return the full list of observation partial objects
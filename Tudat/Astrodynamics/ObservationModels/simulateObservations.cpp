@@ -0,0 +1,77 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#include "Tudat/Astrodynamics/ObservationModels/simulateObservations.h"
+
+namespace tudat
+{
+
+namespace observation_models
+{
+
+//! Function to generate a noise vector, with each entry independently generated from the same noise function
+Eigen::VectorXd getIdenticallyAndIndependentlyDistributedNoise(
+        const boost::function< double( const double ) > noiseFunction,
+        const int observationSize,
+        const double evaluationTime )
+{
+    Eigen::VectorXd noiseValues = Eigen::VectorXd( observationSize );
+    for( int i = 0; i < observationSize; i++ )
+    {
+        noiseValues( i ) = noiseFunction( evaluationTime );
+    }
+    return noiseValues;
+}
+
+//! Function to compute a (platform-independent) 64-bit FNV-1a hash of a string
+static uint64_t computeStringHash( const std::string& hashInput )
+{
+    uint64_t hashValue = 0xCBF29CE484222325ULL;
+    for( unsigned int i = 0; i < hashInput.size( ); i++ )
+    {
+        hashValue = ( hashValue ^ static_cast< unsigned char >( hashInput.at( i ) ) ) * 0x100000001B3ULL;
+    }
+    return hashValue;
+}
+
+//! Function to compute the seed of the noise generator for a single observable/link end combination
+double getObservationNoiseSeed( const double baseSeed, const ObservableType observableType, const LinkEnds& linkEnds )
+{
+    // Create unique string identifier of observable/link end combination
+    std::string observationSetIdentifier = std::to_string( observableType );
+    for( LinkEnds::const_iterator linkEndIterator = linkEnds.begin( ); linkEndIterator != linkEnds.end( );
+         linkEndIterator++ )
+    {
+        observationSetIdentifier += ";" + std::to_string( linkEndIterator->first ) + ":" +
+                linkEndIterator->second.first + "/" + linkEndIterator->second.second;
+    }
+
+    // Retrieve bit pattern of base seed, so that all distinct seeds (including negative and non-integer values) are hashed
+    // differently
+    uint64_t baseSeedBits;
+    std::memcpy( &baseSeedBits, &baseSeed, sizeof( baseSeedBits ) );
+
+    // Combine inputs, and apply 64-bit mixing function (finalizer of SplitMix64 generator)
+    uint64_t hashValue = baseSeedBits * 0x9E3779B97F4A7C15ULL + computeStringHash( observationSetIdentifier );
+    hashValue = ( hashValue ^ ( hashValue >> 30 ) ) * 0xBF58476D1CE4E5B9ULL;
+    hashValue = ( hashValue ^ ( hashValue >> 27 ) ) * 0x94D049BB133111EBULL;
+    hashValue = hashValue ^ ( hashValue >> 31 );
+
+    // Reduce to 32 bits, as used by random number generator
+    return static_cast< double >( static_cast< uint32_t >( hashValue >> 32 ) );
+}
+
+} // namespace observation_models
+
+} // namespace tudat
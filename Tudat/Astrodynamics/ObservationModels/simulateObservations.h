@@ -11,10 +11,15 @@
 #ifndef TUDAT_SIMULATEOBSERVATIONS_H
 #define TUDAT_SIMULATEOBSERVATIONS_H
 
+#include <algorithm>
+#include <atomic>
+
 #include <boost/shared_ptr.hpp>
 #include <boost/bind.hpp>
 
 #include "Tudat/Astrodynamics/ObservationModels/observationSimulator.h"
+#include "Tudat/Basics/parallelLoops.h"
+#include "Tudat/Mathematics/Statistics/randomVariableGenerator.h"
 
 namespace tudat
 {
@@ -197,124 +202,291 @@ simulateObservations(
                 createObservationSimulationTimeSettingsMap( observationsToSimulate ), observationSimulators );
 }
 
-//! Function to simulate observations from set of observables and link and sets
+//! Function to simulate observations for single observable and single set of link ends, from base class simulator.
 /*!
- *  Function to simulate observations from set of observables, link ends and observation time settings
- *  Iterates over all observables and link ends and simulates observations.
- *  \param observationsToSimulate List of observation time settings per link end set per observable type.
- *  \param observationSimulators List of Observation simulators per link end set per observable type.
- *  \param viabilityCalculatorList List (per observable type and per link ends) of observation viability calculators, which
- *  are used to reject simulated observation if they dont fulfill a given (set of) conditions, e.g. minimum elevation angle
- *  (default none).
- *  \return Simulated observatoon values and associated times for requested observable types and link end sets.
+ *  Function to simulate observations for single observable and single set of link ends, from a simulator of which the
+ *  observable size is not known at compile time.
+ *  \param observationsToSimulate Object that computes/defines settings for observation times/reference link end
+ *  \param observationSimulator Observation simulator for observable for which observations are to be calculated.
+ *  \param linkEnds Link end set for which observations are to be calculated.
+ *  \param currentObservationViabilityCalculators List of observation viability calculators, which are used to reject simulated
+ *  observation if they dont fulfill a given (set of) conditions, e.g. minimum elevation angle (default none).
+ *  \return Pair of first: vector of observations; second: vector of times at which observations are taken
+ *  (reference to link end defined in observationsToSimulate).
  */
 template< typename ObservationScalarType = double, typename TimeType = double >
-std::map< ObservableType, std::map< LinkEnds, std::pair< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >,
-std::pair< std::vector< TimeType >, LinkEndType > > > >
-simulateObservations(
-        const std::map< ObservableType, std::map< LinkEnds,
-        boost::shared_ptr< ObservationSimulationTimeSettings< TimeType > > > >& observationsToSimulate,
-        const std::map< ObservableType,
-        boost::shared_ptr< ObservationSimulatorBase< ObservationScalarType, TimeType > > >& observationSimulators,
-        const PerObservableObservationViabilityCalculatorList viabilityCalculatorList =
-        PerObservableObservationViabilityCalculatorList( ) )
+std::pair< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >,std::pair< std::vector< TimeType >, LinkEndType > >
+simulateSingleObservationSet(
+        const boost::shared_ptr< ObservationSimulationTimeSettings< TimeType > > observationsToSimulate,
+        const boost::shared_ptr< ObservationSimulatorBase< ObservationScalarType, TimeType > > observationSimulator,
+        const LinkEnds& linkEnds,
+        const std::vector< boost::shared_ptr< ObservationViabilityCalculator > > currentObservationViabilityCalculators =
+        std::vector< boost::shared_ptr< ObservationViabilityCalculator > >( ) )
 {
-    // Declare return map.
-    std::map< ObservableType, std::map< LinkEnds, std::pair< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >,
-            std::pair< std::vector< TimeType >, LinkEndType > > > > observations;
+    int observationSize = observationSimulator->getObservationSize( linkEnds );
 
-    // Iterate over all observables.
-    for( typename std::map< ObservableType, std::map< LinkEnds,
-         boost::shared_ptr< ObservationSimulationTimeSettings< TimeType > >  > >::const_iterator observationIterator =
-         observationsToSimulate.begin( ); observationIterator != observationsToSimulate.end( ); observationIterator++ )
+    std::pair< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >, std::pair< std::vector< TimeType >, LinkEndType > >
+            simulatedObservations;
+    switch( observationSize )
+    {
+    case 1:
+    {
+        boost::shared_ptr< ObservationSimulator< 1, ObservationScalarType, TimeType > > derivedObservationSimulator =
+                boost::dynamic_pointer_cast< ObservationSimulator< 1, ObservationScalarType, TimeType > >(
+                    observationSimulator );
+
+        if( derivedObservationSimulator == NULL )
+        {
+            throw std::runtime_error( "Error when simulating observation: dynamic case to size 1 is NULL" );
+        }
+
+        // Simulate observations for current observable and link ends set.
+        simulatedObservations = simulateSingleObservationSet< ObservationScalarType, TimeType, 1 >(
+                    observationsToSimulate, derivedObservationSimulator,
+                    linkEnds, currentObservationViabilityCalculators );
+        break;
+    }
+    case 2:
     {
+        boost::shared_ptr< ObservationSimulator< 2, ObservationScalarType, TimeType > > derivedObservationSimulator =
+                boost::dynamic_pointer_cast< ObservationSimulator< 2, ObservationScalarType, TimeType > >(
+                    observationSimulator );
 
-        PerLinkEndsObservationViabilityCalculatorList perLinkViabilityCalculators;
-        if( viabilityCalculatorList.count( observationIterator->first ) > 0 )
+        if( derivedObservationSimulator == NULL )
         {
-            perLinkViabilityCalculators = viabilityCalculatorList.at( observationIterator->first );
+            throw std::runtime_error( "Error when simulating observation: dynamic case to size 2 is NULL" );
         }
-        // Iterate over all link ends for current observable.
+
+        // Simulate observations for current observable and link ends set.
+        simulatedObservations = simulateSingleObservationSet< ObservationScalarType, TimeType, 2 >(
+                    observationsToSimulate, derivedObservationSimulator,
+                    linkEnds, currentObservationViabilityCalculators );
+        break;
+    }
+    case 3:
+    {
+        boost::shared_ptr< ObservationSimulator< 3, ObservationScalarType, TimeType > > derivedObservationSimulator =
+                boost::dynamic_pointer_cast< ObservationSimulator< 3, ObservationScalarType, TimeType > >(
+                    observationSimulator );
+
+        if( derivedObservationSimulator == NULL )
+        {
+            throw std::runtime_error( "Error when simulating observation: dynamic case to size 3 is NULL" );
+        }
+
+        // Simulate observations for current observable and link ends set.
+        simulatedObservations = simulateSingleObservationSet< ObservationScalarType, TimeType, 3 >(
+                    observationsToSimulate, derivedObservationSimulator,
+                    linkEnds, currentObservationViabilityCalculators );
+        break;
+    }
+    default:
+        throw std::runtime_error( "Error, simulation of observations not yet implemented for size " +
+                                  std::to_string( observationSize ) );
+
+    }
+    return simulatedObservations;
+}
+
+//! Function to create the list of observable/link end combinations for which observations are to be simulated
+/*!
+ *  Function to create the list of observable/link end combinations for which observations are to be simulated, in order of
+ *  iteration over the observation time settings.
+ *  \param observationsToSimulate List of observation time settings per link end set per observable type.
+ *  \return List of observable/link end combinations for which observations are to be simulated
+ */
+template< typename TimeType >
+std::vector< std::pair< ObservableType, LinkEnds > > getObservationSetList(
+        const std::map< ObservableType, std::map< LinkEnds,
+        boost::shared_ptr< ObservationSimulationTimeSettings< TimeType > > > >& observationsToSimulate )
+{
+    std::vector< std::pair< ObservableType, LinkEnds > > observationSetList;
+    for( typename std::map< ObservableType, std::map< LinkEnds,
+         boost::shared_ptr< ObservationSimulationTimeSettings< TimeType > >  > >::const_iterator observationIterator =
+         observationsToSimulate.begin( ); observationIterator != observationsToSimulate.end( ); observationIterator++ )
+    {
         for( typename std::map< LinkEnds,
              boost::shared_ptr< ObservationSimulationTimeSettings< TimeType > > >::const_iterator linkEndIterator =
              observationIterator->second.begin( ); linkEndIterator != observationIterator->second.end( ); linkEndIterator++ )
         {
+            observationSetList.push_back( std::make_pair( observationIterator->first, linkEndIterator->first ) );
+        }
+    }
+    return observationSetList;
+}
+
+//! Function to simulate observations (and optionally add noise) for a list of observable/link end combinations.
+/*!
+ *  Function to simulate observations, and optionally add noise, for a list of observable/link end combinations (tasks), using
+ *  the observation simulators and viability calculators of a single thread. The list is shared between threads by means of
+ *  the nextTaskIndex counter: each call of this function processes tasks from the list until none are left. If an exception
+ *  is thrown, the remaining tasks are cancelled before the exception is rethrown.
+ *  \param observationSetList List of observable/link end combinations for which observations are to be simulated
+ *  \param observationsToSimulate List of observation time settings per link end set per observable type.
+ *  \param observationSimulatorsPerThread List of Observation simulators per link end set per observable type, for each
+ *  thread.
+ *  \param viabilityCalculatorListPerThread List (per observable type and per link ends) of observation viability
+ *  calculators, for each thread.
+ *  \param noiseGenerators Random noise generator per entry of observationSetList; each noise generator is used for its
+ *  own task only. If the list is empty, no noise is added.
+ *  \param nextTaskIndex Index of next entry of observationSetList that is to be processed (shared by threads)
+ *  \param simulatedObservations Simulated observations, per entry of observationSetList (modified by this function)
+ *  \param threadIndex Index of the thread from which this function is called
+ */
+template< typename ObservationScalarType, typename TimeType >
+void simulateObservationSetsFromList(
+        const std::vector< std::pair< ObservableType, LinkEnds > >& observationSetList,
+        const std::map< ObservableType, std::map< LinkEnds,
+        boost::shared_ptr< ObservationSimulationTimeSettings< TimeType > > > >& observationsToSimulate,
+        const std::vector< std::map< ObservableType,
+        boost::shared_ptr< ObservationSimulatorBase< ObservationScalarType, TimeType > > > >& observationSimulatorsPerThread,
+        const std::vector< PerObservableObservationViabilityCalculatorList >& viabilityCalculatorListPerThread,
+        const std::vector< boost::function< double( ) > >& noiseGenerators,
+        std::atomic< unsigned int >& nextTaskIndex,
+        std::vector< std::pair< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >,
+        std::pair< std::vector< TimeType >, LinkEndType > > >& simulatedObservations,
+        const unsigned int threadIndex )
+{
+    const std::map< ObservableType, boost::shared_ptr< ObservationSimulatorBase< ObservationScalarType, TimeType > > >&
+            observationSimulators = observationSimulatorsPerThread.at( threadIndex );
+    const PerObservableObservationViabilityCalculatorList& viabilityCalculatorList =
+            viabilityCalculatorListPerThread.at( threadIndex );
+    try
+    {
+        unsigned int currentTaskIndex;
+        while( ( currentTaskIndex = nextTaskIndex++ ) < observationSetList.size( ) )
+        {
+            const ObservableType currentObservable = observationSetList.at( currentTaskIndex ).first;
+            const LinkEnds& currentLinkEnds = observationSetList.at( currentTaskIndex ).second;
 
             std::vector< boost::shared_ptr< ObservationViabilityCalculator > > currentObservationViabilityCalculators;
-            if( perLinkViabilityCalculators.count( linkEndIterator->first ) > 0 )
+            if( viabilityCalculatorList.count( currentObservable ) > 0 &&
+                    viabilityCalculatorList.at( currentObservable ).count( currentLinkEnds ) > 0 )
             {
-                currentObservationViabilityCalculators = perLinkViabilityCalculators.at( linkEndIterator->first );
+                currentObservationViabilityCalculators = viabilityCalculatorList.at( currentObservable ).at( currentLinkEnds );
             }
 
-            int observationSize = observationSimulators.at( observationIterator->first )->getObservationSize(
-                        linkEndIterator->first );
+            // Simulate observations for current observable and link ends set.
+            simulatedObservations[ currentTaskIndex ] = simulateSingleObservationSet< ObservationScalarType, TimeType >(
+                        observationsToSimulate.at( currentObservable ).at( currentLinkEnds ),
+                        observationSimulators.at( currentObservable ), currentLinkEnds,
+                        currentObservationViabilityCalculators );
 
-            switch( observationSize )
-            {
-            case 1:
+            // Add noise to observations, in order of observation times
+            if( noiseGenerators.size( ) > 0 )
             {
-                boost::shared_ptr< ObservationSimulator< 1, ObservationScalarType, TimeType > > derivedObservationSimulator =
-                        boost::dynamic_pointer_cast< ObservationSimulator< 1, ObservationScalarType, TimeType > >(
-                            observationSimulators.at( observationIterator->first ) );
-
-                if( derivedObservationSimulator == NULL )
+                Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >& currentObservations =
+                        simulatedObservations[ currentTaskIndex ].first;
+                for( int i = 0; i < currentObservations.rows( ); i++ )
                 {
-                    throw std::runtime_error( "Error when simulating observation: dynamic case to size 1 is NULL" );
+                    currentObservations( i ) += static_cast< ObservationScalarType >(
+                                noiseGenerators.at( currentTaskIndex )( ) );
                 }
-
-                // Simulate observations for current observable and link ends set.
-                observations[ observationIterator->first ][ linkEndIterator->first ] =
-                        simulateSingleObservationSet< ObservationScalarType, TimeType, 1 >(
-                            linkEndIterator->second, derivedObservationSimulator,
-                            linkEndIterator->first, currentObservationViabilityCalculators );
-                break;
             }
-            case 2:
-            {
-                boost::shared_ptr< ObservationSimulator< 2, ObservationScalarType, TimeType > > derivedObservationSimulator =
-                        boost::dynamic_pointer_cast< ObservationSimulator< 2, ObservationScalarType, TimeType > >(
-                            observationSimulators.at( observationIterator->first ) );
-
-                if( derivedObservationSimulator == NULL )
-                {
-                    throw std::runtime_error( "Error when simulating observation: dynamic case to size 2 is NULL" );
-                }
+        }
+    }
+    catch( ... )
+    {
+        nextTaskIndex = observationSetList.size( );
+        throw;
+    }
+}
 
-                // Simulate observations for current observable and link ends set.
-                observations[ observationIterator->first ][ linkEndIterator->first ] =
-                        simulateSingleObservationSet< ObservationScalarType, TimeType, 2 >(
-                            linkEndIterator->second, derivedObservationSimulator,
-                            linkEndIterator->first, currentObservationViabilityCalculators );
-                break;
-            }
-            case 3:
-            {
-                boost::shared_ptr< ObservationSimulator< 3, ObservationScalarType, TimeType > > derivedObservationSimulator =
-                        boost::dynamic_pointer_cast< ObservationSimulator< 3, ObservationScalarType, TimeType > >(
-                            observationSimulators.at( observationIterator->first ) );
+//! Function to simulate observations (and optionally add noise) for a set of observables and link ends, using multiple threads.
+/*!
+ *  Function to simulate observations, and optionally add noise, for a set of observables and link ends. The combinations of
+ *  observable and link ends are distributed dynamically over a number of threads, with one thread for each entry of
+ *  observationSimulatorsPerThread (limited to the number of combinations). The environment models used by the observation
+ *  models (e.g. tabulated ephemerides and their interpolators) are modified when being evaluated, so each thread must use
+ *  observation simulators and viability calculators that are created from its own, independent, environment (see
+ *  simulation_setup::createIndependentBodyMapCopy); simulators and viability calculators must not be shared between threads.
+ *  \param observationsToSimulate List of observation time settings per link end set per observable type.
+ *  \param observationSimulatorsPerThread List of Observation simulators per link end set per observable type, for each
+ *  thread.
+ *  \param viabilityCalculatorListPerThread List (per observable type and per link ends) of observation viability
+ *  calculators, for each thread (must be of same size as observationSimulatorsPerThread).
+ *  \param noiseGenerators Random noise generator per observable/link end combination, in order of iteration over
+ *  observationsToSimulate. If the list is empty, no noise is added.
+ *  \return Simulated observation values and associated times for requested observable types and link end sets.
+ */
+template< typename ObservationScalarType = double, typename TimeType = double >
+std::map< ObservableType, std::map< LinkEnds, std::pair< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >,
+std::pair< std::vector< TimeType >, LinkEndType > > > >
+simulateObservationSetsConcurrently(
+        const std::map< ObservableType, std::map< LinkEnds,
+        boost::shared_ptr< ObservationSimulationTimeSettings< TimeType > > > >& observationsToSimulate,
+        const std::vector< std::map< ObservableType,
+        boost::shared_ptr< ObservationSimulatorBase< ObservationScalarType, TimeType > > > >& observationSimulatorsPerThread,
+        const std::vector< PerObservableObservationViabilityCalculatorList >& viabilityCalculatorListPerThread,
+        const std::vector< boost::function< double( ) > >& noiseGenerators )
+{
+    typedef std::pair< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >,
+            std::pair< std::vector< TimeType >, LinkEndType > > SingleObservationSet;
 
-                if( derivedObservationSimulator == NULL )
-                {
-                    throw std::runtime_error( "Error when simulating observation: dynamic case to size 3 is NULL" );
-                }
+    // Create list of all observable/link end combinations
+    std::vector< std::pair< ObservableType, LinkEnds > > observationSetList = getObservationSetList( observationsToSimulate );
 
-                // Simulate observations for current observable and link ends set.
-                observations[ observationIterator->first ][ linkEndIterator->first ] =
-                        simulateSingleObservationSet< ObservationScalarType, TimeType, 3 >(
-                            linkEndIterator->second, derivedObservationSimulator,
-                            linkEndIterator->first, currentObservationViabilityCalculators );
-                break;
-            }
-            default:
-                throw std::runtime_error( "Error, simulation of observations not yet implemented for size " +
-                                          std::to_string( observationSize ) );
+    if( observationSimulatorsPerThread.size( ) == 0 ||
+            observationSimulatorsPerThread.size( ) != viabilityCalculatorListPerThread.size( ) )
+    {
+        throw std::runtime_error( "Error when simulating observations, number of observation simulator sets is inconsistent" );
+    }
+    else if( noiseGenerators.size( ) > 0 && noiseGenerators.size( ) != observationSetList.size( ) )
+    {
+        throw std::runtime_error( "Error when simulating observations, number of noise generators is inconsistent" );
+    }
 
-            }
-        }
+    // Simulate observations, with tasks distributed dynamically over the threads.
+    std::vector< SingleObservationSet > simulatedObservationSets( observationSetList.size( ) );
+    std::atomic< unsigned int > nextTaskIndex( 0 );
+    utilities::runOnParallelThreads(
+                utilities::getNumberOfThreadsToUse( observationSimulatorsPerThread.size( ), observationSetList.size( ) ),
+                boost::bind( &simulateObservationSetsFromList< ObservationScalarType, TimeType >,
+                             boost::cref( observationSetList ), boost::cref( observationsToSimulate ),
+                             boost::cref( observationSimulatorsPerThread ), boost::cref( viabilityCalculatorListPerThread ),
+                             boost::cref( noiseGenerators ), boost::ref( nextTaskIndex ),
+                             boost::ref( simulatedObservationSets ), _1 ) );
+
+    // Set simulated observations in return map
+    std::map< ObservableType, std::map< LinkEnds, SingleObservationSet > > observations;
+    for( unsigned int i = 0; i < observationSetList.size( ); i++ )
+    {
+        observations[ observationSetList.at( i ).first ][ observationSetList.at( i ).second ] =
+                simulatedObservationSets.at( i );
     }
     return observations;
 }
 
+//! Function to simulate observations from set of observables and link and sets
+/*!
+ *  Function to simulate observations from set of observables, link ends and observation time settings
+ *  Iterates over all observables and link ends and simulates observations.
+ *  \param observationsToSimulate List of observation time settings per link end set per observable type.
+ *  \param observationSimulators List of Observation simulators per link end set per observable type.
+ *  \param viabilityCalculatorList List (per observable type and per link ends) of observation viability calculators, which
+ *  are used to reject simulated observation if they dont fulfill a given (set of) conditions, e.g. minimum elevation angle
+ *  (default none).
+ *  \return Simulated observatoon values and associated times for requested observable types and link end sets.
+ */
+template< typename ObservationScalarType = double, typename TimeType = double >
+std::map< ObservableType, std::map< LinkEnds, std::pair< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >,
+std::pair< std::vector< TimeType >, LinkEndType > > > >
+simulateObservations(
+        const std::map< ObservableType, std::map< LinkEnds,
+        boost::shared_ptr< ObservationSimulationTimeSettings< TimeType > > > >& observationsToSimulate,
+        const std::map< ObservableType,
+        boost::shared_ptr< ObservationSimulatorBase< ObservationScalarType, TimeType > > >& observationSimulators,
+        const PerObservableObservationViabilityCalculatorList viabilityCalculatorList =
+        PerObservableObservationViabilityCalculatorList( ) )
+{
+    return simulateObservationSetsConcurrently< ObservationScalarType, TimeType >(
+                observationsToSimulate, std::vector< std::map< ObservableType,
+                boost::shared_ptr< ObservationSimulatorBase< ObservationScalarType, TimeType > > > >(
+                    1, observationSimulators ),
+                std::vector< PerObservableObservationViabilityCalculatorList >( 1, viabilityCalculatorList ),
+                std::vector< boost::function< double( ) > >( ) );
+}
+
 //! Function to simulate observations with observation noise from set of observables and link and sets
 /*!
  *  Function to simulate observations with observation noise from set of observables, link ends and observation time settings
@@ -405,17 +577,68 @@ simulateObservationsWithNoise(
     return noisyObservationsList;
 }
 
+//! Function to generate a noise vector, with each entry independently generated from the same noise function
+/*!
+ *  Function to generate a noise vector, with each entry independently generated from the same noise function
+ *  \param noiseFunction Function that returns the (scalar) observation noise as a function of observation time.
+ *  \param observationSize Size of the noise vector
+ *  \param evaluationTime Time at which noise is to be evaluated
+ *  \return Noise vector
+ */
 Eigen::VectorXd getIdenticallyAndIndependentlyDistributedNoise(
         const boost::function< double( const double ) > noiseFunction,
         const int observationSize,
-        const double evaluationTime )
+        const double evaluationTime );
+
+//! Function to compute the seed of the noise generator for a single observable/link end combination
+/*!
+ *  Function to compute the seed of the noise generator for a single observable/link end combination, from a base seed, the
+ *  observable type and the link ends. The seeds are computed by hashing all inputs, such that the noise streams of different
+ *  combinations are decorrelated. Since the seed does not depend on the position of the combination in the list of
+ *  observations that is simulated, the noise of a given combination is independent of the number of threads used in the
+ *  simulation, and of the other observables and link ends that are simulated.
+ *  \param baseSeed Base seed of the noise simulation
+ *  \param observableType Observable type of the combination
+ *  \param linkEnds Link ends of the combination
+ *  \return Seed of random noise generator for given observable/link end combination
+ */
+double getObservationNoiseSeed( const double baseSeed, const ObservableType observableType, const LinkEnds& linkEnds );
+
+//! Function to create a random noise generator for each observable/link end combination that is to be simulated
+/*!
+ *  Function to create a random noise generator for each observable/link end combination that is to be simulated, with a
+ *  seed computed from noiseSeed, the observable type and the link ends (see getObservationNoiseSeed).
+ *  \param observationsToSimulate List of observation time settings per link end set per observable type.
+ *  \param noiseDistributions Distribution type and distribution parameters (see
+ *  statistics::createBoostContinuousRandomVariableGeneratorFunction) of the noise, per observable type.
+ *  \param noiseSeed Base seed of noise simulation
+ *  \return Random noise generators, in order of iteration over observationsToSimulate.
+ */
+template< typename TimeType = double >
+std::vector< boost::function< double( ) > > createObservationNoiseGenerators(
+        const std::map< ObservableType, std::map< LinkEnds,
+        boost::shared_ptr< ObservationSimulationTimeSettings< TimeType > > > >& observationsToSimulate,
+        const std::map< ObservableType, std::pair< statistics::ContinuousBoostStatisticalDistributions, std::vector< double > > >&
+        noiseDistributions,
+        const double noiseSeed )
 {
-    Eigen::VectorXd noiseValues = Eigen::VectorXd( observationSize );
-    for( int i = 0; i < observationSize; i++ )
+    std::vector< boost::function< double( ) > > noiseGenerators;
+    std::vector< std::pair< ObservableType, LinkEnds > > observationSetList = getObservationSetList( observationsToSimulate );
+    for( unsigned int i = 0; i < observationSetList.size( ); i++ )
     {
-        noiseValues( i ) = noiseFunction( evaluationTime );
+        const ObservableType currentObservable = observationSetList.at( i ).first;
+        if( noiseDistributions.count( currentObservable ) == 0 )
+        {
+            throw std::runtime_error( "Error when setting observation noise distribution, missing observable" );
+        }
+
+        noiseGenerators.push_back(
+                    statistics::createBoostContinuousRandomVariableGeneratorFunction(
+                        noiseDistributions.at( currentObservable ).first,
+                        noiseDistributions.at( currentObservable ).second,
+                        getObservationNoiseSeed( noiseSeed, currentObservable, observationSetList.at( i ).second ) ) );
     }
-    return noiseValues;
+    return noiseGenerators;
 }
 
 //! Function to simulate observations with observation noise from set of observables and link and sets
@@ -597,6 +820,46 @@ simulateObservationsWithNoise(
                 observationsToSimulate, observationSimulators, noiseFunctionList, viabilityCalculatorList );
 }
 
+//! Function to simulate observations with reproducible random observation noise from set of observables and link and sets
+/*!
+ *  Function to simulate observations with random observation noise from set of observables, link ends and observation time
+ *  settings. The noise for each observable type is drawn from a given continuous distribution. Each observable/link end
+ *  combination uses its own random number generator, with a seed computed from noiseSeed, the observable type and the link
+ *  ends (see getObservationNoiseSeed). Consequently, the simulated noise is fully reproducible.
+ *  \param observationsToSimulate List of observation time settings per link end set per observable type.
+ *  \param observationSimulators List of Observation simulators per link end set per observable type.
+ *  \param noiseDistributions Distribution type and distribution parameters (see
+ *  statistics::createBoostContinuousRandomVariableGeneratorFunction) of the noise, per observable type. For multi-valued
+ *  observables, each entry is drawn independently.
+ *  \param noiseSeed Base seed of noise simulation
+ *  \param viabilityCalculatorList List (per observable type and per link ends) of observation viability calculators, which
+ *  are used to reject simulated observation if they dont fulfill a given (set of) conditions, e.g. minimum elevation angle
+ *  (default none).
+ *  \return Simulated observatoon values and associated times for requested observable types and link end sets.
+ */
+template< typename ObservationScalarType = double, typename TimeType = double >
+std::map< ObservableType, std::map< LinkEnds, std::pair< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >,
+std::pair< std::vector< TimeType >, LinkEndType > > > >
+simulateObservationsWithNoise(
+        const std::map< ObservableType, std::map< LinkEnds,
+        boost::shared_ptr< ObservationSimulationTimeSettings< TimeType > > > >& observationsToSimulate,
+        const std::map< ObservableType,
+        boost::shared_ptr< ObservationSimulatorBase< ObservationScalarType, TimeType > > >& observationSimulators,
+        const std::map< ObservableType, std::pair< statistics::ContinuousBoostStatisticalDistributions, std::vector< double > > >&
+        noiseDistributions,
+        const double noiseSeed,
+        const PerObservableObservationViabilityCalculatorList viabilityCalculatorList =
+        PerObservableObservationViabilityCalculatorList( ) )
+{
+    // Simulate observations with noise
+    return simulateObservationSetsConcurrently< ObservationScalarType, TimeType >(
+                observationsToSimulate, std::vector< std::map< ObservableType,
+                boost::shared_ptr< ObservationSimulatorBase< ObservationScalarType, TimeType > > > >(
+                    1, observationSimulators ),
+                std::vector< PerObservableObservationViabilityCalculatorList >( 1, viabilityCalculatorList ),
+                createObservationNoiseGenerators( observationsToSimulate, noiseDistributions, noiseSeed ) );
+}
+
 //! Function to remove link id from the simulated observations
 /*!
  * /param simulatedObservations The simulated observation
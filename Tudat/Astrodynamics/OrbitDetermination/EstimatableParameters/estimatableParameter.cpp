@@ -238,6 +238,28 @@ bool isParameterTidalProperty( const EstimatebleParametersEnum parameterType )
     return flag;
 }
 
+//! Function to determine whether the given parameter influences only the observation models, and not the dynamics.
+bool isParameterObservationModelOnlyProperty( const EstimatebleParametersEnum parameterType )
+{
+    bool flag;
+    switch( parameterType )
+    {
+    case constant_additive_observation_bias:
+        flag = true;
+        break;
+    case constant_relative_observation_bias:
+        flag = true;
+        break;
+    case ground_station_position:
+        flag = true;
+        break;
+    default:
+        flag = false;
+        break;
+    }
+    return flag;
+}
+
 
 
 
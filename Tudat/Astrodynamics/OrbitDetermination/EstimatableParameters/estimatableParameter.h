@@ -98,6 +98,16 @@ bool isParameterObservationLinkProperty( const EstimatebleParametersEnum paramet
  */
 bool isParameterTidalProperty( const EstimatebleParametersEnum parameterType );
 
+//! Function to determine whether the given parameter influences only the observation models, and not the dynamics.
+/*!
+ * Function to determine whether the given parameter influences only the observation models, and not the dynamics, such as
+ * observation biases and ground station positions. A change in such a parameter does not require the equations of motion
+ * and variational equations to be re-integrated.
+ * \param parameterType Parameter identifier.
+ * \return True if parameter influences only the observation models.
+ */
+bool isParameterObservationModelOnlyProperty( const EstimatebleParametersEnum parameterType );
+
 //! Typedef for full parameter identifier.
 typedef std::pair< EstimatebleParametersEnum, std::pair< std::string, std::string > > EstimatebleParameterIdentifier;
 
@@ -247,6 +257,8 @@ public:
         }
 
         totalParameterSetSize_ = estimatedParameterSetSize_;
+
+        parameterModificationCounters_.resize( parameterIndices_.size( ), 0 );
     }
 
     //! Function to return the total number of parameter values (including consider parameters)
@@ -340,31 +352,50 @@ public:
         else
         {
             int currentStartIndex = 0;
+            int currentParameterIndex = 0;
 
+            // Set initial state parameter values, and update modification counters of changed parameters.
             for( unsigned int i = 0; i < estimateInitialStateParameters_.size( ); i++ )
             {
-                estimateInitialStateParameters_[ i ]->setParameterValue(
-                            newParameterValues.segment( currentStartIndex, estimateInitialStateParameters_[ i ]->getParameterSize( ) ).
-                            template cast< InitialStateParameterType >( ) );
+                Eigen::Matrix< InitialStateParameterType, Eigen::Dynamic, 1 > newInitialState =
+                        newParameterValues.segment( currentStartIndex, estimateInitialStateParameters_[ i ]->getParameterSize( ) ).
+                        template cast< InitialStateParameterType >( );
+                if( newInitialState != estimateInitialStateParameters_[ i ]->getParameterValue( ) )
+                {
+                    estimateInitialStateParameters_[ i ]->setParameterValue( newInitialState );
+                    parameterModificationCounters_[ currentParameterIndex ]++;
+                }
                 currentStartIndex += estimateInitialStateParameters_[ i ]->getParameterSize( );
+                currentParameterIndex++;
             }
 
             // Set double parameter values.
             for( unsigned int i = 0; i < estimatedDoubleParameters_.size( ); i++ )
             {
-                estimatedDoubleParameters_[ i ]->setParameterValue( static_cast< double >( newParameterValues( currentStartIndex ) ) );
+                double newDoubleParameter = static_cast< double >( newParameterValues( currentStartIndex ) );
+                if( newDoubleParameter != estimatedDoubleParameters_[ i ]->getParameterValue( ) )
+                {
+                    estimatedDoubleParameters_[ i ]->setParameterValue( newDoubleParameter );
+                    parameterModificationCounters_[ currentParameterIndex ]++;
+                }
                 currentStartIndex++;
+                currentParameterIndex++;
             }
 
             // Set vector parameter values.
-
             for( unsigned int i = 0; i < estimatedVectorParameters_.size( ); i++ )
             {
-                estimatedVectorParameters_[ i ]->setParameterValue(
-                            newParameterValues.segment( currentStartIndex, estimatedVectorParameters_[ i ]->getParameterSize( ) ).
-                            template cast< double >( ) );
+                Eigen::VectorXd newVectorParameter =
+                        newParameterValues.segment( currentStartIndex, estimatedVectorParameters_[ i ]->getParameterSize( ) ).
+                        template cast< double >( );
+                if( newVectorParameter != estimatedVectorParameters_[ i ]->getParameterValue( ) )
+                {
+                    estimatedVectorParameters_[ i ]->setParameterValue( newVectorParameter );
+                    parameterModificationCounters_[ currentParameterIndex ]++;
+                }
 
                 currentStartIndex += estimatedVectorParameters_[ i ]->getParameterSize( );
+                currentParameterIndex++;
             }
         }
     }
@@ -426,6 +457,69 @@ public:
         return parameterIndices_;
     }
 
+    //! Function to retrieve the number of times that each of the parameters has been modified.
+    /*!
+     *  Function to retrieve the number of times that each of the parameters has been modified by resetParameterValues (a
+     *  reset to the current value is not counted). Order of entries is the same as that of parameterIndices_.
+     *  \return Number of times that each of the parameters has been modified.
+     */
+    std::vector< int > getParameterModificationCounters( )
+    {
+        return parameterModificationCounters_;
+    }
+
+    //! Function to retrieve the identifiers of all parameters that have been modified since a given reference.
+    /*!
+     *  Function to retrieve the identifiers of all parameters that have been modified since a given reference, as defined by
+     *  the output of getParameterModificationCounters at the time of the reference.
+     *  \param referenceModificationCounters Parameter modification counters at the reference.
+     *  \return Identifiers of all parameters that have been modified since the reference.
+     */
+    std::vector< EstimatebleParameterIdentifier > getParametersModifiedSince(
+            const std::vector< int >& referenceModificationCounters )
+    {
+        if( referenceModificationCounters.size( ) != parameterModificationCounters_.size( ) )
+        {
+            throw std::runtime_error( "Error when retrieving modified parameters, reference has size " +
+                                      std::to_string( referenceModificationCounters.size( ) ) +
+                                      ", while internal size is " + std::to_string( parameterModificationCounters_.size( ) ) );
+        }
+
+        std::vector< EstimatebleParameterIdentifier > modifiedParameters;
+        int currentParameterIndex = 0;
+        for( unsigned int i = 0; i < estimateInitialStateParameters_.size( ); i++ )
+        {
+            if( parameterModificationCounters_[ currentParameterIndex ] !=
+                    referenceModificationCounters[ currentParameterIndex ] )
+            {
+                modifiedParameters.push_back( estimateInitialStateParameters_[ i ]->getParameterName( ) );
+            }
+            currentParameterIndex++;
+        }
+
+        for( unsigned int i = 0; i < estimatedDoubleParameters_.size( ); i++ )
+        {
+            if( parameterModificationCounters_[ currentParameterIndex ] !=
+                    referenceModificationCounters[ currentParameterIndex ] )
+            {
+                modifiedParameters.push_back( estimatedDoubleParameters_[ i ]->getParameterName( ) );
+            }
+            currentParameterIndex++;
+        }
+
+        for( unsigned int i = 0; i < estimatedVectorParameters_.size( ); i++ )
+        {
+            if( parameterModificationCounters_[ currentParameterIndex ] !=
+                    referenceModificationCounters[ currentParameterIndex ] )
+            {
+                modifiedParameters.push_back( estimatedVectorParameters_[ i ]->getParameterName( ) );
+            }
+            currentParameterIndex++;
+        }
+
+        return modifiedParameters;
+    }
+
 
 protected:
 
@@ -445,6 +539,9 @@ protected:
      */
     std::vector< std::pair< int, int > > parameterIndices_;
 
+    //! Number of times that each of the parameters has been modified, in same order as parameterIndices_.
+    std::vector< int > parameterModificationCounters_;
+
     //! List of double parameters that are to be estimated.
     std::vector< boost::shared_ptr< EstimatableParameter< double > > > estimatedDoubleParameters_;
 
@@ -11,6 +11,7 @@
 #define BOOST_TEST_MAIN
 
 
+#include <algorithm>
 #include <limits>
 
 #include <boost/test/unit_test.hpp>
@@ -78,6 +79,157 @@ BOOST_AUTO_TEST_CASE( test_EstimationFromPosition )
     BOOST_CHECK_EQUAL( executeEarthOrbiterBiasEstimation( true, false, true, true, true ).second, true );
 }
 
+//! Function to retrieve the vehicle state and combined state transition and sensitivity matrix at a number of times
+std::vector< Eigen::MatrixXd > getCurrentPropagationResults(
+        const NamedBodyMap& bodyMap,
+        const OrbitDeterminationManager< double, double >& orbitDeterminationManager,
+        const std::vector< double >& evaluationTimes )
+{
+    std::vector< Eigen::MatrixXd > propagationResults;
+    for( unsigned int i = 0; i < evaluationTimes.size( ); i++ )
+    {
+        Eigen::MatrixXd combinedMatrix = orbitDeterminationManager.getVariationalEquationsSolver( )->
+                getStateTransitionMatrixInterface( )->getFullCombinedStateTransitionAndSensitivityMatrix(
+                    evaluationTimes.at( i ) );
+        Eigen::MatrixXd currentResults = Eigen::MatrixXd::Zero( combinedMatrix.rows( ), combinedMatrix.cols( ) + 1 );
+        currentResults.block( 0, 0, combinedMatrix.rows( ), combinedMatrix.cols( ) ) = combinedMatrix;
+        currentResults.col( combinedMatrix.cols( ) ) =
+                bodyMap.at( "Vehicle" )->getEphemeris( )->getCartesianState( evaluationTimes.at( i ) );
+        propagationResults.push_back( currentResults );
+    }
+    return propagationResults;
+}
+
+//! Function to compute the maximum relative difference between two lists of propagation results
+double getMaximumRelativeDifference( const std::vector< Eigen::MatrixXd >& firstResults,
+                                     const std::vector< Eigen::MatrixXd >& secondResults )
+{
+    double maximumDifference = 0.0;
+    for( unsigned int i = 0; i < firstResults.size( ); i++ )
+    {
+        maximumDifference = std::max(
+                    maximumDifference, ( firstResults.at( i ) - secondResults.at( i ) ).cwiseAbs( ).maxCoeff( ) /
+                    secondResults.at( i ).cwiseAbs( ).maxCoeff( ) );
+    }
+    return maximumDifference;
+}
+
+//! Test whether the dynamics are only re-propagated when required, or when explicitly requested, after resetting the
+//! values of observation bias and ground station position parameters.
+BOOST_AUTO_TEST_CASE( test_ReintegrationForObservationModelParameters )
+{
+    //Load spice kernels.
+    spice_interface::loadStandardSpiceKernels( );
+
+    double initialEphemerisTime = 1.0E7;
+    double finalEphemerisTime = initialEphemerisTime + 86400.0;
+
+    // Create bodies
+    std::vector< std::string > bodyNames;
+    bodyNames.push_back( "Earth" );
+    NamedBodyMap bodyMap = createBodies( getDefaultBodySettings( bodyNames ) );
+    bodyMap[ "Vehicle" ] = boost::make_shared< Body >( );
+    bodyMap[ "Vehicle" ]->setEphemeris( boost::make_shared< TabulatedCartesianEphemeris< > >(
+                                            boost::shared_ptr< interpolators::OneDimensionalInterpolator
+                                            < double, Eigen::Vector6d > >( ), "Earth", "ECLIPJ2000" ) );
+    setGlobalFrameBodyEphemerides( bodyMap, "Earth", "ECLIPJ2000" );
+    createGroundStation( bodyMap.at( "Earth" ), "Station1", ( Eigen::Vector3d( ) << 0.0, 0.35, 0.0 ).finished( ),
+                         geodetic_position );
+
+    // Create acceleration models and propagation settings
+    SelectedAccelerationMap accelerationMap;
+    accelerationMap[ "Vehicle" ][ "Earth" ].push_back( boost::make_shared< AccelerationSettings >( central_gravity ) );
+    std::vector< std::string > bodiesToIntegrate;
+    std::vector< std::string > centralBodies;
+    bodiesToIntegrate.push_back( "Vehicle" );
+    centralBodies.push_back( "Earth" );
+    AccelerationMap accelerationModelMap = createAccelerationModelsMap(
+                bodyMap, accelerationMap, bodiesToIntegrate, centralBodies );
+
+    Eigen::Vector6d initialStateInKeplerianElements;
+    initialStateInKeplerianElements( semiMajorAxisIndex ) = 7200.0E3;
+    initialStateInKeplerianElements( eccentricityIndex ) = 0.05;
+    initialStateInKeplerianElements( inclinationIndex ) = unit_conversions::convertDegreesToRadians( 85.3 );
+    initialStateInKeplerianElements( argumentOfPeriapsisIndex ) = unit_conversions::convertDegreesToRadians( 235.7 );
+    initialStateInKeplerianElements( longitudeOfAscendingNodeIndex ) = unit_conversions::convertDegreesToRadians( 23.4 );
+    initialStateInKeplerianElements( trueAnomalyIndex ) = unit_conversions::convertDegreesToRadians( 139.87 );
+    const double earthGravitationalParameter =
+            bodyMap.at( "Earth" )->getGravityFieldModel( )->getGravitationalParameter( );
+    Eigen::Vector6d systemInitialState = convertKeplerianToCartesianElements(
+                initialStateInKeplerianElements, earthGravitationalParameter );
+
+    boost::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+            boost::make_shared< TranslationalStatePropagatorSettings< double > >
+            ( centralBodies, accelerationModelMap, bodiesToIntegrate, systemInitialState, finalEphemerisTime );
+    boost::shared_ptr< IntegratorSettings< double > > integratorSettings =
+            boost::make_shared< IntegratorSettings< double > >( rungeKutta4, initialEphemerisTime, 60.0 );
+
+    // Define one-way range observable, with estimated bias
+    LinkEnds linkEnds;
+    linkEnds[ transmitter ] = std::make_pair( "Earth", "Station1" );
+    linkEnds[ receiver ] = std::make_pair( "Vehicle", "" );
+    observation_models::ObservationSettingsMap observationSettingsMap;
+    observationSettingsMap.insert(
+                std::make_pair( linkEnds, boost::make_shared< ObservationSettings >(
+                                    one_way_range, boost::shared_ptr< LightTimeCorrectionSettings >( ),
+                                    boost::make_shared< ConstantObservationBiasSettings >( Eigen::Vector1d::Zero( ) ) ) ) );
+
+    // Create parameters: initial state, observation bias and ground station position
+    std::vector< boost::shared_ptr< EstimatableParameterSettings > > parameterNames;
+    parameterNames.push_back(
+                boost::make_shared< InitialTranslationalStateEstimatableParameterSettings< double > >(
+                    "Vehicle", systemInitialState, "Earth" ) );
+    parameterNames.push_back( boost::make_shared< ConstantObservationBiasEstimatableParameterSettings >(
+                                  linkEnds, one_way_range, true ) );
+    parameterNames.push_back( boost::make_shared< EstimatableParameterSettings >(
+                                  "Earth", ground_station_position, "Station1" ) );
+    boost::shared_ptr< EstimatableParameterSet< double > > parametersToEstimate =
+            createParametersToEstimate( parameterNames, bodyMap );
+
+    // Create orbit determination object (propagates dynamics and variational equations).
+    OrbitDeterminationManager< double, double > orbitDeterminationManager =
+            OrbitDeterminationManager< double, double >(
+                bodyMap, parametersToEstimate, observationSettingsMap, integratorSettings, propagatorSettings );
+
+    std::vector< double > evaluationTimes;
+    for( unsigned int i = 1; i < 10; i++ )
+    {
+        evaluationTimes.push_back( initialEphemerisTime + static_cast< double >( i ) * 8000.0 );
+    }
+
+    // Modify bias and ground station position, and retrieve results for these parameter values.
+    Eigen::VectorXd perturbedParameters = parametersToEstimate->getFullParameterValues< double >( );
+    perturbedParameters.segment( 6, perturbedParameters.rows( ) - 6 ) += Eigen::VectorXd::Constant(
+                perturbedParameters.rows( ) - 6, 1.0 );
+    orbitDeterminationManager.resetParameterEstimate( perturbedParameters );
+    std::vector< Eigen::MatrixXd > nominalResults =
+            getCurrentPropagationResults( bodyMap, orbitDeterminationManager, evaluationTimes );
+
+    // Modify environment directly, and check that modifying only bias and station position does not re-propagate the
+    // dynamics (which would change the results due to the modified gravitational parameter).
+    bodyMap.at( "Earth" )->getGravityFieldModel( )->resetGravitationalParameter(
+                earthGravitationalParameter * ( 1.0 + 1.0E-4 ) );
+    perturbedParameters.segment( 6, perturbedParameters.rows( ) - 6 ) += Eigen::VectorXd::Constant(
+                perturbedParameters.rows( ) - 6, 1.0 );
+    orbitDeterminationManager.resetParameterEstimate( perturbedParameters );
+    std::vector< Eigen::MatrixXd > retainedResults =
+            getCurrentPropagationResults( bodyMap, orbitDeterminationManager, evaluationTimes );
+    BOOST_CHECK_EQUAL( getMaximumRelativeDifference( retainedResults, nominalResults ), 0.0 );
+
+    // Check that forced re-integration does re-propagate the dynamics.
+    orbitDeterminationManager.resetParameterEstimate( perturbedParameters, true, true );
+    std::vector< Eigen::MatrixXd > forcedResults =
+            getCurrentPropagationResults( bodyMap, orbitDeterminationManager, evaluationTimes );
+    BOOST_CHECK( getMaximumRelativeDifference( forcedResults, nominalResults ) > 1.0E-6 );
+
+    // Restore environment, and check that retained results are equal to those of a full re-integration.
+    bodyMap.at( "Earth" )->getGravityFieldModel( )->resetGravitationalParameter( earthGravitationalParameter );
+    orbitDeterminationManager.resetParameterEstimate( perturbedParameters, true, true );
+    std::vector< Eigen::MatrixXd > reintegratedResults =
+            getCurrentPropagationResults( bodyMap, orbitDeterminationManager, evaluationTimes );
+    BOOST_CHECK_SMALL( getMaximumRelativeDifference( retainedResults, reintegratedResults ), 1.0E-15 );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }
@@ -244,6 +244,146 @@ BOOST_AUTO_TEST_CASE( test_ParameterPostFitResiduals )
     }
 }
 
+//! Function to create an independent environment and dynamical model for Apollo re-entry, without Earth J2.
+boost::shared_ptr< ParameterInfluenceSimulationSetup< > > createApolloParameterInfluenceSimulationSetup( )
+{
+    const double simulationStartEpoch = 0.0;
+
+    // Create Earth and vehicle objects. Since this setup is used by multiple threads, the Earth rotation is not
+    // retrieved from Spice (which is not thread-safe) during the propagation.
+    std::map< std::string, boost::shared_ptr< BodySettings > > bodySettings =
+            getDefaultBodySettings( { "Earth" } );
+    bodySettings[ "Earth" ]->ephemerisSettings = boost::make_shared< simulation_setup::ConstantEphemerisSettings >(
+                Eigen::Vector6d::Zero( ), "SSB", "J2000" );
+    bodySettings[ "Earth" ]->rotationModelSettings = boost::make_shared< SimpleRotationModelSettings >(
+                "J2000", "IAU_Earth",
+                spice_interface::computeRotationQuaternionBetweenFrames( "J2000", "IAU_Earth", simulationStartEpoch ),
+                simulationStartEpoch, 2.0 * mathematical_constants::PI / physical_constants::JULIAN_DAY );
+    simulation_setup::NamedBodyMap bodyMap = simulation_setup::createBodies( bodySettings );
+
+    bodyMap[ "Apollo" ] = boost::make_shared< simulation_setup::Body >( );
+    bodyMap[ "Apollo" ]->setEphemeris( boost::make_shared< TabulatedCartesianEphemeris< > >(
+                                           boost::shared_ptr< interpolators::OneDimensionalInterpolator
+                                           < double, Eigen::Vector6d > >( ), "Earth", "J2000" ) );
+    bodyMap[ "Apollo" ]->setAerodynamicCoefficientInterface(
+                unit_tests::getApolloCoefficientInterface( ) );
+    bodyMap[ "Apollo" ]->setConstantBodyMass( 5.0E3 );
+    setGlobalFrameBodyEphemerides( bodyMap, "SSB", "J2000" );
+
+    // Create acceleration models
+    SelectedAccelerationMap accelerationMap;
+    accelerationMap[ "Apollo" ][ "Earth" ].push_back( boost::make_shared< SphericalHarmonicAccelerationSettings >( 2, 0 ) );
+    accelerationMap[ "Apollo" ][ "Earth" ].push_back( boost::make_shared< AccelerationSettings >( aerodynamic ) );
+    std::vector< std::string > bodiesToPropagate = { "Apollo" };
+    std::vector< std::string > centralBodies = { "Earth" };
+    basic_astrodynamics::AccelerationMap accelerationModelMap = createAccelerationModelsMap(
+                bodyMap, accelerationMap, bodiesToPropagate, centralBodies );
+
+    double constantAngleOfAttack = 25.0 * mathematical_constants::PI / 180.0;
+    bodyMap.at( "Apollo" )->getFlightConditions( )->getAerodynamicAngleCalculator( )->setOrientationAngleFunctions(
+                boost::lambda::constant( constantAngleOfAttack ) );
+
+    // Set initial state of Apollo.
+    Eigen::Vector6d apolloSphericalEntryState;
+    apolloSphericalEntryState( SphericalOrbitalStateElementIndices::radiusIndex ) =
+            spice_interface::getAverageRadius( "Earth" ) + 120.0E3;
+    apolloSphericalEntryState( SphericalOrbitalStateElementIndices::latitudeIndex ) =
+            25.0 * mathematical_constants::PI / 180.0;
+    apolloSphericalEntryState( SphericalOrbitalStateElementIndices::longitudeIndex )  =
+            25.0 * mathematical_constants::PI / 180.0;
+    apolloSphericalEntryState( SphericalOrbitalStateElementIndices::speedIndex ) = 7.7E3;
+    apolloSphericalEntryState( SphericalOrbitalStateElementIndices::flightPathIndex ) =
+            -1.25 * mathematical_constants::PI / 180.0;
+    apolloSphericalEntryState( SphericalOrbitalStateElementIndices::headingAngleIndex )  =
+            25.0 * mathematical_constants::PI / 180.0;
+    Eigen::Vector6d systemInitialState = transformStateToGlobalFrame(
+                convertSphericalOrbitalToCartesianState( apolloSphericalEntryState ), simulationStartEpoch,
+                bodyMap.at( "Earth" )->getRotationalEphemeris( ) );
+
+    // Create propagation and integration settings.
+    boost::shared_ptr< PropagationTerminationSettings > terminationSettings =
+            boost::make_shared< PropagationDependentVariableTerminationSettings >(
+                boost::make_shared< SingleDependentVariableSaveSettings >(
+                    altitude_dependent_variable, "Apollo", "Earth" ), 25.0E3, true );
+    boost::shared_ptr< PropagatorSettings< double > > propagatorSettings =
+            boost::make_shared< TranslationalStatePropagatorSettings< double > >
+            ( centralBodies, accelerationModelMap, bodiesToPropagate, systemInitialState,
+              terminationSettings, cowell );
+    boost::shared_ptr< IntegratorSettings< > > integratorSettings =
+            boost::make_shared< IntegratorSettings< > >
+            ( rungeKutta4, simulationStartEpoch, 1.0 );
+
+    return boost::make_shared< ParameterInfluenceSimulationSetup< > >( bodyMap, integratorSettings, propagatorSettings );
+}
+
+//! This test checks whether the multi-threaded analysis of a list of perturbations reproduces the single-perturbation results
+BOOST_AUTO_TEST_CASE( test_ParameterPostFitResidualsMultipleThreads )
+{
+    // Load Spice kernels.
+    spice_interface::loadStandardSpiceKernels( );
+
+    // Retrieve Earth J2
+    boost::shared_ptr< ParameterInfluenceSimulationSetup< > > referenceSetup = createApolloParameterInfluenceSimulationSetup( );
+    double earthC20 =
+            boost::dynamic_pointer_cast< gravitation::SphericalHarmonicsGravityField >(
+                referenceSetup->bodyMap_.at( "Earth" )->getGravityFieldModel( ) )->getCosineCoefficients( )( 2, 0 );
+
+    // Define list of perturbations in Earth J2
+    boost::shared_ptr< EstimatableParameterSettings > perturbedParameterSettings =
+            boost::make_shared< SphericalHarmonicEstimatableParameterSettings >(
+                2, 0, 2, 0, "Earth", spherical_harmonics_cosine_coefficient_block );
+    std::vector< double > perturbationScalings = { -1.0, -0.5, 0.5 };
+    std::vector< boost::shared_ptr< ParameterInfluencePerturbationSettings > > perturbationSettingsList;
+    for( unsigned int i = 0; i < perturbationScalings.size( ); i++ )
+    {
+        perturbationSettingsList.push_back(
+                    boost::make_shared< ParameterInfluencePerturbationSettings >(
+                        perturbedParameterSettings, std::vector< double >( { perturbationScalings.at( i ) * earthC20 } ),
+                        std::vector< int >( { 0 } ) ) );
+    }
+
+    // Perform analysis for all perturbations, using two threads
+    std::vector< std::pair< boost::shared_ptr< PodOutput< double > >, Eigen::VectorXd > > parameterInfluences =
+            determinePostfitParameterInfluences< double, double >(
+                &createApolloParameterInfluenceSimulationSetup, perturbationSettingsList, 1.0, 2, 2 );
+    Eigen::MatrixXd parameterInfluenceMatrix = getPostfitParameterInfluenceMatrix( parameterInfluences );
+    BOOST_CHECK_EQUAL( parameterInfluenceMatrix.rows( ), 6 );
+    BOOST_CHECK_EQUAL( parameterInfluenceMatrix.cols( ), 3 );
+
+    // Perform analysis for all perturbations, using a single thread (so that one simulation setup is reused for all
+    // perturbations).
+    std::vector< std::pair< boost::shared_ptr< PodOutput< double > >, Eigen::VectorXd > > singleThreadParameterInfluences =
+            determinePostfitParameterInfluences< double, double >(
+                &createApolloParameterInfluenceSimulationSetup, perturbationSettingsList, 1.0, 2, 1 );
+    Eigen::MatrixXd singleThreadParameterInfluenceMatrix = getPostfitParameterInfluenceMatrix( singleThreadParameterInfluences );
+
+    // Compare against single-perturbation analyses
+    for( unsigned int i = 0; i < perturbationScalings.size( ); i++ )
+    {
+        // Reset initial states, modified by preceding estimation with reference setup
+        referenceSetup->resetNominalInitialStates( );
+
+        std::pair< boost::shared_ptr< PodOutput< double > >, Eigen::VectorXd > estimationOutput =
+                determinePostfitParameterInfluence(
+                    referenceSetup->bodyMap_, referenceSetup->integratorSettings_, referenceSetup->propagatorSettings_,
+                    perturbedParameterSettings, 1.0, std::vector< double >( { perturbationScalings.at( i ) * earthC20 } ),
+                    std::vector< int >( { 0 } ) );
+
+        for( unsigned int j = 0; j < 6; j++ )
+        {
+            BOOST_CHECK_SMALL( std::fabs( parameterInfluenceMatrix( j, i ) - estimationOutput.second( j ) ),
+                               1.0E-6 * estimationOutput.second.segment( 3 * ( j / 3 ), 3 ).norm( ) );
+            BOOST_CHECK_SMALL( std::fabs( singleThreadParameterInfluenceMatrix( j, i ) - estimationOutput.second( j ) ),
+                               1.0E-6 * estimationOutput.second.segment( 3 * ( j / 3 ), 3 ).norm( ) );
+        }
+
+        BOOST_CHECK_CLOSE_FRACTION( parameterInfluences.at( i ).first->residualStandardDeviation_,
+                                    estimationOutput.first->residualStandardDeviation_, 1.0E-6 );
+        BOOST_CHECK_CLOSE_FRACTION( singleThreadParameterInfluences.at( i ).first->residualStandardDeviation_,
+                                    estimationOutput.first->residualStandardDeviation_, 1.0E-6 );
+    }
+}
+
 //! This test checks whether the absorption of the solar J2 in re-entry is done correctly.
 BOOST_AUTO_TEST_CASE( test_ParameterPostFitResidualsApollo )
 {
@@ -12,11 +12,15 @@
 #define TUDAT_DETERMINEPARAMETERPOSTFITINFLUENCE_H
 
 #include <algorithm>
+#include <atomic>
 
+#include <boost/bind.hpp>
+#include <boost/function.hpp>
 #include <boost/make_shared.hpp>
 
 #include "Tudat/Astrodynamics/ObservationModels/simulateObservations.h"
 #include "Tudat/Astrodynamics/OrbitDetermination/orbitDeterminationManager.h"
+#include "Tudat/Basics/parallelLoops.h"
 #include "Tudat/SimulationSetup/EstimationSetup/createEstimatableParameters.h"
 
 namespace tudat
@@ -25,37 +29,98 @@ namespace tudat
 namespace simulation_setup
 {
 
-//! Function that determines how well the translational dynamics of N bodies can absorb  the influence of a change in an
-//! environmental parameter value
+//! Object containing the environment and dynamical model settings used in a post-fit parameter influence analysis
 /*!
- *  Function that determines how well the translational dynamics of N bodies can absorb  the influence of a change in an
- *  environmental parameter value. The methods outlined by e.g. Dirkx et al. (2016); Planetary and Space Science 134:82-95.
- *  This function uses a nominal dynamical model to simulate ideal observations of a set of N bodies' 3-dimensional positions.
- *  These observations are then used as input to an orbit determination routing in which a set of parameters have their values
- *  adjusted w.r.t. the nominal case. In the orbit determination, only the initial states of the N bodies are estimated. As such,
- *  this function provides the degree to which a change (e.g. uncertainty) in the environment can be mimicked by a change in the
- *  bodies initial conditions.
- *  \param bodyMap List of body objects that comprises the environment
- *  \param integratorSettings Settings for numerical integrator.
- *  \param propagatorSettings Settings for propagator.
- *  \param perturbedParameterSettings Type of parameter that is to be adjusted in analysis.
- *  \param simulatedObservationInterval Time interval between consecutive simulated 3-dimensional position observations
- *  \param parameterPerturbations Perturbations in the parameter vector that are to be used
- *  \param parameterIndices Indices in the vector of perturbed parameter at which to apply the perturbations in
- *  parameterPerturbations, e.g. index parameterIndices( i ) of the parameter vector gets perturbation parameterPerturbations( i )
- *  \param numberOfIterations Number of iterations to use in the orbit determination loop
- *  \return Pair of estimation output (first) and adjustment to initial state vectors (second)
+ *  Object containing the environment and dynamical model settings used in a post-fit parameter influence analysis. When
+ *  running multiple analyses concurrently (see determinePostfitParameterInfluences), each concurrent analysis requires its own,
+ *  independent, object (with a body map and acceleration models not shared with any other object). Since an estimation resets
+ *  the initial states in the propagator settings to their post-fit values, the nominal initial states are stored upon creation,
+ *  so that they can be restored before the object is reused for a subsequent analysis (see resetNominalInitialStates).
  */
 template< typename TimeType = double, typename StateScalarType = double >
-std::pair< boost::shared_ptr< PodOutput< StateScalarType > >, Eigen::VectorXd > determinePostfitParameterInfluence(
-        const NamedBodyMap& bodyMap,
-        const boost::shared_ptr< numerical_integrators::IntegratorSettings< TimeType > > integratorSettings,
+class ParameterInfluenceSimulationSetup
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param bodyMap List of body objects that comprises the environment
+     *  \param integratorSettings Settings for numerical integrator.
+     *  \param propagatorSettings Settings for propagator (with acceleration models created from bodyMap).
+     */
+    ParameterInfluenceSimulationSetup(
+            const NamedBodyMap& bodyMap,
+            const boost::shared_ptr< numerical_integrators::IntegratorSettings< TimeType > > integratorSettings,
+            const boost::shared_ptr< propagators::PropagatorSettings< StateScalarType > > propagatorSettings ):
+        bodyMap_( bodyMap ), integratorSettings_( integratorSettings ), propagatorSettings_( propagatorSettings ),
+        nominalInitialStates_( propagatorSettings->getInitialStates( ) ){ }
+
+    //! Function to reset the initial states in the propagator settings to the nominal initial states
+    void resetNominalInitialStates( )
+    {
+        propagatorSettings_->resetInitialStates( nominalInitialStates_ );
+    }
+
+    //! List of body objects that comprises the environment
+    NamedBodyMap bodyMap_;
+
+    //! Settings for numerical integrator.
+    boost::shared_ptr< numerical_integrators::IntegratorSettings< TimeType > > integratorSettings_;
+
+    //! Settings for propagator (with acceleration models created from bodyMap_).
+    boost::shared_ptr< propagators::PropagatorSettings< StateScalarType > > propagatorSettings_;
+
+    //! Nominal initial states of the propagated bodies, as set in propagatorSettings_ upon creation of this object.
+    Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > nominalInitialStates_;
+};
+
+//! Object defining a single parameter perturbation for which the post-fit influence is to be determined
+class ParameterInfluencePerturbationSettings
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param perturbedParameterSettings Type of parameter that is to be adjusted in analysis.
+     *  \param parameterPerturbations Perturbations in the parameter vector that are to be used
+     *  \param parameterIndices Indices in the vector of perturbed parameter at which to apply the perturbations in
+     *  parameterPerturbations
+     */
+    ParameterInfluencePerturbationSettings(
+            const boost::shared_ptr< estimatable_parameters::EstimatableParameterSettings > perturbedParameterSettings,
+            const std::vector< double >& parameterPerturbations,
+            const std::vector< int >& parameterIndices ):
+        perturbedParameterSettings_( perturbedParameterSettings ), parameterPerturbations_( parameterPerturbations ),
+        parameterIndices_( parameterIndices ){ }
+
+    //! Type of parameter that is to be adjusted in analysis.
+    boost::shared_ptr< estimatable_parameters::EstimatableParameterSettings > perturbedParameterSettings_;
+
+    //! Perturbations in the parameter vector that are to be used
+    std::vector< double > parameterPerturbations_;
+
+    //! Indices in the vector of perturbed parameter at which to apply the perturbations in parameterPerturbations_
+    std::vector< int > parameterIndices_;
+};
+
+//! Function to create the observation models and estimated initial states used in a post-fit parameter influence analysis.
+/*!
+ *  Function to create the observation models and estimated initial states used in a post-fit parameter influence analysis:
+ *  for each propagated body, the 3-dimensional position is observed, and the initial state is estimated.
+ *  \param propagatorSettings Settings for propagator (only single-arc translational dynamics supported)
+ *  \param linkEndsList List of link ends for each observed body (returned by reference)
+ *  \param observationSettingsMap Settings for the observation models (returned by reference)
+ *  \param initialStateParameterNames Settings for the initial states that are to be estimated (returned by reference)
+ *  \return List of bodies for which the dynamics is to be fit
+ */
+template< typename StateScalarType = double >
+std::vector< std::string > createParameterInfluenceEstimationSettings(
         const boost::shared_ptr< propagators::PropagatorSettings< StateScalarType > > propagatorSettings,
-        const boost::shared_ptr< estimatable_parameters::EstimatableParameterSettings > perturbedParameterSettings,
-        const double simulatedObservationInterval,
-        const std::vector< double > parameterPerturbations,
-        const std::vector< int > parameterIndices,
-        const int numberOfIterations = 2 )
+        std::vector< observation_models::LinkEnds >& linkEndsList,
+        observation_models::ObservationSettingsMap& observationSettingsMap,
+        std::vector< boost::shared_ptr< estimatable_parameters::EstimatableParameterSettings > >& initialStateParameterNames )
 {
     using namespace observation_models;
     using namespace estimatable_parameters;
@@ -73,9 +138,9 @@ std::pair< boost::shared_ptr< PodOutput< StateScalarType > >, Eigen::VectorXd >
     std::vector< std::string > observedBodies = translationalPropagatorSettings->bodiesToIntegrate_;
 
     // Create list of ideal observation settings and initial states to estimate
-    std::vector< LinkEnds > linkEndsList;
-    ObservationSettingsMap observationSettingsMap;
-    std::vector< boost::shared_ptr< EstimatableParameterSettings > > initialStateParameterNames;
+    linkEndsList.clear( );
+    observationSettingsMap.clear( );
+    initialStateParameterNames.clear( );
     for( unsigned int i = 0; i < observedBodies.size( ); i++ )
     {
         // Add current body to list of observed bodies
@@ -93,18 +158,29 @@ std::pair< boost::shared_ptr< PodOutput< StateScalarType > >, Eigen::VectorXd >
                         translationalPropagatorSettings->centralBodies_.at( i ) ) );
     }
 
-    // Create initial state estimation objects
-    boost::shared_ptr< EstimatableParameterSet< StateScalarType > > initialStateParametersToEstimate =
-            createParametersToEstimate< StateScalarType >( initialStateParameterNames, bodyMap );
-
-    // Create orbit determination object.
-    OrbitDeterminationManager< StateScalarType, TimeType > orbitDeterminationManager =
-            OrbitDeterminationManager< StateScalarType, TimeType >(
-                bodyMap, initialStateParametersToEstimate, observationSettingsMap,
-                integratorSettings, propagatorSettings );
+    return observedBodies;
+}
 
-    // Retrieve nominal (e.g. pre-fit) body states
-    Eigen::VectorXd nominalBodyStates = initialStateParametersToEstimate->template getFullParameterValues< double >( );
+//! Function to simulate the ideal position observations used in a post-fit parameter influence analysis
+/*!
+ *  Function to simulate the ideal position observations used in a post-fit parameter influence analysis, from the current
+ *  (nominal) dynamics of the orbit determination manager.
+ *  \param bodyMap List of body objects that comprises the environment
+ *  \param orbitDeterminationManager Orbit determination manager, with nominal dynamics integrated
+ *  \param observedBodies List of bodies for which the dynamics is to be fit
+ *  \param linkEndsList List of link ends for each observed body
+ *  \param simulatedObservationInterval Time interval between consecutive simulated 3-dimensional position observations
+ *  \return Simulated observations, in format required for estimation input
+ */
+template< typename TimeType = double, typename StateScalarType = double >
+typename OrbitDeterminationManager< StateScalarType, TimeType >::PodInputType simulateParameterInfluenceObservations(
+        const NamedBodyMap& bodyMap,
+        OrbitDeterminationManager< StateScalarType, TimeType >& orbitDeterminationManager,
+        const std::vector< std::string >& observedBodies,
+        const std::vector< observation_models::LinkEnds >& linkEndsList,
+        const double simulatedObservationInterval )
+{
+    using namespace observation_models;
 
     // Get range over which observations are to be simulated.
     std::pair< double, double > dataTimeInterval =
@@ -128,25 +204,25 @@ std::pair< boost::shared_ptr< PodOutput< StateScalarType > >, Eigen::VectorXd >
     }
 
     // Simulate ideal observations
-    typedef Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > ObservationVectorType;
-    typedef std::map< LinkEnds, std::pair< ObservationVectorType, std::pair< std::vector< TimeType >, LinkEndType > > > SingleObservablePodInputType;
-    typedef std::map< ObservableType, SingleObservablePodInputType > PodInputDataType;
-    PodInputDataType observationsAndTimes = simulateObservations< StateScalarType, TimeType >(
+    return simulateObservations< StateScalarType, TimeType >(
                 measurementSimulationInput, orbitDeterminationManager.getObservationSimulators( ) );
-    //input_output::writeMatrixToFile( observationsAndTimes.begin( )->second.begin( )->second.first, "preFitObservations.dat" );
-
-    // Define estimation input
-    boost::shared_ptr< PodInput< StateScalarType, TimeType > > podInput =
-            boost::make_shared< PodInput< StateScalarType, TimeType > >(
-                observationsAndTimes, initialStateParametersToEstimate->getParameterSetSize( ) );
-    podInput->defineEstimationSettings( true, true, false, true, true );
-
-    // Create parameters that are to be perturbed
-    std::vector< boost::shared_ptr< EstimatableParameterSettings > > perturbedParameterSettingsList;
-    perturbedParameterSettingsList.push_back( perturbedParameterSettings );
-    boost::shared_ptr< EstimatableParameterSet< StateScalarType > > perturbedParameters =
-            createParametersToEstimate< StateScalarType >( perturbedParameterSettingsList, bodyMap );
+}
 
+//! Function to perturb the values of a set of parameters
+/*!
+ *  Function to perturb the values of a set of parameters, e.g. index parameterIndices( i ) of the parameter vector gets
+ *  perturbation parameterPerturbations( i ).
+ *  \param perturbedParameters Parameters that are to be perturbed
+ *  \param parameterPerturbations Perturbations in the parameter vector that are to be used
+ *  \param parameterIndices Indices in the parameter vector at which to apply the perturbations in parameterPerturbations
+ *  \return Unperturbed parameter vector
+ */
+template< typename StateScalarType = double >
+Eigen::VectorXd perturbParameterInfluenceParameters(
+        const boost::shared_ptr< estimatable_parameters::EstimatableParameterSet< StateScalarType > > perturbedParameters,
+        const std::vector< double >& parameterPerturbations,
+        const std::vector< int >& parameterIndices )
+{
     // Perturb parameters by required amount
     Eigen::VectorXd parameterVectorToPerturb = perturbedParameters->template getFullParameterValues< double >( );
     Eigen::VectorXd unperturbedParameterVector = parameterVectorToPerturb;
@@ -163,6 +239,86 @@ std::pair< boost::shared_ptr< PodOutput< StateScalarType > >, Eigen::VectorXd >
     }
     perturbedParameters->resetParameterValues( parameterVectorToPerturb );
 
+    return unperturbedParameterVector;
+}
+
+//! Function that determines how well the translational dynamics of N bodies can absorb  the influence of a change in an
+//! environmental parameter value
+/*!
+ *  Function that determines how well the translational dynamics of N bodies can absorb  the influence of a change in an
+ *  environmental parameter value. The methods outlined by e.g. Dirkx et al. (2016); Planetary and Space Science 134:82-95.
+ *  This function uses a nominal dynamical model to simulate ideal observations of a set of N bodies' 3-dimensional positions.
+ *  These observations are then used as input to an orbit determination routing in which a set of parameters have their values
+ *  adjusted w.r.t. the nominal case. In the orbit determination, only the initial states of the N bodies are estimated. As such,
+ *  this function provides the degree to which a change (e.g. uncertainty) in the environment can be mimicked by a change in the
+ *  bodies initial conditions.
+ *  \param bodyMap List of body objects that comprises the environment
+ *  \param integratorSettings Settings for numerical integrator.
+ *  \param propagatorSettings Settings for propagator.
+ *  \param perturbedParameterSettings Type of parameter that is to be adjusted in analysis.
+ *  \param simulatedObservationInterval Time interval between consecutive simulated 3-dimensional position observations
+ *  \param parameterPerturbations Perturbations in the parameter vector that are to be used
+ *  \param parameterIndices Indices in the vector of perturbed parameter at which to apply the perturbations in
+ *  parameterPerturbations, e.g. index parameterIndices( i ) of the parameter vector gets perturbation parameterPerturbations( i )
+ *  \param numberOfIterations Number of iterations to use in the orbit determination loop
+ *  \return Pair of estimation output (first) and adjustment to initial state vectors (second)
+ */
+template< typename TimeType = double, typename StateScalarType = double >
+std::pair< boost::shared_ptr< PodOutput< StateScalarType > >, Eigen::VectorXd > determinePostfitParameterInfluence(
+        const NamedBodyMap& bodyMap,
+        const boost::shared_ptr< numerical_integrators::IntegratorSettings< TimeType > > integratorSettings,
+        const boost::shared_ptr< propagators::PropagatorSettings< StateScalarType > > propagatorSettings,
+        const boost::shared_ptr< estimatable_parameters::EstimatableParameterSettings > perturbedParameterSettings,
+        const double simulatedObservationInterval,
+        const std::vector< double > parameterPerturbations,
+        const std::vector< int > parameterIndices,
+        const int numberOfIterations = 2 )
+{
+    using namespace observation_models;
+    using namespace estimatable_parameters;
+
+    // Create list of ideal observation settings and initial states to estimate
+    std::vector< LinkEnds > linkEndsList;
+    ObservationSettingsMap observationSettingsMap;
+    std::vector< boost::shared_ptr< EstimatableParameterSettings > > initialStateParameterNames;
+    std::vector< std::string > observedBodies = createParameterInfluenceEstimationSettings(
+                propagatorSettings, linkEndsList, observationSettingsMap, initialStateParameterNames );
+
+    // Create initial state estimation objects
+    boost::shared_ptr< EstimatableParameterSet< StateScalarType > > initialStateParametersToEstimate =
+            createParametersToEstimate< StateScalarType >( initialStateParameterNames, bodyMap );
+
+    // Create orbit determination object.
+    OrbitDeterminationManager< StateScalarType, TimeType > orbitDeterminationManager =
+            OrbitDeterminationManager< StateScalarType, TimeType >(
+                bodyMap, initialStateParametersToEstimate, observationSettingsMap,
+                integratorSettings, propagatorSettings );
+
+    // Retrieve nominal (e.g. pre-fit) body states
+    Eigen::VectorXd nominalBodyStates = initialStateParametersToEstimate->template getFullParameterValues< double >( );
+
+    // Simulate ideal observations
+    typedef typename OrbitDeterminationManager< StateScalarType, TimeType >::PodInputType PodInputDataType;
+    PodInputDataType observationsAndTimes = simulateParameterInfluenceObservations< TimeType, StateScalarType >(
+                bodyMap, orbitDeterminationManager, observedBodies, linkEndsList, simulatedObservationInterval );
+    //input_output::writeMatrixToFile( observationsAndTimes.begin( )->second.begin( )->second.first, "preFitObservations.dat" );
+
+    // Define estimation input
+    boost::shared_ptr< PodInput< StateScalarType, TimeType > > podInput =
+            boost::make_shared< PodInput< StateScalarType, TimeType > >(
+                observationsAndTimes, initialStateParametersToEstimate->getParameterSetSize( ) );
+    podInput->defineEstimationSettings( true, true, false, true, true );
+
+    // Create parameters that are to be perturbed
+    std::vector< boost::shared_ptr< EstimatableParameterSettings > > perturbedParameterSettingsList;
+    perturbedParameterSettingsList.push_back( perturbedParameterSettings );
+    boost::shared_ptr< EstimatableParameterSet< StateScalarType > > perturbedParameters =
+            createParametersToEstimate< StateScalarType >( perturbedParameterSettingsList, bodyMap );
+
+    // Perturb parameters by required amount
+    Eigen::VectorXd unperturbedParameterVector = perturbParameterInfluenceParameters(
+                perturbedParameters, parameterPerturbations, parameterIndices );
+
     // Fit nominal dynamics to pertrubed dynamical model
     boost::shared_ptr< PodOutput< StateScalarType > > podOutput = orbitDeterminationManager.estimateParameters(
                 podInput, boost::make_shared< EstimationConvergenceChecker >( numberOfIterations ) );
@@ -177,6 +333,244 @@ std::pair< boost::shared_ptr< PodOutput< StateScalarType > >, Eigen::VectorXd >
 
 }
 
+//! Function that determines the post-fit influence of a parameter perturbation, using pre-computed nominal observations
+/*!
+ *  Function that determines the post-fit influence of a parameter perturbation (see determinePostfitParameterInfluence), using
+ *  pre-computed observations of the nominal dynamics. The parameter is perturbed before the dynamics is first integrated, so
+ *  that no propagation of the nominal dynamics is required. The initial states in the propagator settings are reset to their
+ *  nominal values before the analysis, so that the simulationSetup may be reused for multiple analyses. Upon return, the
+ *  parameter is reset to its nominal value, and the initial states to their nominal values.
+ *  \param simulationSetup Environment and dynamical model settings, not shared with any concurrently running analysis
+ *  \param perturbationSettings Settings for the parameter perturbation
+ *  \param observationsAndTimes Observations of the nominal dynamics, as created by simulateParameterInfluenceObservations
+ *  \param numberOfIterations Number of iterations to use in the orbit determination loop
+ *  \param printOutput Boolean denoting whether to print output to the terminal when running the estimation.
+ *  \return Pair of estimation output (first) and adjustment to initial state vectors (second)
+ */
+template< typename TimeType = double, typename StateScalarType = double >
+std::pair< boost::shared_ptr< PodOutput< StateScalarType > >, Eigen::VectorXd >
+determinePostfitParameterInfluenceFromNominalObservations(
+        const boost::shared_ptr< ParameterInfluenceSimulationSetup< TimeType, StateScalarType > > simulationSetup,
+        const boost::shared_ptr< ParameterInfluencePerturbationSettings > perturbationSettings,
+        const typename OrbitDeterminationManager< StateScalarType, TimeType >::PodInputType& observationsAndTimes,
+        const int numberOfIterations = 2,
+        const bool printOutput = true )
+{
+    using namespace observation_models;
+    using namespace estimatable_parameters;
+
+    // Reset initial states, which are modified by any preceding estimation using this simulation setup
+    simulationSetup->resetNominalInitialStates( );
+
+    // Create list of ideal observation settings and initial states to estimate
+    std::vector< LinkEnds > linkEndsList;
+    ObservationSettingsMap observationSettingsMap;
+    std::vector< boost::shared_ptr< EstimatableParameterSettings > > initialStateParameterNames;
+    createParameterInfluenceEstimationSettings(
+                simulationSetup->propagatorSettings_, linkEndsList, observationSettingsMap, initialStateParameterNames );
+
+    // Create initial state estimation objects, and retrieve nominal body states
+    boost::shared_ptr< EstimatableParameterSet< StateScalarType > > initialStateParametersToEstimate =
+            createParametersToEstimate< StateScalarType >( initialStateParameterNames, simulationSetup->bodyMap_ );
+    Eigen::VectorXd nominalBodyStates = initialStateParametersToEstimate->template getFullParameterValues< double >( );
+
+    // Create and perturb parameters
+    std::vector< boost::shared_ptr< EstimatableParameterSettings > > perturbedParameterSettingsList;
+    perturbedParameterSettingsList.push_back( perturbationSettings->perturbedParameterSettings_ );
+    boost::shared_ptr< EstimatableParameterSet< StateScalarType > > perturbedParameters =
+            createParametersToEstimate< StateScalarType >( perturbedParameterSettingsList, simulationSetup->bodyMap_ );
+    Eigen::VectorXd unperturbedParameterVector = perturbParameterInfluenceParameters(
+                perturbedParameters, perturbationSettings->parameterPerturbations_, perturbationSettings->parameterIndices_ );
+
+    boost::shared_ptr< PodOutput< StateScalarType > > podOutput;
+    try
+    {
+        // Create orbit determination object, integrating perturbed dynamics from nominal initial states.
+        OrbitDeterminationManager< StateScalarType, TimeType > orbitDeterminationManager =
+                OrbitDeterminationManager< StateScalarType, TimeType >(
+                    simulationSetup->bodyMap_, initialStateParametersToEstimate, observationSettingsMap,
+                    simulationSetup->integratorSettings_, simulationSetup->propagatorSettings_ );
+
+        // Fit nominal dynamics to pertrubed dynamical model, using existing propagation on first iteration
+        boost::shared_ptr< PodInput< StateScalarType, TimeType > > podInput =
+                boost::make_shared< PodInput< StateScalarType, TimeType > >(
+                    observationsAndTimes, initialStateParametersToEstimate->getParameterSetSize( ) );
+        podInput->defineEstimationSettings( false, true, false, printOutput, true );
+        podOutput = orbitDeterminationManager.estimateParameters(
+                    podInput, boost::make_shared< EstimationConvergenceChecker >( numberOfIterations ) );
+    }
+    catch( ... )
+    {
+        perturbedParameters->resetParameterValues( unperturbedParameterVector );
+        simulationSetup->resetNominalInitialStates( );
+        throw;
+    }
+
+    // Reset parameter and initial states to nominal values
+    perturbedParameters->resetParameterValues( unperturbedParameterVector );
+    simulationSetup->resetNominalInitialStates( );
+
+    return std::make_pair(
+                podOutput, initialStateParametersToEstimate->template getFullParameterValues< double >( ) - nominalBodyStates );
+}
+
+//! Function that performs post-fit parameter influence analyses from a shared list, until none are left
+/*!
+ *  Function that performs post-fit parameter influence analyses from a shared list, until none are left. The list is shared
+ *  between threads by means of the nextPerturbationIndex counter. If an exception is thrown, the remaining analyses are
+ *  cancelled before the exception is rethrown.
+ *  \param simulationSetups Environment and dynamical model settings, with one entry per thread
+ *  \param perturbationSettingsList List of parameter perturbations for which the influence is to be determined
+ *  \param observationsAndTimes Observations of the nominal dynamics
+ *  \param numberOfIterations Number of iterations to use in the orbit determination loop
+ *  \param printOutput Boolean denoting whether to print output to the terminal when running the estimation.
+ *  \param nextPerturbationIndex Index of next entry of perturbationSettingsList that is to be processed (shared by threads)
+ *  \param parameterInfluences Output of analyses, with entries in order of perturbationSettingsList (modified by this function)
+ *  \param threadIndex Index of the thread that calls this function, i.e. of the entry of simulationSetups that is used
+ */
+template< typename TimeType, typename StateScalarType >
+void processParameterInfluencePerturbations(
+        const std::vector< boost::shared_ptr< ParameterInfluenceSimulationSetup< TimeType, StateScalarType > > >&
+        simulationSetups,
+        const std::vector< boost::shared_ptr< ParameterInfluencePerturbationSettings > >& perturbationSettingsList,
+        const typename OrbitDeterminationManager< StateScalarType, TimeType >::PodInputType& observationsAndTimes,
+        const int numberOfIterations,
+        const bool printOutput,
+        std::atomic< unsigned int >& nextPerturbationIndex,
+        std::vector< std::pair< boost::shared_ptr< PodOutput< StateScalarType > >, Eigen::VectorXd > >& parameterInfluences,
+        const unsigned int threadIndex )
+{
+    try
+    {
+        unsigned int currentPerturbationIndex;
+        while( ( currentPerturbationIndex = nextPerturbationIndex++ ) < perturbationSettingsList.size( ) )
+        {
+            parameterInfluences[ currentPerturbationIndex ] =
+                    determinePostfitParameterInfluenceFromNominalObservations< TimeType, StateScalarType >(
+                        simulationSetups.at( threadIndex ), perturbationSettingsList.at( currentPerturbationIndex ),
+                        observationsAndTimes, numberOfIterations, printOutput );
+        }
+    }
+    catch( ... )
+    {
+        nextPerturbationIndex = perturbationSettingsList.size( );
+        throw;
+    }
+}
+
+//! Function that determines the post-fit influence of a list of parameter perturbations, using multiple threads
+/*!
+ *  Function that determines the post-fit influence of a list of parameter perturbations (see
+ *  determinePostfitParameterInfluence). The nominal dynamics is propagated only once, and the observations simulated from
+ *  it are shared by all perturbation analyses. The analyses for the separate perturbations are distributed over a number of
+ *  threads, each of which uses its own environment and dynamical model settings, as created by simulationSetupFunction.
+ *  Since the Spice library is not thread-safe, only a single thread should be used if the environment retrieves any data from
+ *  Spice during the propagation (data retrieved during the creation of the environment is safe).
+ *  \param simulationSetupFunction Function that creates a new, independent, environment and dynamical model settings. This
+ *  function is called from the calling thread only, once per thread used.
+ *  \param perturbationSettingsList List of parameter perturbations for which the influence is to be determined
+ *  \param simulatedObservationInterval Time interval between consecutive simulated 3-dimensional position observations
+ *  \param numberOfIterations Number of iterations to use in the orbit determination loop
+ *  \param numberOfThreads Number of threads to use (if 0, the number of concurrent threads supported by the hardware is used)
+ *  \return Estimation output (first) and adjustment to initial state vectors (second), for each entry of
+ *  perturbationSettingsList (in the same order).
+ */
+template< typename TimeType = double, typename StateScalarType = double >
+std::vector< std::pair< boost::shared_ptr< PodOutput< StateScalarType > >, Eigen::VectorXd > >
+determinePostfitParameterInfluences(
+        const boost::function< boost::shared_ptr< ParameterInfluenceSimulationSetup< TimeType, StateScalarType > >( ) >
+        simulationSetupFunction,
+        const std::vector< boost::shared_ptr< ParameterInfluencePerturbationSettings > >& perturbationSettingsList,
+        const double simulatedObservationInterval,
+        const int numberOfIterations = 2,
+        const unsigned int numberOfThreads = 0 )
+{
+    using namespace observation_models;
+    using namespace estimatable_parameters;
+
+    typedef std::pair< boost::shared_ptr< PodOutput< StateScalarType > >, Eigen::VectorXd > ParameterInfluenceOutput;
+    typedef typename OrbitDeterminationManager< StateScalarType, TimeType >::PodInputType PodInputDataType;
+
+    std::vector< ParameterInfluenceOutput > parameterInfluences( perturbationSettingsList.size( ) );
+    if( perturbationSettingsList.size( ) == 0 )
+    {
+        return parameterInfluences;
+    }
+
+    // Set number of threads that is to be used
+    const unsigned int numberOfThreadsToUse = utilities::getNumberOfThreadsToUse(
+                numberOfThreads, perturbationSettingsList.size( ) );
+
+    // Propagate nominal dynamics and simulate observations
+    std::vector< boost::shared_ptr< ParameterInfluenceSimulationSetup< TimeType, StateScalarType > > > simulationSetups;
+    simulationSetups.push_back( simulationSetupFunction( ) );
+    PodInputDataType observationsAndTimes;
+    {
+        std::vector< LinkEnds > linkEndsList;
+        ObservationSettingsMap observationSettingsMap;
+        std::vector< boost::shared_ptr< EstimatableParameterSettings > > initialStateParameterNames;
+        std::vector< std::string > observedBodies = createParameterInfluenceEstimationSettings(
+                    simulationSetups.at( 0 )->propagatorSettings_, linkEndsList, observationSettingsMap,
+                    initialStateParameterNames );
+
+        OrbitDeterminationManager< StateScalarType, TimeType > nominalOrbitDeterminationManager =
+                OrbitDeterminationManager< StateScalarType, TimeType >(
+                    simulationSetups.at( 0 )->bodyMap_,
+                    createParametersToEstimate< StateScalarType >(
+                        initialStateParameterNames, simulationSetups.at( 0 )->bodyMap_ ),
+                    observationSettingsMap, simulationSetups.at( 0 )->integratorSettings_,
+                    simulationSetups.at( 0 )->propagatorSettings_ );
+        observationsAndTimes = simulateParameterInfluenceObservations< TimeType, StateScalarType >(
+                    simulationSetups.at( 0 )->bodyMap_, nominalOrbitDeterminationManager, observedBodies, linkEndsList,
+                    simulatedObservationInterval );
+    }
+
+    // Create independent environment for each additional thread
+    for( unsigned int i = 1; i < numberOfThreadsToUse; i++ )
+    {
+        simulationSetups.push_back( simulationSetupFunction( ) );
+    }
+
+    // Run analyses, with perturbations distributed dynamically over the threads.
+    std::atomic< unsigned int > nextPerturbationIndex( 0 );
+    const bool printOutput = ( numberOfThreadsToUse == 1 );
+    utilities::runOnParallelThreads(
+                numberOfThreadsToUse,
+                boost::bind( &processParameterInfluencePerturbations< TimeType, StateScalarType >,
+                             boost::cref( simulationSetups ), boost::cref( perturbationSettingsList ),
+                             boost::cref( observationsAndTimes ), numberOfIterations, printOutput,
+                             boost::ref( nextPerturbationIndex ), boost::ref( parameterInfluences ), _1 ) );
+
+    return parameterInfluences;
+}
+
+//! Function to concatenate the initial state adjustments from a list of post-fit parameter influence analyses
+/*!
+ *  Function to concatenate the initial state adjustments from a list of post-fit parameter influence analyses into a single
+ *  matrix.
+ *  \param parameterInfluences Output of list of post-fit parameter influence analyses (e.g. from
+ *  determinePostfitParameterInfluences)
+ *  \return Matrix with initial state adjustment of parameter influence analysis i as column i.
+ */
+template< typename StateScalarType = double >
+Eigen::MatrixXd getPostfitParameterInfluenceMatrix(
+        const std::vector< std::pair< boost::shared_ptr< PodOutput< StateScalarType > >, Eigen::VectorXd > >&
+        parameterInfluences )
+{
+    if( parameterInfluences.size( ) == 0 )
+    {
+        return Eigen::MatrixXd::Zero( 0, 0 );
+    }
+
+    Eigen::MatrixXd parameterInfluenceMatrix = Eigen::MatrixXd::Zero(
+                parameterInfluences.at( 0 ).second.rows( ), parameterInfluences.size( ) );
+    for( unsigned int i = 0; i < parameterInfluences.size( ); i++ )
+    {
+        parameterInfluenceMatrix.col( i ) = parameterInfluences.at( i ).second;
+    }
+    return parameterInfluenceMatrix;
+}
+
 }
 
 }
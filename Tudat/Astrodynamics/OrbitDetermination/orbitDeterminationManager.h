@@ -332,7 +332,9 @@ public:
     /*!
      *  This function calculates the observation partials matrix and residuals, based on the state transition matrix,
      *  sensitivity matrix and body states resulting from the previous numerical integration iteration.
-     *  Partials and observations are calculated by the observationManagers_.
+     *  Partials and observations are calculated by the observationManagers_. If the only parameters that have been modified
+     *  since the previous call (in the same estimation) are constant additive observation biases, the observation partials are
+     *  unchanged, and only the observations are recomputed.
      *  \param observationsAndTimes Observable values and associated time tags, per observable type and set of link ends.
      *  \param parameterVectorSize Length of the vector of estimated parameters
      *  \param totalObservationSize Total number of observations in observationsAndTimes map.
@@ -343,8 +345,18 @@ public:
             const PodInputType& observationsAndTimes, const int parameterVectorSize, const int totalObservationSize,
             std::pair< Eigen::VectorXd, Eigen::MatrixXd >& residualsAndPartials  )
     {
+        // Check if partials from previous call can be reused.
+        bool reuseObservationPartials = canCachedObservationPartialsBeReused( parameterVectorSize, totalObservationSize );
+
         // Initialize return data.
-        residualsAndPartials.second = Eigen::MatrixXd::Zero( totalObservationSize, parameterVectorSize );
+        if( reuseObservationPartials )
+        {
+            residualsAndPartials.second = cachedObservationPartials_;
+        }
+        else
+        {
+            residualsAndPartials.second = Eigen::MatrixXd::Zero( totalObservationSize, parameterVectorSize );
+        }
         residualsAndPartials.first = Eigen::VectorXd::Zero( totalObservationSize );
 
         // Declare variable denoting current index in vector of all observations.
@@ -362,26 +374,77 @@ public:
                 simulationInputTime.clear( );
                 simulationInputTime = dataIterator->second.second.first;
 
-                // Compute estimated ranges and range partials from current parameter estimate.
-                std::pair< ObservationVectorType, Eigen::MatrixXd > observationsWithPartials;
-                observationsWithPartials = observationManagers_[ observablesIterator->first ]->
-                        computeObservationsWithPartials(
-                            simulationInputTime, dataIterator->first, dataIterator->second.second.second );
+                if( reuseObservationPartials )
+                {
+                    // Compute estimated observations from current parameter estimate, using cached partials.
+                    ObservationVectorType observations = observationManagers_[ observablesIterator->first ]->
+                            computeObservations(
+                                simulationInputTime, dataIterator->first, dataIterator->second.second.second );
+
+                    // Compute residuals for current link ends and observabel type.
+                    residualsAndPartials.first.segment( startIndex, dataIterator->second.first.size( ) ) =
+                            ( dataIterator->second.first - observations ).template cast< double >( );
+                }
+                else
+                {
+                    // Compute estimated ranges and range partials from current parameter estimate.
+                    std::pair< ObservationVectorType, Eigen::MatrixXd > observationsWithPartials;
+                    observationsWithPartials = observationManagers_[ observablesIterator->first ]->
+                            computeObservationsWithPartials(
+                                simulationInputTime, dataIterator->first, dataIterator->second.second.second );
 
-                // Compute residuals for current link ends and observabel type.
-                residualsAndPartials.first.segment( startIndex, dataIterator->second.first.size( ) ) =
-                        ( dataIterator->second.first - observationsWithPartials.first ).template cast< double >( );
+                    // Compute residuals for current link ends and observabel type.
+                    residualsAndPartials.first.segment( startIndex, dataIterator->second.first.size( ) ) =
+                            ( dataIterator->second.first - observationsWithPartials.first ).template cast< double >( );
 
 
-                // Set current observation partials in matrix of all partials
-                residualsAndPartials.second.block( startIndex, 0, dataIterator->second.first.size( ), parameterVectorSize ) =
-                        observationsWithPartials.second;
+                    // Set current observation partials in matrix of all partials
+                    residualsAndPartials.second.block( startIndex, 0, dataIterator->second.first.size( ), parameterVectorSize ) =
+                            observationsWithPartials.second;
+                }
 
                 // Increment current index of observation.
                 startIndex += dataIterator->second.first.size( );
 
             }
         }
+
+        // Store partials for use in next call.
+        if( !reuseObservationPartials )
+        {
+            cachedObservationPartials_ = residualsAndPartials.second;
+        }
+        parameterModificationCountersOfCachedPartials_ = parametersToEstimate_->getParameterModificationCounters( );
+    }
+
+    //! Function to check whether the observation partials of the previous iteration can be reused.
+    /*!
+     *  Function to check whether the observation partials of the previous iteration can be reused. This is the case if all
+     *  parameters that have been modified since then are constant additive observation biases, since the observations are
+     *  linear in these parameters, and they influence neither the dynamics nor the partials w.r.t. other parameters.
+     *  \param parameterVectorSize Length of the vector of estimated parameters
+     *  \param totalObservationSize Total number of observations
+     *  \return True if the cached observation partials can be reused.
+     */
+    bool canCachedObservationPartialsBeReused( const int parameterVectorSize, const int totalObservationSize )
+    {
+        if( ( parameterModificationCountersOfCachedPartials_.size( ) == 0 ) ||
+                ( cachedObservationPartials_.rows( ) != totalObservationSize ) ||
+                ( cachedObservationPartials_.cols( ) != parameterVectorSize ) )
+        {
+            return false;
+        }
+
+        std::vector< estimatable_parameters::EstimatebleParameterIdentifier > modifiedParameters =
+                parametersToEstimate_->getParametersModifiedSince( parameterModificationCountersOfCachedPartials_ );
+        for( unsigned int i = 0; i < modifiedParameters.size( ); i++ )
+        {
+            if( modifiedParameters.at( i ).first != estimatable_parameters::constant_additive_observation_bias )
+            {
+                return false;
+            }
+        }
+        return true;
     }
 
     //! Function to normalize the matrix of partial derivatives so that each column is in the range [-1,1]
@@ -459,6 +522,10 @@ public:
     {
         currentParameterEstimate_ = parametersToEstimate_->template getFullParameterValues< ObservationScalarType >( );
 
+        // Clear observation partials of previous estimation
+        cachedObservationPartials_.resize( 0, 0 );
+        parameterModificationCountersOfCachedPartials_.clear( );
+
         // Get size of parameter vector and number of observations (total and per type)
         int parameterVectorSize = currentParameterEstimate_.size( );
         std::pair< std::map< observation_models::ObservableType, int >, int > observationNumberPair =
@@ -499,10 +566,12 @@ public:
         {
             try
             {
-                // Re-integrate equations of motion and variational equations with new parameter estimate.
+                // Re-integrate equations of motion and variational equations with new parameter estimate (always
+                // re-integrate on first iteration, if requested).
                 if( ( numberOfIterations > 0 ) ||( podInput->getReintegrateEquationsOnFirstIteration( ) ) )
                 {
-                    resetParameterEstimate( newParameterEstimate, podInput->getReintegrateVariationalEquations( ) );
+                    resetParameterEstimate( newParameterEstimate, podInput->getReintegrateVariationalEquations( ),
+                                            ( numberOfIterations == 0 ) );
                 }
 
                 if( podInput->getSaveStateHistoryForEachIteration( ) )
@@ -635,12 +704,16 @@ public:
      *  Function to reset the current parameter estimate; reintegrates the variational equations and equations of motion with new estimate.
      *  \param newParameterEstimate New estimate of parameter vector.
      *  \param reintegrateVariationalEquations Boolean denoting whether the variational equations are to be reintegrated
+     *  \param forceReintegration Boolean denoting whether the equations are to be reintegrated, even if only parameters
+     *  that influence just the observation models have been modified (see VariationalEquationsSolver::resetParameterEstimate)
      */
-    void resetParameterEstimate( const ParameterVectorType& newParameterEstimate, const bool reintegrateVariationalEquations = 1 )
+    void resetParameterEstimate( const ParameterVectorType& newParameterEstimate, const bool reintegrateVariationalEquations = 1,
+                                 const bool forceReintegration = false )
     {
         if( integrateAndEstimateOrbit_ )
         {
-            variationalEquationsSolver_->resetParameterEstimate( newParameterEstimate, reintegrateVariationalEquations );
+            variationalEquationsSolver_->resetParameterEstimate(
+                        newParameterEstimate, reintegrateVariationalEquations, forceReintegration );
         }
         else
         {
@@ -908,6 +981,16 @@ protected:
     //! Current values of the vector of estimated parameters
     ParameterVectorType currentParameterEstimate_;
 
+    //! Observation partials computed by most recent call to calculateObservationMatrixAndResiduals (unnormalized).
+    Eigen::MatrixXd cachedObservationPartials_;
+
+    //! Parameter modification counters at the time of the most recent call to calculateObservationMatrixAndResiduals.
+    /*!
+     *  Parameter modification counters at the time of the most recent call to calculateObservationMatrixAndResiduals, empty
+     *  if no observation partials have been computed in the current estimation.
+     */
+    std::vector< int > parameterModificationCountersOfCachedPartials_;
+
     //std::vector< int > observationLinkParameterIndices_;
 
     //! Object used to interpolate the numerically integrated result of the state transition/sensitivity matrices.
@@ -0,0 +1,247 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <limits>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/make_shared.hpp>
+#include <boost/bind.hpp>
+#include <boost/lambda/lambda.hpp>
+
+#include "Tudat/Astrodynamics/BasicAstrodynamics/massRateModel.h"
+#include "Tudat/Astrodynamics/Ephemerides/constantEphemeris.h"
+#include "Tudat/Astrodynamics/Ephemerides/simpleRotationalEphemeris.h"
+#include "Tudat/Astrodynamics/Gravitation/sphericalHarmonicsGravityField.h"
+#include "Tudat/Mathematics/Statistics/basicStatistics.h"
+#include "Tudat/Mathematics/Statistics/randomSampling.h"
+#include "Tudat/SimulationSetup/EnvironmentSetup/body.h"
+#include "Tudat/SimulationSetup/EnvironmentSetup/createBodies.h"
+#include "Tudat/SimulationSetup/PropagationSetup/createAccelerationModels.h"
+#include "Tudat/SimulationSetup/PropagationSetup/monteCarloPropagation.h"
+#include "Tudat/SimulationSetup/PropagationSetup/propagationSettings.h"
+
+namespace tudat
+{
+
+namespace unit_tests
+{
+
+using namespace tudat::propagators;
+using namespace tudat::simulation_setup;
+using namespace tudat::numerical_integrators;
+
+BOOST_AUTO_TEST_SUITE( test_monte_carlo_propagation )
+
+//! Function to create the environment of the Monte Carlo test.
+NamedBodyMap createMonteCarloTestBodyMap( )
+{
+    NamedBodyMap bodyMap;
+    bodyMap[ "Vehicle" ] = boost::make_shared< Body >( );
+    setGlobalFrameBodyEphemerides( bodyMap, "SSB", "J2000" );
+    return bodyMap;
+}
+
+//! Function to create the propagator settings of a sample, with the mass rate taken from a random sample.
+boost::shared_ptr< SingleArcPropagatorSettings< double > > createMonteCarloTestPropagatorSettings(
+        const NamedBodyMap& bodyMap, const unsigned int sampleIndex, const std::vector< Eigen::VectorXd >& massRates )
+{
+    std::map< std::string, boost::shared_ptr< basic_astrodynamics::MassRateModel > > massRateModels;
+    massRateModels[ "Vehicle" ] = boost::make_shared< basic_astrodynamics::CustomMassRateModel >(
+                boost::lambda::constant( -massRates.at( sampleIndex )( 0 ) ) );
+
+    return boost::make_shared< MassPropagatorSettings< double > >(
+                std::vector< std::string >( { "Vehicle" } ), massRateModels, Eigen::VectorXd::Constant( 1, 500.0 ),
+                boost::make_shared< PropagationTimeTerminationSettings >( 1000.0 ) );
+}
+
+//! Function to create the integrator settings of a sample.
+boost::shared_ptr< IntegratorSettings< > > createMonteCarloTestIntegratorSettings( const unsigned int sampleIndex )
+{
+    return boost::make_shared< IntegratorSettings< > >( rungeKutta4, 0.0, 10.0 );
+}
+
+//! Test Monte Carlo propagation of mass with random mass rates, for which the final mass is known analytically.
+BOOST_AUTO_TEST_CASE( testMonteCarloMassPropagation )
+{
+    // Generate random mass rates.
+    const unsigned int numberOfSamples = 1000;
+    std::vector< Eigen::VectorXd > massRates = statistics::generateGaussianRandomSample(
+                123, numberOfSamples, Eigen::VectorXd::Constant( 1, 0.2 ), Eigen::VectorXd::Constant( 1, 0.01 ) );
+    std::vector< double > expectedFinalMasses;
+    for( unsigned int i = 0; i < numberOfSamples; i++ )
+    {
+        expectedFinalMasses.push_back( 500.0 - 1000.0 * massRates.at( i )( 0 ) );
+    }
+
+    // Run Monte Carlo analysis with single thread, and with multiple threads in two parts.
+    NamedBodyMap bodyMap = createMonteCarloTestBodyMap( );
+    std::vector< double > quantileProbabilities = { 0.5 };
+    MonteCarloPropagation< > singleThreadMonteCarlo(
+                bodyMap, "J2000",
+                boost::bind( &createMonteCarloTestPropagatorSettings, _1, _2, massRates ),
+                &createMonteCarloTestIntegratorSettings,
+                &getFinalPropagatedState< double, double >, quantileProbabilities, 1, 100 );
+    singleThreadMonteCarlo.runSamples( numberOfSamples );
+
+    MonteCarloPropagation< > multiThreadMonteCarlo(
+                bodyMap, "J2000",
+                boost::bind( &createMonteCarloTestPropagatorSettings, _1, _2, massRates ),
+                &createMonteCarloTestIntegratorSettings,
+                &getFinalPropagatedState< double, double >, quantileProbabilities, 4, 64 );
+    multiThreadMonteCarlo.runSamples( 300 );
+    multiThreadMonteCarlo.runSamples( numberOfSamples - 300 );
+    BOOST_CHECK_EQUAL( multiThreadMonteCarlo.getNumberOfSamplesRun( ), numberOfSamples );
+
+    // Compare statistics against statistics of analytical final masses.
+    boost::shared_ptr< statistics::StreamingStatistics > sampleStatistics = singleThreadMonteCarlo.getSampleStatistics( );
+    BOOST_CHECK_EQUAL( sampleStatistics->getNumberOfSamples( ), numberOfSamples );
+    BOOST_CHECK_CLOSE_FRACTION( sampleStatistics->getSampleMean( )( 0 ),
+                                statistics::computeSampleMean( expectedFinalMasses ), 1.0E-12 );
+    BOOST_CHECK_CLOSE_FRACTION( sampleStatistics->getSampleCovariance( )( 0, 0 ),
+                                statistics::computeSampleVariance( expectedFinalMasses ), 1.0E-8 );
+    BOOST_CHECK_SMALL( sampleStatistics->getQuantiles( 0 )( 0 ) -
+                       statistics::computeSampleMedian( expectedFinalMasses ), 1.0 );
+
+    // Check that results are independent of number of threads and batches.
+    BOOST_CHECK_EQUAL( multiThreadMonteCarlo.getSampleStatistics( )->getSampleMean( )( 0 ),
+                       sampleStatistics->getSampleMean( )( 0 ) );
+    BOOST_CHECK_EQUAL( multiThreadMonteCarlo.getSampleStatistics( )->getSampleCovariance( )( 0, 0 ),
+                       sampleStatistics->getSampleCovariance( )( 0, 0 ) );
+    BOOST_CHECK_EQUAL( multiThreadMonteCarlo.getSampleStatistics( )->getQuantiles( 0 )( 0 ),
+                       sampleStatistics->getQuantiles( 0 )( 0 ) );
+
+    // Check that errors in propagation are forwarded.
+    MonteCarloPropagation< > erroneousMonteCarlo(
+                bodyMap, "J2000",
+                boost::bind( &createMonteCarloTestPropagatorSettings, _1, _2, massRates ),
+                &createMonteCarloTestIntegratorSettings,
+                &getFinalPropagatedState< double, double >, quantileProbabilities, 2 );
+    BOOST_CHECK_THROW( erroneousMonteCarlo.runSamples( numberOfSamples + 1 ), std::out_of_range );
+}
+
+//! Function to create the environment of the translational Monte Carlo test (Earth with J2 gravity field, and vehicle).
+NamedBodyMap createMonteCarloTestTranslationalBodyMap( )
+{
+    Eigen::MatrixXd cosineCoefficients = Eigen::MatrixXd::Zero( 3, 3 );
+    cosineCoefficients( 0, 0 ) = 1.0;
+    cosineCoefficients( 2, 0 ) = -4.841651437908150E-4;
+
+    NamedBodyMap bodyMap;
+    bodyMap[ "Earth" ] = boost::make_shared< Body >( );
+    bodyMap[ "Earth" ]->setEphemeris( boost::make_shared< ephemerides::ConstantEphemeris >(
+                                          Eigen::Vector6d( Eigen::Vector6d::Zero( ) ), "SSB", "J2000" ) );
+    bodyMap[ "Earth" ]->setRotationalEphemeris( boost::make_shared< ephemerides::SimpleRotationalEphemeris >(
+                                                    Eigen::Quaterniond( Eigen::Matrix3d::Identity( ) ),
+                                                    7.292115E-5, 0.0, "J2000", "IAU_Earth" ) );
+    bodyMap[ "Earth" ]->setGravityFieldModel( boost::make_shared< gravitation::SphericalHarmonicsGravityField >(
+                                                  3.986004418E14, 6378137.0, cosineCoefficients,
+                                                  Eigen::MatrixXd::Zero( 3, 3 ), "IAU_Earth" ) );
+    bodyMap[ "Vehicle" ] = boost::make_shared< Body >( );
+    setGlobalFrameBodyEphemerides( bodyMap, "SSB", "J2000" );
+    return bodyMap;
+}
+
+//! Function to create the propagator settings of a sample, with the initial state taken from a random sample.
+boost::shared_ptr< SingleArcPropagatorSettings< double > > createMonteCarloTestTranslationalPropagatorSettings(
+        const NamedBodyMap& bodyMap, const unsigned int sampleIndex,
+        const std::vector< Eigen::VectorXd >& initialStates )
+{
+    // Create acceleration models in the environment of the thread that runs the sample.
+    SelectedAccelerationMap accelerationMap;
+    accelerationMap[ "Vehicle" ][ "Earth" ].push_back(
+                boost::make_shared< SphericalHarmonicAccelerationSettings >( 2, 0 ) );
+    std::vector< std::string > bodiesToPropagate = { "Vehicle" };
+    std::vector< std::string > centralBodies = { "Earth" };
+    basic_astrodynamics::AccelerationMap accelerationModelMap = createAccelerationModelsMap(
+                bodyMap, accelerationMap, bodiesToPropagate, centralBodies );
+
+    return boost::make_shared< TranslationalStatePropagatorSettings< double > >(
+                centralBodies, accelerationModelMap, bodiesToPropagate, initialStates.at( sampleIndex ), 3600.0 );
+}
+
+//! Test Monte Carlo propagation of an orbit with random initial states, with single and multiple threads.
+BOOST_AUTO_TEST_CASE( testMonteCarloTranslationalPropagation )
+{
+    // Generate random initial states about a nominal low Earth orbit.
+    const unsigned int numberOfSamples = 100;
+    const double orbitalRadius = 6378137.0 + 500.0E3;
+    const double orbitalVelocity = std::sqrt( 3.986004418E14 / orbitalRadius );
+    Eigen::VectorXd nominalInitialState = ( Eigen::VectorXd( 6 ) << orbitalRadius, 0.0, 0.0, 0.0,
+                                            orbitalVelocity * std::cos( 0.5 ),
+                                            orbitalVelocity * std::sin( 0.5 ) ).finished( );
+    Eigen::VectorXd initialStateStandardDeviation =
+            ( Eigen::VectorXd( 6 ) << 100.0, 100.0, 100.0, 0.1, 0.1, 0.1 ).finished( );
+    std::vector< Eigen::VectorXd > initialStates = statistics::generateGaussianRandomSample(
+                456, numberOfSamples, nominalInitialState, initialStateStandardDeviation );
+
+    // Run Monte Carlo analysis with single thread, and with multiple threads in several batches.
+    NamedBodyMap bodyMap = createMonteCarloTestTranslationalBodyMap( );
+    std::vector< double > quantileProbabilities = { 0.1, 0.5, 0.9 };
+    MonteCarloPropagation< > singleThreadMonteCarlo(
+                bodyMap, "J2000",
+                boost::bind( &createMonteCarloTestTranslationalPropagatorSettings, _1, _2, initialStates ),
+                &createMonteCarloTestIntegratorSettings,
+                &getFinalPropagatedState< double, double >, quantileProbabilities, 1 );
+    singleThreadMonteCarlo.runSamples( numberOfSamples );
+
+    MonteCarloPropagation< > multiThreadMonteCarlo(
+                bodyMap, "J2000",
+                boost::bind( &createMonteCarloTestTranslationalPropagatorSettings, _1, _2, initialStates ),
+                &createMonteCarloTestIntegratorSettings,
+                &getFinalPropagatedState< double, double >, quantileProbabilities, 4, 16 );
+    multiThreadMonteCarlo.runSamples( numberOfSamples );
+    BOOST_CHECK_EQUAL( multiThreadMonteCarlo.getNumberOfSamplesRun( ), numberOfSamples );
+
+    // Check that the template body map has not been used for the propagations.
+    BOOST_CHECK( bodyMap.at( "Vehicle" )->getState( ) == Eigen::Vector6d::Zero( ) );
+
+    // Check that results are independent of number of threads and batches.
+    boost::shared_ptr< statistics::StreamingStatistics > sampleStatistics = singleThreadMonteCarlo.getSampleStatistics( );
+    boost::shared_ptr< statistics::StreamingStatistics > multiThreadSampleStatistics =
+            multiThreadMonteCarlo.getSampleStatistics( );
+    BOOST_CHECK_EQUAL( sampleStatistics->getNumberOfSamples( ), numberOfSamples );
+    BOOST_CHECK_EQUAL( multiThreadSampleStatistics->getNumberOfSamples( ), numberOfSamples );
+    for( unsigned int i = 0; i < 6; i++ )
+    {
+        BOOST_CHECK_EQUAL( multiThreadSampleStatistics->getSampleMean( )( i ),
+                           sampleStatistics->getSampleMean( )( i ) );
+        for( unsigned int j = 0; j < 6; j++ )
+        {
+            BOOST_CHECK_EQUAL( multiThreadSampleStatistics->getSampleCovariance( )( i, j ),
+                               sampleStatistics->getSampleCovariance( )( i, j ) );
+        }
+        for( unsigned int j = 0; j < quantileProbabilities.size( ); j++ )
+        {
+            BOOST_CHECK_EQUAL( multiThreadSampleStatistics->getQuantiles( j )( i ),
+                               sampleStatistics->getQuantiles( j )( i ) );
+        }
+    }
+
+    // Check that mean final position is close to that of the nominal orbit (final position dispersion is of the order
+    // of a few km after one hour, so that the sample mean is expected within a few hundred m of the nominal).
+    MonteCarloPropagation< > nominalMonteCarlo(
+                bodyMap, "J2000",
+                boost::bind( &createMonteCarloTestTranslationalPropagatorSettings, _1, _2,
+                             std::vector< Eigen::VectorXd >( 1, nominalInitialState ) ),
+                &createMonteCarloTestIntegratorSettings );
+    nominalMonteCarlo.runSamples( 1 );
+    Eigen::VectorXd nominalFinalState = nominalMonteCarlo.getSampleStatistics( )->getSampleMean( );
+    BOOST_CHECK_SMALL( ( sampleStatistics->getSampleMean( ).segment( 0, 3 ) -
+                         nominalFinalState.segment( 0, 3 ) ).norm( ), 1.0E3 );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
@@ -0,0 +1,165 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <limits>
+
+#include <boost/test/unit_test.hpp>
+#include <boost/bind.hpp>
+#include <boost/make_shared.hpp>
+
+#include "Tudat/Basics/testMacros.h"
+#include "Tudat/Astrodynamics/Propagators/stateTransitionMatrixInterface.h"
+
+namespace tudat
+{
+
+namespace unit_tests
+{
+
+using namespace tudat::propagators;
+
+BOOST_AUTO_TEST_SUITE( test_state_transition_matrix_interface )
+
+//! Function to compute a (cubic polynomial) dummy combined state transition and sensitivity matrix
+Eigen::MatrixXd getDummyCombinedMatrix( const double time, const int numberOfRows, const int numberOfColumns )
+{
+    Eigen::MatrixXd combinedMatrix = Eigen::MatrixXd::Zero( numberOfRows, numberOfColumns );
+    for( int i = 0; i < numberOfRows; i++ )
+    {
+        for( int j = 0; j < numberOfColumns; j++ )
+        {
+            double scaledTime = time / 1000.0;
+            combinedMatrix( i, j ) = static_cast< double >( i - j ) + 0.1 * ( i + 1 ) * scaledTime -
+                    0.03 * ( j + 1 ) * scaledTime * scaledTime + 0.002 * ( i + j ) * scaledTime * scaledTime * scaledTime;
+        }
+    }
+    return combinedMatrix;
+}
+
+//! Function to create dummy variational equations solution
+std::vector< std::map< double, Eigen::MatrixXd > > getDummyVariationalEquationsSolution(
+        const double startTime, const double endTime, const double timeStep,
+        const int numberOfRows, const int numberOfColumns )
+{
+    std::vector< std::map< double, Eigen::MatrixXd > > variationalEquationsSolution;
+    variationalEquationsSolution.resize( 2 );
+
+    double currentTime = startTime;
+    while( currentTime <= endTime + timeStep / 2.0 )
+    {
+        Eigen::MatrixXd combinedMatrix = getDummyCombinedMatrix( currentTime, numberOfRows, numberOfColumns );
+        variationalEquationsSolution[ 0 ][ currentTime ] = combinedMatrix.block( 0, 0, numberOfRows, numberOfRows );
+        variationalEquationsSolution[ 1 ][ currentTime ] =
+                combinedMatrix.block( 0, numberOfRows, numberOfRows, numberOfColumns - numberOfRows );
+        currentTime += timeStep;
+    }
+    return variationalEquationsSolution;
+}
+
+//! Dummy function to recompute solution between checkpoints, which checks the initial matrix, and counts the calls
+std::vector< std::map< double, Eigen::MatrixXd > > recomputeDummySegment(
+        const double startTime, const Eigen::MatrixXd& initialCombinedMatrix, const double endTime,
+        const std::vector< int >& storedColumns, int& numberOfCalls )
+{
+    Eigen::MatrixXd expectedMatrix = getDummyCombinedMatrix(
+                startTime, initialCombinedMatrix.rows( ), initialCombinedMatrix.cols( ) );
+    for( unsigned int i = 0; i < storedColumns.size( ); i++ )
+    {
+        for( int j = 0; j < initialCombinedMatrix.rows( ); j++ )
+        {
+            BOOST_CHECK_SMALL( initialCombinedMatrix( j, storedColumns.at( i ) ) -
+                               expectedMatrix( j, storedColumns.at( i ) ), 1.0E-12 );
+        }
+    }
+
+    numberOfCalls++;
+    return getDummyVariationalEquationsSolution(
+                startTime, endTime, 10.0, initialCombinedMatrix.rows( ), initialCombinedMatrix.cols( ) );
+}
+
+//! Test interpolation of compressed state transition and sensitivity matrix history
+BOOST_AUTO_TEST_CASE( testCompressedStateTransitionMatrixInterface )
+{
+    int numberOfRows = 6;
+    int numberOfColumns = 9;
+    std::vector< std::map< double, Eigen::MatrixXd > > variationalEquationsSolution =
+            getDummyVariationalEquationsSolution( 0.0, 10000.0, 50.0, numberOfRows, numberOfColumns );
+
+    std::vector< int > columnsToStore;
+    columnsToStore.push_back( 7 );
+    columnsToStore.push_back( 1 );
+    columnsToStore.push_back( 2 );
+
+    // Create interfaces with full and partial storage, and with double and float storage.
+    boost::shared_ptr< CombinedStateTransitionAndSensitivityMatrixInterface > fullDoubleInterface =
+            boost::make_shared< CompressedSingleArcCombinedStateTransitionAndSensitivityMatrixInterface< double > >(
+                variationalEquationsSolution, numberOfRows, numberOfColumns );
+    boost::shared_ptr< CombinedStateTransitionAndSensitivityMatrixInterface > partialDoubleInterface =
+            boost::make_shared< CompressedSingleArcCombinedStateTransitionAndSensitivityMatrixInterface< double > >(
+                variationalEquationsSolution, numberOfRows, numberOfColumns, columnsToStore );
+    boost::shared_ptr< CombinedStateTransitionAndSensitivityMatrixInterface > fullFloatInterface =
+            boost::make_shared< CompressedSingleArcCombinedStateTransitionAndSensitivityMatrixInterface< float > >(
+                variationalEquationsSolution, numberOfRows, numberOfColumns );
+
+    // Create interface storing only every tenth epoch
+    int numberOfSegmentCalls = 0;
+    boost::shared_ptr< CombinedStateTransitionAndSensitivityMatrixInterface > checkpointInterface =
+            boost::make_shared< CompressedSingleArcCombinedStateTransitionAndSensitivityMatrixInterface< double > >(
+                variationalEquationsSolution, numberOfRows, numberOfColumns, columnsToStore, 10,
+                boost::bind( &recomputeDummySegment, _1, _2, _3, columnsToStore, boost::ref( numberOfSegmentCalls ) ) );
+    BOOST_CHECK_EQUAL( boost::dynamic_pointer_cast<
+                       CompressedSingleArcCombinedStateTransitionAndSensitivityMatrixInterface< double > >(
+                           checkpointInterface )->getStoredTimes( ).size( ), 21 );
+
+    for( double testTime = 25.0; testTime < 9999.0; testTime += 123.0 )
+    {
+        Eigen::MatrixXd expectedMatrix = getDummyCombinedMatrix( testTime, numberOfRows, numberOfColumns );
+
+        // Cubic polynomial should be interpolated exactly (to numerical precision) with four-point Lagrange interpolation
+        Eigen::MatrixXd fullDoubleMatrix = fullDoubleInterface->getCombinedStateTransitionAndSensitivityMatrix( testTime );
+        Eigen::MatrixXd partialDoubleMatrix = partialDoubleInterface->getCombinedStateTransitionAndSensitivityMatrix( testTime );
+        Eigen::MatrixXd fullFloatMatrix = fullFloatInterface->getCombinedStateTransitionAndSensitivityMatrix( testTime );
+        Eigen::MatrixXd checkpointMatrix = checkpointInterface->getCombinedStateTransitionAndSensitivityMatrix( testTime );
+
+        BOOST_CHECK_EQUAL( fullDoubleMatrix.rows( ), numberOfRows );
+        BOOST_CHECK_EQUAL( fullDoubleMatrix.cols( ), numberOfColumns );
+        for( int i = 0; i < numberOfRows; i++ )
+        {
+            for( int j = 0; j < numberOfColumns; j++ )
+            {
+                BOOST_CHECK_SMALL( fullDoubleMatrix( i, j ) - expectedMatrix( i, j ), 1.0E-12 );
+                BOOST_CHECK_SMALL( fullFloatMatrix( i, j ) - expectedMatrix( i, j ), 1.0E-5 );
+
+                // Check that only stored columns are non-zero
+                if( std::find( columnsToStore.begin( ), columnsToStore.end( ), j ) != columnsToStore.end( ) )
+                {
+                    BOOST_CHECK_SMALL( partialDoubleMatrix( i, j ) - expectedMatrix( i, j ), 1.0E-12 );
+                    BOOST_CHECK_SMALL( checkpointMatrix( i, j ) - expectedMatrix( i, j ), 1.0E-12 );
+                }
+                else
+                {
+                    BOOST_CHECK_EQUAL( partialDoubleMatrix( i, j ), 0.0 );
+                    BOOST_CHECK_EQUAL( checkpointMatrix( i, j ), 0.0 );
+                }
+            }
+        }
+    }
+
+    // Check that solution between checkpoints is recomputed once per segment
+    BOOST_CHECK_EQUAL( numberOfSegmentCalls, 20 );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
@@ -605,6 +605,335 @@ BOOST_AUTO_TEST_CASE( testEarthOrbiterVariationalEquationCalculation )
 
 }
 
+//! Test the compressed storage of the state transition and sensitivity matrix history, using checkpoints.
+/*!
+ *  Test the compressed storage of the state transition and sensitivity matrix history, using checkpoints. The variational
+ *  equations are propagated for an Earth orbiter, once with full storage of the matrix history and once with storage of
+ *  only every n-th epoch. In the latter case, the matrices between the checkpoints are recomputed on request by
+ *  re-integrating from the checkpoints. The matrices at the integration epochs are compared for both cases, with the
+ *  variational equations integrated both concurrently with, and separately from, the equations of motion.
+ */
+BOOST_AUTO_TEST_CASE( testCompressedStateTransitionMatrixStorage )
+{
+    //Load spice kernels.
+    spice_interface::loadStandardSpiceKernels( );
+
+    // Define bodies in simulation
+    std::vector< std::string > bodyNames;
+    bodyNames.push_back( "Earth" );
+    bodyNames.push_back( "Sun" );
+    bodyNames.push_back( "Moon" );
+
+    // Specify initial and final time
+    double initialEphemerisTime = 1.0E7;
+    double finalEphemerisTime = initialEphemerisTime + 2.0 * 3600.0;
+    double integrationTimeStep = 10.0;
+
+    // Create bodies needed in simulation
+    NamedBodyMap bodyMap = createBodies( getDefaultBodySettings( bodyNames ) );
+    bodyMap[ "Vehicle" ] = boost::make_shared< Body >( );
+    bodyMap[ "Vehicle" ]->setEphemeris( boost::make_shared< TabulatedCartesianEphemeris< > >(
+                                            boost::shared_ptr< interpolators::OneDimensionalInterpolator
+                                            < double, Eigen::Vector6d > >( ), "Earth", "ECLIPJ2000" ) );
+    setGlobalFrameBodyEphemerides( bodyMap, "SSB", "ECLIPJ2000" );
+
+    // Set accelerations on Vehicle that are to be taken into account.
+    SelectedAccelerationMap accelerationMap;
+    std::map< std::string, std::vector< boost::shared_ptr< AccelerationSettings > > > accelerationsOfVehicle;
+    accelerationsOfVehicle[ "Earth" ].push_back( boost::make_shared< SphericalHarmonicAccelerationSettings >( 4, 4 ) );
+    accelerationsOfVehicle[ "Sun" ].push_back( boost::make_shared< AccelerationSettings >(
+                                                   basic_astrodynamics::central_gravity ) );
+    accelerationsOfVehicle[ "Moon" ].push_back( boost::make_shared< AccelerationSettings >(
+                                                    basic_astrodynamics::central_gravity ) );
+    accelerationMap[ "Vehicle" ] = accelerationsOfVehicle;
+
+    // Set bodies for which initial state is to be estimated and integrated.
+    std::vector< std::string > bodiesToIntegrate;
+    std::vector< std::string > centralBodies;
+    bodiesToIntegrate.push_back( "Vehicle" );
+    centralBodies.push_back( "Earth" );
+
+    // Create acceleration models
+    AccelerationMap accelerationModelMap = createAccelerationModelsMap(
+                bodyMap, accelerationMap, bodiesToIntegrate, centralBodies );
+
+    // Set initial state of vehicle.
+    Eigen::Vector6d initialStateInKeplerianElements;
+    initialStateInKeplerianElements( semiMajorAxisIndex ) = 7500.0E3;
+    initialStateInKeplerianElements( eccentricityIndex ) = 0.1;
+    initialStateInKeplerianElements( inclinationIndex ) = unit_conversions::convertDegreesToRadians( 85.3 );
+    initialStateInKeplerianElements( argumentOfPeriapsisIndex ) = unit_conversions::convertDegreesToRadians( 235.7 );
+    initialStateInKeplerianElements( longitudeOfAscendingNodeIndex ) = unit_conversions::convertDegreesToRadians( 23.4 );
+    initialStateInKeplerianElements( trueAnomalyIndex ) = unit_conversions::convertDegreesToRadians( 139.87 );
+    Eigen::Vector6d systemInitialState = convertKeplerianToCartesianElements(
+                initialStateInKeplerianElements,
+                bodyMap.at( "Earth" )->getGravityFieldModel( )->getGravitationalParameter( ) );
+
+    // Create propagator settings
+    boost::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+            boost::make_shared< TranslationalStatePropagatorSettings< double > >
+            ( centralBodies, accelerationModelMap, bodiesToIntegrate, systemInitialState, finalEphemerisTime, cowell );
+
+    // Define and create parameters.
+    std::vector< boost::shared_ptr< EstimatableParameterSettings > > parameterNames;
+    parameterNames.push_back(
+                boost::make_shared< InitialTranslationalStateEstimatableParameterSettings< double > >(
+                    "Vehicle", systemInitialState, "Earth" ) );
+    parameterNames.push_back( boost::make_shared< EstimatableParameterSettings >( "Moon", gravitational_parameter ) );
+    parameterNames.push_back( boost::make_shared< SphericalHarmonicEstimatableParameterSettings >(
+                                  2, 0, 4, 4, "Earth", spherical_harmonics_cosine_coefficient_block ) );
+    boost::shared_ptr< estimatable_parameters::EstimatableParameterSet< double > > parametersToEstimate =
+            createParametersToEstimate( parameterNames, bodyMap );
+
+    // Define compressed storage, with checkpoints at every 10th integration epoch.
+    int checkpointInterval = 10;
+    boost::shared_ptr< StateTransitionMatrixStorageSettings > storageSettings =
+            boost::make_shared< StateTransitionMatrixStorageSettings >(
+                std::vector< int >( ), false, checkpointInterval );
+
+    int numberOfEpochs = static_cast< int >( ( finalEphemerisTime - initialEphemerisTime ) / integrationTimeStep );
+    for( unsigned int integrateConcurrently = 0; integrateConcurrently < 2; integrateConcurrently++ )
+    {
+        boost::shared_ptr< IntegratorSettings< double > > integratorSettings =
+                boost::make_shared< IntegratorSettings< double > >(
+                    rungeKutta4, initialEphemerisTime, integrationTimeStep );
+
+        // Propagate variational equations with full storage of matrix history, and retrieve matrices at all epochs.
+        std::vector< Eigen::MatrixXd > fullStorageMatrices;
+        {
+            SingleArcVariationalEquationsSolver< double, double > fullStorageSolver(
+                        bodyMap, integratorSettings, propagatorSettings, parametersToEstimate,
+                        integrateConcurrently, integratorSettings );
+            for( int i = 0; i < numberOfEpochs; i++ )
+            {
+                fullStorageMatrices.push_back(
+                            fullStorageSolver.getStateTransitionMatrixInterface( )->
+                            getCombinedStateTransitionAndSensitivityMatrix(
+                                initialEphemerisTime + static_cast< double >( i ) * integrationTimeStep ) );
+            }
+        }
+
+        // Propagate variational equations with compressed storage of matrix history
+        SingleArcVariationalEquationsSolver< double, double > compressedStorageSolver(
+                    bodyMap, integratorSettings, propagatorSettings, parametersToEstimate,
+                    integrateConcurrently, integratorSettings, true, true, storageSettings );
+        boost::shared_ptr< CompressedSingleArcCombinedStateTransitionAndSensitivityMatrixInterface< double > >
+                compressedInterface = boost::dynamic_pointer_cast<
+                CompressedSingleArcCombinedStateTransitionAndSensitivityMatrixInterface< double > >(
+                    compressedStorageSolver.getStateTransitionMatrixInterface( ) );
+        BOOST_CHECK_EQUAL( ( compressedInterface == NULL ), false );
+
+        // Check that only checkpoints are stored
+        BOOST_CHECK_EQUAL( compressedInterface->getStoredTimes( ).size( ),
+                           static_cast< unsigned int >( numberOfEpochs / checkpointInterval + 1 ) );
+
+        // Compare matrices (recomputed between checkpoints) with full storage, in forward and backward order (initial
+        // epoch omitted, as sensitivity matrix is zero there).
+        for( int j = 0; j < 2 * ( numberOfEpochs - 1 ); j++ )
+        {
+            int i = ( j < numberOfEpochs - 1 ) ? ( j + 1 ) : ( 2 * ( numberOfEpochs - 1 ) - j );
+            Eigen::MatrixXd compressedStorageMatrix = compressedInterface->getCombinedStateTransitionAndSensitivityMatrix(
+                        initialEphemerisTime + static_cast< double >( i ) * integrationTimeStep );
+            for( int k = 0; k < compressedStorageMatrix.cols( ); k++ )
+            {
+                BOOST_CHECK_SMALL( ( compressedStorageMatrix.col( k ) - fullStorageMatrices.at( i ).col( k ) ).norm( ) /
+                                   fullStorageMatrices.at( i ).col( k ).norm( ), 1.0E-12 );
+            }
+        }
+
+        // Check that integrator settings are not modified by recomputation between checkpoints.
+        BOOST_CHECK_EQUAL( integratorSettings->initialTime_, initialEphemerisTime );
+    }
+}
+
+//! Test the skipping of structurally zero blocks in the product of the variational matrix and state transition matrix.
+/*!
+ *  Test the skipping of structurally zero blocks in the product of the partial derivatives of the state derivatives
+ *  w.r.t. the current states (variational matrix) and the state transition and sensitivity matrix. The Earth, Moon and
+ *  two vehicles, which do not exert accelerations on each other, are propagated. It is checked that the blocks that are
+ *  multiplied contain all non-zero entries of the variational matrix, but not the blocks coupling the two vehicles, and
+ *  that the block-wise product is equal to the full matrix product.
+ */
+BOOST_AUTO_TEST_CASE( testVariationalMatrixSparsity )
+{
+    //Load spice kernels.
+    spice_interface::loadStandardSpiceKernels( );
+
+    // Define bodies in simulation
+    std::vector< std::string > bodyNames;
+    bodyNames.push_back( "Earth" );
+    bodyNames.push_back( "Sun" );
+    bodyNames.push_back( "Moon" );
+
+    // Specify initial and final time
+    double initialEphemerisTime = 1.0E7;
+    double finalEphemerisTime = initialEphemerisTime + 3600.0;
+
+    // Create bodies needed in simulation
+    NamedBodyMap bodyMap = createBodies( getDefaultBodySettings( bodyNames ) );
+    std::vector< std::string > vehicleNames;
+    vehicleNames.push_back( "Vehicle1" );
+    vehicleNames.push_back( "Vehicle2" );
+    for( unsigned int i = 0; i < vehicleNames.size( ); i++ )
+    {
+        bodyMap[ vehicleNames.at( i ) ] = boost::make_shared< Body >( );
+        bodyMap[ vehicleNames.at( i ) ]->setEphemeris( boost::make_shared< TabulatedCartesianEphemeris< > >(
+                                                           boost::shared_ptr< interpolators::OneDimensionalInterpolator
+                                                           < double, Eigen::Vector6d > >( ), "Earth", "ECLIPJ2000" ) );
+    }
+    setGlobalFrameBodyEphemerides( bodyMap, "SSB", "ECLIPJ2000" );
+
+    // Set accelerations, with no acceleration between the two vehicles.
+    SelectedAccelerationMap accelerationMap;
+    accelerationMap[ "Earth" ][ "Sun" ].push_back( boost::make_shared< AccelerationSettings >( central_gravity ) );
+    accelerationMap[ "Earth" ][ "Moon" ].push_back( boost::make_shared< AccelerationSettings >( central_gravity ) );
+    accelerationMap[ "Moon" ][ "Earth" ].push_back( boost::make_shared< AccelerationSettings >( central_gravity ) );
+    accelerationMap[ "Moon" ][ "Sun" ].push_back( boost::make_shared< AccelerationSettings >( central_gravity ) );
+    accelerationMap[ "Vehicle1" ][ "Earth" ].push_back( boost::make_shared< AccelerationSettings >( central_gravity ) );
+    accelerationMap[ "Vehicle1" ][ "Moon" ].push_back( boost::make_shared< AccelerationSettings >( central_gravity ) );
+    accelerationMap[ "Vehicle2" ][ "Earth" ].push_back( boost::make_shared< AccelerationSettings >( central_gravity ) );
+    accelerationMap[ "Vehicle2" ][ "Sun" ].push_back( boost::make_shared< AccelerationSettings >( central_gravity ) );
+
+    // Set bodies for which initial state is to be estimated and integrated.
+    std::vector< std::string > bodiesToIntegrate;
+    std::vector< std::string > centralBodies;
+    bodiesToIntegrate.push_back( "Earth" );
+    centralBodies.push_back( "Sun" );
+    bodiesToIntegrate.push_back( "Moon" );
+    centralBodies.push_back( "Earth" );
+    bodiesToIntegrate.push_back( "Vehicle1" );
+    centralBodies.push_back( "Earth" );
+    bodiesToIntegrate.push_back( "Vehicle2" );
+    centralBodies.push_back( "Earth" );
+
+    // Create acceleration models
+    AccelerationMap accelerationModelMap = createAccelerationModelsMap(
+                bodyMap, accelerationMap, bodiesToIntegrate, centralBodies );
+
+    // Set initial states of Earth and Moon from ephemerides, and of vehicles from Keplerian elements.
+    double earthGravitationalParameter = bodyMap.at( "Earth" )->getGravityFieldModel( )->getGravitationalParameter( );
+    Eigen::VectorXd systemInitialState = Eigen::VectorXd::Zero( 24 );
+    systemInitialState.segment( 0, 12 ) = getInitialStatesOfBodies(
+                std::vector< std::string >( bodiesToIntegrate.begin( ), bodiesToIntegrate.begin( ) + 2 ),
+                std::vector< std::string >( centralBodies.begin( ), centralBodies.begin( ) + 2 ),
+                bodyMap, initialEphemerisTime );
+
+    Eigen::Vector6d vehicleInitialStateInKeplerianElements;
+    vehicleInitialStateInKeplerianElements( semiMajorAxisIndex ) = 7500.0E3;
+    vehicleInitialStateInKeplerianElements( eccentricityIndex ) = 0.1;
+    vehicleInitialStateInKeplerianElements( inclinationIndex ) = unit_conversions::convertDegreesToRadians( 85.3 );
+    vehicleInitialStateInKeplerianElements( argumentOfPeriapsisIndex ) = unit_conversions::convertDegreesToRadians( 235.7 );
+    vehicleInitialStateInKeplerianElements( longitudeOfAscendingNodeIndex ) = unit_conversions::convertDegreesToRadians( 23.4 );
+    vehicleInitialStateInKeplerianElements( trueAnomalyIndex ) = unit_conversions::convertDegreesToRadians( 139.87 );
+    systemInitialState.segment( 12, 6 ) = convertKeplerianToCartesianElements(
+                vehicleInitialStateInKeplerianElements, earthGravitationalParameter );
+
+    vehicleInitialStateInKeplerianElements( semiMajorAxisIndex ) = 8000.0E3;
+    vehicleInitialStateInKeplerianElements( inclinationIndex ) = unit_conversions::convertDegreesToRadians( 23.4 );
+    vehicleInitialStateInKeplerianElements( trueAnomalyIndex ) = unit_conversions::convertDegreesToRadians( 12.5 );
+    systemInitialState.segment( 18, 6 ) = convertKeplerianToCartesianElements(
+                vehicleInitialStateInKeplerianElements, earthGravitationalParameter );
+
+    // Create propagator and integrator settings
+    boost::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+            boost::make_shared< TranslationalStatePropagatorSettings< double > >
+            ( centralBodies, accelerationModelMap, bodiesToIntegrate, systemInitialState, finalEphemerisTime, cowell );
+    boost::shared_ptr< IntegratorSettings< double > > integratorSettings =
+            boost::make_shared< IntegratorSettings< double > >( rungeKutta4, initialEphemerisTime, 60.0 );
+
+    // Define and create parameters.
+    std::vector< boost::shared_ptr< EstimatableParameterSettings > > parameterNames;
+    for( unsigned int i = 0; i < bodiesToIntegrate.size( ); i++ )
+    {
+        parameterNames.push_back(
+                    boost::make_shared< InitialTranslationalStateEstimatableParameterSettings< double > >(
+                        bodiesToIntegrate.at( i ), systemInitialState.segment( 6 * i, 6 ), centralBodies.at( i ) ) );
+    }
+    parameterNames.push_back( boost::make_shared< EstimatableParameterSettings >( "Earth", gravitational_parameter ) );
+    boost::shared_ptr< estimatable_parameters::EstimatableParameterSet< double > > parametersToEstimate =
+            createParametersToEstimate( parameterNames, bodyMap );
+
+    // Propagate dynamics, and create variational equations.
+    SingleArcDynamicsSimulator< double, double > dynamicsSimulator(
+                bodyMap, integratorSettings, propagatorSettings, true, false );
+    boost::shared_ptr< DynamicsStateDerivativeModel< double, double > > dynamicsStateDerivative =
+            dynamicsSimulator.getDynamicsStateDerivative( );
+    boost::shared_ptr< VariationalEquations > variationalEquations = boost::make_shared< VariationalEquations >(
+                createStateDerivativePartials< double, double >(
+                    dynamicsStateDerivative->getStateDerivativeModels( ), bodyMap, parametersToEstimate ),
+                parametersToEstimate, dynamicsStateDerivative->getStateTypeStartIndices( ) );
+
+    // Check that rows of each body are a single block, and that vehicle-vehicle blocks are not multiplied
+    std::vector< std::pair< std::pair< int, int >, std::vector< std::pair< int, int > > > > sparsityPattern =
+            variationalEquations->getVariationalMatrixSparsityPattern( );
+    BOOST_CHECK_EQUAL( sparsityPattern.size( ), 4 );
+    for( unsigned int i = 0; i < sparsityPattern.size( ); i++ )
+    {
+        BOOST_CHECK_EQUAL( sparsityPattern.at( i ).first.first, 6 * i );
+        BOOST_CHECK_EQUAL( sparsityPattern.at( i ).first.second, 6 );
+
+        if( i >= 2 )
+        {
+            int otherVehicleStartColumn = ( i == 2 ) ? 18 : 12;
+            for( unsigned int j = 0; j < sparsityPattern.at( i ).second.size( ); j++ )
+            {
+                BOOST_CHECK( ( sparsityPattern.at( i ).second.at( j ).first + sparsityPattern.at( i ).second.at( j ).second
+                               <= otherVehicleStartColumn ) ||
+                             ( sparsityPattern.at( i ).second.at( j ).first >= otherVehicleStartColumn + 6 ) );
+            }
+        }
+    }
+
+    // Update environment and partials to epoch halfway through propagation
+    double testTime = initialEphemerisTime + 1800.0;
+    Eigen::MatrixXd currentState = dynamicsSimulator.getEquationsOfMotionNumericalSolution( ).at( testTime );
+    dynamicsStateDerivative->computeStateDerivative( testTime, currentState );
+    variationalEquations->clearPartials( );
+    variationalEquations->updatePartials( testTime );
+
+    // Compute block-wise product (with non-zero initial output, to check that all entries are set).
+    int numberOfParameters = static_cast< int >( variationalEquations->getNumberOfParameterValues( ) );
+    Eigen::MatrixXd stateTransitionAndSensitivityMatrices = Eigen::MatrixXd::Random( 24, numberOfParameters );
+    Eigen::MatrixXd matrixDerivative = Eigen::MatrixXd::Constant( 24, numberOfParameters, 1.0 );
+    variationalEquations->getBodyInitialStatePartialMatrix< double >(
+                stateTransitionAndSensitivityMatrices, matrixDerivative.block( 0, 0, 24, numberOfParameters ) );
+    Eigen::MatrixXd variationalMatrix = variationalEquations->getVariationalMatrix( );
+
+    // Check that all non-zero entries of variational matrix are in blocks that are multiplied
+    for( unsigned int i = 0; i < sparsityPattern.size( ); i++ )
+    {
+        for( int row = sparsityPattern.at( i ).first.first;
+             row < sparsityPattern.at( i ).first.first + sparsityPattern.at( i ).first.second; row++ )
+        {
+            for( int col = 0; col < variationalMatrix.cols( ); col++ )
+            {
+                if( variationalMatrix( row, col ) != 0.0 )
+                {
+                    bool isEntryInPattern = false;
+                    for( unsigned int j = 0; j < sparsityPattern.at( i ).second.size( ); j++ )
+                    {
+                        if( col >= sparsityPattern.at( i ).second.at( j ).first &&
+                                col < sparsityPattern.at( i ).second.at( j ).first +
+                                sparsityPattern.at( i ).second.at( j ).second )
+                        {
+                            isEntryInPattern = true;
+                        }
+                    }
+                    BOOST_CHECK_EQUAL( isEntryInPattern, true );
+                }
+            }
+        }
+    }
+
+    // Compare block-wise product with full product
+    Eigen::MatrixXd expectedMatrixDerivative = variationalMatrix * stateTransitionAndSensitivityMatrices;
+    for( int i = 0; i < 24; i++ )
+    {
+        BOOST_CHECK_SMALL( ( matrixDerivative.row( i ) - expectedMatrixDerivative.row( i ) ).norm( ) /
+                           expectedMatrixDerivative.row( i ).norm( ), 1.0E-12 );
+    }
+}
+
 
 BOOST_AUTO_TEST_SUITE_END( )
 
@@ -18,6 +18,12 @@ namespace tudat
 namespace propagators
 {
 
+//! Function to determine whether an epoch of the numerical solution is stored as a checkpoint in compressed storage.
+bool isMatrixHistoryCheckpointEpoch( const int epochIndex, const int numberOfEpochs, const int checkpointInterval )
+{
+    return ( epochIndex % checkpointInterval == 0 ) || ( epochIndex == numberOfEpochs - 1 );
+}
+
 //! Function to reset the state transition and sensitivity matrix interpolators
 void SingleArcCombinedStateTransitionAndSensitivityMatrixInterface::updateMatrixInterpolators(
         const boost::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::MatrixXd > >
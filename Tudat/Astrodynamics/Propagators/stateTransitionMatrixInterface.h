@@ -11,8 +11,12 @@
 #ifndef TUDAT_STATETRANSITIONMATRIXINTERFACE_H
 #define TUDAT_STATETRANSITIONMATRIXINTERFACE_H
 
+#include <algorithm>
+#include <map>
 #include <vector>
 
+#include <boost/function.hpp>
+#include <boost/make_shared.hpp>
 #include <boost/shared_ptr.hpp>
 
 #include <Eigen/Core>
@@ -221,6 +225,454 @@ private:
     sensitivityMatrixInterpolator_;
 };
 
+//! Class defining settings for the (compressed) storage of the single-arc state transition and sensitivity matrix history
+/*!
+ *  Class defining settings for the (compressed) storage of the single-arc state transition and sensitivity matrix history.
+ *  By default, the full matrices are stored at each epoch and interpolated with Lagrange interpolators. With these settings,
+ *  the CompressedSingleArcCombinedStateTransitionAndSensitivityMatrixInterface is used instead, which stores only the
+ *  requested columns of the combined matrix, in a single contiguous block of float or double values. Optionally, only
+ *  every n-th epoch is stored (checkpoint), with the values in between recomputed on demand by re-integrating the
+ *  variational equations from the checkpoints.
+ */
+class StateTransitionMatrixStorageSettings
+{
+public:
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param columnsToStore Indices of the columns of the combined state transition and sensitivity matrix that are to be
+     * stored (all columns if empty). Columns that are not stored are returned as zero by the interface.
+     * \param useSinglePrecision Boolean denoting whether the matrix history is to be stored in single precision (float),
+     * instead of double precision.
+     * \param checkpointInterval Number of integration epochs between subsequent stored epochs. If larger than one,
+     * the matrices at the intermediate epochs are recomputed on demand by re-integrating from the stored epochs.
+     * \param interpolationOrder Number of points used in the Lagrange interpolation of the stored matrix history.
+     */
+    StateTransitionMatrixStorageSettings(
+            const std::vector< int >& columnsToStore = std::vector< int >( ),
+            const bool useSinglePrecision = false,
+            const int checkpointInterval = 1,
+            const int interpolationOrder = 4 ):
+        columnsToStore_( columnsToStore ), useSinglePrecision_( useSinglePrecision ),
+        checkpointInterval_( checkpointInterval ), interpolationOrder_( interpolationOrder ){ }
+
+    //! Destructor
+    virtual ~StateTransitionMatrixStorageSettings( ){ }
+
+    //! Indices of the columns of the combined matrix that are to be stored (all columns if empty).
+    std::vector< int > columnsToStore_;
+
+    //! Boolean denoting whether the matrix history is to be stored in single precision.
+    bool useSinglePrecision_;
+
+    //! Number of integration epochs between subsequent stored epochs.
+    int checkpointInterval_;
+
+    //! Number of points used in the Lagrange interpolation of the stored matrix history.
+    int interpolationOrder_;
+};
+
+//! Function to determine whether an epoch of the numerical solution is stored as a checkpoint in compressed storage.
+/*!
+ *  Function to determine whether an epoch of the numerical solution is stored as a checkpoint in the compressed storage
+ *  of the state transition and sensitivity matrix history. Every checkpointInterval-th epoch is stored, as well as the
+ *  final epoch.
+ *  \param epochIndex Index of the epoch in the (time-ordered) numerical solution.
+ *  \param numberOfEpochs Total number of epochs in the numerical solution.
+ *  \param checkpointInterval Number of integration epochs between subsequent stored epochs.
+ *  \return True if the epoch is a checkpoint, false otherwise.
+ */
+bool isMatrixHistoryCheckpointEpoch( const int epochIndex, const int numberOfEpochs, const int checkpointInterval );
+
+//! Interface object for single-arc state transition and sensitivity matrices, using compressed storage of their history.
+/*!
+ *  Interface object for single-arc state transition and sensitivity matrices, using compressed storage of their history.
+ *  Only the requested columns of the combined matrix are stored, with the data at all epochs stored in a single
+ *  contiguous matrix (one column per epoch) of the StorageScalarType (float or double). The matrices are
+ *  interpolated using Lagrange interpolation. If the checkpoint interval is larger than one, only every n-th epoch
+ *  of the numerical solution is stored. The solution between two checkpoints is then recomputed from a user-provided
+ *  function (typically re-integrating the variational equations) the first time it is requested, and retained until a
+ *  time in a different interval between checkpoints is requested.
+ */
+template< typename StorageScalarType = double >
+class CompressedSingleArcCombinedStateTransitionAndSensitivityMatrixInterface:
+        public CombinedStateTransitionAndSensitivityMatrixInterface
+{
+public:
+
+    //! Typedef for function recomputing the variational equations solution between two checkpoints.
+    /*!
+     *  Typedef for function recomputing the variational equations solution between two checkpoints. Input arguments are
+     *  the time of the first checkpoint, the combined state transition and sensitivity matrix at this time, and the time
+     *  of the second checkpoint. Output is the vector of state transition and sensitivity matrix histories (as used by
+     *  the constructor).
+     */
+    typedef boost::function< std::vector< std::map< double, Eigen::MatrixXd > >(
+            const double, const Eigen::MatrixXd&, const double ) > SegmentIntegrationFunction;
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param variationalEquationsSolution Vector of two matrix histories. First vector entry is state transition matrix
+     * history, second entry is sensitivity matrix history.
+     * \param numberOfInitialDynamicalParameters Size of the estimated initial state vector (and size of square
+     * state transition matrix.
+     * \param numberOfParameters Total number of estimated parameters (initial states and other parameters).
+     * \param columnsToStore Indices of the columns of the combined matrix that are to be stored (all columns if empty).
+     * \param checkpointInterval Number of epochs of the input history between subsequent stored epochs.
+     * \param segmentIntegrationFunction Function recomputing the solution between two checkpoints (required if
+     * checkpointInterval is larger than one).
+     * \param interpolationOrder Number of points used in the Lagrange interpolation of the stored matrix history.
+     * \param integrateSegmentsForwards Boolean denoting whether the solution between checkpoints is to be recomputed
+     * starting at the earlier checkpoint (if true) or at the later checkpoint (if false, for backwards propagation).
+     */
+    CompressedSingleArcCombinedStateTransitionAndSensitivityMatrixInterface(
+            const std::vector< std::map< double, Eigen::MatrixXd > >& variationalEquationsSolution,
+            const int numberOfInitialDynamicalParameters,
+            const int numberOfParameters,
+            const std::vector< int >& columnsToStore = std::vector< int >( ),
+            const int checkpointInterval = 1,
+            const SegmentIntegrationFunction segmentIntegrationFunction = SegmentIntegrationFunction( ),
+            const int interpolationOrder = 4,
+            const bool integrateSegmentsForwards = true ):
+        CombinedStateTransitionAndSensitivityMatrixInterface( numberOfInitialDynamicalParameters, numberOfParameters ),
+        checkpointInterval_( checkpointInterval ),
+        segmentIntegrationFunction_( segmentIntegrationFunction ),
+        interpolationOrder_( interpolationOrder )
+    {
+        if( checkpointInterval_ < 1 )
+        {
+            throw std::runtime_error( "Error when making compressed state transition matrix interface, checkpoint interval must be positive." );
+        }
+
+        if( checkpointInterval_ > 1 && segmentIntegrationFunction_.empty( ) )
+        {
+            throw std::runtime_error( "Error when making compressed state transition matrix interface, no function provided to recompute solution between checkpoints." );
+        }
+
+        if( interpolationOrder_ < 2 )
+        {
+            throw std::runtime_error( "Error when making compressed state transition matrix interface, interpolation order must be at least 2." );
+        }
+
+        // Set (sorted and unique) list of columns to store
+        if( columnsToStore.size( ) == 0 )
+        {
+            for( int i = 0; i < stateTransitionMatrixSize_ + sensitivityMatrixSize_; i++ )
+            {
+                storedColumnIndices_.push_back( i );
+            }
+        }
+        else
+        {
+            storedColumnIndices_ = columnsToStore;
+            std::sort( storedColumnIndices_.begin( ), storedColumnIndices_.end( ) );
+            storedColumnIndices_.erase( std::unique( storedColumnIndices_.begin( ), storedColumnIndices_.end( ) ),
+                                        storedColumnIndices_.end( ) );
+
+            if( storedColumnIndices_.front( ) < 0 ||
+                    storedColumnIndices_.back( ) >= stateTransitionMatrixSize_ + sensitivityMatrixSize_ )
+            {
+                throw std::runtime_error( "Error when making compressed state transition matrix interface, column index out of bounds." );
+            }
+        }
+
+        combinedStateTransitionMatrix_ = Eigen::MatrixXd::Zero(
+                    stateTransitionMatrixSize_, stateTransitionMatrixSize_ + sensitivityMatrixSize_ );
+
+        updateMatrixHistory( variationalEquationsSolution, integrateSegmentsForwards );
+    }
+
+    //! Destructor.
+    ~CompressedSingleArcCombinedStateTransitionAndSensitivityMatrixInterface( ){ }
+
+    //! Function to reset the stored state transition and sensitivity matrix history
+    /*!
+     * Function to reset the stored state transition and sensitivity matrix history
+     * \param variationalEquationsSolution Vector of two matrix histories. First vector entry is state transition matrix
+     * history, second entry is sensitivity matrix history.
+     * \param integrateSegmentsForwards Boolean denoting whether the solution between checkpoints is to be recomputed
+     * starting at the earlier checkpoint (if true) or at the later checkpoint (if false, for backwards propagation).
+     */
+    void updateMatrixHistory( const std::vector< std::map< double, Eigen::MatrixXd > >& variationalEquationsSolution,
+                              const bool integrateSegmentsForwards = true )
+    {
+        integrateSegmentsForwards_ = integrateSegmentsForwards;
+
+        // Store every checkpointInterval_-th epoch, as well as the final epoch
+        std::vector< double > checkpointTimes;
+        int numberOfEpochs = variationalEquationsSolution.at( 0 ).size( );
+        int currentEpochIndex = 0;
+        for( std::map< double, Eigen::MatrixXd >::const_iterator matrixIterator =
+             variationalEquationsSolution.at( 0 ).begin( );
+             matrixIterator != variationalEquationsSolution.at( 0 ).end( ); matrixIterator++ )
+        {
+            if( isMatrixHistoryCheckpointEpoch( currentEpochIndex, numberOfEpochs, checkpointInterval_ ) )
+            {
+                checkpointTimes.push_back( matrixIterator->first );
+            }
+            currentEpochIndex++;
+        }
+
+        setStoredMatrixHistory( variationalEquationsSolution, checkpointTimes, storedTimes_, storedMatrixHistory_ );
+        lookUpScheme_ = boost::make_shared< interpolators::HuntingAlgorithmLookupScheme< double > >( storedTimes_ );
+
+        // Reset recomputed solution between checkpoints
+        currentSegmentIndex_ = -1;
+        segmentTimes_.clear( );
+        segmentMatrixHistory_.resize( 0, 0 );
+    }
+
+    //! Function to get the concatenated state transition and sensitivity matrix at a given time.
+    /*!
+     *  Function to get the concatenated state transition and sensitivity matrix at a given time. Columns that are not
+     *  stored are set to zero.
+     *  \param evaluationTime Time at which to evaluate matrix interpolators
+     *  \return Concatenated state transition and sensitivity matrices.
+     */
+    Eigen::MatrixXd getCombinedStateTransitionAndSensitivityMatrix( const double evaluationTime )
+    {
+        if( checkpointInterval_ == 1 )
+        {
+            interpolateStoredMatrixHistory( storedTimes_, storedMatrixHistory_, lookUpScheme_, evaluationTime );
+        }
+        else
+        {
+            // Recompute solution between checkpoints, if not yet available
+            int segmentIndex = lookUpScheme_->findNearestLowerNeighbour( evaluationTime );
+            if( segmentIndex != currentSegmentIndex_ )
+            {
+                recomputeSegment( segmentIndex );
+            }
+            interpolateStoredMatrixHistory( segmentTimes_, segmentMatrixHistory_, segmentLookUpScheme_, evaluationTime );
+        }
+
+        return combinedStateTransitionMatrix_;
+    }
+
+    //! Function to get the concatenated state transition and sensitivity matrix at a given time.
+    /*!
+     *  Function to get the concatenated state transition and sensitivity matrix at a given time
+     *  (functionality equal to getCombinedStateTransitionAndSensitivityMatrix for single-arc case).
+     *  \param evaluationTime Time at which to evaluate matrix interpolators
+     *  \return Concatenated state transition and sensitivity matrices.
+     */
+    Eigen::MatrixXd getFullCombinedStateTransitionAndSensitivityMatrix( const double evaluationTime )
+    {
+        return getCombinedStateTransitionAndSensitivityMatrix( evaluationTime );
+    }
+
+    //! Function to get the size of the total parameter vector.
+    /*!
+     * Function to get the size of the total parameter vector. For single-arc, this is simply the combination of
+     * the size of the state transition and sensitivity matrices.
+     * \return Size of the total parameter vector.
+     */
+    int getFullParameterVectorSize( )
+    {
+        return sensitivityMatrixSize_ + stateTransitionMatrixSize_;
+    }
+
+    //! Function to get the indices of the columns of the combined matrix that are stored.
+    /*!
+     * Function to get the indices of the columns of the combined matrix that are stored.
+     * \return Indices of the columns of the combined matrix that are stored.
+     */
+    std::vector< int > getStoredColumnIndices( )
+    {
+        return storedColumnIndices_;
+    }
+
+    //! Function to get the epochs at which the (compressed) matrix history is stored.
+    /*!
+     * Function to get the epochs at which the (compressed) matrix history is stored (i.e. checkpoints if
+     * checkpointInterval_ is larger than one).
+     * \return Epochs at which the (compressed) matrix history is stored.
+     */
+    std::vector< double > getStoredTimes( )
+    {
+        return storedTimes_;
+    }
+
+private:
+
+    //! Function to set contiguous storage of the requested columns of the matrix history, at a list of epochs.
+    /*!
+     * Function to set contiguous storage of the requested columns of the matrix history, at a list of epochs.
+     * \param variationalEquationsSolution Vector of two matrix histories. First vector entry is state transition matrix
+     * history, second entry is sensitivity matrix history.
+     * \param timesToStore Epochs at which the matrices are to be stored.
+     * \param storedTimes List of epochs at which matrices are stored (returned by reference).
+     * \param storedMatrixHistory Matrix with stored columns at a single epoch in each column (returned by reference).
+     */
+    void setStoredMatrixHistory(
+            const std::vector< std::map< double, Eigen::MatrixXd > >& variationalEquationsSolution,
+            const std::vector< double >& timesToStore,
+            std::vector< double >& storedTimes,
+            Eigen::Matrix< StorageScalarType, Eigen::Dynamic, Eigen::Dynamic >& storedMatrixHistory )
+    {
+        if( timesToStore.size( ) < 2 )
+        {
+            throw std::runtime_error( "Error when storing state transition matrix history, at least two epochs required." );
+        }
+
+        storedTimes = timesToStore;
+        storedMatrixHistory.resize( stateTransitionMatrixSize_ * storedColumnIndices_.size( ), storedTimes.size( ) );
+
+        for( unsigned int i = 0; i < storedTimes.size( ); i++ )
+        {
+            const Eigen::MatrixXd& currentStateTransitionMatrix =
+                    variationalEquationsSolution.at( 0 ).at( storedTimes.at( i ) );
+            for( unsigned int j = 0; j < storedColumnIndices_.size( ); j++ )
+            {
+                if( storedColumnIndices_.at( j ) < stateTransitionMatrixSize_ )
+                {
+                    storedMatrixHistory.block( j * stateTransitionMatrixSize_, i, stateTransitionMatrixSize_, 1 ) =
+                            currentStateTransitionMatrix.col( storedColumnIndices_.at( j ) ).
+                            template cast< StorageScalarType >( );
+                }
+                else
+                {
+                    storedMatrixHistory.block( j * stateTransitionMatrixSize_, i, stateTransitionMatrixSize_, 1 ) =
+                            variationalEquationsSolution.at( 1 ).at( storedTimes.at( i ) ).col(
+                                storedColumnIndices_.at( j ) - stateTransitionMatrixSize_ ).
+                            template cast< StorageScalarType >( );
+                }
+            }
+        }
+    }
+
+    //! Function to recompute the matrix history between two subsequent checkpoints.
+    /*!
+     * Function to recompute the matrix history between two subsequent checkpoints, using the segmentIntegrationFunction_.
+     * Result is stored in the segmentTimes_ and segmentMatrixHistory_ members.
+     * \param segmentIndex Index of checkpoint at start of segment that is to be recomputed.
+     */
+    void recomputeSegment( const int segmentIndex )
+    {
+        int startCheckpointIndex = integrateSegmentsForwards_ ? segmentIndex : segmentIndex + 1;
+        int endCheckpointIndex = integrateSegmentsForwards_ ? segmentIndex + 1 : segmentIndex;
+
+        // Retrieve full combined matrix at checkpoint (with zero columns where no data is stored)
+        Eigen::MatrixXd initialCombinedMatrix = Eigen::MatrixXd::Zero(
+                    stateTransitionMatrixSize_, stateTransitionMatrixSize_ + sensitivityMatrixSize_ );
+        for( unsigned int j = 0; j < storedColumnIndices_.size( ); j++ )
+        {
+            initialCombinedMatrix.col( storedColumnIndices_.at( j ) ) =
+                    storedMatrixHistory_.block( j * stateTransitionMatrixSize_, startCheckpointIndex,
+                                                stateTransitionMatrixSize_, 1 ).template cast< double >( );
+        }
+
+        std::vector< std::map< double, Eigen::MatrixXd > > segmentSolution = segmentIntegrationFunction_(
+                    storedTimes_.at( startCheckpointIndex ), initialCombinedMatrix,
+                    storedTimes_.at( endCheckpointIndex ) );
+
+        std::vector< double > segmentTimesToStore;
+        for( std::map< double, Eigen::MatrixXd >::const_iterator matrixIterator = segmentSolution.at( 0 ).begin( );
+             matrixIterator != segmentSolution.at( 0 ).end( ); matrixIterator++ )
+        {
+            segmentTimesToStore.push_back( matrixIterator->first );
+        }
+        setStoredMatrixHistory( segmentSolution, segmentTimesToStore, segmentTimes_, segmentMatrixHistory_ );
+        segmentLookUpScheme_ = boost::make_shared< interpolators::HuntingAlgorithmLookupScheme< double > >(
+                    segmentTimes_ );
+
+        currentSegmentIndex_ = segmentIndex;
+    }
+
+    //! Function to interpolate the stored columns, and set the result in combinedStateTransitionMatrix_
+    /*!
+     * Function to interpolate the stored columns with a Lagrange interpolator, and set the result in
+     * combinedStateTransitionMatrix_. Near the edges of the data, the interpolation stencil is shifted so that it is
+     * fully inside the data range.
+     * \param times Epochs at which the matrix history is stored.
+     * \param matrixHistory Matrix with stored columns at a single epoch in each column.
+     * \param lookUpScheme Look-up scheme for times vector.
+     * \param evaluationTime Time at which to interpolate matrices.
+     */
+    void interpolateStoredMatrixHistory(
+            const std::vector< double >& times,
+            const Eigen::Matrix< StorageScalarType, Eigen::Dynamic, Eigen::Dynamic >& matrixHistory,
+            const boost::shared_ptr< interpolators::HuntingAlgorithmLookupScheme< double > > lookUpScheme,
+            const double evaluationTime )
+    {
+        int numberOfPoints = std::min( interpolationOrder_, static_cast< int >( times.size( ) ) );
+        int lowerIndex = lookUpScheme->findNearestLowerNeighbour( evaluationTime );
+        int stencilStartIndex = std::max( std::min( lowerIndex - numberOfPoints / 2 + 1,
+                                                    static_cast< int >( times.size( ) ) - numberOfPoints ), 0 );
+
+        // Compute Lagrange polynomial coefficients
+        Eigen::Matrix< StorageScalarType, Eigen::Dynamic, 1 > interpolationWeights =
+                Eigen::Matrix< StorageScalarType, Eigen::Dynamic, 1 >::Ones( numberOfPoints );
+        for( int i = 0; i < numberOfPoints; i++ )
+        {
+            double currentWeight = 1.0;
+            for( int j = 0; j < numberOfPoints; j++ )
+            {
+                if( i != j )
+                {
+                    currentWeight *= ( evaluationTime - times.at( stencilStartIndex + j ) ) /
+                            ( times.at( stencilStartIndex + i ) - times.at( stencilStartIndex + j ) );
+                }
+            }
+            interpolationWeights( i ) = static_cast< StorageScalarType >( currentWeight );
+        }
+
+        interpolatedColumns_.noalias( ) =
+                ( matrixHistory.block( 0, stencilStartIndex, matrixHistory.rows( ), numberOfPoints ) *
+                  interpolationWeights ).template cast< double >( );
+
+        for( unsigned int j = 0; j < storedColumnIndices_.size( ); j++ )
+        {
+            combinedStateTransitionMatrix_.col( storedColumnIndices_.at( j ) ) =
+                    interpolatedColumns_.segment( j * stateTransitionMatrixSize_, stateTransitionMatrixSize_ );
+        }
+    }
+
+    //! Predefined matrix to use as return value when calling getCombinedStateTransitionAndSensitivityMatrix.
+    Eigen::MatrixXd combinedStateTransitionMatrix_;
+
+    //! Predefined vector containing interpolated stored columns (concatenated).
+    Eigen::VectorXd interpolatedColumns_;
+
+    //! Indices of the columns of the combined matrix that are stored.
+    std::vector< int > storedColumnIndices_;
+
+    //! Number of epochs of the input history between subsequent stored epochs.
+    int checkpointInterval_;
+
+    //! Function recomputing the solution between two checkpoints.
+    SegmentIntegrationFunction segmentIntegrationFunction_;
+
+    //! Number of points used in the Lagrange interpolation of the stored matrix history.
+    int interpolationOrder_;
+
+    //! Boolean denoting whether the solution between checkpoints is recomputed starting at the earlier checkpoint.
+    bool integrateSegmentsForwards_;
+
+    //! Epochs at which the matrix history is stored.
+    std::vector< double > storedTimes_;
+
+    //! Stored matrix history, with the (concatenated) stored columns at a single epoch in each column.
+    Eigen::Matrix< StorageScalarType, Eigen::Dynamic, Eigen::Dynamic > storedMatrixHistory_;
+
+    //! Look-up scheme for storedTimes_.
+    boost::shared_ptr< interpolators::HuntingAlgorithmLookupScheme< double > > lookUpScheme_;
+
+    //! Index of checkpoint at start of segment for which solution is currently stored in segmentMatrixHistory_.
+    int currentSegmentIndex_;
+
+    //! Epochs at which the recomputed matrix history of the current segment is stored.
+    std::vector< double > segmentTimes_;
+
+    //! Recomputed matrix history of the current segment (with same structure as storedMatrixHistory_).
+    Eigen::Matrix< StorageScalarType, Eigen::Dynamic, Eigen::Dynamic > segmentMatrixHistory_;
+
+    //! Look-up scheme for segmentTimes_.
+    boost::shared_ptr< interpolators::HuntingAlgorithmLookupScheme< double > > segmentLookUpScheme_;
+};
+
 //! Interface object of interpolation of numerically propagated state transition and sensitivity matrices for multi-arc
 //! estimation.
 class MultiArcCombinedStateTransitionAndSensitivityMatrixInterface: public CombinedStateTransitionAndSensitivityMatrixInterface
@@ -7,6 +7,7 @@
  *    a copy of the license with this file. If not, please or visit:
  *    http://tudat.tudelft.nl/LICENSE.
  */
+#include <algorithm>
 #include <map>
 
 #include <boost/function.hpp>
@@ -175,6 +176,87 @@ void VariationalEquations::setStatePartialFunctionList( )
     }
 }
 
+//! Function (called by constructor) to determine which blocks of the variational matrix may be non-zero.
+void VariationalEquations::setVariationalMatrixSparsityPattern( )
+{
+    variationalMatrixSparsityPattern_.clear( );
+
+    // Iterate over all state types and bodies, and retrieve column blocks set by state partial functions
+    for( std::map< IntegratedStateType, std::vector< std::multimap< std::pair< int, int >,
+         boost::function< void( Eigen::Block< Eigen::MatrixXd > ) > > > >::iterator
+         typeIterator = statePartialList_.begin( ); typeIterator != statePartialList_.end( ); typeIterator++ )
+    {
+        int startIndex = stateTypeStartIndices_.at( typeIterator->first );
+        int currentStateSize = getSingleIntegrationSize( typeIterator->first );
+        for( unsigned int i = 0; i < typeIterator->second.size( ); i++ )
+        {
+            std::vector< std::pair< int, int > > currentColumnBlocks;
+
+            // Add identity block of position w.r.t. velocity
+            if( typeIterator->first == propagators::transational_state )
+            {
+                currentColumnBlocks.push_back( std::make_pair( startIndex + i * currentStateSize, currentStateSize ) );
+            }
+
+            for( statePartialIterator_ = typeIterator->second.at( i ).begin( );
+                 statePartialIterator_ != typeIterator->second.at( i ).end( );
+                 statePartialIterator_++ )
+            {
+                currentColumnBlocks.push_back( statePartialIterator_->first );
+            }
+
+            variationalMatrixSparsityPattern_.push_back(
+                        std::make_pair( std::make_pair( startIndex + i * currentStateSize, currentStateSize ),
+                                        currentColumnBlocks ) );
+        }
+    }
+
+    // Add column blocks that are filled by corrections for hierarchical dynamics (in same order as setBodyStatePartialMatrix)
+    for( unsigned int i = 0; i < statePartialAdditionIndices_.size( ); i++ )
+    {
+        int sourceColumn = statePartialAdditionIndices_.at( i ).first;
+        for( unsigned int j = 0; j < variationalMatrixSparsityPattern_.size( ); j++ )
+        {
+            std::vector< std::pair< int, int > >& currentColumnBlocks = variationalMatrixSparsityPattern_.at( j ).second;
+            for( unsigned int k = 0; k < currentColumnBlocks.size( ); k++ )
+            {
+                if( ( currentColumnBlocks.at( k ).first < sourceColumn + 3 ) &&
+                        ( currentColumnBlocks.at( k ).first + currentColumnBlocks.at( k ).second > sourceColumn ) )
+                {
+                    currentColumnBlocks.push_back( std::make_pair( statePartialAdditionIndices_.at( i ).second, 3 ) );
+                    break;
+                }
+            }
+        }
+    }
+
+    // Sort column blocks, and merge overlapping and adjacent blocks
+    for( unsigned int i = 0; i < variationalMatrixSparsityPattern_.size( ); i++ )
+    {
+        std::vector< std::pair< int, int > > unmergedColumnBlocks = variationalMatrixSparsityPattern_.at( i ).second;
+        std::sort( unmergedColumnBlocks.begin( ), unmergedColumnBlocks.end( ) );
+
+        std::vector< std::pair< int, int > > mergedColumnBlocks;
+        for( unsigned int j = 0; j < unmergedColumnBlocks.size( ); j++ )
+        {
+            if( mergedColumnBlocks.size( ) > 0 &&
+                    ( unmergedColumnBlocks.at( j ).first <=
+                      mergedColumnBlocks.back( ).first + mergedColumnBlocks.back( ).second ) )
+            {
+                mergedColumnBlocks.back( ).second = std::max(
+                            mergedColumnBlocks.back( ).second,
+                            unmergedColumnBlocks.at( j ).first + unmergedColumnBlocks.at( j ).second -
+                            mergedColumnBlocks.back( ).first );
+            }
+            else
+            {
+                mergedColumnBlocks.push_back( unmergedColumnBlocks.at( j ) );
+            }
+        }
+        variationalMatrixSparsityPattern_.at( i ).second = mergedColumnBlocks;
+    }
+}
+
 }
 
 }
@@ -100,6 +100,9 @@ public:
         setStatePartialFunctionList( );
         setTranslationalStatePartialFrameScalingFunctions( parametersToEstimate );
         setParameterPartialFunctionList( parametersToEstimate );
+
+        // Determine which blocks of variationalMatrix_ can be non-zero.
+        setVariationalMatrixSparsityPattern( );
     }
     
     //! Calculates matrix containing partial derivatives of state derivatives w.r.t. body state.
@@ -125,9 +128,43 @@ public:
     {
         setBodyStatePartialMatrix( );
 
-        // Add partials of body positions and velocities.
-        currentMatrixDerivative.block( 0, 0, totalDynamicalStateSize_, numberOfParameterValues_ ) =
-                ( variationalMatrix_.template cast< StateScalarType >( ) * stateTransitionAndSensitivityMatrices );
+        // Add partials of body positions and velocities, only multiplying blocks of variationalMatrix_ that may be non-zero
+        for( unsigned int i = 0; i < variationalMatrixSparsityPattern_.size( ); i++ )
+        {
+            int rowStartIndex = variationalMatrixSparsityPattern_.at( i ).first.first;
+            int numberOfRows = variationalMatrixSparsityPattern_.at( i ).first.second;
+            const std::vector< std::pair< int, int > >& nonZeroColumnBlocks =
+                    variationalMatrixSparsityPattern_.at( i ).second;
+
+            if( nonZeroColumnBlocks.size( ) == 0 )
+            {
+                currentMatrixDerivative.block( rowStartIndex, 0, numberOfRows, numberOfParameterValues_ ).setZero( );
+            }
+
+            for( unsigned int j = 0; j < nonZeroColumnBlocks.size( ); j++ )
+            {
+                if( j == 0 )
+                {
+                    currentMatrixDerivative.block( rowStartIndex, 0, numberOfRows, numberOfParameterValues_ ).noalias( ) =
+                            variationalMatrix_.block( rowStartIndex, nonZeroColumnBlocks.at( j ).first,
+                                                      numberOfRows, nonZeroColumnBlocks.at( j ).second ).
+                            template cast< StateScalarType >( ) *
+                            stateTransitionAndSensitivityMatrices.block(
+                                nonZeroColumnBlocks.at( j ).first, 0,
+                                nonZeroColumnBlocks.at( j ).second, numberOfParameterValues_ );
+                }
+                else
+                {
+                    currentMatrixDerivative.block( rowStartIndex, 0, numberOfRows, numberOfParameterValues_ ).noalias( ) +=
+                            variationalMatrix_.block( rowStartIndex, nonZeroColumnBlocks.at( j ).first,
+                                                      numberOfRows, nonZeroColumnBlocks.at( j ).second ).
+                            template cast< StateScalarType >( ) *
+                            stateTransitionAndSensitivityMatrices.block(
+                                nonZeroColumnBlocks.at( j ).first, 0,
+                                nonZeroColumnBlocks.at( j ).second, numberOfParameterValues_ );
+                }
+            }
+        }
     }
 
     //! Calculates matrix containing partial derivatives of state derivatives w.r.t. parameters.
@@ -226,6 +263,29 @@ public:
     {
         return numberOfParameterValues_;
     }
+
+    //! Function to retrieve the blocks of the variational matrix that may be non-zero.
+    /*!
+     *  Function to retrieve the blocks of the variational matrix (partials of state derivatives w.r.t. current states)
+     *  that may be non-zero.
+     *  \return Sparsity pattern of variational matrix (see variationalMatrixSparsityPattern_)
+     */
+    std::vector< std::pair< std::pair< int, int >, std::vector< std::pair< int, int > > > >
+    getVariationalMatrixSparsityPattern( )
+    {
+        return variationalMatrixSparsityPattern_;
+    }
+
+    //! Function to retrieve the current matrix of partial derivatives of state derivatives w.r.t. current states.
+    /*!
+     *  Function to retrieve the current matrix of partial derivatives of state derivatives w.r.t. current states, as
+     *  computed by the last call to setBodyStatePartialMatrix.
+     *  \return Current matrix of partial derivatives of state derivatives w.r.t. current states.
+     */
+    Eigen::MatrixXd getVariationalMatrix( )
+    {
+        return variationalMatrix_;
+    }
     
 protected:
     
@@ -237,6 +297,14 @@ private:
      * w.r.t. a current state (stored in the statePartialList_ member) from the state derivative partials.
      */
     void setStatePartialFunctionList( );
+
+    //! Function (called by constructor) to determine which blocks of the variational matrix may be non-zero.
+    /*!
+     * Function (called by constructor) to determine which blocks of the variational matrix may be non-zero, from the
+     * state partial functions in statePartialList_ and the hierarchical dynamics indices in
+     * statePartialAdditionIndices_. The result is set in the variationalMatrixSparsityPattern_ member.
+     */
+    void setVariationalMatrixSparsityPattern( );
         
     //! Function to add parameter partial functions for single state derivative model, and set of parameter objects.
     /*!
@@ -493,6 +561,17 @@ private:
     //! Total matrix of partial derivatives of state derivatives w.r.t. current states.
     Eigen::MatrixXd variationalMatrix_;
 
+    //! Blocks of variationalMatrix_ that may be non-zero.
+    /*!
+     *  Blocks of variationalMatrix_ that may be non-zero. Each vector entry corresponds to the block of rows of a single
+     *  propagated body, with the first entry of the outer pair the start row and number of rows of this block. The second
+     *  entry of the outer pair contains the (start column, number of columns) of all column blocks in these rows that may
+     *  be non-zero, with adjacent blocks merged. Products with the state transition matrix are only computed for these
+     *  blocks.
+     */
+    std::vector< std::pair< std::pair< int, int >, std::vector< std::pair< int, int > > > >
+    variationalMatrixSparsityPattern_;
+
     //! Total matrix of partial derivatives of state derivatives w.r.t. parameter vectors.
     Eigen::MatrixXd variationalParameterMatrix_;
 };
@@ -1747,6 +1747,290 @@ BOOST_AUTO_TEST_CASE( testAccelerationLimitedGuidedThrust )
     }
 }
 
+//! Test the segment lookup, switching times and re-parameterization of a thrust segment table, as well as the thrust
+//! magnitude and direction models that use the table.
+BOOST_AUTO_TEST_CASE( testThrustSegmentTable )
+{
+    using namespace tudat;
+    using namespace propulsion;
+
+    // Define profile with non-uniform segment durations (including a very short segment)
+    std::vector< double > switchingTimes = { 100.0, 250.0, 250.5, 600.0, 1300.0, 1305.0, 2000.0 };
+    std::vector< double > thrustMagnitudes = { 1.0, 0.0, 2.0, 3.0, 0.0, 0.5 };
+    std::vector< double > specificImpulses = { 3000.0, TUDAT_NAN, 2500.0, 3500.0, TUDAT_NAN, 4000.0 };
+    std::vector< Eigen::Vector3d > thrustDirections;
+    for( unsigned int i = 0; i < thrustMagnitudes.size( ); i++ )
+    {
+        thrustDirections.push_back( Eigen::Vector3d( 1.0 + i, -2.0 * i, 0.5 ) );
+    }
+    boost::shared_ptr< ThrustSegmentTable > thrustSegmentTable = boost::make_shared< ThrustSegmentTable >(
+                switchingTimes, thrustMagnitudes, specificImpulses, thrustDirections );
+
+    BOOST_CHECK_EQUAL( thrustSegmentTable->getNumberOfSegments( ), 6 );
+    BOOST_CHECK_EQUAL( thrustSegmentTable->getSwitchingTimes( ).size( ), switchingTimes.size( ) );
+    for( unsigned int i = 0; i < switchingTimes.size( ); i++ )
+    {
+        BOOST_CHECK_EQUAL( thrustSegmentTable->getSwitchingTimes( ).at( i ), switchingTimes.at( i ) );
+    }
+
+    // Check segment values
+    for( unsigned int i = 0; i < thrustMagnitudes.size( ); i++ )
+    {
+        const ThrustSegment& currentSegment = thrustSegmentTable->getSegment( i );
+        BOOST_CHECK_EQUAL( currentSegment.thrustMagnitude, thrustMagnitudes.at( i ) );
+        if( thrustMagnitudes.at( i ) > 0.0 )
+        {
+            BOOST_CHECK_CLOSE_FRACTION(
+                        currentSegment.massRate, computePropellantMassRateFromSpecificImpulse(
+                            thrustMagnitudes.at( i ), specificImpulses.at( i ) ), std::numeric_limits< double >::epsilon( ) );
+            TUDAT_CHECK_MATRIX_CLOSE_FRACTION( currentSegment.thrustDirection, thrustDirections.at( i ).normalized( ),
+                                               ( 4.0 * std::numeric_limits< double >::epsilon( ) ) );
+        }
+        else
+        {
+            BOOST_CHECK_EQUAL( currentSegment.massRate, 0.0 );
+            BOOST_CHECK_EQUAL( currentSegment.thrustDirection.norm( ), 0.0 );
+        }
+    }
+
+    // Compare segment lookup (with and without hint) with linear search, including times at switching times.
+    std::vector< double > testTimes = switchingTimes;
+    for( double time = 0.0; time < 2100.0; time += 0.25 )
+    {
+        testTimes.push_back( time );
+    }
+
+    int segmentIndexHint = -1;
+    for( unsigned int i = 0; i < testTimes.size( ); i++ )
+    {
+        double currentTime = testTimes.at( i );
+        int expectedSegmentIndex = -1;
+        for( unsigned int j = 0; j < switchingTimes.size( ) - 1; j++ )
+        {
+            if( currentTime >= switchingTimes.at( j ) && currentTime < switchingTimes.at( j + 1 ) )
+            {
+                expectedSegmentIndex = j;
+            }
+        }
+        BOOST_CHECK_EQUAL( thrustSegmentTable->getSegmentIndex( currentTime ), expectedSegmentIndex );
+        BOOST_CHECK_EQUAL( thrustSegmentTable->getSegmentIndex( currentTime, segmentIndexHint ), expectedSegmentIndex );
+        segmentIndexHint = expectedSegmentIndex;
+
+        double expectedNextSwitchingTime = std::numeric_limits< double >::infinity( );
+        for( unsigned int j = 0; j < switchingTimes.size( ); j++ )
+        {
+            if( switchingTimes.at( j ) > currentTime )
+            {
+                expectedNextSwitchingTime = switchingTimes.at( j );
+                break;
+            }
+        }
+        BOOST_CHECK_EQUAL( thrustSegmentTable->getNextSwitchingTime( currentTime ), expectedNextSwitchingTime );
+    }
+
+    // Check that active segment is used up to and including its end time
+    thrustSegmentTable->setActiveSegment( 2 );
+    BOOST_CHECK_EQUAL( thrustSegmentTable->getSegmentIndex( 600.0 ), 2 );
+    BOOST_CHECK_EQUAL( thrustSegmentTable->getSegmentIndex( 250.5 ), 2 );
+    BOOST_CHECK_EQUAL( thrustSegmentTable->getSegmentIndex( 600.5 ), 3 );
+    BOOST_CHECK_EQUAL( thrustSegmentTable->getNextSwitchingTime( 600.0 ), 1300.0 );
+    thrustSegmentTable->setActiveSegment( -1 );
+    BOOST_CHECK_EQUAL( thrustSegmentTable->getSegmentIndex( 600.0 ), 3 );
+    BOOST_CHECK_THROW( thrustSegmentTable->setActiveSegment( 6 ), std::runtime_error );
+
+    // Check thrust magnitude and direction models
+    SegmentTableThrustMagnitudeWrapper thrustMagnitudeWrapper( thrustSegmentTable );
+    SegmentTableForceGuidance thrustGuidance( thrustSegmentTable, "" );
+    for( unsigned int i = 0; i < testTimes.size( ); i++ )
+    {
+        double currentTime = testTimes.at( i );
+        int segmentIndex = thrustSegmentTable->getSegmentIndex( currentTime );
+
+        thrustMagnitudeWrapper.update( currentTime );
+        thrustGuidance.updateCalculator( currentTime );
+        BOOST_CHECK_EQUAL( thrustMagnitudeWrapper.getCurrentSegmentIndex( ), segmentIndex );
+        if( segmentIndex >= 0 )
+        {
+            BOOST_CHECK_EQUAL( thrustMagnitudeWrapper.getCurrentThrustMagnitude( ), thrustMagnitudes.at( segmentIndex ) );
+            BOOST_CHECK_EQUAL( thrustMagnitudeWrapper.getCurrentMassRate( ),
+                               thrustSegmentTable->getSegment( segmentIndex ).massRate );
+            BOOST_CHECK_EQUAL( ( thrustGuidance.getCurrentForceDirectionInPropagationFrame( ) -
+                                 thrustSegmentTable->getSegment( segmentIndex ).thrustDirection ).norm( ), 0.0 );
+        }
+        else
+        {
+            BOOST_CHECK_EQUAL( thrustMagnitudeWrapper.getCurrentThrustMagnitude( ), 0.0 );
+            BOOST_CHECK_EQUAL( thrustMagnitudeWrapper.getCurrentMassRate( ), 0.0 );
+        }
+    }
+
+    // Re-parameterize table, and check that existing models use new values
+    thrustMagnitudes = { 0.0, 0.1, 0.2, 0.3, 0.4, 0.0 };
+    specificImpulses = { TUDAT_NAN, 1000.0, 2000.0, 3000.0, 4000.0, TUDAT_NAN };
+    thrustSegmentTable->resetSegmentValues( thrustMagnitudes, specificImpulses, thrustDirections );
+    switchingTimes = { 0.0, 10.0, 20.0, 30.0, 40.0, 50.0, 60.0 };
+    thrustSegmentTable->resetSwitchingTimes( switchingTimes );
+
+    thrustMagnitudeWrapper.resetCurrentTime( );
+    thrustMagnitudeWrapper.update( 35.0 );
+    BOOST_CHECK_EQUAL( thrustMagnitudeWrapper.getCurrentSegmentIndex( ), 3 );
+    BOOST_CHECK_EQUAL( thrustMagnitudeWrapper.getCurrentThrustMagnitude( ), 0.3 );
+    BOOST_CHECK_CLOSE_FRACTION( thrustMagnitudeWrapper.getCurrentMassRate( ),
+                                computePropellantMassRateFromSpecificImpulse( 0.3, 3000.0 ),
+                                std::numeric_limits< double >::epsilon( ) );
+    thrustGuidance.updateCalculator( 15.0 );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( thrustGuidance.getCurrentForceDirectionInPropagationFrame( ),
+                                       thrustDirections.at( 1 ).normalized( ),
+                                       ( 4.0 * std::numeric_limits< double >::epsilon( ) ) );
+
+    // Check that invalid input is rejected
+    std::vector< double > invalidSwitchingTimes = { 0.0, 10.0, 20.0 };
+    BOOST_CHECK_THROW( thrustSegmentTable->resetSwitchingTimes( invalidSwitchingTimes ), std::runtime_error );
+    invalidSwitchingTimes = switchingTimes;
+    invalidSwitchingTimes.at( 3 ) = invalidSwitchingTimes.at( 2 );
+    BOOST_CHECK_THROW( thrustSegmentTable->resetSwitchingTimes( invalidSwitchingTimes ), std::runtime_error );
+    BOOST_CHECK_THROW( thrustSegmentTable->resetSegmentValues( thrustMagnitudes, specificImpulses ), std::runtime_error );
+    specificImpulses.at( 2 ) = 0.0;
+    BOOST_CHECK_THROW( thrustSegmentTable->resetSegmentValues( thrustMagnitudes, specificImpulses, thrustDirections ),
+                       std::runtime_error );
+
+    // Check that table is unchanged by rejected input
+    std::vector< double > retrievedSwitchingTimes = thrustSegmentTable->getSwitchingTimes( );
+    for( unsigned int i = 0; i < switchingTimes.size( ); i++ )
+    {
+        BOOST_CHECK_EQUAL( retrievedSwitchingTimes.at( i ), switchingTimes.at( i ) );
+    }
+    for( unsigned int i = 0; i < thrustMagnitudes.size( ); i++ )
+    {
+        BOOST_CHECK_EQUAL( thrustSegmentTable->getSegment( i ).thrustMagnitude, thrustMagnitudes.at( i ) );
+    }
+    BOOST_CHECK_CLOSE_FRACTION( thrustSegmentTable->getSegment( 2 ).massRate,
+                                computePropellantMassRateFromSpecificImpulse( 0.2, 2000.0 ),
+                                std::numeric_limits< double >::epsilon( ) );
+
+    std::vector< double > singleSegmentSwitchingTimes = { 0.0, 1.0 };
+    std::vector< double > singleSegmentValues = { 1.0 };
+    BOOST_CHECK_THROW( ThrustSegmentTable( singleSegmentSwitchingTimes, thrustMagnitudes, specificImpulses ),
+                       std::runtime_error );
+    boost::shared_ptr< ThrustSegmentTable > magnitudeOnlySegmentTable = boost::make_shared< ThrustSegmentTable >(
+                singleSegmentSwitchingTimes, singleSegmentValues, singleSegmentValues );
+    BOOST_CHECK_THROW( SegmentTableForceGuidance( magnitudeOnlySegmentTable, "" ), std::runtime_error );
+}
+
+//! Test the propagation of a piecewise constant thrust profile defined by a thrust segment table, integrating each
+//! segment as a separate arc that ends exactly at the switching time. The table is then re-parameterized, and the
+//! propagation is repeated using the same acceleration and mass rate models.
+BOOST_AUTO_TEST_CASE( testSegmentTableThrustAcceleration )
+{
+    using namespace tudat;
+    using namespace numerical_integrators;
+    using namespace simulation_setup;
+    using namespace basic_astrodynamics;
+    using namespace propagators;
+
+    // Create vehicle object.
+    simulation_setup::NamedBodyMap bodyMap;
+    double vehicleMass = 5.0E3;
+    bodyMap[ "Vehicle" ] = boost::make_shared< simulation_setup::Body >( );
+    bodyMap[ "Vehicle" ]->setConstantBodyMass( vehicleMass );
+    bodyMap[ "Vehicle" ]->setEphemeris(
+                boost::make_shared< ephemerides::TabulatedCartesianEphemeris< > >(
+                    boost::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::Vector6d  > >( ),
+                    "SSB" ) );
+    setGlobalFrameBodyEphemerides( bodyMap, "SSB", "ECLIPJ2000" );
+
+    // Define thrust profile (thrust arc, coast arc, thrust arc)
+    std::vector< double > switchingTimes = { 0.0, 200.0, 500.0, 1000.0 };
+    std::vector< double > thrustMagnitudes = { 1.0E3, 0.0, 500.0 };
+    std::vector< double > specificImpulses = { 250.0, TUDAT_NAN, 300.0 };
+    std::vector< Eigen::Vector3d > thrustDirections =
+    { Eigen::Vector3d( -1.4, 2.4, 5.6 ), Eigen::Vector3d::Zero( ), Eigen::Vector3d( 3.0, -0.2, 1.0 ) };
+    boost::shared_ptr< propulsion::ThrustSegmentTable > thrustSegmentTable =
+            boost::make_shared< propulsion::ThrustSegmentTable >(
+                switchingTimes, thrustMagnitudes, specificImpulses, thrustDirections );
+
+    // Create acceleration and mass rate models.
+    SelectedAccelerationMap accelerationMap;
+    std::vector< std::string > bodiesToPropagate = { "Vehicle" };
+    std::vector< std::string > centralBodies = { "SSB" };
+    accelerationMap[ "Vehicle" ][ "Vehicle" ].push_back(
+                boost::make_shared< ThrustAccelerationSettings >(
+                    boost::make_shared< SegmentTableThrustDirectionSettings >( thrustSegmentTable ),
+                    boost::make_shared< SegmentTableThrustEngineSettings >( thrustSegmentTable ) ) );
+    basic_astrodynamics::AccelerationMap accelerationModelMap = createAccelerationModelsMap(
+                bodyMap, accelerationMap, bodiesToPropagate, centralBodies );
+
+    std::map< std::string, boost::shared_ptr< basic_astrodynamics::MassRateModel > > massRateModels;
+    massRateModels[ "Vehicle" ] = createMassRateModel(
+                "Vehicle", boost::make_shared< FromThrustMassModelSettings >( 1 ), bodyMap, accelerationModelMap );
+
+    // Create propagation settings
+    Eigen::VectorXd initialState = Eigen::VectorXd::Zero( 7 );
+    initialState( 6 ) = vehicleMass;
+
+    boost::shared_ptr< PropagationTimeTerminationSettings > terminationSettings =
+            boost::make_shared< propagators::PropagationTimeTerminationSettings >( switchingTimes.back( ) );
+    std::vector< boost::shared_ptr< SingleArcPropagatorSettings< double > > > propagatorSettingsVector;
+    propagatorSettingsVector.push_back(
+                boost::make_shared< TranslationalStatePropagatorSettings< double > >(
+                    centralBodies, accelerationModelMap, bodiesToPropagate, initialState.segment( 0, 6 ),
+                    terminationSettings ) );
+    propagatorSettingsVector.push_back(
+                boost::make_shared< MassPropagatorSettings< double > >(
+                    bodiesToPropagate, massRateModels, initialState.segment( 6, 1 ), terminationSettings ) );
+    boost::shared_ptr< SingleArcPropagatorSettings< double > > propagatorSettings =
+            boost::make_shared< MultiTypePropagatorSettings< double > >( propagatorSettingsVector, terminationSettings );
+
+    boost::shared_ptr< IntegratorSettings< > > integratorSettings =
+            boost::make_shared< IntegratorSettings< > >( rungeKutta4, 0.0, 1.0 );
+
+    for( unsigned int parameterizationIndex = 0; parameterizationIndex < 2; parameterizationIndex++ )
+    {
+        // Re-parameterize profile for second propagation.
+        if( parameterizationIndex == 1 )
+        {
+            thrustMagnitudes = { 200.0, 800.0, 0.0 };
+            specificImpulses = { 3000.0, 2000.0, TUDAT_NAN };
+            thrustDirections = { Eigen::Vector3d( 0.0, 1.0, 0.0 ), Eigen::Vector3d( 1.0, 1.0, 1.0 ),
+                                 Eigen::Vector3d::Zero( ) };
+            thrustSegmentTable->resetSegmentValues( thrustMagnitudes, specificImpulses, thrustDirections );
+        }
+
+        // Propagate each segment as a separate arc, and compare with analytical solution.
+        Eigen::VectorXd currentState = initialState;
+        Eigen::Vector3d expectedVelocity = Eigen::Vector3d::Zero( );
+        double expectedMass = vehicleMass;
+        for( unsigned int i = 0; i < thrustSegmentTable->getNumberOfSegments( ); i++ )
+        {
+            thrustSegmentTable->setActiveSegment( i );
+            integratorSettings->initialTime_ = switchingTimes.at( i );
+            terminationSettings->terminationTime_ = thrustSegmentTable->getNextSwitchingTime( switchingTimes.at( i ) );
+            propagatorSettings->resetInitialStates( currentState );
+
+            SingleArcDynamicsSimulator< > dynamicsSimulator(
+                        bodyMap, integratorSettings, propagatorSettings, true, false, false );
+            std::map< double, Eigen::Matrix< double, Eigen::Dynamic, 1 > > numericalSolution =
+                    dynamicsSimulator.getEquationsOfMotionNumericalSolution( );
+            BOOST_CHECK_EQUAL( numericalSolution.rbegin( )->first, switchingTimes.at( i + 1 ) );
+            currentState = numericalSolution.rbegin( )->second;
+
+            if( thrustMagnitudes.at( i ) > 0.0 )
+            {
+                double previousMass = expectedMass;
+                expectedMass -= ( switchingTimes.at( i + 1 ) - switchingTimes.at( i ) ) *
+                        propulsion::computePropellantMassRateFromSpecificImpulse(
+                            thrustMagnitudes.at( i ), specificImpulses.at( i ) );
+                expectedVelocity += thrustDirections.at( i ).normalized( ) * specificImpulses.at( i ) *
+                        physical_constants::SEA_LEVEL_GRAVITATIONAL_ACCELERATION * std::log( previousMass / expectedMass );
+            }
+
+            BOOST_CHECK_CLOSE_FRACTION( currentState( 6 ), expectedMass, 1.0E-12 );
+            TUDAT_CHECK_MATRIX_CLOSE_FRACTION( ( currentState.segment( 3, 3 ) ), expectedVelocity, 1.0E-11 );
+        }
+        thrustSegmentTable->setActiveSegment( -1 );
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
@@ -14,6 +14,7 @@
 #include <boost/function.hpp>
 #include <boost/lambda/lambda.hpp>
 
+#include "Tudat/Astrodynamics/Propulsion/thrustSegmentTable.h"
 #include "Tudat/Astrodynamics/ReferenceFrames/referenceFrameTransformations.h"
 #include "Tudat/Astrodynamics/ReferenceFrames/dependentOrientationCalculator.h"
 #include "Tudat/Basics/basicTypedefs.h"
@@ -272,6 +273,123 @@ protected:
 
 };
 
+//! Class for computing the force direction from a piecewise constant profile stored in a ThrustSegmentTable.
+/*!
+ *  Class for computing the force direction from a piecewise constant profile stored in a ThrustSegmentTable. The
+ *  (normalized) direction of each segment is stored in the table, so that an update only requires the lookup of the
+ *  active segment (starting from the segment found at the previous update). Outside of the time interval covered by the
+ *  table, the direction of the first/last segment is used. For segments with zero thrust, the direction is zero.
+ *  Since the table is shared, and not copied, by this object, the profile may be re-parameterized
+ *  (see ThrustSegmentTable::resetSegmentValues) without recreating this object.
+ */
+class SegmentTableForceGuidance: public BodyFixedForceDirectionGuidance
+{
+public:
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param thrustSegmentTable Table defining the piecewise constant thrust profile (must contain thrust directions).
+     * \param centralBody Name of central body
+     * \param bodyFixedForceDirection Function returning the unit-vector of the force direction in a body-fixed frame (e.g.
+     * engine thrust pointing in body-fixed frame).
+     */
+    SegmentTableForceGuidance(
+            const boost::shared_ptr< ThrustSegmentTable > thrustSegmentTable,
+            const std::string& centralBody,
+            const boost::function< Eigen::Vector3d( ) > bodyFixedForceDirection =
+            boost::lambda::constant( Eigen::Vector3d::UnitX( ) ) ):
+        BodyFixedForceDirectionGuidance ( bodyFixedForceDirection ),
+        thrustSegmentTable_( thrustSegmentTable ),
+        centralBody_( centralBody ),
+        currentSegmentIndex_( -1 ),
+        currentForceDirection_( Eigen::Vector3d::Constant( TUDAT_NAN ) )
+    {
+        if( !thrustSegmentTable_->getAreThrustDirectionsDefined( ) )
+        {
+            throw std::runtime_error( "Error when creating SegmentTableForceGuidance, no thrust directions defined in table." );
+        }
+    }
+
+    //! Function returning the current force direction, as computed by last call to updateCalculator/updateForceDirection.
+    /*!
+     *  Function returning the current force direction, as computed by last call to updateCalculator/updateForceDirection.
+     *  \return Current force direction, expressed in propagation frame.
+     */
+    Eigen::Vector3d getCurrentForceDirectionInPropagationFrame( )
+    {
+        return currentForceDirection_;
+    }
+
+    //! Function to get the rotation from body-fixed to inertial frame.
+    /*!
+     *  Function to get the rotation from body-fixed to inertial frame. NOT YET IMPLEMENTED IN THIS DERIVED CLASS.
+     *  \return NOT YET IMPLEMENTED IN THIS DERIVED CLASS.
+     */
+    Eigen::Quaterniond getRotationToGlobalFrame( )
+    {
+        throw std::runtime_error( "Error, body-fixed frame to propagation frame not yet implemented for SegmentTableForceGuidance." );
+    }
+
+    //! Function to return the name of the central body.
+    /*!
+     * Function to return the name of the central body.
+     * \return Name of the central body.
+     */
+    std::string getCentralBody( )
+    {
+        return centralBody_;
+    }
+
+    //! Function to return the table defining the piecewise constant thrust profile.
+    /*!
+     * Function to return the table defining the piecewise constant thrust profile.
+     * \return Table defining the piecewise constant thrust profile.
+     */
+    boost::shared_ptr< ThrustSegmentTable > getThrustSegmentTable( )
+    {
+        return thrustSegmentTable_;
+    }
+
+protected:
+
+    //! Function to update the force direction to the current time.
+    /*!
+     *  Function to update the force direction to the current time.
+     *  \param time Time to which object is to be updated.
+     */
+    void updateForceDirection( const double time )
+    {
+        currentSegmentIndex_ = thrustSegmentTable_->getSegmentIndex( time, currentSegmentIndex_ );
+        if( currentSegmentIndex_ >= 0 )
+        {
+            currentForceDirection_ = thrustSegmentTable_->getSegment( currentSegmentIndex_ ).thrustDirection;
+        }
+        else if( time < thrustSegmentTable_->getSegment( 0 ).startTime )
+        {
+            currentForceDirection_ = thrustSegmentTable_->getSegment( 0 ).thrustDirection;
+        }
+        else
+        {
+            currentForceDirection_ = thrustSegmentTable_->getSegment(
+                        thrustSegmentTable_->getNumberOfSegments( ) - 1 ).thrustDirection;
+        }
+    }
+
+    //! Table defining the piecewise constant thrust profile.
+    boost::shared_ptr< ThrustSegmentTable > thrustSegmentTable_;
+
+    //! Name of central body
+    std::string centralBody_;
+
+    //! Index of current segment, as computed by last call to updateForceDirection.
+    int currentSegmentIndex_;
+
+    //! Current force direction, as computed by last call to updateCalculator/updateForceDirection.
+    Eigen::Vector3d currentForceDirection_;
+
+};
+
 
 
 } // namespace propulsion
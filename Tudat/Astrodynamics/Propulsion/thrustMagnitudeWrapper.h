@@ -15,6 +15,7 @@
 #include <boost/function.hpp>
 #include <boost/lambda/lambda.hpp>
 
+#include "Tudat/Astrodynamics/Propulsion/thrustSegmentTable.h"
 #include "Tudat/Astrodynamics/SystemModels/engineModel.h"
 #include "Tudat/Mathematics/Interpolators/interpolator.h"
 
@@ -498,6 +499,113 @@ private:
 
 };
 
+//! Class to compute the thrust magnitude and mass rate from a piecewise constant profile stored in a ThrustSegmentTable.
+/*!
+ *  Class to compute the thrust magnitude and mass rate from a piecewise constant profile stored in a ThrustSegmentTable.
+ *  The mass rate of each segment is precomputed in the table, so that an update only requires the lookup of the
+ *  active segment (starting from the segment found at the previous update). Outside of the time interval covered by the
+ *  table, the thrust and mass rate are zero. Since the table is shared, and not copied, by this object, the profile may
+ *  be re-parameterized (see ThrustSegmentTable::resetSegmentValues) without recreating this object.
+ */
+class SegmentTableThrustMagnitudeWrapper: public ThrustMagnitudeWrapper
+{
+public:
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param thrustSegmentTable Table defining the piecewise constant thrust profile.
+     */
+    SegmentTableThrustMagnitudeWrapper(
+            const boost::shared_ptr< ThrustSegmentTable > thrustSegmentTable ):
+        thrustSegmentTable_( thrustSegmentTable ),
+        currentSegmentIndex_( -1 ),
+        currentThrustMagnitude_( TUDAT_NAN ),
+        currentMassRate_( TUDAT_NAN ){ }
+
+    //! Destructor.
+    ~SegmentTableThrustMagnitudeWrapper( ){ }
+
+    //! Function to update the thrust magnitude to the current time.
+    /*!
+     *  Function to update the thrust magnitude to the current time.
+     *  \param time Time to which the model is to be updated.
+     */
+    void update( const double time )
+    {
+        if( !( currentTime_ == time ) )
+        {
+            currentSegmentIndex_ = thrustSegmentTable_->getSegmentIndex( time, currentSegmentIndex_ );
+            if( currentSegmentIndex_ >= 0 )
+            {
+                const ThrustSegment& currentSegment = thrustSegmentTable_->getSegment( currentSegmentIndex_ );
+                currentThrustMagnitude_ = currentSegment.thrustMagnitude;
+                currentMassRate_ = currentSegment.massRate;
+            }
+            else
+            {
+                currentThrustMagnitude_ = 0.0;
+                currentMassRate_ = 0.0;
+            }
+            currentTime_ = time;
+        }
+    }
+
+    //! Function to return the current thrust magnitude
+    /*!
+     * Function to return the current thrust magnitude, as computed by last call to update member function.
+     * \return Current thrust magnitude
+     */
+    double getCurrentThrustMagnitude( )
+    {
+        return currentThrustMagnitude_;
+    }
+
+    //! Function to return the current mass rate
+    /*!
+     * Function to return the current mass rate, as computed by last call to update member function.
+     * \return Current mass rate
+     */
+    double getCurrentMassRate( )
+    {
+        return currentMassRate_;
+    }
+
+    //! Function to return the index of the current segment
+    /*!
+     * Function to return the index of the current segment, as computed by last call to update member function.
+     * \return Index of current segment (-1 if outside of the time interval covered by the table).
+     */
+    int getCurrentSegmentIndex( )
+    {
+        return currentSegmentIndex_;
+    }
+
+    //! Function to return the table defining the piecewise constant thrust profile.
+    /*!
+     * Function to return the table defining the piecewise constant thrust profile.
+     * \return Table defining the piecewise constant thrust profile.
+     */
+    boost::shared_ptr< ThrustSegmentTable > getThrustSegmentTable( )
+    {
+        return thrustSegmentTable_;
+    }
+
+private:
+
+    //! Table defining the piecewise constant thrust profile.
+    boost::shared_ptr< ThrustSegmentTable > thrustSegmentTable_;
+
+    //! Index of current segment, as computed by last call to update member function.
+    int currentSegmentIndex_;
+
+    //! Current thrust magnitude, as computed by last call to update member function.
+    double currentThrustMagnitude_;
+
+    //! Current mass rate, as computed by last call to update member function.
+    double currentMassRate_;
+};
+
 } // namespace propulsion
 
 } // namespace tudat
@@ -0,0 +1,243 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+#include <boost/lexical_cast.hpp>
+
+#include "Tudat/Astrodynamics/Propulsion/thrustFunctions.h"
+#include "Tudat/Astrodynamics/Propulsion/thrustSegmentTable.h"
+
+namespace tudat
+{
+
+namespace propulsion
+{
+
+//! Maximum number of buckets of the segment lookup grid, per segment.
+static const unsigned int MAXIMUM_NUMBER_OF_BUCKETS_PER_SEGMENT = 4;
+
+//! Constructor
+ThrustSegmentTable::ThrustSegmentTable(
+        const std::vector< double >& switchingTimes,
+        const std::vector< double >& thrustMagnitudes,
+        const std::vector< double >& specificImpulses,
+        const std::vector< Eigen::Vector3d >& thrustDirections ):
+    bucketWidth_( 0.0 ), areThrustDirectionsDefined_( thrustDirections.size( ) > 0 ), activeSegment_( -1 )
+{
+    if( thrustMagnitudes.size( ) == 0 )
+    {
+        throw std::runtime_error( "Error when creating thrust segment table, no segments provided" );
+    }
+
+    if( switchingTimes.size( ) != thrustMagnitudes.size( ) + 1 )
+    {
+        throw std::runtime_error( "Error when creating thrust segment table, number of switching times (" +
+                                  boost::lexical_cast< std::string >( switchingTimes.size( ) ) +
+                                  ") should be equal to number of segments (" +
+                                  boost::lexical_cast< std::string >( thrustMagnitudes.size( ) ) + ") plus one" );
+    }
+
+    segments_.resize( thrustMagnitudes.size( ) );
+    setSwitchingTimes( switchingTimes );
+    setSegmentValues( thrustMagnitudes, specificImpulses, thrustDirections );
+}
+
+//! Function to retrieve the switching times of the profile.
+std::vector< double > ThrustSegmentTable::getSwitchingTimes( ) const
+{
+    std::vector< double > switchingTimes;
+    switchingTimes.reserve( segments_.size( ) + 1 );
+    for( unsigned int i = 0; i < segments_.size( ); i++ )
+    {
+        switchingTimes.push_back( segments_[ i ].startTime );
+    }
+    switchingTimes.push_back( segments_.back( ).endTime );
+    return switchingTimes;
+}
+
+//! Function to retrieve the first switching time after a given time.
+double ThrustSegmentTable::getNextSwitchingTime( const double time ) const
+{
+    if( time < segments_.front( ).startTime )
+    {
+        return segments_.front( ).startTime;
+    }
+
+    int segmentIndex = findSegmentIndex( time );
+    if( segmentIndex < 0 )
+    {
+        return std::numeric_limits< double >::infinity( );
+    }
+    else
+    {
+        return segments_[ segmentIndex ].endTime;
+    }
+}
+
+//! Function to set the segment over which the numerical integration is currently performed.
+void ThrustSegmentTable::setActiveSegment( const int segmentIndex )
+{
+    if( segmentIndex < -1 || segmentIndex >= static_cast< int >( segments_.size( ) ) )
+    {
+        throw std::runtime_error( "Error when setting active segment of thrust segment table, index " +
+                                  boost::lexical_cast< std::string >( segmentIndex ) + " is invalid" );
+    }
+    activeSegment_ = segmentIndex;
+}
+
+//! Function to reset the values of thrust magnitude, specific impulse and direction in each segment.
+void ThrustSegmentTable::resetSegmentValues(
+        const std::vector< double >& thrustMagnitudes,
+        const std::vector< double >& specificImpulses,
+        const std::vector< Eigen::Vector3d >& thrustDirections )
+{
+    if( thrustMagnitudes.size( ) != segments_.size( ) )
+    {
+        throw std::runtime_error( "Error when resetting thrust segment table, number of segments is inconsistent" );
+    }
+
+    if( areThrustDirectionsDefined_ != ( thrustDirections.size( ) > 0 ) )
+    {
+        throw std::runtime_error(
+                    "Error when resetting thrust segment table, thrust directions must be provided if, and only if, they "
+                    "were provided when creating the table" );
+    }
+
+    setSegmentValues( thrustMagnitudes, specificImpulses, thrustDirections );
+}
+
+//! Function to reset the switching times of the profile.
+void ThrustSegmentTable::resetSwitchingTimes( const std::vector< double >& switchingTimes )
+{
+    if( switchingTimes.size( ) != segments_.size( ) + 1 )
+    {
+        throw std::runtime_error( "Error when resetting thrust segment table switching times, number of switching "
+                                  "times is inconsistent" );
+    }
+
+    setSwitchingTimes( switchingTimes );
+}
+
+//! Function to set the values of thrust magnitude, specific impulse and direction in each segment.
+void ThrustSegmentTable::setSegmentValues(
+        const std::vector< double >& thrustMagnitudes,
+        const std::vector< double >& specificImpulses,
+        const std::vector< Eigen::Vector3d >& thrustDirections )
+{
+    if( specificImpulses.size( ) != segments_.size( ) )
+    {
+        throw std::runtime_error( "Error when setting thrust segment table, number of specific impulses is inconsistent" );
+    }
+
+    if( areThrustDirectionsDefined_ && thrustDirections.size( ) != segments_.size( ) )
+    {
+        throw std::runtime_error( "Error when setting thrust segment table, number of thrust directions is inconsistent" );
+    }
+
+    // Check all input before modifying the segments, so that the table is unchanged if the input is invalid.
+    for( unsigned int i = 0; i < segments_.size( ); i++ )
+    {
+        if( !( thrustMagnitudes[ i ] >= 0.0 ) )
+        {
+            throw std::runtime_error( "Error when setting thrust segment table, thrust magnitude in segment " +
+                                      boost::lexical_cast< std::string >( i ) + " is invalid" );
+        }
+
+        if( thrustMagnitudes[ i ] > 0.0 )
+        {
+            if( !( specificImpulses[ i ] > 0.0 ) )
+            {
+                throw std::runtime_error( "Error when setting thrust segment table, specific impulse in thrusting segment " +
+                                          boost::lexical_cast< std::string >( i ) + " is invalid" );
+            }
+
+            if( areThrustDirectionsDefined_ && !( thrustDirections[ i ].norm( ) > 0.0 ) )
+            {
+                throw std::runtime_error( "Error when setting thrust segment table, thrust direction in thrusting segment " +
+                                          boost::lexical_cast< std::string >( i ) + " is invalid" );
+            }
+        }
+    }
+
+    for( unsigned int i = 0; i < segments_.size( ); i++ )
+    {
+        ThrustSegment& currentSegment = segments_[ i ];
+        currentSegment.thrustMagnitude = thrustMagnitudes[ i ];
+        currentSegment.specificImpulse = specificImpulses[ i ];
+        currentSegment.thrustDirection.setZero( );
+
+        if( currentSegment.thrustMagnitude > 0.0 )
+        {
+            currentSegment.massRate = computePropellantMassRateFromSpecificImpulse(
+                        currentSegment.thrustMagnitude, currentSegment.specificImpulse );
+
+            if( areThrustDirectionsDefined_ )
+            {
+                currentSegment.thrustDirection = thrustDirections[ i ].normalized( );
+            }
+        }
+        else
+        {
+            currentSegment.massRate = 0.0;
+        }
+    }
+}
+
+//! Function to set the switching times, and recompute the bucket grid used for segment lookup.
+void ThrustSegmentTable::setSwitchingTimes( const std::vector< double >& switchingTimes )
+{
+    // Check switching times and determine shortest segment, before modifying the segments, so that the table is
+    // unchanged if the switching times are invalid.
+    double minimumSegmentDuration = std::numeric_limits< double >::infinity( );
+    for( unsigned int i = 0; i < segments_.size( ); i++ )
+    {
+        if( !( switchingTimes[ i + 1 ] > switchingTimes[ i ] ) )
+        {
+            throw std::runtime_error( "Error when setting thrust segment table, switching times must be strictly increasing" );
+        }
+        minimumSegmentDuration = std::min( minimumSegmentDuration, switchingTimes[ i + 1 ] - switchingTimes[ i ] );
+    }
+
+    // Set segment boundaries.
+    for( unsigned int i = 0; i < segments_.size( ); i++ )
+    {
+        segments_[ i ].startTime = switchingTimes[ i ];
+        segments_[ i ].endTime = switchingTimes[ i + 1 ];
+    }
+
+    // Set bucket grid, such that each bucket contains at most two segment boundaries, unless this requires an excessive
+    // number of buckets
+    double totalDuration = switchingTimes.back( ) - switchingTimes.front( );
+    unsigned int numberOfBuckets = static_cast< unsigned int >(
+                std::min( std::ceil( totalDuration / minimumSegmentDuration ),
+                          static_cast< double >( MAXIMUM_NUMBER_OF_BUCKETS_PER_SEGMENT * segments_.size( ) ) ) );
+    numberOfBuckets = std::max( numberOfBuckets, 1u );
+    bucketWidth_ = totalDuration / static_cast< double >( numberOfBuckets );
+
+    bucketStartSegments_.resize( numberOfBuckets );
+    unsigned int currentSegment = 0;
+    for( unsigned int i = 0; i < numberOfBuckets; i++ )
+    {
+        double bucketStartTime = switchingTimes.front( ) + static_cast< double >( i ) * bucketWidth_;
+        while( currentSegment < segments_.size( ) - 1 && bucketStartTime >= segments_[ currentSegment ].endTime )
+        {
+            currentSegment++;
+        }
+        bucketStartSegments_[ i ] = currentSegment;
+    }
+}
+
+} // namespace propulsion
+
+} // namespace tudat
@@ -0,0 +1,299 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_THRUSTSEGMENTTABLE_H
+#define TUDAT_THRUSTSEGMENTTABLE_H
+
+#include <vector>
+
+#include <boost/shared_ptr.hpp>
+
+#include <Eigen/Core>
+
+namespace tudat
+{
+
+namespace propulsion
+{
+
+//! Single segment of a piecewise constant thrust profile, as stored in a ThrustSegmentTable.
+struct ThrustSegment
+{
+    //! Time at which the segment starts (inclusive).
+    double startTime;
+
+    //! Time at which the segment ends (exclusive).
+    double endTime;
+
+    //! Thrust magnitude during the segment.
+    double thrustMagnitude;
+
+    //! Specific impulse during the segment.
+    double specificImpulse;
+
+    //! Propellant mass rate during the segment, precomputed from thrust magnitude and specific impulse.
+    double massRate;
+
+    //! Thrust direction (unit vector in propagation frame) during the segment, zero if not defined.
+    Eigen::Vector3d thrustDirection;
+};
+
+//! Class storing a piecewise constant thrust profile as a flat table of segments.
+/*!
+ *  Class storing a piecewise constant thrust profile (magnitude, specific impulse and, optionally, direction in the
+ *  propagation frame) as a flat, contiguous table of segments, as typically used for low-thrust trajectory optimization.
+ *  Segment i is active on the half-open interval [t_i, t_{i+1}) between subsequent switching times; outside of the
+ *  first and last switching time, the engine is off. The mass rate and unit thrust direction of each segment are
+ *  computed when the table is (re)set, so that evaluating the profile requires no function calls or interpolation.
+ *  The segment at a given time is found without searching through the table: a uniform grid of buckets over the
+ *  full time interval stores the first segment of each bucket, with the bucket width chosen such that only a small,
+ *  bounded, number of segments needs to be checked per bucket. In addition, a segment index hint (typically the
+ *  segment found at the previous evaluation) may be provided, which is checked first.
+ *  Since the profile is discontinuous at the switching times, the numerical integration should not step over them;
+ *  the switching times can be retrieved (getSwitchingTimes, getNextSwitchingTime) to integrate exactly up to each of
+ *  them (e.g. using NumericalIntegrator::integrateTo or a time termination condition per arc). When integrating over
+ *  a single segment in this manner, the segment can be set as active segment (setActiveSegment), so that it is also used
+ *  at its end time, where the integrator evaluates the state derivative at the end of its final step.
+ *  The segment values and switching times can be reset without recreating the table, so that an optimizer can
+ *  re-parameterize the profile without recreating the objects (acceleration and mass rate models) using the table.
+ */
+class ThrustSegmentTable
+{
+public:
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param switchingTimes List of switching times: start time of each segment, followed by the end time of the last
+     * segment (strictly increasing; size must be number of segments plus one).
+     * \param thrustMagnitudes Thrust magnitude in each segment (zero for a coast segment).
+     * \param specificImpulses Specific impulse in each segment (not used for segments with zero thrust).
+     * \param thrustDirections Thrust direction (in propagation frame) in each segment. Directions are normalized when
+     * setting the table. May be empty, in which case the table can only be used for the thrust magnitude.
+     */
+    ThrustSegmentTable(
+            const std::vector< double >& switchingTimes,
+            const std::vector< double >& thrustMagnitudes,
+            const std::vector< double >& specificImpulses,
+            const std::vector< Eigen::Vector3d >& thrustDirections = std::vector< Eigen::Vector3d >( ) );
+
+    //! Destructor
+    ~ThrustSegmentTable( ){ }
+
+    //! Function to retrieve the index of the segment that is active at a given time.
+    /*!
+     * Function to retrieve the index of the segment that is active at a given time.
+     * \param time Time at which the active segment is to be determined.
+     * \param segmentIndexHint Index of segment that is checked first (typically the segment found at the previous
+     * call); ignored if negative.
+     * \return Index of active segment, or -1 if time is outside of the time interval covered by the table.
+     */
+    int getSegmentIndex( const double time, const int segmentIndexHint = -1 ) const
+    {
+        // Check active segment (on closed interval) first.
+        if( activeSegment_ >= 0 )
+        {
+            const ThrustSegment& activeSegment = segments_[ activeSegment_ ];
+            if( time >= activeSegment.startTime && time <= activeSegment.endTime )
+            {
+                return activeSegment_;
+            }
+        }
+
+        return findSegmentIndex( time, segmentIndexHint );
+    }
+
+    //! Function to retrieve a single segment of the table.
+    /*!
+     * Function to retrieve a single segment of the table (no range check is performed).
+     * \param segmentIndex Index of segment that is to be retrieved.
+     * \return Segment with requested index.
+     */
+    const ThrustSegment& getSegment( const int segmentIndex ) const
+    {
+        return segments_[ segmentIndex ];
+    }
+
+    //! Function to retrieve the full list of segments.
+    /*!
+     * Function to retrieve the full list of segments.
+     * \return List of segments.
+     */
+    const std::vector< ThrustSegment >& getSegments( ) const
+    {
+        return segments_;
+    }
+
+    //! Function to retrieve the number of segments in the table.
+    /*!
+     * Function to retrieve the number of segments in the table.
+     * \return Number of segments in the table.
+     */
+    unsigned int getNumberOfSegments( ) const
+    {
+        return segments_.size( );
+    }
+
+    //! Function to retrieve the switching times of the profile.
+    /*!
+     * Function to retrieve the switching times of the profile, i.e. the start time of each segment, followed by the
+     * end time of the last segment.
+     * \return Switching times of the profile.
+     */
+    std::vector< double > getSwitchingTimes( ) const;
+
+    //! Function to retrieve the first switching time after a given time.
+    /*!
+     * Function to retrieve the first switching time after a given time, i.e. the time up to which the profile is
+     * continuous.
+     * \param time Time from which the next switching time is to be determined.
+     * \return First switching time strictly larger than time (infinity if there is none).
+     */
+    double getNextSwitchingTime( const double time ) const;
+
+    //! Function to check whether thrust directions are defined for the segments.
+    /*!
+     * Function to check whether thrust directions are defined for the segments.
+     * \return True if thrust directions are defined for the segments.
+     */
+    bool getAreThrustDirectionsDefined( ) const
+    {
+        return areThrustDirectionsDefined_;
+    }
+
+    //! Function to set the segment over which the numerical integration is currently performed.
+    /*!
+     * Function to set the segment over which the numerical integration is currently performed. The active segment is
+     * used on the closed interval [t_i, t_{i+1}], so that the evaluation at the end of the final integration step of the
+     * segment (at its switching time) does not use the value of the next segment.
+     * \param segmentIndex Index of the active segment, or -1 if no segment is to be active.
+     */
+    void setActiveSegment( const int segmentIndex );
+
+    //! Function to retrieve the segment over which the numerical integration is currently performed.
+    /*!
+     * Function to retrieve the segment over which the numerical integration is currently performed.
+     * \return Index of the active segment (-1 if none).
+     */
+    int getActiveSegment( ) const
+    {
+        return activeSegment_;
+    }
+
+    //! Function to reset the values of thrust magnitude, specific impulse and direction in each segment.
+    /*!
+     * Function to reset the values of thrust magnitude, specific impulse and direction in each segment, for
+     * the existing switching times. Since the table is modified in place, all models using the table use the new
+     * values directly. Note that any values cached by these models at the current time must be reset (as is done
+     * automatically by the propagation before each state derivative evaluation).
+     * \param thrustMagnitudes Thrust magnitude in each segment.
+     * \param specificImpulses Specific impulse in each segment.
+     * \param thrustDirections Thrust direction in each segment (may only be empty if no directions were defined when
+     * creating the table).
+     */
+    void resetSegmentValues(
+            const std::vector< double >& thrustMagnitudes,
+            const std::vector< double >& specificImpulses,
+            const std::vector< Eigen::Vector3d >& thrustDirections = std::vector< Eigen::Vector3d >( ) );
+
+    //! Function to reset the switching times of the profile.
+    /*!
+     * Function to reset the switching times of the profile, keeping the values in each segment.
+     * \param switchingTimes New switching times (number of entries must be equal to existing number).
+     */
+    void resetSwitchingTimes( const std::vector< double >& switchingTimes );
+
+private:
+
+    //! Function to find the index of the segment that contains a given time.
+    /*!
+     * Function to find the index of the segment that contains a given time (on its half-open interval), without
+     * considering the active segment.
+     * \param time Time for which the segment is to be found.
+     * \param segmentIndexHint Index of segment that is checked first; ignored if negative.
+     * \return Index of segment containing time, or -1 if time is outside of the time interval covered by the table.
+     */
+    int findSegmentIndex( const double time, const int segmentIndexHint = -1 ) const
+    {
+        // Check hint segment first.
+        if( segmentIndexHint >= 0 && segmentIndexHint < static_cast< int >( segments_.size( ) ) )
+        {
+            const ThrustSegment& hintSegment = segments_[ segmentIndexHint ];
+            if( time >= hintSegment.startTime && time < hintSegment.endTime )
+            {
+                return segmentIndexHint;
+            }
+        }
+
+        if( !( time >= segments_.front( ).startTime && time < segments_.back( ).endTime ) )
+        {
+            return -1;
+        }
+
+        // Retrieve first segment of bucket, and step through the (small number of) segments in the bucket.
+        unsigned int bucketIndex = static_cast< unsigned int >( ( time - segments_.front( ).startTime ) / bucketWidth_ );
+        if( bucketIndex >= bucketStartSegments_.size( ) )
+        {
+            bucketIndex = bucketStartSegments_.size( ) - 1;
+        }
+
+        unsigned int segmentIndex = bucketStartSegments_[ bucketIndex ];
+        while( segmentIndex < segments_.size( ) - 1 && time >= segments_[ segmentIndex ].endTime )
+        {
+            segmentIndex++;
+        }
+        while( segmentIndex > 0 && time < segments_[ segmentIndex ].startTime )
+        {
+            segmentIndex--;
+        }
+        return static_cast< int >( segmentIndex );
+    }
+
+    //! Function to set the values of thrust magnitude, specific impulse and direction in each segment.
+    /*!
+     * Function to set the values of thrust magnitude, specific impulse and direction in each segment, checking the
+     * consistency of the input.
+     * \param thrustMagnitudes Thrust magnitude in each segment.
+     * \param specificImpulses Specific impulse in each segment.
+     * \param thrustDirections Thrust direction in each segment.
+     */
+    void setSegmentValues(
+            const std::vector< double >& thrustMagnitudes,
+            const std::vector< double >& specificImpulses,
+            const std::vector< Eigen::Vector3d >& thrustDirections );
+
+    //! Function to set the switching times, and recompute the bucket grid used for segment lookup.
+    /*!
+     * Function to set the switching times, and recompute the bucket grid used for segment lookup.
+     * \param switchingTimes Switching times of the profile.
+     */
+    void setSwitchingTimes( const std::vector< double >& switchingTimes );
+
+    //! Contiguous list of segments of the profile.
+    std::vector< ThrustSegment > segments_;
+
+    //! Index of the segment active at the start of each bucket of the lookup grid.
+    std::vector< unsigned int > bucketStartSegments_;
+
+    //! Width (in time) of each bucket of the lookup grid.
+    double bucketWidth_;
+
+    //! Boolean denoting whether thrust directions are defined for the segments.
+    bool areThrustDirectionsDefined_;
+
+    //! Index of the segment over which the numerical integration is currently performed (-1 if none).
+    int activeSegment_;
+};
+
+} // namespace propulsion
+
+} // namespace tudat
+
+#endif // TUDAT_THRUSTSEGMENTTABLE_H
@@ -231,6 +231,64 @@ BOOST_AUTO_TEST_CASE( testAerodynamicAngleCalculator )
     }
 }
 
+//! Test whether rotations stored by the aerodynamic angle calculator are recomputed after an update
+BOOST_AUTO_TEST_CASE( testAerodynamicAngleCalculatorRotationUpdate )
+{
+    Eigen::Vector6d testState;
+    testState << -1656517.23153109, -5790058.28764025, -2440584.88186829,
+            6526.30784888051, -2661.34558272018, 2377.09572383163;
+
+    double angleOfAttack = 1.232;
+    double angleOfSideslip = -0.00322;
+    double bankAngle = 2.323432;
+
+    // Create angle calculator, with angles that can be modified between updates.
+    AerodynamicAngleCalculator aerodynamicAngleCalculator(
+                boost::lambda::constant( testState ),
+                boost::lambda::constant( Eigen::Quaterniond( Eigen::Matrix3d::Identity( ) ) ), "", 1,
+                boost::lambda::var( angleOfAttack ),
+                boost::lambda::var( angleOfSideslip ),
+                boost::lambda::var( bankAngle ) );
+
+    for( unsigned int i = 0; i < 3; i++ )
+    {
+        aerodynamicAngleCalculator.update( static_cast< double >( i ), true );
+
+        // Request rotations twice, and check that the (stored) results are identical.
+        for( unsigned int j = 0; j < 2; j++ )
+        {
+            Eigen::Matrix3d trajectoryToBodyFrameMatrix =
+                    aerodynamicAngleCalculator.getRotationQuaternionBetweenFrames(
+                        trajectory_frame, body_frame ).toRotationMatrix( );
+            Eigen::Matrix3d bodyToTrajectoryFrameMatrix =
+                    aerodynamicAngleCalculator.getRotationQuaternionBetweenFrames(
+                        body_frame, trajectory_frame ).toRotationMatrix( );
+            Eigen::Matrix3d expectedTrajectoryToBodyFrameMatrix =
+                    getAirspeedBasedAerodynamicToBodyFrameTransformationMatrix( angleOfAttack, angleOfSideslip ) *
+                    getTrajectoryToAerodynamicFrameTransformationMatrix( bankAngle );
+
+            TUDAT_CHECK_MATRIX_CLOSE_FRACTION( trajectoryToBodyFrameMatrix, expectedTrajectoryToBodyFrameMatrix,
+                                               1.0E-14 );
+            TUDAT_CHECK_MATRIX_CLOSE_FRACTION( bodyToTrajectoryFrameMatrix,
+                                               expectedTrajectoryToBodyFrameMatrix.transpose( ), 1.0E-14 );
+        }
+
+        // Modify angles for next update.
+        angleOfAttack -= 0.3;
+        angleOfSideslip += 0.01;
+        bankAngle -= 0.7;
+    }
+
+    // Check that rotations requiring angles that are not defined cannot be retrieved.
+    AerodynamicAngleCalculator incompleteAerodynamicAngleCalculator(
+                boost::lambda::constant( testState ),
+                boost::lambda::constant( Eigen::Quaterniond( Eigen::Matrix3d::Identity( ) ) ), "", 1 );
+    incompleteAerodynamicAngleCalculator.update( 0.0, true );
+    BOOST_CHECK_NO_THROW( incompleteAerodynamicAngleCalculator.getRotationQuaternionBetweenFrames(
+                              inertial_frame, trajectory_frame ) );
+    BOOST_CHECK_THROW( incompleteAerodynamicAngleCalculator.getRotationQuaternionBetweenFrames(
+                           inertial_frame, body_frame ), std::runtime_error );
+}
 
 BOOST_AUTO_TEST_SUITE_END( )
 
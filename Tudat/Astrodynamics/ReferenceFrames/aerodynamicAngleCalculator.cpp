@@ -100,7 +100,7 @@ std::string getAerodynamicAngleName( const AerodynamicsReferenceFrameAngles angl
 void AerodynamicAngleCalculator::update( const double currentTime, const bool updateBodyOrientation )
 {
     // Clear all current rotation matrices.
-    currentRotationMatrices_.clear( );
+    resetCurrentRotations( );
 
     // Get current body-fixed state.
     if( !( currentTime == currentTime_ ) )
@@ -113,9 +113,8 @@ void AerodynamicAngleCalculator::update( const double currentTime, const bool up
                     currentBodyFixedGroundSpeedBasedState_.segment( 0, 3 ) );
 
         // Calculate latitude and longitude.
-        currentAerodynamicAngles_[ latitude_angle ] =
-                mathematical_constants::PI / 2.0 - sphericalCoordinates( 1 );
-        currentAerodynamicAngles_[ longitude_angle ] = sphericalCoordinates( 2 );
+        setCurrentAerodynamicAngle( latitude_angle, mathematical_constants::PI / 2.0 - sphericalCoordinates( 1 ) );
+        setCurrentAerodynamicAngle( longitude_angle, sphericalCoordinates( 2 ) );
 
         // Compute wind velocity vector
         Eigen::Vector3d localWindVelocity = Eigen::Vector3d::Zero( );
@@ -135,15 +134,16 @@ void AerodynamicAngleCalculator::update( const double currentTime, const bool up
         // Calculate vertical <-> aerodynamic <-> body-fixed angles if neede.
         if( calculateVerticalToAerodynamicFrame_ )
         {
+            // Compute (and store) corotating to vertical frame rotation, which is needed for the velocity in the
+            // vertical frame.
+            Eigen::Quaterniond corotatingToVerticalFrameRotation = computeRotationToNextFrame( corotating_frame + 1 );
+            setCurrentRotation( corotating_frame + 1, vertical_frame + 1, corotatingToVerticalFrameRotation );
+
             Eigen::Vector3d verticalFrameVelocity =
-                    getRotatingPlanetocentricToLocalVerticalFrameTransformationQuaternion(
-                        currentAerodynamicAngles_.at( longitude_angle ),
-                        currentAerodynamicAngles_.at( latitude_angle ) ) *
-                    currentBodyFixedAirspeedBasedState_.segment( 3, 3 );
-
-            currentAerodynamicAngles_[ heading_angle ] = calculateHeadingAngle( verticalFrameVelocity );
-            currentAerodynamicAngles_[ flight_path_angle ] =
-                    calculateFlightPathAngle( verticalFrameVelocity );
+                    corotatingToVerticalFrameRotation * currentBodyFixedAirspeedBasedState_.segment( 3, 3 );
+
+            setCurrentAerodynamicAngle( heading_angle, calculateHeadingAngle( verticalFrameVelocity ) );
+            setCurrentAerodynamicAngle( flight_path_angle, calculateFlightPathAngle( verticalFrameVelocity ) );
         }
 
         currentTime_ = currentTime;
@@ -158,26 +158,26 @@ void AerodynamicAngleCalculator::update( const double currentTime, const bool up
 
         if( !angleOfAttackFunction_.empty( ) )
         {
-            currentAerodynamicAngles_[ angle_of_attack ] = angleOfAttackFunction_( );
+            setCurrentAerodynamicAngle( angle_of_attack, angleOfAttackFunction_( ) );
         }
 
         if( !angleOfSideslipFunction_.empty( ) )
         {
-            currentAerodynamicAngles_[ angle_of_sideslip ] = angleOfSideslipFunction_( );
+            setCurrentAerodynamicAngle( angle_of_sideslip, angleOfSideslipFunction_( ) );
         }
 
         if( !bankAngleFunction_.empty( ) )
         {
-            currentAerodynamicAngles_[ bank_angle ] = bankAngleFunction_( );
+            setCurrentAerodynamicAngle( bank_angle, bankAngleFunction_( ) );
         }
 
         currentBodyAngleTime_ = currentTime;
     }
     else if( !( currentBodyAngleTime_ == currentTime ) )
     {
-        currentAerodynamicAngles_[ angle_of_attack ] = 0.0;
-        currentAerodynamicAngles_[ angle_of_sideslip ] = 0.0;
-        currentAerodynamicAngles_[ bank_angle ] = 0.0;
+        setCurrentAerodynamicAngle( angle_of_attack, 0.0 );
+        setCurrentAerodynamicAngle( angle_of_sideslip, 0.0 );
+        setCurrentAerodynamicAngle( bank_angle, 0.0 );
     }
 }
 
@@ -187,10 +187,6 @@ Eigen::Quaterniond AerodynamicAngleCalculator::getRotationQuaternionBetweenFrame
         const AerodynamicsReferenceFrames originalFrame,
         const AerodynamicsReferenceFrames targetFrame )
 {
-    // Initialize rotation to identity matrix.
-    Eigen::Quaterniond rotationToFrame = Eigen::Quaterniond( Eigen::Matrix3d::Identity( ) );
-
-
     // Check if update settings are consistent with requested frames.
     if( !calculateVerticalToAerodynamicFrame_ &&
             ( originalFrame > vertical_frame || targetFrame > vertical_frame ) )
@@ -198,171 +194,82 @@ Eigen::Quaterniond AerodynamicAngleCalculator::getRotationQuaternionBetweenFrame
         throw std::runtime_error( "Error in AerodynamicAngleCalculator, instance ends at vertical frame" );
     }
 
-    // Set current frame pair.
-    std::pair< AerodynamicsReferenceFrames, AerodynamicsReferenceFrames > currentRotationPair =
-            std::make_pair( originalFrame, targetFrame );
-
-    // Calculate rotation matrix if current rotation is not yet calculated.
-    if( currentRotationMatrices_.count( currentRotationPair ) == 0 )
+    // Get indices of required frames in rotation cache.
+    int originalFrameIndex = static_cast< int >( originalFrame ) + 1;
+    int targetFrameIndex = static_cast< int >( targetFrame ) + 1;
+    if( originalFrameIndex < 0 || originalFrameIndex >= NUMBER_OF_AERODYNAMIC_REFERENCE_FRAMES ||
+            targetFrameIndex < 0 || targetFrameIndex >= NUMBER_OF_AERODYNAMIC_REFERENCE_FRAMES )
     {
-        // Get indices of required frames.
-        int currentFrameIndex = static_cast< int >( originalFrame );
-        int targetFrameIndex = static_cast< int >( targetFrame );
+        throw std::runtime_error( "Error, frame pair " + std::to_string( originalFrame ) + ", " +
+                                  std::to_string( targetFrame ) + " not found in AerodynamicAngleCalculator" );
+    }
 
-        // Check if any rotation is needed.
-        if( currentFrameIndex != targetFrameIndex )
-        {
-            // Check 'direction' of transformation through AerodynamicsReferenceFrames list.
-            bool isTargetFrameUp;
-            if( targetFrameIndex > currentFrameIndex )
-            {
-                isTargetFrameUp = 1;
-            }
-            else if( targetFrameIndex < currentFrameIndex )
-            {
-                isTargetFrameUp = 0;
-            }
-            else
-            {
-                throw std::runtime_error(
-                            "Error when identifying target frame direction in AerodynamicAngleCalculator." );
+    // Check if any rotation is needed.
+    if( originalFrameIndex == targetFrameIndex )
+    {
+        return Eigen::Quaterniond( Eigen::Matrix3d::Identity( ) );
+    }
 
-            }
+    // Calculate rotation if current rotation is not yet calculated.
+    if( !isCurrentRotationComputed_[ originalFrameIndex ][ targetFrameIndex ] )
+    {
+        // Compose rotation from the upward (i.e. in direction of the body frame) rotations between subsequent frames.
+        int lowerFrameIndex = std::min( originalFrameIndex, targetFrameIndex );
+        int upperFrameIndex = std::max( originalFrameIndex, targetFrameIndex );
 
-            // Add rotation sequence until final frame is reached.
-            while( currentFrameIndex != targetFrameIndex )
+        Eigen::Quaterniond upwardRotation = Eigen::Quaterniond( Eigen::Matrix3d::Identity( ) );
+        for( int currentFrameIndex = lowerFrameIndex; currentFrameIndex < upperFrameIndex; currentFrameIndex++ )
+        {
+            if( !isCurrentRotationComputed_[ currentFrameIndex ][ currentFrameIndex + 1 ] )
             {
-                switch( currentFrameIndex )
-                {
-                case static_cast< int >( inertial_frame ):
-
-                    if( isTargetFrameUp )
-                    {
-                        rotationToFrame = currentRotationFromCorotatingToInertialFrame_.inverse( ) *
-                                rotationToFrame;
-                    }
-                    else
-                    {
-                        throw std::runtime_error(
-                                    "Error, inertial_frame is end frame in AerodynamicAngleCalculator" );
-                    }
-                    break;
-                case static_cast< int >( corotating_frame ):
-
-                    if( isTargetFrameUp )
-                    {
-                        rotationToFrame =
-                                getRotatingPlanetocentricToLocalVerticalFrameTransformationQuaternion(
-                                    currentAerodynamicAngles_.at( longitude_angle ),
-                                    currentAerodynamicAngles_.at( latitude_angle ) ) *
-                                rotationToFrame;
-                    }
-                    else
-                    {
-                        rotationToFrame = currentRotationFromCorotatingToInertialFrame_ *
-                                rotationToFrame;
-                    }
-                    break;
-                case static_cast< int >( vertical_frame ):
-                    if( isTargetFrameUp )
-                    {
-
-                        rotationToFrame =
-                                getLocalVerticalFrameToTrajectoryTransformationQuaternion(
-                                    currentAerodynamicAngles_.at( flight_path_angle ),
-                                    currentAerodynamicAngles_.at( heading_angle ) ) * rotationToFrame;
-                    }
-                    else
-                    {
-                        rotationToFrame =
-                                getLocalVerticalToRotatingPlanetocentricFrameTransformationQuaternion(
-                                    currentAerodynamicAngles_.at( longitude_angle ),
-                                    currentAerodynamicAngles_.at( latitude_angle ) ) *
-                                rotationToFrame;
-                    }
-                    break;
-                case static_cast< int >( trajectory_frame ):
-                    if( isTargetFrameUp )
-                    {
-                        rotationToFrame =
-                                getTrajectoryToAerodynamicFrameTransformationQuaternion(
-                                    currentAerodynamicAngles_.at( bank_angle ) ) *
-                                rotationToFrame;
-
-                    }
-                    else
-                    {
-                        rotationToFrame =
-                                getTrajectoryToLocalVerticalFrameTransformationQuaternion(
-                                    currentAerodynamicAngles_.at( flight_path_angle ),
-                                    currentAerodynamicAngles_.at( heading_angle ) ) *
-                                rotationToFrame;
-                    }
-                    break;
-                case static_cast< int >( aerodynamic_frame ):
-                    if( isTargetFrameUp )
-                    {
-                        rotationToFrame =
-                                getAirspeedBasedAerodynamicToBodyFrameTransformationQuaternion(
-                                    currentAerodynamicAngles_.at( angle_of_attack ),
-                                    currentAerodynamicAngles_.at( angle_of_sideslip ) ) *
-                                rotationToFrame;
-                    }
-                    else
-                    {
-                        rotationToFrame =
-                                getAerodynamicToTrajectoryFrameTransformationQuaternion(
-                                    currentAerodynamicAngles_.at( bank_angle ) ) *
-                                rotationToFrame;
-                    }
-                    break;
-                case static_cast< int >( body_frame ):
-                    if( isTargetFrameUp )
-                    {
-
-                        throw std::runtime_error(
-                                    "Error, body frame is end frame in AerodynamicAngleCalculator." );
-                    }
-                    else
-                    {
-                        rotationToFrame =
-                                getBodyToAirspeedBasedAerodynamicFrameTransformationQuaternion(
-                                    currentAerodynamicAngles_.at( angle_of_attack ),
-                                    currentAerodynamicAngles_.at( angle_of_sideslip ) ) *
-                                rotationToFrame;
-                    }
-                    break;
-                default:
-                    throw std::runtime_error(
-                                "Error, index " +
-                                std::to_string( currentFrameIndex ) +
-                                "not found in AerodynamicAngleCalculator" );
-
-                }
-
-                // Increment/decrement current frame.
-                if( isTargetFrameUp )
-                {
-                    currentFrameIndex++;
-                }
-                else
-                {
-                    currentFrameIndex--;
-                }
+                setCurrentRotation( currentFrameIndex, currentFrameIndex + 1,
+                                    computeRotationToNextFrame( currentFrameIndex ) );
             }
+            upwardRotation = currentRotations_[ currentFrameIndex ][ currentFrameIndex + 1 ] * upwardRotation;
         }
 
         // Set current rotation (as well as inverse).
-        currentRotationMatrices_[ currentRotationPair ] = rotationToFrame;
-        currentRotationMatrices_[ std::make_pair( targetFrame, originalFrame ) ] =
-                rotationToFrame.inverse( );
+        setCurrentRotation( lowerFrameIndex, upperFrameIndex, upwardRotation );
     }
-    else
+
+    return currentRotations_[ originalFrameIndex ][ targetFrameIndex ];
+}
+
+//! Function to compute the rotation from a frame to the next frame in the transformation chain.
+Eigen::Quaterniond AerodynamicAngleCalculator::computeRotationToNextFrame( const int lowerFrameIndex )
+{
+    Eigen::Quaterniond rotationToNextFrame;
+    switch( lowerFrameIndex - 1 )
     {
-        rotationToFrame = currentRotationMatrices_.at( currentRotationPair );
+    case static_cast< int >( inertial_frame ):
+        rotationToNextFrame = currentRotationFromCorotatingToInertialFrame_.inverse( );
+        break;
+    case static_cast< int >( corotating_frame ):
+        rotationToNextFrame = getRotatingPlanetocentricToLocalVerticalFrameTransformationQuaternion(
+                    getCurrentAerodynamicAngle( longitude_angle ),
+                    getCurrentAerodynamicAngle( latitude_angle ) );
+        break;
+    case static_cast< int >( vertical_frame ):
+        rotationToNextFrame = getLocalVerticalFrameToTrajectoryTransformationQuaternion(
+                    getCurrentAerodynamicAngle( flight_path_angle ),
+                    getCurrentAerodynamicAngle( heading_angle ) );
+        break;
+    case static_cast< int >( trajectory_frame ):
+        rotationToNextFrame = getTrajectoryToAerodynamicFrameTransformationQuaternion(
+                    getCurrentAerodynamicAngle( bank_angle ) );
+        break;
+    case static_cast< int >( aerodynamic_frame ):
+        rotationToNextFrame = getAirspeedBasedAerodynamicToBodyFrameTransformationQuaternion(
+                    getCurrentAerodynamicAngle( angle_of_attack ),
+                    getCurrentAerodynamicAngle( angle_of_sideslip ) );
+        break;
+    default:
+        throw std::runtime_error(
+                    "Error, index " +
+                    std::to_string( lowerFrameIndex - 1 ) +
+                    "not found in AerodynamicAngleCalculator" );
     }
-
-    return rotationToFrame;
+    return rotationToNextFrame;
 }
 
 //! Function to get a single orientation angle.
@@ -370,14 +277,14 @@ double AerodynamicAngleCalculator::getAerodynamicAngle(
         const AerodynamicsReferenceFrameAngles angleId )
 {
     double angleValue = TUDAT_NAN;
-    if( currentAerodynamicAngles_.count( angleId ) == 0 )
+    if( angleId < 0 || angleId >= NUMBER_OF_AERODYNAMIC_ANGLES || !isCurrentAerodynamicAngleSet_[ angleId ] )
     {
         throw std::runtime_error( "Error in AerodynamicAngleCalculator, angleId " +
                                   std::to_string( angleId ) + "not found" );
     }
     else
     {
-        angleValue = currentAerodynamicAngles_.at( angleId );
+        angleValue = currentAerodynamicAngles_[ angleId ];
     }
     return angleValue;
 }
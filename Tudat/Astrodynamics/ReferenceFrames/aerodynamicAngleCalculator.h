@@ -11,6 +11,7 @@
 #ifndef TUDAT_AERODYNAMICANGLECALCULATOR_H
 #define TUDAT_AERODYNAMICANGLECALCULATOR_H
 
+#include <algorithm>
 #include <vector>
 #include <map>
 
@@ -47,6 +48,9 @@ enum AerodynamicsReferenceFrames
     body_frame = 4
 };
 
+//! Number of frames in the AerodynamicsReferenceFrames transformation chain.
+static const int NUMBER_OF_AERODYNAMIC_REFERENCE_FRAMES = 6;
+
 //! Function to get a string representing a 'named identification' of a reference frame.
 /*!
  * Function to get a string representing a 'named identification' of a reference frame.
@@ -68,6 +72,9 @@ enum AerodynamicsReferenceFrameAngles
     bank_angle = 6
 };
 
+//! Number of angles in the AerodynamicsReferenceFrameAngles list.
+static const int NUMBER_OF_AERODYNAMIC_ANGLES = 7;
+
 //! Function to get a string representing a 'named identification' of an aerodynamic angle
 /*!
  * Function to get a string representing a 'named identification' of an aerodynamic angle
@@ -119,7 +126,11 @@ public:
         angleOfSideslipFunction_( angleOfSideslipFunction ),
         bankAngleFunction_( bankAngleFunction ),
         angleUpdateFunction_( angleUpdateFunction ),
-        currentBodyAngleTime_( TUDAT_NAN ){ }
+        currentBodyAngleTime_( TUDAT_NAN )
+    {
+        std::fill( isCurrentAerodynamicAngleSet_, isCurrentAerodynamicAngleSet_ + NUMBER_OF_AERODYNAMIC_ANGLES, false );
+        resetCurrentRotations( );
+    }
 
     //! Function to set the atmospheric wind model
     /*!
@@ -182,7 +193,10 @@ public:
     //! Function to get the rotation quaternion between two frames
     /*!
      * Function to get the rotation quaternion between two frames. This function uses the values
-     * calculated by the previous call of the update( ) function.
+     * calculated by the previous call of the update( ) function. Each rotation between two subsequent frames in the
+     * transformation chain, and each requested rotation (as well as its inverse), is computed at most once after each
+     * call to update( ), and only when it is first requested, so that rotations that are not used by any model are
+     * not computed.
      * \param originalFrame Id for 'current' frame
      * \param targetFrame Id for frame to which transformation object should transfrom a vector
      * (from originalFrame).
@@ -291,18 +305,89 @@ public:
 
 private:
 
+    //! Function to set the value of a current angle.
+    /*!
+     * Function to set the value of a current angle.
+     * \param angleId Id of angle that is to be set.
+     * \param angleValue Value of angle.
+     */
+    void setCurrentAerodynamicAngle( const AerodynamicsReferenceFrameAngles angleId, const double angleValue )
+    {
+        currentAerodynamicAngles_[ angleId ] = angleValue;
+        isCurrentAerodynamicAngleSet_[ angleId ] = true;
+    }
+
+    //! Function to retrieve the value of a current angle, checking whether it has been set.
+    /*!
+     * Function to retrieve the value of a current angle, checking whether it has been set.
+     * \param angleId Id of requested angle.
+     * \return Value of requested angle.
+     */
+    double getCurrentAerodynamicAngle( const AerodynamicsReferenceFrameAngles angleId ) const
+    {
+        if( !isCurrentAerodynamicAngleSet_[ angleId ] )
+        {
+            throw std::runtime_error( "Error in AerodynamicAngleCalculator, angle " +
+                                      getAerodynamicAngleName( angleId ) + "not set" );
+        }
+        return currentAerodynamicAngles_[ angleId ];
+    }
+
+    //! Function to signal that all current rotations are to be recomputed when they are next requested.
+    void resetCurrentRotations( )
+    {
+        std::fill( &isCurrentRotationComputed_[ 0 ][ 0 ],
+                   &isCurrentRotationComputed_[ 0 ][ 0 ] +
+                   NUMBER_OF_AERODYNAMIC_REFERENCE_FRAMES * NUMBER_OF_AERODYNAMIC_REFERENCE_FRAMES, false );
+    }
+
+    //! Function to set a current rotation, as well as its inverse.
+    /*!
+     * Function to set a current rotation, as well as its inverse.
+     * \param originalFrameIndex Index in rotation cache of original frame (frame id plus one).
+     * \param targetFrameIndex Index in rotation cache of target frame (frame id plus one).
+     * \param rotation Rotation from original to target frame.
+     */
+    void setCurrentRotation( const int originalFrameIndex, const int targetFrameIndex,
+                             const Eigen::Quaterniond& rotation )
+    {
+        currentRotations_[ originalFrameIndex ][ targetFrameIndex ] = rotation;
+        currentRotations_[ targetFrameIndex ][ originalFrameIndex ] = rotation.conjugate( );
+        isCurrentRotationComputed_[ originalFrameIndex ][ targetFrameIndex ] = true;
+        isCurrentRotationComputed_[ targetFrameIndex ][ originalFrameIndex ] = true;
+    }
+
+    //! Function to compute the rotation from a frame to the next frame in the transformation chain.
+    /*!
+     * Function to compute the rotation from a frame to the next frame in the transformation chain (i.e. from the frame
+     * with id lowerFrameIndex - 1 to the frame with id lowerFrameIndex), from the current angles.
+     * \param lowerFrameIndex Index in rotation cache of original frame (frame id plus one).
+     * \return Rotation from original frame to next frame in the transformation chain.
+     */
+    Eigen::Quaterniond computeRotationToNextFrame( const int lowerFrameIndex );
+
     //! Model that computes the atmospheric wind as a function of position and time
     boost::shared_ptr< aerodynamics::WindModel > windModel_;
 
     //! Shape model of central body, used in computation of altitude that is required for wind calculation
     boost::shared_ptr< basic_astrodynamics::BodyShapeModel > shapeModel_;
 
-    //! Map of current angles, as calculated by previous call to update( ) function.
-    std::map< AerodynamicsReferenceFrameAngles, double > currentAerodynamicAngles_;
+    //! Current angles, as calculated by previous call to update( ) function (indexed by AerodynamicsReferenceFrameAngles).
+    double currentAerodynamicAngles_[ NUMBER_OF_AERODYNAMIC_ANGLES ];
+
+    //! Booleans denoting whether each of the entries of currentAerodynamicAngles_ has been set.
+    bool isCurrentAerodynamicAngleSet_[ NUMBER_OF_AERODYNAMIC_ANGLES ];
+
+    //! Current rotations between frames, as calculated since previous call to update( ) function.
+    /*!
+     *  Current rotations between frames, as calculated since previous call to update( ) function. Entry [i][j] contains
+     *  the rotation from the frame with id i - 1 to the frame with id j - 1 (offset due to inertial_frame = -1), and is
+     *  only valid if the corresponding entry of isCurrentRotationComputed_ is true.
+     */
+    Eigen::Quaterniond currentRotations_[ NUMBER_OF_AERODYNAMIC_REFERENCE_FRAMES ][ NUMBER_OF_AERODYNAMIC_REFERENCE_FRAMES ];
 
-    //! Map of current transformation quaternions, as calculated since previous call to update( ) function.
-    std::map< std::pair< AerodynamicsReferenceFrames, AerodynamicsReferenceFrames >,
-    Eigen::Quaterniond > currentRotationMatrices_;
+    //! Booleans denoting whether each of the entries of currentRotations_ has been computed since the last update.
+    bool isCurrentRotationComputed_[ NUMBER_OF_AERODYNAMIC_REFERENCE_FRAMES ][ NUMBER_OF_AERODYNAMIC_REFERENCE_FRAMES ];
 
     //! Current airspeed-based body-fixed state of vehicle, as set by previous call to update( ).
     Eigen::Vector6d currentBodyFixedAirspeedBasedState_;
@@ -0,0 +1,109 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <stdexcept>
+#include <vector>
+
+#include <boost/bind.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include "Tudat/Basics/parallelLoops.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+//! Function to flag the items in a block, and store the block in which each item is processed.
+void flagItemsInBlock( std::vector< int >& blockIndicesOfItems, std::vector< int >& numberOfBlockCalls,
+                       const unsigned int blockIndex, const unsigned int startIndex, const unsigned int endIndex )
+{
+    numberOfBlockCalls.at( blockIndex )++;
+    for( unsigned int i = startIndex; i < endIndex; i++ )
+    {
+        blockIndicesOfItems.at( i ) = blockIndex;
+    }
+}
+
+//! Function that throws for a given thread index.
+void throwForThreadIndex( const unsigned int failingThreadIndex, std::vector< int >& numberOfThreadCalls,
+                          const unsigned int threadIndex )
+{
+    numberOfThreadCalls.at( threadIndex )++;
+    if( threadIndex == failingThreadIndex )
+    {
+        throw std::runtime_error( "Failure on thread " + std::to_string( threadIndex ) );
+    }
+}
+
+BOOST_AUTO_TEST_SUITE( test_parallel_loops )
+
+//! Test number of threads, and processing of contiguous blocks of items.
+BOOST_AUTO_TEST_CASE( testParallelForBlocks )
+{
+    using namespace utilities;
+
+    BOOST_CHECK_EQUAL( getNumberOfThreadsToUse( 4, 10 ), 4 );
+    BOOST_CHECK_EQUAL( getNumberOfThreadsToUse( 4, 3 ), 3 );
+    BOOST_CHECK_EQUAL( getNumberOfThreadsToUse( 4, 0 ), 1 );
+    BOOST_CHECK( getNumberOfThreadsToUse( 0, 1000 ) >= 1 );
+
+    const unsigned int numberOfItems = 103;
+    for( unsigned int numberOfThreads = 1; numberOfThreads <= 8; numberOfThreads++ )
+    {
+        std::vector< int > blockIndicesOfItems( numberOfItems, -1 );
+        std::vector< int > numberOfBlockCalls( numberOfThreads, 0 );
+        parallelForBlocks( numberOfItems, numberOfThreads,
+                           boost::bind( &flagItemsInBlock, boost::ref( blockIndicesOfItems ),
+                                        boost::ref( numberOfBlockCalls ), _1, _2, _3 ) );
+
+        // Check that each block is processed once, and that blocks are contiguous, ordered and cover all items.
+        for( unsigned int i = 0; i < numberOfThreads; i++ )
+        {
+            BOOST_CHECK_EQUAL( numberOfBlockCalls.at( i ), 1 );
+        }
+        BOOST_CHECK_EQUAL( blockIndicesOfItems.at( 0 ), 0 );
+        BOOST_CHECK_EQUAL( blockIndicesOfItems.at( numberOfItems - 1 ), static_cast< int >( numberOfThreads ) - 1 );
+        for( unsigned int i = 1; i < numberOfItems; i++ )
+        {
+            BOOST_CHECK( blockIndicesOfItems.at( i ) - blockIndicesOfItems.at( i - 1 ) == 0 ||
+                         blockIndicesOfItems.at( i ) - blockIndicesOfItems.at( i - 1 ) == 1 );
+        }
+    }
+}
+
+//! Test forwarding of exceptions from calling thread and other threads.
+BOOST_AUTO_TEST_CASE( testParallelThreadExceptions )
+{
+    using namespace utilities;
+
+    const unsigned int numberOfThreads = 4;
+    for( unsigned int failingThreadIndex = 0; failingThreadIndex < numberOfThreads; failingThreadIndex++ )
+    {
+        std::vector< int > numberOfThreadCalls( numberOfThreads, 0 );
+        BOOST_CHECK_THROW( runOnParallelThreads(
+                               numberOfThreads, boost::bind( &throwForThreadIndex, failingThreadIndex,
+                                                             boost::ref( numberOfThreadCalls ), _1 ) ),
+                           std::runtime_error );
+
+        // Check that all threads have been run to completion before forwarding the exception.
+        for( unsigned int i = 0; i < numberOfThreads; i++ )
+        {
+            BOOST_CHECK_EQUAL( numberOfThreadCalls.at( i ), 1 );
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
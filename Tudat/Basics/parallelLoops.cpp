@@ -0,0 +1,99 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <algorithm>
+#include <exception>
+#include <thread>
+#include <vector>
+
+#include <boost/bind.hpp>
+
+#include "Tudat/Basics/parallelLoops.h"
+
+namespace tudat
+{
+
+namespace utilities
+{
+
+//! Function to run a function for a single thread, storing any exception that is thrown.
+void runThreadFunction( const boost::function< void( const unsigned int ) >& threadFunction,
+                        const unsigned int threadIndex, std::exception_ptr& threadException )
+{
+    try
+    {
+        threadFunction( threadIndex );
+    }
+    catch( ... )
+    {
+        threadException = std::current_exception( );
+    }
+}
+
+//! Function to process a single contiguous block of items, for the block that corresponds to a given thread.
+void processBlockOfItems(
+        const boost::function< void( const unsigned int, const unsigned int, const unsigned int ) >& blockFunction,
+        const unsigned int numberOfItems, const unsigned int numberOfBlocks, const unsigned int blockIndex )
+{
+    blockFunction( blockIndex, ( blockIndex * numberOfItems ) / numberOfBlocks,
+                   ( ( blockIndex + 1 ) * numberOfItems ) / numberOfBlocks );
+}
+
+//! Function to determine the number of threads that is to be used for a given number of tasks.
+unsigned int getNumberOfThreadsToUse( const unsigned int numberOfThreads, const unsigned int numberOfTasks )
+{
+    unsigned int numberOfThreadsToUse = numberOfThreads;
+    if( numberOfThreadsToUse == 0 )
+    {
+        numberOfThreadsToUse = std::thread::hardware_concurrency( );
+    }
+    return std::max( std::min( numberOfThreadsToUse, numberOfTasks ), 1U );
+}
+
+//! Function to run a function on a number of threads, with the calling thread acting as the first thread.
+void runOnParallelThreads( const unsigned int numberOfThreads,
+                           const boost::function< void( const unsigned int ) >& threadFunction )
+{
+    std::vector< std::exception_ptr > threadExceptions( std::max( numberOfThreads, 1U ) );
+    std::vector< std::thread > threads;
+    for( unsigned int i = 1; i < numberOfThreads; i++ )
+    {
+        threads.push_back( std::thread( &runThreadFunction, std::cref( threadFunction ), i,
+                                        std::ref( threadExceptions.at( i ) ) ) );
+    }
+    runThreadFunction( threadFunction, 0, threadExceptions.at( 0 ) );
+    for( unsigned int i = 0; i < threads.size( ); i++ )
+    {
+        threads.at( i ).join( );
+    }
+
+    // Forward any error encountered on any of the threads
+    for( unsigned int i = 0; i < threadExceptions.size( ); i++ )
+    {
+        if( threadExceptions.at( i ) )
+        {
+            std::rethrow_exception( threadExceptions.at( i ) );
+        }
+    }
+}
+
+//! Function to process a range of items in contiguous blocks on parallel threads.
+void parallelForBlocks( const unsigned int numberOfItems, const unsigned int numberOfThreads,
+                        const boost::function< void( const unsigned int, const unsigned int, const unsigned int ) >&
+                        blockFunction )
+{
+    const unsigned int numberOfBlocks = getNumberOfThreadsToUse( numberOfThreads, numberOfItems );
+    runOnParallelThreads( numberOfBlocks, boost::bind( &processBlockOfItems, boost::cref( blockFunction ),
+                                                       numberOfItems, numberOfBlocks, _1 ) );
+}
+
+} // namespace utilities
+
+} // namespace tudat
@@ -0,0 +1,67 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_PARALLEL_LOOPS_H
+#define TUDAT_PARALLEL_LOOPS_H
+
+#include <boost/function.hpp>
+
+namespace tudat
+{
+
+namespace utilities
+{
+
+//! Function to determine the number of threads that is to be used for a given number of tasks.
+/*!
+ *  Function to determine the number of threads that is to be used for a given number of tasks. The requested number of
+ *  threads is limited to the number of tasks, as any additional thread would remain idle, and at least one thread is
+ *  always used.
+ *  \param numberOfThreads Requested number of threads (0 to use the number of concurrent threads supported by the
+ *  hardware).
+ *  \param numberOfTasks Number of tasks that are to be distributed over the threads.
+ *  \return Number of threads that is to be used.
+ */
+unsigned int getNumberOfThreadsToUse( const unsigned int numberOfThreads, const unsigned int numberOfTasks );
+
+//! Function to run a function on a number of threads, with the calling thread acting as the first thread.
+/*!
+ *  Function to run a function on a number of threads, with the calling thread acting as the first thread, and to wait
+ *  for all threads to finish. Any exception thrown by the function (on any of the threads) is forwarded to the caller
+ *  after all threads have finished; if more than one thread throws, the exception of the thread with the lowest index
+ *  is forwarded. The function is called concurrently, so that it must be thread-safe for distinct thread indices.
+ *  \param numberOfThreads Number of threads on which the function is to be run (including the calling thread).
+ *  \param threadFunction Function that is to be run, with the index of the thread (0 for the calling thread) as input.
+ */
+void runOnParallelThreads( const unsigned int numberOfThreads,
+                           const boost::function< void( const unsigned int ) >& threadFunction );
+
+//! Function to process a range of items in contiguous blocks on parallel threads.
+/*!
+ *  Function to process the items [0, numberOfItems) in contiguous blocks of (nearly) equal size, with one block per
+ *  thread, using runOnParallelThreads (so that any exception is forwarded to the caller). Block i contains the items
+ *  [ i * numberOfItems / numberOfBlocks, ( i + 1 ) * numberOfItems / numberOfBlocks ), with the number of blocks given by
+ *  getNumberOfThreadsToUse( numberOfThreads, numberOfItems ). The block function is called concurrently, so that it
+ *  must be thread-safe for distinct blocks.
+ *  \param numberOfItems Number of items that are to be processed.
+ *  \param numberOfThreads Requested number of threads (0 to use the number of concurrent threads supported by the
+ *  hardware).
+ *  \param blockFunction Function that processes a single block, with the index of the block, the index of the first
+ *  item in the block, and the index after the last item in the block as input.
+ */
+void parallelForBlocks( const unsigned int numberOfItems, const unsigned int numberOfThreads,
+                        const boost::function< void( const unsigned int, const unsigned int, const unsigned int ) >&
+                        blockFunction );
+
+} // namespace utilities
+
+} // namespace tudat
+
+#endif // TUDAT_PARALLEL_LOOPS_H
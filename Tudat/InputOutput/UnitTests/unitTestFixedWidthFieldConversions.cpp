@@ -0,0 +1,156 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <cmath>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include "Tudat/InputOutput/basicInputOutput.h"
+#include "Tudat/InputOutput/fixedWidthFieldConversions.h"
+#include "Tudat/InputOutput/textFileBuffer.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+BOOST_AUTO_TEST_SUITE( test_fixed_width_field_conversions )
+
+//! Test conversion of fixed-width fields to floating-point numbers.
+BOOST_AUTO_TEST_CASE( testFixedWidthFieldToDoubleConversion )
+{
+    using input_output::convertFixedWidthFieldToDouble;
+
+    // Check that conversion is identical to std::stod for a range of fields.
+    std::vector< std::string > fields =
+    { "0", "-0.0", "1", "+12.5", "-.00000055", "010.22613693", "  98.7654321  ", "1.0E-12", "-3.25e+05", "6.02214076E23",
+      "123456789012345678901234", "0.1234567890123456789", "2.5E-300", "14.71825687710393", "  -55493", "1e22" };
+    for( unsigned int i = 0; i < fields.size( ); i++ )
+    {
+        double value;
+        BOOST_CHECK( convertFixedWidthFieldToDouble( fields.at( i ).c_str( ), fields.at( i ).size( ), 0,
+                                                     fields.at( i ).size( ), value ) );
+        BOOST_CHECK_EQUAL( value, std::stod( fields.at( i ) ) );
+        BOOST_CHECK_EQUAL( std::signbit( value ), std::signbit( std::stod( fields.at( i ) ) ) );
+    }
+
+    // Check conversion of fields inside a line, including fields extending beyond end of line.
+    std::string line = "1957 10  1 1   18.7  255";
+    double value;
+    BOOST_CHECK( convertFixedWidthFieldToDouble( line.c_str( ), line.size( ), 4, 3, value ) );
+    BOOST_CHECK_EQUAL( value, 10.0 );
+    BOOST_CHECK( convertFixedWidthFieldToDouble( line.c_str( ), line.size( ), 12, 8, value ) );
+    BOOST_CHECK_EQUAL( value, 18.7 );
+    BOOST_CHECK( convertFixedWidthFieldToDouble( line.c_str( ), line.size( ), 20, 10, value ) );
+    BOOST_CHECK_EQUAL( value, 255.0 );
+    BOOST_CHECK( !convertFixedWidthFieldToDouble( line.c_str( ), line.size( ), 12, 3, value ) );
+    BOOST_CHECK_EQUAL( value, 0.0 );
+    BOOST_CHECK( !convertFixedWidthFieldToDouble( line.c_str( ), line.size( ), 30, 4, value ) );
+
+    // Check that invalid fields are rejected.
+    std::vector< std::string > invalidFields = { "1.2.3", "-", "12a", "1 2", "1.0E", "." };
+    for( unsigned int i = 0; i < invalidFields.size( ); i++ )
+    {
+        BOOST_CHECK_THROW( convertFixedWidthFieldToDouble( invalidFields.at( i ).c_str( ), invalidFields.at( i ).size( ),
+                                                           0, invalidFields.at( i ).size( ), value ),
+                           std::runtime_error );
+    }
+}
+
+//! Test conversion of fixed-width fields to integers.
+BOOST_AUTO_TEST_CASE( testFixedWidthFieldToIntegerConversion )
+{
+    using input_output::convertFixedWidthFieldToInteger;
+
+    std::string line = "1 00005U 58002B  -4 +0   ";
+    int value;
+    BOOST_CHECK( convertFixedWidthFieldToInteger( line.c_str( ), line.size( ), 0, 1, value ) );
+    BOOST_CHECK_EQUAL( value, 1 );
+    BOOST_CHECK( convertFixedWidthFieldToInteger( line.c_str( ), line.size( ), 2, 5, value ) );
+    BOOST_CHECK_EQUAL( value, 5 );
+    BOOST_CHECK( convertFixedWidthFieldToInteger( line.c_str( ), line.size( ), 16, 3, value ) );
+    BOOST_CHECK_EQUAL( value, -4 );
+    BOOST_CHECK( convertFixedWidthFieldToInteger( line.c_str( ), line.size( ), 19, 3, value ) );
+    BOOST_CHECK_EQUAL( value, 0 );
+    BOOST_CHECK( !convertFixedWidthFieldToInteger( line.c_str( ), line.size( ), 22, 10, value ) );
+
+    BOOST_CHECK_THROW( convertFixedWidthFieldToInteger( line.c_str( ), line.size( ), 2, 6, value ),
+                       std::runtime_error );
+    BOOST_CHECK_THROW( convertFixedWidthFieldToInteger( "1.5", 3, 0, 3, value ), std::runtime_error );
+    BOOST_CHECK_THROW( convertFixedWidthFieldToInteger( "99999999999", 11, 0, 11, value ), std::runtime_error );
+}
+
+//! Test reading of text file into buffer.
+BOOST_AUTO_TEST_CASE( testTextFileBuffer )
+{
+    std::string filePath = input_output::getTudatRootPath( ) + "InputOutput/UnitTests/testSolarActivity.txt";
+    input_output::TextFileBuffer textFileBuffer( filePath );
+
+    // Compare lines with those read using std::getline.
+    std::ifstream dataFile( filePath.c_str( ) );
+    std::string line;
+    unsigned int lineIndex = 0;
+    while( std::getline( dataFile, line ) )
+    {
+        if( line.size( ) > 0 && line[ line.size( ) - 1 ] == '\r' )
+        {
+            line.erase( line.size( ) - 1 );
+        }
+
+        BOOST_CHECK( lineIndex < textFileBuffer.getNumberOfLines( ) );
+        if( lineIndex < textFileBuffer.getNumberOfLines( ) )
+        {
+            BOOST_CHECK_EQUAL( textFileBuffer.getLineString( lineIndex ), line );
+            BOOST_CHECK_EQUAL( textFileBuffer.getLineLength( lineIndex ), line.size( ) );
+        }
+        lineIndex++;
+    }
+    BOOST_CHECK_EQUAL( textFileBuffer.getNumberOfLines( ), lineIndex );
+
+    BOOST_CHECK( textFileBuffer.doesLineStartWith( 0, textFileBuffer.getLineString( 0 ).substr( 0, 3 ).c_str( ) ) );
+    BOOST_CHECK_THROW( input_output::TextFileBuffer( filePath + ".nonexistent" ), std::runtime_error );
+
+    // Check empty file, and file with Windows end-of-line characters and without final end-of-line character.
+    const std::string temporaryFilePath = ( boost::filesystem::temp_directory_path( ) / boost::filesystem::unique_path(
+                                                "textFileBufferTest-%%%%-%%%%-%%%%.txt" ) ).string( );
+    {
+        std::ofstream temporaryFile( temporaryFilePath.c_str( ), std::ios::binary );
+    }
+    BOOST_CHECK_EQUAL( input_output::TextFileBuffer( temporaryFilePath ).getNumberOfLines( ), 0 );
+
+    {
+        std::ofstream temporaryFile( temporaryFilePath.c_str( ), std::ios::binary );
+        temporaryFile << "first line\r\n\r\n  \t\nlast line";
+    }
+    {
+        input_output::TextFileBuffer temporaryFileBuffer( temporaryFilePath );
+        BOOST_CHECK_EQUAL( temporaryFileBuffer.getNumberOfLines( ), 4 );
+        BOOST_CHECK_EQUAL( temporaryFileBuffer.getLineString( 0 ), "first line" );
+        BOOST_CHECK_EQUAL( temporaryFileBuffer.getLineLength( 1 ), 0 );
+        BOOST_CHECK( temporaryFileBuffer.isLineBlank( 1 ) );
+        BOOST_CHECK( temporaryFileBuffer.isLineBlank( 2 ) );
+        BOOST_CHECK_EQUAL( temporaryFileBuffer.getLineString( 3 ), "last line" );
+        BOOST_CHECK( !temporaryFileBuffer.isLineBlank( 3 ) );
+    }
+    boost::filesystem::remove( temporaryFilePath );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
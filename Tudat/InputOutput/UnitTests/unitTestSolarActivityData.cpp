@@ -30,6 +30,7 @@
 #include "Tudat/InputOutput/parseSolarActivityData.h"
 #include "Tudat/InputOutput/extractSolarActivityData.h"
 #include "Tudat/InputOutput/solarActivityData.h"
+#include "Tudat/InputOutput/solarActivityTable.h"
 #include "Tudat/InputOutput/basicInputOutput.h"
 
 
@@ -183,6 +184,83 @@ BOOST_AUTO_TEST_CASE( test_function_readSolarActivityData )
     }
 }
 
+//! Function to check whether the data in a solar activity table is identical to that in a map of solar activity data.
+void checkSolarActivityTableEquality(
+        const tudat::input_output::solar_activity::SolarActivityTable& solarActivityTable,
+        const tudat::input_output::solar_activity::SolarActivityDataMap& solarActivityMap )
+{
+    using namespace tudat::input_output::solar_activity;
+
+    BOOST_CHECK_EQUAL( solarActivityTable.getNumberOfAvailableDays( ), solarActivityMap.size( ) );
+    BOOST_CHECK_EQUAL( solarActivityTable.getFirstJulianDay( ), solarActivityMap.begin( )->first );
+
+    for( SolarActivityDataMap::const_iterator dataIterator = solarActivityMap.begin( );
+         dataIterator != solarActivityMap.end( ); dataIterator++ )
+    {
+        const SolarActivityTableEntry* entry = solarActivityTable.getEntry( dataIterator->first );
+        BOOST_CHECK( entry != NULL );
+        if( entry == NULL )
+        {
+            continue;
+        }
+
+        const SolarActivityData& data = *dataIterator->second;
+        BOOST_CHECK_EQUAL( entry->year, data.year );
+        BOOST_CHECK_EQUAL( entry->month, data.month );
+        BOOST_CHECK_EQUAL( entry->day, data.day );
+        BOOST_CHECK_EQUAL( entry->bartelsSolarRotationNumber, data.bartelsSolarRotationNumber );
+        BOOST_CHECK_EQUAL( entry->dayOfBartelsCycle, data.dayOfBartelsCycle );
+        BOOST_CHECK_EQUAL( entry->planetaryRangeIndexSum, data.planetaryRangeIndexSum );
+        BOOST_CHECK_EQUAL( entry->planetaryEquivalentAmplitudeAverage, data.planetaryEquivalentAmplitudeAverage );
+        BOOST_CHECK_EQUAL( entry->planetaryDailyCharacterFigure, data.planetaryDailyCharacterFigure );
+        BOOST_CHECK_EQUAL( entry->planetaryDailyCharacterFigureConverted,
+                           data.planetaryDailyCharacterFigureConverted );
+        BOOST_CHECK_EQUAL( entry->internationalSunspotNumber, data.internationalSunspotNumber );
+        BOOST_CHECK_EQUAL( entry->solarRadioFlux107Adjusted, data.solarRadioFlux107Adjusted );
+        BOOST_CHECK_EQUAL( entry->fluxQualifier, data.fluxQualifier );
+        BOOST_CHECK_EQUAL( entry->centered81DaySolarRadioFlux107Adjusted, data.centered81DaySolarRadioFlux107Adjusted );
+        BOOST_CHECK_EQUAL( entry->last81DaySolarRadioFlux107Adjusted, data.last81DaySolarRadioFlux107Adjusted );
+        BOOST_CHECK_EQUAL( entry->solarRadioFlux107Observed, data.solarRadioFlux107Observed );
+        BOOST_CHECK_EQUAL( entry->centered81DaySolarRadioFlux107Observed, data.centered81DaySolarRadioFlux107Observed );
+        BOOST_CHECK_EQUAL( entry->last81DaySolarRadioFlux107Observed, data.last81DaySolarRadioFlux107Observed );
+        BOOST_CHECK_EQUAL( entry->dataType, data.dataType );
+
+        for( unsigned int i = 0; i < 8; i++ )
+        {
+            BOOST_CHECK_EQUAL( entry->planetaryRangeIndices[ i ], data.planetaryRangeIndexVector( i ) );
+            BOOST_CHECK_EQUAL( entry->planetaryEquivalentAmplitudes[ i ], data.planetaryEquivalentAmplitudeVector( i ) );
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE( test_function_readSolarActivityTable )
+{
+    using namespace tudat::input_output::solar_activity;
+
+    // Retrieve path of test files.
+    std::string cppPath( __FILE__ );
+    std::string folder = cppPath.substr( 0, cppPath.find_last_of( "/\\" ) + 1 );
+
+    // Compare table read directly from file, and table created from map, with map of solar activity data.
+    std::vector< std::string > fileNames = { "testSolarActivity.txt", "sw19571001.txt" };
+    for( unsigned int i = 0; i < fileNames.size( ); i++ )
+    {
+        SolarActivityDataMap solarActivityMap = readSolarActivityData( folder + fileNames.at( i ) );
+        SolarActivityTable solarActivityTable = readSolarActivityTable( folder + fileNames.at( i ) );
+
+        checkSolarActivityTableEquality( solarActivityTable, solarActivityMap );
+        checkSolarActivityTableEquality( SolarActivityTable( solarActivityMap ), solarActivityMap );
+    }
+
+    // Check day of the year, and retrieval of days outside of table.
+    SolarActivityTable solarActivityTable = readSolarActivityTable( folder + "testSolarActivity.txt" );
+    double julianDay = tudat::basic_astrodynamics::convertCalendarDateToJulianDay( 1957, 10, 3, 0, 0, 0.0 );
+    BOOST_CHECK_EQUAL( solarActivityTable.getEntry( julianDay )->dayOfTheYear, 276 );
+    BOOST_CHECK( solarActivityTable.getEntry( solarActivityTable.getFirstJulianDay( ) - 1.0 ) == NULL );
+    BOOST_CHECK( solarActivityTable.getEntry( solarActivityTable.getFirstJulianDay( ) +
+                                              solarActivityTable.getNumberOfDays( ) ) == NULL );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }   // unit_tests
@@ -37,6 +37,8 @@
 #include <vector>
 
 #include "Tudat/Astrodynamics/BasicAstrodynamics/stateVectorIndices.h"
+#include "Tudat/InputOutput/basicInputOutput.h"
+#include "Tudat/InputOutput/twoLineElementCatalog.h"
 #include "Tudat/InputOutput/twoLineElementsTextFileReader.h"
 
 namespace tudat
@@ -183,6 +185,97 @@ BOOST_AUTO_TEST_CASE( testTwoLineElementsTextFileReaderForThreeLine )
     BOOST_CHECK_EQUAL( twoLineElementDataAfterIntegrityCheck.at( 2 ).revolutionNumber, 57038 );
 }
 
+//! Test reading of TLE catalog into records, by comparison with TLE text file reader.
+BOOST_AUTO_TEST_CASE( testTwoLineElementCatalog )
+{
+    using input_output::TwoLineElementsTextFileReader;
+    using input_output::TwoLineElementData;
+    using input_output::TwoLineElementRecord;
+
+    std::vector< std::string > fileNames =
+    { "testTwoLineElementsTextFile2Line.txt", "testTwoLineElementsTextFile3Line.txt" };
+    std::vector< TwoLineElementsTextFileReader::LineNumberTypesForTwoLineElementInputData > lineNumberTypes =
+    { TwoLineElementsTextFileReader::twoLineType, TwoLineElementsTextFileReader::threeLineType };
+
+    for( unsigned int i = 0; i < fileNames.size( ); i++ )
+    {
+        // Read TLE data using TLE text file reader.
+        TwoLineElementsTextFileReader twoLineElementsTextFileReader;
+        twoLineElementsTextFileReader.setLineNumberTypeForTwoLineElementInputData( lineNumberTypes.at( i ) );
+        twoLineElementsTextFileReader.setRelativeDirectoryPath( "InputOutput/UnitTests/" );
+        twoLineElementsTextFileReader.setFileName( fileNames.at( i ) );
+        twoLineElementsTextFileReader.openFile( );
+        twoLineElementsTextFileReader.readAndStoreData( );
+        twoLineElementsTextFileReader.closeFile( );
+        twoLineElementsTextFileReader.setCurrentYear( 2011 );
+        twoLineElementsTextFileReader.storeTwoLineElementData( );
+        std::vector< TwoLineElementData > expectedData = twoLineElementsTextFileReader.getTwoLineElementData( );
+        twoLineElementsTextFileReader.checkTwoLineElementsFileIntegrity( );
+        std::vector< TwoLineElementData > expectedValidData = twoLineElementsTextFileReader.getTwoLineElementData( );
+
+        // Read TLE data into records, using one and multiple threads.
+        for( unsigned int numberOfThreads = 1; numberOfThreads <= 4; numberOfThreads += 3 )
+        {
+            std::vector< TwoLineElementRecord > twoLineElementRecords = input_output::readTwoLineElementCatalog(
+                        input_output::getTudatRootPath( ) + "InputOutput/UnitTests/" + fileNames.at( i ), 2011,
+                        ( i == 0 ) ? 2 : 3, numberOfThreads );
+
+            BOOST_CHECK_EQUAL( twoLineElementRecords.size( ), expectedData.size( ) );
+            for( unsigned int j = 0; j < twoLineElementRecords.size( ); j++ )
+            {
+                TwoLineElementData computedData = input_output::createTwoLineElementData(
+                            twoLineElementRecords.at( j ) );
+
+                BOOST_CHECK_EQUAL( computedData.objectNameString, expectedData.at( j ).objectNameString );
+                BOOST_CHECK( computedData.objectName == expectedData.at( j ).objectName );
+                BOOST_CHECK_EQUAL( computedData.lineNumberLine1, expectedData.at( j ).lineNumberLine1 );
+                BOOST_CHECK_EQUAL( computedData.objectIdentificationNumber,
+                                   expectedData.at( j ).objectIdentificationNumber );
+                BOOST_CHECK_EQUAL( computedData.tleClassification, expectedData.at( j ).tleClassification );
+                BOOST_CHECK_EQUAL( computedData.fourDigitlaunchYear, expectedData.at( j ).fourDigitlaunchYear );
+                BOOST_CHECK_EQUAL( computedData.launchNumber, expectedData.at( j ).launchNumber );
+                BOOST_CHECK_EQUAL( computedData.launchPart, expectedData.at( j ).launchPart );
+                BOOST_CHECK_EQUAL( computedData.fourDigitEpochYear, expectedData.at( j ).fourDigitEpochYear );
+                BOOST_CHECK_EQUAL( computedData.epochDay, expectedData.at( j ).epochDay );
+                BOOST_CHECK_EQUAL( computedData.firstDerivativeOfMeanMotionDividedByTwo,
+                                   expectedData.at( j ).firstDerivativeOfMeanMotionDividedByTwo );
+                BOOST_CHECK_EQUAL( computedData.secondDerivativeOfMeanMotionDividedBySix,
+                                   expectedData.at( j ).secondDerivativeOfMeanMotionDividedBySix );
+                BOOST_CHECK_EQUAL( computedData.bStar, expectedData.at( j ).bStar );
+                BOOST_CHECK_EQUAL( computedData.orbitalModel, expectedData.at( j ).orbitalModel );
+                BOOST_CHECK_EQUAL( computedData.tleNumber, expectedData.at( j ).tleNumber );
+                BOOST_CHECK_EQUAL( computedData.modulo10CheckSumLine1, expectedData.at( j ).modulo10CheckSumLine1 );
+                BOOST_CHECK_EQUAL( computedData.lineNumberLine2, expectedData.at( j ).lineNumberLine2 );
+                BOOST_CHECK_EQUAL( computedData.objectIdentificationNumberLine2,
+                                   expectedData.at( j ).objectIdentificationNumberLine2 );
+                for( unsigned int k = 0; k < 5; k++ )
+                {
+                    BOOST_CHECK_EQUAL( computedData.TLEKeplerianElements( k ),
+                                       expectedData.at( j ).TLEKeplerianElements( k ) );
+                }
+                BOOST_CHECK_EQUAL( computedData.meanAnomaly, expectedData.at( j ).meanAnomaly );
+                BOOST_CHECK_EQUAL( computedData.meanMotionInRevolutionsPerDay,
+                                   expectedData.at( j ).meanMotionInRevolutionsPerDay );
+                BOOST_CHECK_EQUAL( computedData.revolutionNumber, expectedData.at( j ).revolutionNumber );
+                BOOST_CHECK_EQUAL( computedData.totalRevolutionNumber, expectedData.at( j ).totalRevolutionNumber );
+                BOOST_CHECK_EQUAL( computedData.modulo10CheckSumLine2, expectedData.at( j ).modulo10CheckSumLine2 );
+                BOOST_CHECK_EQUAL( computedData.perigee, expectedData.at( j ).perigee );
+                BOOST_CHECK_EQUAL( computedData.apogee, expectedData.at( j ).apogee );
+                BOOST_CHECK( computedData.lineNumbers == expectedData.at( j ).lineNumbers );
+            }
+
+            // Check that the same TLEs are identified as corrupted.
+            BOOST_CHECK_EQUAL( input_output::removeCorruptedTwoLineElementRecords( twoLineElementRecords ), 7 );
+            BOOST_CHECK_EQUAL( twoLineElementRecords.size( ), expectedValidData.size( ) );
+            for( unsigned int j = 0; j < twoLineElementRecords.size( ); j++ )
+            {
+                BOOST_CHECK_EQUAL( twoLineElementRecords.at( j ).objectIdentificationNumber,
+                                   expectedValidData.at( j ).objectIdentificationNumber );
+            }
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }   // namespace unit_tests
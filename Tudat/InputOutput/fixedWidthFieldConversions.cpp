@@ -0,0 +1,266 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <algorithm>
+#include <climits>
+#include <cstdlib>
+#include <stdexcept>
+
+#include "Tudat/InputOutput/fixedWidthFieldConversions.h"
+
+namespace tudat
+{
+namespace input_output
+{
+
+//! Maximum number of significant digits for which the mantissa of a field is exactly representable as a double.
+static const int MAXIMUM_NUMBER_OF_EXACT_SIGNIFICANT_DIGITS = 15;
+
+//! Exactly representable powers of ten.
+static const double EXACT_POWERS_OF_TEN[ ] =
+{ 1.0E0, 1.0E1, 1.0E2, 1.0E3, 1.0E4, 1.0E5, 1.0E6, 1.0E7, 1.0E8, 1.0E9, 1.0E10, 1.0E11,
+  1.0E12, 1.0E13, 1.0E14, 1.0E15, 1.0E16, 1.0E17, 1.0E18, 1.0E19, 1.0E20, 1.0E21, 1.0E22 };
+
+//! Function to check whether a character is whitespace.
+inline bool isFieldWhitespace( const char character )
+{
+    return ( character == ' ' || character == '\t' || character == '\r' || character == '\n' );
+}
+
+//! Function to check whether a character is a decimal digit.
+inline bool isFieldDigit( const char character )
+{
+    return ( character >= '0' && character <= '9' );
+}
+
+//! Function to throw an exception for a field that could not be converted.
+void throwFieldConversionError( const char* line, const unsigned int lineLength,
+                                const unsigned int startIndex, const unsigned int width,
+                                const std::string& typeName )
+{
+    throw std::runtime_error( "Error when converting fixed-width field '" +
+                              getFixedWidthFieldString( line, lineLength, startIndex, width ) +
+                              "' (column " + std::to_string( startIndex + 1 ) + ") to " + typeName );
+}
+
+//! Function to retrieve a fixed-width field in a line of text as a string.
+std::string getFixedWidthFieldString( const char* line, const unsigned int lineLength,
+                                      const unsigned int startIndex, const unsigned int width )
+{
+    if( startIndex >= lineLength )
+    {
+        return std::string( );
+    }
+    return std::string( line + startIndex, std::min( width, lineLength - startIndex ) );
+}
+
+//! Function to convert a fixed-width field in a line of text to a floating-point number.
+bool convertFixedWidthFieldToDouble( const char* line, const unsigned int lineLength,
+                                     const unsigned int startIndex, const unsigned int width,
+                                     double& value )
+{
+    value = 0.0;
+
+    const char* fieldEnd = line + std::min( lineLength, startIndex + width );
+    const char* currentCharacter = line + std::min( lineLength, startIndex );
+
+    // Skip leading whitespace.
+    while( currentCharacter < fieldEnd && isFieldWhitespace( *currentCharacter ) )
+    {
+        currentCharacter++;
+    }
+    if( currentCharacter == fieldEnd )
+    {
+        return false;
+    }
+    const char* numberStart = currentCharacter;
+
+    // Parse sign.
+    bool isNegative = false;
+    if( *currentCharacter == '-' || *currentCharacter == '+' )
+    {
+        isNegative = ( *currentCharacter == '-' );
+        currentCharacter++;
+    }
+
+    // Parse digits of mantissa, before and after decimal point, retaining the first 19 significant digits.
+    unsigned long long mantissa = 0;
+    int numberOfSignificantDigits = 0;
+    int decimalExponent = 0;
+    bool isMantissaTruncated = false;
+    bool isDigitFound = false;
+    bool isDecimalPointFound = false;
+    for( ; currentCharacter < fieldEnd; currentCharacter++ )
+    {
+        if( isFieldDigit( *currentCharacter ) )
+        {
+            isDigitFound = true;
+            if( numberOfSignificantDigits < 19 )
+            {
+                mantissa = 10 * mantissa + static_cast< unsigned long long >( *currentCharacter - '0' );
+                if( mantissa > 0 )
+                {
+                    numberOfSignificantDigits++;
+                }
+                if( isDecimalPointFound )
+                {
+                    decimalExponent--;
+                }
+            }
+            else
+            {
+                isMantissaTruncated = true;
+                if( !isDecimalPointFound )
+                {
+                    decimalExponent++;
+                }
+            }
+        }
+        else if( *currentCharacter == '.' && !isDecimalPointFound )
+        {
+            isDecimalPointFound = true;
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    if( !isDigitFound )
+    {
+        throwFieldConversionError( line, lineLength, startIndex, width, "floating-point number" );
+    }
+
+    // Parse exponent.
+    if( currentCharacter < fieldEnd && ( *currentCharacter == 'e' || *currentCharacter == 'E' ) )
+    {
+        currentCharacter++;
+        bool isExponentNegative = false;
+        if( currentCharacter < fieldEnd && ( *currentCharacter == '-' || *currentCharacter == '+' ) )
+        {
+            isExponentNegative = ( *currentCharacter == '-' );
+            currentCharacter++;
+        }
+
+        int exponent = 0;
+        bool isExponentDigitFound = false;
+        while( currentCharacter < fieldEnd && isFieldDigit( *currentCharacter ) )
+        {
+            if( exponent < 100000 )
+            {
+                exponent = 10 * exponent + ( *currentCharacter - '0' );
+            }
+            isExponentDigitFound = true;
+            currentCharacter++;
+        }
+
+        if( !isExponentDigitFound )
+        {
+            throwFieldConversionError( line, lineLength, startIndex, width, "floating-point number" );
+        }
+        decimalExponent += ( isExponentNegative ? -exponent : exponent );
+    }
+    const char* numberEnd = currentCharacter;
+
+    // Check that remainder of field is whitespace.
+    while( currentCharacter < fieldEnd && isFieldWhitespace( *currentCharacter ) )
+    {
+        currentCharacter++;
+    }
+    if( currentCharacter != fieldEnd )
+    {
+        throwFieldConversionError( line, lineLength, startIndex, width, "floating-point number" );
+    }
+
+    // Compute value, using a single exact operation if possible.
+    if( !isMantissaTruncated && numberOfSignificantDigits <= MAXIMUM_NUMBER_OF_EXACT_SIGNIFICANT_DIGITS &&
+            decimalExponent >= -22 && decimalExponent <= 22 )
+    {
+        value = static_cast< double >( mantissa );
+        if( decimalExponent < 0 )
+        {
+            value /= EXACT_POWERS_OF_TEN[ -decimalExponent ];
+        }
+        else
+        {
+            value *= EXACT_POWERS_OF_TEN[ decimalExponent ];
+        }
+
+        if( isNegative )
+        {
+            value = -value;
+        }
+    }
+    else
+    {
+        std::string numberString( numberStart, numberEnd );
+        value = std::strtod( numberString.c_str( ), NULL );
+    }
+
+    return true;
+}
+
+//! Function to convert a fixed-width field in a line of text to an integer.
+bool convertFixedWidthFieldToInteger( const char* line, const unsigned int lineLength,
+                                      const unsigned int startIndex, const unsigned int width,
+                                      int& value )
+{
+    value = 0;
+
+    const char* fieldEnd = line + std::min( lineLength, startIndex + width );
+    const char* currentCharacter = line + std::min( lineLength, startIndex );
+
+    // Skip leading whitespace.
+    while( currentCharacter < fieldEnd && isFieldWhitespace( *currentCharacter ) )
+    {
+        currentCharacter++;
+    }
+    if( currentCharacter == fieldEnd )
+    {
+        return false;
+    }
+
+    // Parse sign and digits.
+    bool isNegative = false;
+    if( *currentCharacter == '-' || *currentCharacter == '+' )
+    {
+        isNegative = ( *currentCharacter == '-' );
+        currentCharacter++;
+    }
+
+    long long absoluteValue = 0;
+    bool isDigitFound = false;
+    while( currentCharacter < fieldEnd && isFieldDigit( *currentCharacter ) )
+    {
+        absoluteValue = 10 * absoluteValue + static_cast< long long >( *currentCharacter - '0' );
+        if( absoluteValue > static_cast< long long >( INT_MAX ) )
+        {
+            throwFieldConversionError( line, lineLength, startIndex, width, "integer (out of range)" );
+        }
+        isDigitFound = true;
+        currentCharacter++;
+    }
+
+    // Check that remainder of field is whitespace.
+    while( currentCharacter < fieldEnd && isFieldWhitespace( *currentCharacter ) )
+    {
+        currentCharacter++;
+    }
+    if( !isDigitFound || currentCharacter != fieldEnd )
+    {
+        throwFieldConversionError( line, lineLength, startIndex, width, "integer" );
+    }
+
+    value = static_cast< int >( isNegative ? -absoluteValue : absoluteValue );
+    return true;
+}
+
+} // namespace input_output
+} // namespace tudat
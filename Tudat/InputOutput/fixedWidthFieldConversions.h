@@ -0,0 +1,72 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_FIXED_WIDTH_FIELD_CONVERSIONS_H
+#define TUDAT_FIXED_WIDTH_FIELD_CONVERSIONS_H
+
+#include <string>
+
+namespace tudat
+{
+namespace input_output
+{
+
+//! Function to convert a fixed-width field in a line of text to a floating-point number.
+/*!
+ * Function to convert a fixed-width field in a line of text to a floating-point number, directly from the characters
+ * in the line (i.e. without creating any intermediate strings). The field may contain leading and trailing whitespace,
+ * a sign, a decimal point and an exponent (e.g. " -1.25E-3"); parts of the field beyond the end of the line are treated
+ * as whitespace. For fields with at most 15 significant digits and a decimal exponent of at most 22 (in absolute
+ * value), the value is computed by a single (exact) multiplication or division, so that the result is identical to
+ * that of std::stod; other fields are converted using std::strtod.
+ * \param line Pointer to first character of the line.
+ * \param lineLength Number of characters in the line.
+ * \param startIndex Index in the line of the first character of the field.
+ * \param width Width (number of characters) of the field.
+ * \param value Value of the field (returned by reference; set to zero if the field is empty).
+ * \return True if the field is not empty.
+ */
+bool convertFixedWidthFieldToDouble( const char* line, const unsigned int lineLength,
+                                     const unsigned int startIndex, const unsigned int width,
+                                     double& value );
+
+//! Function to convert a fixed-width field in a line of text to an integer.
+/*!
+ * Function to convert a fixed-width field in a line of text to an integer, directly from the characters in the line.
+ * The field may contain leading and trailing whitespace and a sign; parts of the field beyond the end of the line are
+ * treated as whitespace.
+ * \param line Pointer to first character of the line.
+ * \param lineLength Number of characters in the line.
+ * \param startIndex Index in the line of the first character of the field.
+ * \param width Width (number of characters) of the field.
+ * \param value Value of the field (returned by reference; set to zero if the field is empty).
+ * \return True if the field is not empty.
+ */
+bool convertFixedWidthFieldToInteger( const char* line, const unsigned int lineLength,
+                                      const unsigned int startIndex, const unsigned int width,
+                                      int& value );
+
+//! Function to retrieve a fixed-width field in a line of text as a string.
+/*!
+ * Function to retrieve a fixed-width field in a line of text as a string (e.g. for error messages), truncated at the end
+ * of the line.
+ * \param line Pointer to first character of the line.
+ * \param lineLength Number of characters in the line.
+ * \param startIndex Index in the line of the first character of the field.
+ * \param width Width (number of characters) of the field.
+ * \return Field as a string.
+ */
+std::string getFixedWidthFieldString( const char* line, const unsigned int lineLength,
+                                      const unsigned int startIndex, const unsigned int width );
+
+} // namespace input_output
+} // namespace tudat
+
+#endif // TUDAT_FIXED_WIDTH_FIELD_CONVERSIONS_H
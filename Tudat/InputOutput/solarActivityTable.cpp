@@ -0,0 +1,300 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Data file:
+ *                        http://celestrak.com/SpaceData/sw19571001.txt
+ *      Data format explanation:
+ *                        http://celestrak.com/SpaceData/SpaceWx-format.asp
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#include "Tudat/Astrodynamics/BasicAstrodynamics/timeConversions.h"
+#include "Tudat/InputOutput/fixedWidthFieldConversions.h"
+#include "Tudat/InputOutput/solarActivityTable.h"
+#include "Tudat/InputOutput/textFileBuffer.h"
+
+namespace tudat
+{
+namespace input_output
+{
+namespace solar_activity
+{
+
+//! Default constructor, sets all fields to zero and marks the entry as not available.
+SolarActivityTableEntry::SolarActivityTableEntry( ):
+    year( 0 ), month( 0 ), day( 0 ), dayOfTheYear( 0 ), bartelsSolarRotationNumber( 0 ), dayOfBartelsCycle( 0 ),
+    planetaryRangeIndexSum( 0 ), planetaryEquivalentAmplitudeAverage( 0 ), planetaryDailyCharacterFigure( 0.0 ),
+    planetaryDailyCharacterFigureConverted( 0 ), internationalSunspotNumber( 0 ), solarRadioFlux107Adjusted( 0.0 ),
+    fluxQualifier( 0 ), centered81DaySolarRadioFlux107Adjusted( 0.0 ), last81DaySolarRadioFlux107Adjusted( 0.0 ),
+    solarRadioFlux107Observed( 0.0 ), centered81DaySolarRadioFlux107Observed( 0.0 ),
+    last81DaySolarRadioFlux107Observed( 0.0 ), dataType( 0 ), isDataAvailable( false )
+{
+    for( unsigned int i = 0; i < 8; i++ )
+    {
+        planetaryRangeIndices[ i ] = 0.0;
+        planetaryEquivalentAmplitudes[ i ] = 0.0;
+    }
+}
+
+//! Constructor from map of solar activity data.
+SolarActivityTable::SolarActivityTable( const SolarActivityDataMap& solarActivityDataMap ):
+    firstJulianDay_( TUDAT_NAN ), numberOfAvailableDays_( 0 )
+{
+    if( solarActivityDataMap.size( ) > 0 )
+    {
+        // Allocate full table at once (map is sorted by Julian day).
+        firstJulianDay_ = solarActivityDataMap.begin( )->first;
+        entries_.resize( static_cast< unsigned int >(
+                             solarActivityDataMap.rbegin( )->first - firstJulianDay_ ) + 1 );
+
+        for( SolarActivityDataMap::const_iterator dataIterator = solarActivityDataMap.begin( );
+             dataIterator != solarActivityDataMap.end( ); dataIterator++ )
+        {
+            setEntry( dataIterator->first, createSolarActivityTableEntry( *dataIterator->second ) );
+        }
+    }
+}
+
+//! Function to set the data of a single day.
+void SolarActivityTable::setEntry( const double julianDay, const SolarActivityTableEntry& entry )
+{
+    // Initialize table if it is empty.
+    if( entries_.size( ) == 0 )
+    {
+        firstJulianDay_ = julianDay;
+    }
+
+    double dayIndex = julianDay - firstJulianDay_;
+    if( !( dayIndex == std::floor( dayIndex ) ) )
+    {
+        throw std::runtime_error( "Error when setting solar activity table entry, Julian day " +
+                                  std::to_string( julianDay ) + " is not an integer number of days from first day " +
+                                  std::to_string( firstJulianDay_ ) );
+    }
+
+    // Extend table at start or end, if needed.
+    if( dayIndex < 0.0 )
+    {
+        entries_.insert( entries_.begin( ), static_cast< unsigned int >( -dayIndex ), SolarActivityTableEntry( ) );
+        firstJulianDay_ = julianDay;
+        dayIndex = 0.0;
+    }
+    else if( dayIndex >= static_cast< double >( entries_.size( ) ) )
+    {
+        entries_.resize( static_cast< unsigned int >( dayIndex ) + 1 );
+    }
+
+    SolarActivityTableEntry& currentEntry = entries_[ static_cast< unsigned int >( dayIndex ) ];
+    if( !currentEntry.isDataAvailable )
+    {
+        numberOfAvailableDays_++;
+    }
+    currentEntry = entry;
+    currentEntry.isDataAvailable = true;
+}
+
+//! Function to compute the day of the year from a calendar date and the associated Julian day.
+static unsigned int computeDayOfTheYear( const unsigned int year, const double julianDay )
+{
+    return static_cast< unsigned int >(
+                julianDay - basic_astrodynamics::convertCalendarDateToJulianDay< double >( year, 1, 1, 0, 0, 0.0 ) ) + 1;
+}
+
+//! Function to create a solar activity table entry from a SolarActivityData object.
+SolarActivityTableEntry createSolarActivityTableEntry( const SolarActivityData& solarActivityData )
+{
+    SolarActivityTableEntry entry;
+    entry.year = solarActivityData.year;
+    entry.month = solarActivityData.month;
+    entry.day = solarActivityData.day;
+    entry.dayOfTheYear = computeDayOfTheYear(
+                entry.year, basic_astrodynamics::convertCalendarDateToJulianDay< double >(
+                    entry.year, entry.month, entry.day, 0, 0, 0.0 ) );
+    entry.bartelsSolarRotationNumber = solarActivityData.bartelsSolarRotationNumber;
+    entry.dayOfBartelsCycle = solarActivityData.dayOfBartelsCycle;
+    for( unsigned int i = 0; i < 8; i++ )
+    {
+        entry.planetaryRangeIndices[ i ] = solarActivityData.planetaryRangeIndexVector( i );
+        entry.planetaryEquivalentAmplitudes[ i ] = solarActivityData.planetaryEquivalentAmplitudeVector( i );
+    }
+    entry.planetaryRangeIndexSum = solarActivityData.planetaryRangeIndexSum;
+    entry.planetaryEquivalentAmplitudeAverage = solarActivityData.planetaryEquivalentAmplitudeAverage;
+    entry.planetaryDailyCharacterFigure = solarActivityData.planetaryDailyCharacterFigure;
+    entry.planetaryDailyCharacterFigureConverted = solarActivityData.planetaryDailyCharacterFigureConverted;
+    entry.internationalSunspotNumber = solarActivityData.internationalSunspotNumber;
+    entry.solarRadioFlux107Adjusted = solarActivityData.solarRadioFlux107Adjusted;
+    entry.fluxQualifier = solarActivityData.fluxQualifier;
+    entry.centered81DaySolarRadioFlux107Adjusted = solarActivityData.centered81DaySolarRadioFlux107Adjusted;
+    entry.last81DaySolarRadioFlux107Adjusted = solarActivityData.last81DaySolarRadioFlux107Adjusted;
+    entry.solarRadioFlux107Observed = solarActivityData.solarRadioFlux107Observed;
+    entry.centered81DaySolarRadioFlux107Observed = solarActivityData.centered81DaySolarRadioFlux107Observed;
+    entry.last81DaySolarRadioFlux107Observed = solarActivityData.last81DaySolarRadioFlux107Observed;
+    entry.dataType = solarActivityData.dataType;
+    entry.isDataAvailable = true;
+    return entry;
+}
+
+//! Function to parse a numerical field at a fixed position in a line of a SpaceWeather data file.
+/*!
+ * Function to parse a numerical field (integer or fixed-point decimal) at a fixed position in a line of a SpaceWeather
+ * data file, directly from the characters in the line (\sa convertFixedWidthFieldToDouble).
+ * \param spaceWeatherFile Buffer containing the SpaceWeather data file.
+ * \param lineIndex Index of line from which the field is to be parsed.
+ * \param startIndex Index of first character of the field.
+ * \param width Width (number of characters) of the field.
+ * \param value Value of the field (returned by reference; set to zero if field is empty).
+ * \return True if the field is not empty.
+ */
+bool parseSpaceWeatherField( const TextFileBuffer& spaceWeatherFile, const unsigned int lineIndex,
+                             const unsigned int startIndex, const unsigned int width, double& value )
+{
+    try
+    {
+        return convertFixedWidthFieldToDouble( spaceWeatherFile.getLine( lineIndex ),
+                                               spaceWeatherFile.getLineLength( lineIndex ), startIndex, width, value );
+    }
+    catch( std::runtime_error& conversionError )
+    {
+        throw std::runtime_error( "Error when parsing space weather data (" + std::string( conversionError.what( ) ) +
+                                  ") in line: " + spaceWeatherFile.getLineString( lineIndex ) );
+    }
+}
+
+//! Function to parse an unsigned integer field at a fixed position in a line of a SpaceWeather data file.
+/*!
+ * Function to parse an unsigned integer field at a fixed position in a line of a SpaceWeather data file
+ * (\sa parseSpaceWeatherField).
+ * \param spaceWeatherFile Buffer containing the SpaceWeather data file.
+ * \param lineIndex Index of line from which the field is to be parsed.
+ * \param startIndex Index of first character of the field.
+ * \param width Width (number of characters) of the field.
+ * \return Value of the field (zero if field is empty).
+ */
+unsigned int parseUnsignedIntegerSpaceWeatherField(
+        const TextFileBuffer& spaceWeatherFile, const unsigned int lineIndex,
+        const unsigned int startIndex, const unsigned int width )
+{
+    double value;
+    parseSpaceWeatherField( spaceWeatherFile, lineIndex, startIndex, width, value );
+    return static_cast< unsigned int >( value );
+}
+
+//! Function that reads a SpaceWeather data file into a solar activity table.
+SolarActivityTable readSolarActivityTable( const std::string& filePath )
+{
+    TextFileBuffer spaceWeatherFile( filePath );
+
+    SolarActivityTable solarActivityTable;
+    SolarActivityTableEntry currentEntry;
+
+    unsigned int dataType = 0;
+    bool isDataBlock = false;
+
+    unsigned int currentYear = 0;
+    double julianDayOnFirstDayOfYear = TUDAT_NAN;
+
+    for( unsigned int lineIndex = 0; lineIndex < spaceWeatherFile.getNumberOfLines( ); lineIndex++ )
+    {
+        // Determine dataType of line (observed/daily predicted/monthly predicted/monthly fit), or end of data block.
+        if( spaceWeatherFile.doesLineStartWith( lineIndex, "BEGIN " ) )
+        {
+            if( spaceWeatherFile.doesLineStartWith( lineIndex, "BEGIN OBSERVED" ) )
+            {
+                dataType = 1;
+            }
+            else if( spaceWeatherFile.doesLineStartWith( lineIndex, "BEGIN DAILY_PREDICTED" ) )
+            {
+                dataType = 2;
+            }
+            else if( spaceWeatherFile.doesLineStartWith( lineIndex, "BEGIN MONTHLY_PREDICTED" ) )
+            {
+                dataType = 3;
+            }
+            else if( spaceWeatherFile.doesLineStartWith( lineIndex, "BEGIN MONTHLY_FIT" ) )
+            {
+                dataType = 4;
+            }
+            else
+            {
+                continue;
+            }
+            isDataBlock = true;
+            continue;
+        }
+        else if( spaceWeatherFile.doesLineStartWith( lineIndex, "END " ) )
+        {
+            isDataBlock = false;
+            continue;
+        }
+
+        if( !isDataBlock || spaceWeatherFile.isLineBlank( lineIndex ) )
+        {
+            continue;
+        }
+
+        // Parse line, using column positions of FORMAT(I4,I3,I3,I5,I3,8I3,I4,8I4,I4,F4.1,I2,I4,F6.1,I2,5F6.1)
+        currentEntry = SolarActivityTableEntry( );
+        currentEntry.year = parseUnsignedIntegerSpaceWeatherField( spaceWeatherFile, lineIndex, 0, 4 );
+        currentEntry.month = parseUnsignedIntegerSpaceWeatherField( spaceWeatherFile, lineIndex, 4, 3 );
+        currentEntry.day = parseUnsignedIntegerSpaceWeatherField( spaceWeatherFile, lineIndex, 7, 3 );
+        currentEntry.bartelsSolarRotationNumber = parseUnsignedIntegerSpaceWeatherField( spaceWeatherFile, lineIndex, 10, 5 );
+        currentEntry.dayOfBartelsCycle = parseUnsignedIntegerSpaceWeatherField( spaceWeatherFile, lineIndex, 15, 3 );
+
+        // Parse geomagnetic indices only if provided (as done by ExtractSolarActivityData)
+        double firstPlanetaryRangeIndex;
+        if( parseSpaceWeatherField( spaceWeatherFile, lineIndex, 18, 3, firstPlanetaryRangeIndex ) )
+        {
+            for( unsigned int i = 0; i < 8; i++ )
+            {
+                parseSpaceWeatherField( spaceWeatherFile, lineIndex, 18 + 3 * i, 3, currentEntry.planetaryRangeIndices[ i ] );
+                parseSpaceWeatherField( spaceWeatherFile, lineIndex, 46 + 4 * i, 4, currentEntry.planetaryEquivalentAmplitudes[ i ] );
+            }
+            currentEntry.planetaryRangeIndexSum = parseUnsignedIntegerSpaceWeatherField( spaceWeatherFile, lineIndex, 42, 4 );
+            currentEntry.planetaryEquivalentAmplitudeAverage = parseUnsignedIntegerSpaceWeatherField( spaceWeatherFile, lineIndex, 78, 4 );
+        }
+
+        if( parseSpaceWeatherField( spaceWeatherFile, lineIndex, 82, 4, currentEntry.planetaryDailyCharacterFigure ) )
+        {
+            currentEntry.planetaryDailyCharacterFigureConverted = parseUnsignedIntegerSpaceWeatherField( spaceWeatherFile, lineIndex, 86, 2 );
+        }
+        currentEntry.internationalSunspotNumber = parseUnsignedIntegerSpaceWeatherField( spaceWeatherFile, lineIndex, 88, 4 );
+        parseSpaceWeatherField( spaceWeatherFile, lineIndex, 92, 6, currentEntry.solarRadioFlux107Adjusted );
+        currentEntry.fluxQualifier = parseUnsignedIntegerSpaceWeatherField( spaceWeatherFile, lineIndex, 98, 2 );
+        parseSpaceWeatherField( spaceWeatherFile, lineIndex, 100, 6, currentEntry.centered81DaySolarRadioFlux107Adjusted );
+        parseSpaceWeatherField( spaceWeatherFile, lineIndex, 106, 6, currentEntry.last81DaySolarRadioFlux107Adjusted );
+        parseSpaceWeatherField( spaceWeatherFile, lineIndex, 112, 6, currentEntry.solarRadioFlux107Observed );
+        parseSpaceWeatherField( spaceWeatherFile, lineIndex, 118, 6, currentEntry.centered81DaySolarRadioFlux107Observed );
+        parseSpaceWeatherField( spaceWeatherFile, lineIndex, 124, 6, currentEntry.last81DaySolarRadioFlux107Observed );
+        currentEntry.dataType = dataType;
+
+        // Compute Julian day and day of the year (Julian day of January 1st is only recomputed for a new year).
+        double julianDay = basic_astrodynamics::convertCalendarDateToJulianDay< double >(
+                    currentEntry.year, currentEntry.month, currentEntry.day, 0, 0, 0.0 );
+        if( currentEntry.year != currentYear )
+        {
+            currentYear = currentEntry.year;
+            julianDayOnFirstDayOfYear = basic_astrodynamics::convertCalendarDateToJulianDay< double >(
+                        currentYear, 1, 1, 0, 0, 0.0 );
+        }
+        currentEntry.dayOfTheYear = static_cast< unsigned int >( julianDay - julianDayOnFirstDayOfYear ) + 1;
+
+        solarActivityTable.setEntry( julianDay, currentEntry );
+    }
+
+    return solarActivityTable;
+}
+
+} // namespace solar_activity
+} // namespace input_output
+} // namespace tudat
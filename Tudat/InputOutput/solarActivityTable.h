@@ -0,0 +1,237 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Data file:
+ *                        http://celestrak.com/SpaceData/sw19571001.txt
+ *      Data format explanation:
+ *                        http://celestrak.com/SpaceData/SpaceWx-format.asp
+ *
+ */
+
+#ifndef TUDAT_SOLAR_ACTIVITY_TABLE_H
+#define TUDAT_SOLAR_ACTIVITY_TABLE_H
+
+#include <string>
+#include <vector>
+
+#include "Tudat/InputOutput/solarActivityData.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+
+namespace tudat
+{
+namespace input_output
+{
+namespace solar_activity
+{
+
+//! Solar activity data of a single day, stored as a flat (fixed-size) record.
+/*!
+ * Solar activity data of a single day, containing the same variables as the SolarActivityData struct (see
+ * http://celestrak.com/SpaceData/SpaceWx-format.asp for details on the variables), but stored without any
+ * dynamically allocated members, so that a list of days can be stored in a single contiguous block of memory.
+ * Fields that are empty in the data file are set to zero.
+ */
+struct SolarActivityTableEntry
+{
+    //! Default constructor, sets all fields to zero and marks the entry as not available.
+    SolarActivityTableEntry( );
+
+    //! Year.
+    unsigned int year;
+
+    //! Month.
+    unsigned int month;
+
+    //! Day.
+    unsigned int day;
+
+    //! Day in the current year (1 for January 1st).
+    unsigned int dayOfTheYear;
+
+    //! Bartels Solar Rotation Number.
+    unsigned int bartelsSolarRotationNumber;
+
+    //! Day within the Bartels 27-day cycle (01-27).
+    unsigned int dayOfBartelsCycle;
+
+    //! Eight 3-hourly planetary range indices (Kp).
+    double planetaryRangeIndices[ 8 ];
+
+    //! Sum of the 8 planetary range indices.
+    unsigned int planetaryRangeIndexSum;
+
+    //! Eight 3-hourly planetary equivalent amplitude indices (Ap).
+    double planetaryEquivalentAmplitudes[ 8 ];
+
+    //! Arithmetic average of the 8 planetary equivalent amplitudes (Ap) indices for the day.
+    unsigned int planetaryEquivalentAmplitudeAverage;
+
+    //! Cp or Planetary Daily Character Figure.
+    double planetaryDailyCharacterFigure;
+
+    //! Conversion of the planetaryDailyCharacterFigure to one digit between 0 and 9.
+    unsigned int planetaryDailyCharacterFigureConverted;
+
+    //! International sunspot number.
+    unsigned int internationalSunspotNumber;
+
+    //! 10.7-cm Solar Radio Flux (F10.7) Adjusted to 1 AU.
+    double solarRadioFlux107Adjusted;
+
+    //! Flux Qualifier (\sa SolarActivityData::fluxQualifier).
+    unsigned int fluxQualifier;
+
+    //! Centered 81-day arithmetic average of F10.7 (adjusted).
+    double centered81DaySolarRadioFlux107Adjusted;
+
+    //! Last 81-day arithmetic average of F10.7 (adjusted).
+    double last81DaySolarRadioFlux107Adjusted;
+
+    //! Observed (unadjusted) value of F10.7.
+    double solarRadioFlux107Observed;
+
+    //! Centered 81-day arithmetic average of F10.7 (observed).
+    double centered81DaySolarRadioFlux107Observed;
+
+    //! Last 81-day arithmetic average of F10.7 (observed).
+    double last81DaySolarRadioFlux107Observed;
+
+    //! Data type of the entry (1: observed, 2: daily predicted, 3: monthly predicted, 4: monthly fit).
+    unsigned int dataType;
+
+    //! Boolean denoting whether data is available for this day.
+    bool isDataAvailable;
+};
+
+//! Table of daily solar activity data, indexed by day.
+/*!
+ * Table of daily solar activity data, stored as a contiguous list of SolarActivityTableEntry records, with one entry
+ * for each day between the first and last day for which data is available. The entry for a given Julian day (or time)
+ * is therefore retrieved by a single index computation, without any search. Days inside the range of the table for
+ * which no data is available (e.g. between the monthly predicted values in a CelesTrak file) are stored as entries that
+ * are marked as not available.
+ */
+class SolarActivityTable
+{
+public:
+
+    //! Constructor, creates an empty table.
+    SolarActivityTable( ): firstJulianDay_( TUDAT_NAN ), numberOfAvailableDays_( 0 ){ }
+
+    //! Constructor from map of solar activity data.
+    /*!
+     * Constructor from map of solar activity data, as created by readSolarActivityData.
+     * \param solarActivityDataMap Solar activity data, with Julian day (at 00:00) as key.
+     */
+    SolarActivityTable( const SolarActivityDataMap& solarActivityDataMap );
+
+    //! Function to set the data of a single day.
+    /*!
+     * Function to set the data of a single day, extending the table if the day is outside of its current range. Any
+     * existing data for the day is overwritten.
+     * \param julianDay Julian day (at 00:00) of the data.
+     * \param entry Solar activity data of the day.
+     */
+    void setEntry( const double julianDay, const SolarActivityTableEntry& entry );
+
+    //! Function to retrieve the data of a single day.
+    /*!
+     * Function to retrieve the data of a single day.
+     * \param julianDay Julian day (at 00:00) for which the data is to be retrieved.
+     * \return Pointer to solar activity data of the day (NULL if no data is available for the day).
+     */
+    const SolarActivityTableEntry* getEntry( const double julianDay ) const
+    {
+        double dayIndex = julianDay - firstJulianDay_;
+        if( !( dayIndex >= 0.0 && dayIndex < static_cast< double >( entries_.size( ) ) ) )
+        {
+            return NULL;
+        }
+
+        const SolarActivityTableEntry& entry = entries_[ static_cast< unsigned int >( dayIndex ) ];
+        return ( entry.isDataAvailable ? &entry : NULL );
+    }
+
+    //! Function to retrieve the Julian day of the first entry in the table.
+    /*!
+     * Function to retrieve the Julian day (at 00:00) of the first entry in the table.
+     * \return Julian day of the first entry in the table (NaN if table is empty).
+     */
+    double getFirstJulianDay( ) const
+    {
+        return firstJulianDay_;
+    }
+
+    //! Function to retrieve the number of days in the table.
+    /*!
+     * Function to retrieve the number of days in the table, including those for which no data is available.
+     * \return Number of days in the table.
+     */
+    unsigned int getNumberOfDays( ) const
+    {
+        return entries_.size( );
+    }
+
+    //! Function to retrieve the number of days in the table for which data is available.
+    /*!
+     * Function to retrieve the number of days in the table for which data is available.
+     * \return Number of days in the table for which data is available.
+     */
+    unsigned int getNumberOfAvailableDays( ) const
+    {
+        return numberOfAvailableDays_;
+    }
+
+    //! Function to retrieve the full list of entries.
+    /*!
+     * Function to retrieve the full list of entries (entry i corresponding to the Julian day firstJulianDay_ + i).
+     * \return Full list of entries.
+     */
+    const std::vector< SolarActivityTableEntry >& getEntries( ) const
+    {
+        return entries_;
+    }
+
+private:
+
+    //! Julian day (at 00:00) of the first entry in the table.
+    double firstJulianDay_;
+
+    //! Contiguous list of entries, one for each day from firstJulianDay_ onwards.
+    std::vector< SolarActivityTableEntry > entries_;
+
+    //! Number of entries for which data is available.
+    unsigned int numberOfAvailableDays_;
+};
+
+//! Function to create a solar activity table entry from a SolarActivityData object.
+/*!
+ * Function to create a solar activity table entry from a SolarActivityData object.
+ * \param solarActivityData Solar activity data of a single day.
+ * \return Solar activity table entry with same data.
+ */
+SolarActivityTableEntry createSolarActivityTableEntry( const SolarActivityData& solarActivityData );
+
+//! Function that reads a SpaceWeather data file into a solar activity table.
+/*!
+ * Function that reads a SpaceWeather data file (in the CelesTrak format, as read by readSolarActivityData) into a
+ * solar activity table. The file is parsed directly, line by line, using the fixed column positions of the format,
+ * without creating intermediate objects for each line or field; this is considerably faster than
+ * readSolarActivityData for the full space weather file.
+ * \param filePath Path of the SpaceWeather data file.
+ * \return Solar activity table with the data in the file.
+ */
+SolarActivityTable readSolarActivityTable( const std::string& filePath );
+
+} // namespace solar_activity
+} // namespace input_output
+} // namespace tudat
+
+#endif // TUDAT_SOLAR_ACTIVITY_TABLE_H
@@ -0,0 +1,99 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <stdexcept>
+
+#include <boost/filesystem.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <boost/make_shared.hpp>
+
+#include "Tudat/InputOutput/textFileBuffer.h"
+
+namespace tudat
+{
+namespace input_output
+{
+
+//! Constructor, maps the file into memory.
+TextFileBuffer::TextFileBuffer( const std::string& filePath ):
+    fileContents_( NULL )
+{
+    using namespace boost::interprocess;
+
+    // Map file into memory (an empty file cannot be mapped, and has no lines).
+    std::size_t fileSize = 0;
+    try
+    {
+        fileSize = static_cast< std::size_t >( boost::filesystem::file_size( filePath ) );
+        if( fileSize > 0 )
+        {
+            fileMapping_ = boost::make_shared< file_mapping >( filePath.c_str( ), read_only );
+            mappedRegion_ = boost::make_shared< mapped_region >( *fileMapping_, read_only );
+            fileContents_ = static_cast< const char* >( mappedRegion_->get_address( ) );
+        }
+    }
+    catch( const boost::filesystem::filesystem_error& caughtException )
+    {
+        throw std::runtime_error( "Error when reading text file, could not open file " + filePath + ": " +
+                                  caughtException.what( ) );
+    }
+    catch( const interprocess_exception& caughtException )
+    {
+        throw std::runtime_error( "Error when reading text file, could not map file " + filePath + ": " +
+                                  caughtException.what( ) );
+    }
+
+    // Determine start and length of each line.
+    const char* bufferStart = fileContents_;
+    const char* bufferEnd = bufferStart + fileSize;
+    const char* currentLineStart = bufferStart;
+    while( currentLineStart < bufferEnd )
+    {
+        const char* currentLineEnd = static_cast< const char* >(
+                    std::memchr( currentLineStart, '\n', bufferEnd - currentLineStart ) );
+        const char* nextLineStart;
+        if( currentLineEnd == NULL )
+        {
+            currentLineEnd = bufferEnd;
+            nextLineStart = bufferEnd;
+        }
+        else
+        {
+            nextLineStart = currentLineEnd + 1;
+        }
+
+        if( currentLineEnd > currentLineStart && *( currentLineEnd - 1 ) == '\r' )
+        {
+            currentLineEnd--;
+        }
+
+        lineStartIndices_.push_back( currentLineStart - bufferStart );
+        lineLengths_.push_back( static_cast< unsigned int >( currentLineEnd - currentLineStart ) );
+        currentLineStart = nextLineStart;
+    }
+}
+
+//! Function to check whether a line is blank.
+bool TextFileBuffer::isLineBlank( const unsigned int lineIndex ) const
+{
+    const char* line = getLine( lineIndex );
+    for( unsigned int i = 0; i < getLineLength( lineIndex ); i++ )
+    {
+        if( !( line[ i ] == ' ' || line[ i ] == '\t' || line[ i ] == '\r' ) )
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace input_output
+} // namespace tudat
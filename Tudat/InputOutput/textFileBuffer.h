@@ -0,0 +1,142 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_TEXT_FILE_BUFFER_H
+#define TUDAT_TEXT_FILE_BUFFER_H
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <boost/shared_ptr.hpp>
+
+namespace boost
+{
+namespace interprocess
+{
+class file_mapping;
+class mapped_region;
+}
+}
+
+namespace tudat
+{
+namespace input_output
+{
+
+//! Class holding the full contents of a text file in a single contiguous buffer, indexed by line.
+/*!
+ * Class holding the full contents of a text file in a single contiguous buffer, into which the file is mapped
+ * (read-only) using Boost.Interprocess. The start and length of each line in the buffer are determined once, when
+ * mapping the file, so that each line can subsequently be accessed directly (as a pointer into the buffer and a
+ * length), without copying it into a separate string. End-of-line characters ("\n", as well as a "\r" preceding it)
+ * are not included in the lines. Since the buffer is not modified, lines may be accessed (and parsed) concurrently from
+ * multiple threads. The file must not be modified while this object (or a copy of it) exists.
+ */
+class TextFileBuffer
+{
+public:
+
+    //! Constructor, maps the file into memory.
+    /*!
+     * Constructor, maps the full file into memory and determines the position of each line.
+     * \param filePath Path of the file that is to be read.
+     */
+    TextFileBuffer( const std::string& filePath );
+
+    //! Function to retrieve the number of lines in the file.
+    /*!
+     * Function to retrieve the number of lines in the file (including empty lines, but excluding an empty last line
+     * following the final end-of-line character).
+     * \return Number of lines in the file.
+     */
+    unsigned int getNumberOfLines( ) const
+    {
+        return lineStartIndices_.size( );
+    }
+
+    //! Function to retrieve a pointer to the first character of a line.
+    /*!
+     * Function to retrieve a pointer to the first character of a line (no range check is performed). Note that the
+     * line is not null-terminated; its length is retrieved by getLineLength.
+     * \param lineIndex Index of the line (starting at 0).
+     * \return Pointer to the first character of the line.
+     */
+    const char* getLine( const unsigned int lineIndex ) const
+    {
+        return fileContents_ + lineStartIndices_[ lineIndex ];
+    }
+
+    //! Function to retrieve the length of a line.
+    /*!
+     * Function to retrieve the length (number of characters, excluding end-of-line characters) of a line.
+     * \param lineIndex Index of the line (starting at 0).
+     * \return Length of the line.
+     */
+    unsigned int getLineLength( const unsigned int lineIndex ) const
+    {
+        return lineLengths_[ lineIndex ];
+    }
+
+    //! Function to retrieve a copy of a line as a string.
+    /*!
+     * Function to retrieve a copy of a line as a string (e.g. for error messages).
+     * \param lineIndex Index of the line (starting at 0).
+     * \return Copy of the line.
+     */
+    std::string getLineString( const unsigned int lineIndex ) const
+    {
+        return std::string( getLine( lineIndex ), getLineLength( lineIndex ) );
+    }
+
+    //! Function to check whether a line starts with a given string.
+    /*!
+     * Function to check whether a line starts with a given string.
+     * \param lineIndex Index of the line (starting at 0).
+     * \param prefix String with which the line is to start.
+     * \return True if the line starts with the given string.
+     */
+    bool doesLineStartWith( const unsigned int lineIndex, const char* prefix ) const
+    {
+        std::size_t prefixLength = std::strlen( prefix );
+        return ( getLineLength( lineIndex ) >= prefixLength &&
+                 std::strncmp( getLine( lineIndex ), prefix, prefixLength ) == 0 );
+    }
+
+    //! Function to check whether a line is blank.
+    /*!
+     * Function to check whether a line is blank, i.e. empty or consisting only of whitespace.
+     * \param lineIndex Index of the line (starting at 0).
+     * \return True if the line is blank.
+     */
+    bool isLineBlank( const unsigned int lineIndex ) const;
+
+private:
+
+    //! Object providing the mapping of the file into memory.
+    boost::shared_ptr< boost::interprocess::file_mapping > fileMapping_;
+
+    //! Region of memory into which the file is mapped (NULL for an empty file).
+    boost::shared_ptr< boost::interprocess::mapped_region > mappedRegion_;
+
+    //! Pointer to the contents of the file in the mapped memory.
+    const char* fileContents_;
+
+    //! Index in fileContents_ of the first character of each line.
+    std::vector< std::size_t > lineStartIndices_;
+
+    //! Length of each line (excluding end-of-line characters).
+    std::vector< unsigned int > lineLengths_;
+};
+
+} // namespace input_output
+} // namespace tudat
+
+#endif // TUDAT_TEXT_FILE_BUFFER_H
@@ -0,0 +1,425 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Space Track. TLE Format, http://www.space-track.org/tle_format.html,
+ *          2004. Last accessed: 5 August, 2011.
+ *      Celestrak (c). NORAD Two-Line Element Set Format,
+ *          http://celestrak.com/NORAD/documentation/tle-fmt.asp, 2004. Last accessed: 5 August,
+ *          2011.
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+
+#include <boost/bind.hpp>
+
+#include "Tudat/Astrodynamics/BasicAstrodynamics/orbitalElementConversions.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/physicalConstants.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/stateVectorIndices.h"
+#include "Tudat/Basics/parallelLoops.h"
+#include "Tudat/InputOutput/fixedWidthFieldConversions.h"
+#include "Tudat/InputOutput/textFileBuffer.h"
+#include "Tudat/InputOutput/twoLineElementCatalog.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+
+namespace tudat
+{
+namespace input_output
+{
+
+//! Default constructor, sets all variables to zero.
+TwoLineElementRecord::TwoLineElementRecord( ):
+    lineNumberLine1( 0 ), objectIdentificationNumber( 0 ), tleClassification( ' ' ), launchYear( 0 ),
+    fourDigitlaunchYear( 0 ), launchNumber( 0 ), epochYear( 0 ), fourDigitEpochYear( 0 ), epochDay( 0.0 ),
+    firstDerivativeOfMeanMotionDividedByTwo( 0.0 ), coefficientOfSecondDerivativeOfMeanMotionDividedBySix( 0.0 ),
+    exponentOfSecondDerivativeOfMeanMotionDividedBySix( 0.0 ), secondDerivativeOfMeanMotionDividedBySix( 0.0 ),
+    coefficientOfBStar( 0.0 ), exponentOfBStar( 0 ), bStar( 0.0 ), orbitalModel( 0 ), tleNumber( 0 ),
+    modulo10CheckSumLine1( 0 ), lineNumberLine2( 0 ), objectIdentificationNumberLine2( 0 ), meanAnomaly( 0.0 ),
+    meanMotionInRevolutionsPerDay( 0.0 ), revolutionNumber( 0 ), totalRevolutionNumber( 0 ),
+    modulo10CheckSumLine2( 0 ), perigee( 0.0 ), apogee( 0.0 ), firstLineNumber( 0 ), numberOfLines( 0 ),
+    integrityErrors( 0 )
+{
+    objectName[ 0 ] = '\0';
+    launchPart[ 0 ] = '\0';
+    for( unsigned int i = 0; i < 6; i++ )
+    {
+        TLEKeplerianElements[ i ] = 0.0;
+    }
+}
+
+//! Function to parse a floating-point field of a TLE line.
+static double parseTwoLineElementField( const char* line, const unsigned int lineLength,
+                                        const unsigned int startIndex, const unsigned int width )
+{
+    double value;
+    convertFixedWidthFieldToDouble( line, lineLength, startIndex, width, value );
+    return value;
+}
+
+//! Function to parse an unsigned integer field of a TLE line.
+static unsigned int parseUnsignedIntegerTwoLineElementField( const char* line, const unsigned int lineLength,
+                                                             const unsigned int startIndex, const unsigned int width )
+{
+    int value;
+    convertFixedWidthFieldToInteger( line, lineLength, startIndex, width, value );
+    if( value < 0 )
+    {
+        throw std::runtime_error( "Error when parsing TLE, field '" +
+                                  getFixedWidthFieldString( line, lineLength, startIndex, width ) +
+                                  "' should not be negative" );
+    }
+    return static_cast< unsigned int >( value );
+}
+
+//! Function to convert a two-digit year of a TLE to a four-digit year.
+static unsigned int convertTwoLineElementYearToFourDigitYear( const unsigned int twoDigitYear )
+{
+    return ( twoDigitYear > 56 ) ? ( twoDigitYear + 1900 ) : ( twoDigitYear + 2000 );
+}
+
+//! Function to compute the modulo-10 checksum of a TLE line.
+/*!
+ * Function to compute the modulo-10 checksum of a TLE line, adding all digits in the first 68 columns (as well as one
+ * for each minus sign, if requested).
+ * \param line Pointer to first character of the line.
+ * \param countMinusSigns Boolean denoting whether minus signs count as one.
+ * \return Modulo-10 checksum of the line.
+ */
+static unsigned int computeTwoLineElementChecksum( const char* line, const bool countMinusSigns )
+{
+    unsigned int checksum = 0;
+    for( unsigned int i = 0; i < 68; i++ )
+    {
+        if( line[ i ] >= '0' && line[ i ] <= '9' )
+        {
+            checksum += static_cast< unsigned int >( line[ i ] - '0' );
+        }
+        else if( countMinusSigns && line[ i ] == '-' )
+        {
+            checksum++;
+        }
+    }
+    return checksum % 10;
+}
+
+//! Function to parse a single TLE into a record.
+void parseTwoLineElementRecord( const char* nameLine, const unsigned int nameLineLength,
+                                const char* line1, const unsigned int line1Length,
+                                const char* line2, const unsigned int line2Length,
+                                const unsigned int currentYear,
+                                TwoLineElementRecord& record )
+{
+    using namespace orbital_element_conversions;
+
+    // Reference: Table 2 in (Vallado, D.A., et al., 2006).
+    const double earthWithWorldGeodeticSystem72GravitationalParameter = 398600.8e9;
+
+    if( line1Length < 69 || line2Length < 69 )
+    {
+        throw std::runtime_error( "Error when parsing TLE, lines should contain at least 69 characters" );
+    }
+
+    record = TwoLineElementRecord( );
+
+    // Line 0: object name.
+    if( nameLine != NULL )
+    {
+        unsigned int nameLength = std::min( nameLineLength, 24u );
+        std::memcpy( record.objectName, nameLine, nameLength );
+        record.objectName[ nameLength ] = '\0';
+    }
+
+    // Line 1 (see reference for the column positions).
+    record.lineNumberLine1 = parseUnsignedIntegerTwoLineElementField( line1, line1Length, 0, 1 );
+    record.objectIdentificationNumber = parseUnsignedIntegerTwoLineElementField( line1, line1Length, 2, 5 );
+    record.tleClassification = line1[ 7 ];
+    record.launchYear = parseUnsignedIntegerTwoLineElementField( line1, line1Length, 9, 2 );
+    record.fourDigitlaunchYear = convertTwoLineElementYearToFourDigitYear( record.launchYear );
+    record.launchNumber = parseUnsignedIntegerTwoLineElementField( line1, line1Length, 11, 3 );
+    std::memcpy( record.launchPart, line1 + 14, 3 );
+    record.launchPart[ 3 ] = '\0';
+    record.epochYear = parseUnsignedIntegerTwoLineElementField( line1, line1Length, 18, 2 );
+    record.fourDigitEpochYear = convertTwoLineElementYearToFourDigitYear( record.epochYear );
+    record.epochDay = parseTwoLineElementField( line1, line1Length, 20, 12 );
+    record.firstDerivativeOfMeanMotionDividedByTwo = parseTwoLineElementField( line1, line1Length, 33, 10 );
+
+    // Apply implied leading decimal point to coefficients of second derivative of mean motion and B*.
+    record.coefficientOfSecondDerivativeOfMeanMotionDividedBySix =
+            parseTwoLineElementField( line1, line1Length, 44, 6 ) / 100000.0;
+    record.exponentOfSecondDerivativeOfMeanMotionDividedBySix = parseTwoLineElementField( line1, line1Length, 50, 2 );
+    record.secondDerivativeOfMeanMotionDividedBySix =
+            record.coefficientOfSecondDerivativeOfMeanMotionDividedBySix *
+            std::pow( 10.0, record.exponentOfSecondDerivativeOfMeanMotionDividedBySix );
+
+    record.coefficientOfBStar = parseTwoLineElementField( line1, line1Length, 53, 6 ) / 100000.0;
+    convertFixedWidthFieldToInteger( line1, line1Length, 59, 2, record.exponentOfBStar );
+    record.bStar = record.coefficientOfBStar * std::pow( 10.0, record.exponentOfBStar );
+
+    record.orbitalModel = parseUnsignedIntegerTwoLineElementField( line1, line1Length, 62, 1 );
+    record.tleNumber = parseUnsignedIntegerTwoLineElementField( line1, line1Length, 64, 4 );
+    record.modulo10CheckSumLine1 = parseUnsignedIntegerTwoLineElementField( line1, line1Length, 68, 1 );
+
+    // Line 2 (see reference for the column positions).
+    record.lineNumberLine2 = parseUnsignedIntegerTwoLineElementField( line2, line2Length, 0, 1 );
+    record.objectIdentificationNumberLine2 = parseUnsignedIntegerTwoLineElementField( line2, line2Length, 2, 5 );
+    record.TLEKeplerianElements[ inclinationIndex ] = parseTwoLineElementField( line2, line2Length, 8, 8 );
+    record.TLEKeplerianElements[ longitudeOfAscendingNodeIndex ] = parseTwoLineElementField( line2, line2Length, 17, 8 );
+    record.TLEKeplerianElements[ eccentricityIndex ] = parseTwoLineElementField( line2, line2Length, 26, 7 ) / 10000000;
+    record.TLEKeplerianElements[ argumentOfPeriapsisIndex ] = parseTwoLineElementField( line2, line2Length, 34, 8 );
+    record.meanAnomaly = parseTwoLineElementField( line2, line2Length, 43, 8 );
+    record.meanMotionInRevolutionsPerDay = parseTwoLineElementField( line2, line2Length, 52, 11 );
+    record.revolutionNumber = parseUnsignedIntegerTwoLineElementField( line2, line2Length, 63, 5 );
+    record.modulo10CheckSumLine2 = parseUnsignedIntegerTwoLineElementField( line2, line2Length, 68, 1 );
+
+    // Calculate the approximate total number of revolutions, as the counter resets to 0 after passing by 99999.
+    int approximateNumberOfRevolutions = record.meanMotionInRevolutionsPerDay *
+            ( static_cast< int >( currentYear ) - static_cast< int >( record.fourDigitlaunchYear ) ) *
+            physical_constants::JULIAN_YEAR_IN_DAYS;
+    int approximateNumberOfRevolutionsRemainder = approximateNumberOfRevolutions % 100000;
+    int lostNumberOfRevolutions = approximateNumberOfRevolutions - approximateNumberOfRevolutionsRemainder;
+    // Check if the counter has been reset after passing 99999 (evaluated in unsigned arithmetic, identical to
+    // TwoLineElementsTextFileReader).
+    const unsigned int revolutionNumber = record.revolutionNumber;
+    if( ( revolutionNumber - approximateNumberOfRevolutionsRemainder ) <=
+            ( approximateNumberOfRevolutionsRemainder + 100000 - revolutionNumber ) )
+    {
+        record.totalRevolutionNumber = lostNumberOfRevolutions + revolutionNumber;
+    }
+    else
+    {
+        record.totalRevolutionNumber = lostNumberOfRevolutions - 100000 + revolutionNumber;
+    }
+
+    if( record.totalRevolutionNumber < 0 )
+    {
+        record.totalRevolutionNumber = revolutionNumber;
+    }
+
+    // Compute semi-major axis, perigee and apogee.
+    double meanMotion = record.meanMotionInRevolutionsPerDay * 2.0 * mathematical_constants::PI /
+            physical_constants::JULIAN_DAY;
+    record.TLEKeplerianElements[ semiMajorAxisIndex ] = convertEllipticalMeanMotionToSemiMajorAxis(
+                meanMotion, earthWithWorldGeodeticSystem72GravitationalParameter );
+    record.perigee = record.TLEKeplerianElements[ semiMajorAxisIndex ] *
+            ( 1.0 - record.TLEKeplerianElements[ eccentricityIndex ] );
+    record.apogee = record.TLEKeplerianElements[ semiMajorAxisIndex ] *
+            ( 1.0 + record.TLEKeplerianElements[ eccentricityIndex ] );
+
+    // Check integrity of TLE.
+    if( record.lineNumberLine1 != 1 )
+    {
+        record.integrityErrors |= incorrect_line1_leading_integer;
+    }
+    if( record.lineNumberLine2 != 2 )
+    {
+        record.integrityErrors |= incorrect_line2_leading_integer;
+    }
+    if( record.tleClassification != 'U' && record.tleClassification != 'C' )
+    {
+        record.integrityErrors |= invalid_tle_classification;
+    }
+    if( record.orbitalModel != 0 )
+    {
+        record.integrityErrors |= incorrect_orbital_model;
+    }
+    if( computeTwoLineElementChecksum( line1, true ) != record.modulo10CheckSumLine1 )
+    {
+        record.integrityErrors |= incorrect_line1_checksum;
+    }
+    if( computeTwoLineElementChecksum( line2, false ) != record.modulo10CheckSumLine2 )
+    {
+        record.integrityErrors |= incorrect_line2_checksum;
+    }
+    if( record.objectIdentificationNumber != record.objectIdentificationNumberLine2 )
+    {
+        record.integrityErrors |= object_identification_number_mismatch;
+    }
+}
+
+//! Function to parse a contiguous chunk of the TLEs in a catalog file.
+/*!
+ * Function to parse a contiguous chunk of the TLEs in a catalog file into the associated entries of a (pre-allocated)
+ * list of records. Any exception that is encountered is stored, so that it can be forwarded by the calling thread.
+ * \param catalogFile Buffer containing the catalog file.
+ * \param dataLineIndices Indices of the (non-blank) lines of the catalog file that contain TLE data.
+ * \param numberOfLinesPerTwoLineElementDatum Number of lines per TLE.
+ * \param currentYear Current year, used to compute the total revolution number.
+ * \param startRecordIndex Index of first record that is to be parsed.
+ * \param endRecordIndex Index of record after the last record that is to be parsed.
+ * \param twoLineElementRecords List of records (returned by reference).
+ */
+void parseTwoLineElementRecords( const TextFileBuffer& catalogFile,
+                                 const std::vector< unsigned int >& dataLineIndices,
+                                 const unsigned int numberOfLinesPerTwoLineElementDatum,
+                                 const unsigned int currentYear,
+                                 const unsigned int startRecordIndex,
+                                 const unsigned int endRecordIndex,
+                                 std::vector< TwoLineElementRecord >& twoLineElementRecords )
+{
+    unsigned int firstLineIndex = 0;
+    try
+    {
+        for( unsigned int i = startRecordIndex; i < endRecordIndex; i++ )
+        {
+            firstLineIndex = dataLineIndices[ numberOfLinesPerTwoLineElementDatum * i ];
+            unsigned int line1Index = dataLineIndices[ numberOfLinesPerTwoLineElementDatum * ( i + 1 ) - 2 ];
+            unsigned int line2Index = dataLineIndices[ numberOfLinesPerTwoLineElementDatum * ( i + 1 ) - 1 ];
+
+            TwoLineElementRecord& currentRecord = twoLineElementRecords[ i ];
+            parseTwoLineElementRecord(
+                        ( numberOfLinesPerTwoLineElementDatum == 3 ) ? catalogFile.getLine( firstLineIndex ) : NULL,
+                        catalogFile.getLineLength( firstLineIndex ),
+                        catalogFile.getLine( line1Index ), catalogFile.getLineLength( line1Index ),
+                        catalogFile.getLine( line2Index ), catalogFile.getLineLength( line2Index ),
+                        currentYear, currentRecord );
+            currentRecord.firstLineNumber = firstLineIndex + 1;
+            currentRecord.numberOfLines = numberOfLinesPerTwoLineElementDatum;
+        }
+    }
+    catch( std::runtime_error& parsingError )
+    {
+        throw std::runtime_error( std::string( parsingError.what( ) ) + " (TLE starting at line " +
+                                  std::to_string( firstLineIndex + 1 ) + ")" );
+    }
+}
+
+//! Function to read a TLE catalog file into a list of records.
+std::vector< TwoLineElementRecord > readTwoLineElementCatalog(
+        const std::string& filePath, const unsigned int currentYear,
+        const unsigned int numberOfLinesPerTwoLineElementDatum,
+        const unsigned int numberOfThreads )
+{
+    if( numberOfLinesPerTwoLineElementDatum != 2 && numberOfLinesPerTwoLineElementDatum != 3 )
+    {
+        throw std::runtime_error( "Error when reading TLE catalog, number of lines per TLE should be 2 or 3, not " +
+                                  std::to_string( numberOfLinesPerTwoLineElementDatum ) );
+    }
+
+    // Read file, and determine lines containing TLE data.
+    TextFileBuffer catalogFile( filePath );
+    std::vector< unsigned int > dataLineIndices;
+    dataLineIndices.reserve( catalogFile.getNumberOfLines( ) );
+    for( unsigned int i = 0; i < catalogFile.getNumberOfLines( ); i++ )
+    {
+        if( !catalogFile.isLineBlank( i ) )
+        {
+            dataLineIndices.push_back( i );
+        }
+    }
+
+    if( dataLineIndices.size( ) % numberOfLinesPerTwoLineElementDatum != 0 )
+    {
+        throw std::runtime_error( "Error when reading TLE catalog " + filePath + ", number of lines (" +
+                                  std::to_string( dataLineIndices.size( ) ) + ") is not a multiple of " +
+                                  std::to_string( numberOfLinesPerTwoLineElementDatum ) );
+    }
+    unsigned int numberOfRecords = dataLineIndices.size( ) / numberOfLinesPerTwoLineElementDatum;
+    std::vector< TwoLineElementRecord > twoLineElementRecords( numberOfRecords );
+
+    // Parse TLEs in contiguous chunks.
+    utilities::parallelForBlocks(
+                numberOfRecords, numberOfThreads,
+                boost::bind( &parseTwoLineElementRecords, boost::cref( catalogFile ), boost::cref( dataLineIndices ),
+                             numberOfLinesPerTwoLineElementDatum, currentYear, _2, _3,
+                             boost::ref( twoLineElementRecords ) ) );
+
+    return twoLineElementRecords;
+}
+
+//! Function to check whether a TLE record is corrupted.
+bool isTwoLineElementRecordCorrupted( const TwoLineElementRecord& twoLineElementRecord )
+{
+    return ( twoLineElementRecord.integrityErrors != 0 );
+}
+
+//! Function to remove all corrupted TLEs from a list of records.
+unsigned int removeCorruptedTwoLineElementRecords( std::vector< TwoLineElementRecord >& twoLineElementRecords )
+{
+    std::vector< TwoLineElementRecord >::iterator newEnd = std::remove_if(
+                twoLineElementRecords.begin( ), twoLineElementRecords.end( ), &isTwoLineElementRecordCorrupted );
+    unsigned int numberOfRemovedRecords = std::distance( newEnd, twoLineElementRecords.end( ) );
+    twoLineElementRecords.erase( newEnd, twoLineElementRecords.end( ) );
+    return numberOfRemovedRecords;
+}
+
+//! Function to create a TwoLineElementData object from a TLE record.
+TwoLineElementData createTwoLineElementData( const TwoLineElementRecord& twoLineElementRecord )
+{
+    TwoLineElementData twoLineElementData;
+
+    // Line 0.
+    if( twoLineElementRecord.numberOfLines == 3 )
+    {
+        twoLineElementData.objectNameString = twoLineElementRecord.objectName;
+
+        std::istringstream nameStream( twoLineElementData.objectNameString );
+        std::string namePart;
+        while( nameStream >> namePart )
+        {
+            twoLineElementData.objectName.push_back( namePart );
+        }
+    }
+
+    // Line 1.
+    twoLineElementData.lineNumberLine1 = twoLineElementRecord.lineNumberLine1;
+    twoLineElementData.objectIdentificationNumber = twoLineElementRecord.objectIdentificationNumber;
+    twoLineElementData.tleClassification = twoLineElementRecord.tleClassification;
+    twoLineElementData.launchYear = twoLineElementRecord.launchYear;
+    twoLineElementData.fourDigitlaunchYear = twoLineElementRecord.fourDigitlaunchYear;
+    twoLineElementData.launchNumber = twoLineElementRecord.launchNumber;
+    twoLineElementData.launchPart = twoLineElementRecord.launchPart;
+    twoLineElementData.epochYear = twoLineElementRecord.epochYear;
+    twoLineElementData.fourDigitEpochYear = twoLineElementRecord.fourDigitEpochYear;
+    twoLineElementData.epochDay = twoLineElementRecord.epochDay;
+    twoLineElementData.firstDerivativeOfMeanMotionDividedByTwo =
+            twoLineElementRecord.firstDerivativeOfMeanMotionDividedByTwo;
+    twoLineElementData.coefficientOfSecondDerivativeOfMeanMotionDividedBySix =
+            twoLineElementRecord.coefficientOfSecondDerivativeOfMeanMotionDividedBySix;
+    twoLineElementData.exponentOfSecondDerivativeOfMeanMotionDividedBySix =
+            twoLineElementRecord.exponentOfSecondDerivativeOfMeanMotionDividedBySix;
+    twoLineElementData.secondDerivativeOfMeanMotionDividedBySix =
+            twoLineElementRecord.secondDerivativeOfMeanMotionDividedBySix;
+    twoLineElementData.coefficientOfBStar = twoLineElementRecord.coefficientOfBStar;
+    twoLineElementData.exponentOfBStar = twoLineElementRecord.exponentOfBStar;
+    twoLineElementData.bStar = twoLineElementRecord.bStar;
+    twoLineElementData.orbitalModel = twoLineElementRecord.orbitalModel;
+    twoLineElementData.tleNumber = twoLineElementRecord.tleNumber;
+    twoLineElementData.modulo10CheckSumLine1 = twoLineElementRecord.modulo10CheckSumLine1;
+
+    // Line 2.
+    twoLineElementData.lineNumberLine2 = twoLineElementRecord.lineNumberLine2;
+    twoLineElementData.objectIdentificationNumberLine2 = twoLineElementRecord.objectIdentificationNumberLine2;
+    for( unsigned int i = 0; i < 6; i++ )
+    {
+        twoLineElementData.TLEKeplerianElements( i ) = twoLineElementRecord.TLEKeplerianElements[ i ];
+    }
+    twoLineElementData.meanAnomaly = twoLineElementRecord.meanAnomaly;
+    twoLineElementData.meanMotionInRevolutionsPerDay = twoLineElementRecord.meanMotionInRevolutionsPerDay;
+    twoLineElementData.revolutionNumber = twoLineElementRecord.revolutionNumber;
+    twoLineElementData.totalRevolutionNumber = twoLineElementRecord.totalRevolutionNumber;
+    twoLineElementData.modulo10CheckSumLine2 = twoLineElementRecord.modulo10CheckSumLine2;
+    twoLineElementData.perigee = twoLineElementRecord.perigee;
+    twoLineElementData.apogee = twoLineElementRecord.apogee;
+
+    // Line numbers in input file.
+    for( unsigned int i = 0; i < twoLineElementRecord.numberOfLines; i++ )
+    {
+        twoLineElementData.lineNumbers.push_back( twoLineElementRecord.firstLineNumber + i );
+    }
+
+    return twoLineElementData;
+}
+
+} // namespace input_output
+} // namespace tudat
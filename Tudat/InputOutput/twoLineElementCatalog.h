@@ -0,0 +1,224 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Space Track. TLE Format, http://www.space-track.org/tle_format.html,
+ *          2004. Last accessed: 5 August, 2011.
+ *      Celestrak (c). NORAD Two-Line Element Set Format,
+ *          http://celestrak.com/NORAD/documentation/tle-fmt.asp, 2004. Last accessed: 5 August,
+ *          2011.
+ *
+ */
+
+#ifndef TUDAT_TWO_LINE_ELEMENT_CATALOG_H
+#define TUDAT_TWO_LINE_ELEMENT_CATALOG_H
+
+#include <string>
+#include <vector>
+
+#include "Tudat/InputOutput/twoLineElementData.h"
+
+namespace tudat
+{
+namespace input_output
+{
+
+//! Flags denoting the integrity errors that may be detected in a TLE.
+/*!
+ * Flags denoting the integrity errors that may be detected in a TLE (combined as a bitmask in
+ * TwoLineElementRecord::integrityErrors), corresponding to the checks performed by
+ * TwoLineElementsTextFileReader::checkTwoLineElementsFileIntegrity.
+ */
+enum TwoLineElementIntegrityErrors
+{
+    incorrect_line1_leading_integer = 1,
+    incorrect_line2_leading_integer = 2,
+    invalid_tle_classification = 4,
+    incorrect_orbital_model = 8,
+    incorrect_line1_checksum = 16,
+    incorrect_line2_checksum = 32,
+    object_identification_number_mismatch = 64
+};
+
+//! TLE data of a single object, stored as a flat (fixed-size) record.
+/*!
+ * TLE data of a single object, containing the same variables as the TwoLineElementData struct (see the references for
+ * details on the variables), but stored without any dynamically allocated members, so that a full catalog can be
+ * stored in a single contiguous block of memory.
+ */
+struct TwoLineElementRecord
+{
+    //! Default constructor, sets all variables to zero.
+    TwoLineElementRecord( );
+
+    //! Object name (line 0 of a three-line TLE, null-terminated, at most 24 characters; empty for a two-line TLE).
+    char objectName[ 25 ];
+
+    //! Line number of line 1 (always 1).
+    unsigned int lineNumberLine1;
+
+    //! Object identfication number, range 0 to 99999.
+    unsigned int objectIdentificationNumber;
+
+    //! TLE classification, U is unclassified.
+    char tleClassification;
+
+    //! Launch year, two digits, 57-99 (1900s) and 00-56 (2000s).
+    unsigned int launchYear;
+
+    //! Launch year, four digits.
+    unsigned int fourDigitlaunchYear;
+
+    //! Launch number of above launch year, range 0 to 999.
+    unsigned int launchNumber;
+
+    //! Part/piece/fragment of the launch, range AAA - ZZZ (null-terminated, three characters).
+    char launchPart[ 4 ];
+
+    //! TLE epoch year, two digits, 57-99 (1900s) and 00-56 (2000s).
+    unsigned int epochYear;
+
+    //! TLE epoch year, four digits.
+    unsigned int fourDigitEpochYear;
+
+    //! Epoch day of the year.
+    double epochDay;
+
+    //! First derivative of the mean motion divided by two, in revolutions per day squared.
+    double firstDerivativeOfMeanMotionDividedByTwo;
+
+    //! Coefficient of scientific notation of the second derivative of the mean motion divided by six.
+    double coefficientOfSecondDerivativeOfMeanMotionDividedBySix;
+
+    //! Exponent of scientific notation of the second derivative of the mean motion divided by six.
+    double exponentOfSecondDerivativeOfMeanMotionDividedBySix;
+
+    //! Second derivative of the mean motion divided by six, in revolutions per day cubed.
+    double secondDerivativeOfMeanMotionDividedBySix;
+
+    //! Coefficient of scientific notation of B* (bStar) drag term.
+    double coefficientOfBStar;
+
+    //! Exponent of scientific notation of B* (bStar) drag term.
+    int exponentOfBStar;
+
+    //! B* (bStar) drag term, in units of inverse Earth radius.
+    double bStar;
+
+    //! Orbital model, always '0' nowadays (SGP4/SDP4).
+    unsigned int orbitalModel;
+
+    //! TLE number, range 0 to 9999.
+    unsigned int tleNumber;
+
+    //! Modulo-10 checksum of line 1, as given in the TLE.
+    unsigned int modulo10CheckSumLine1;
+
+    //! Line number of line 2 (always 2).
+    unsigned int lineNumberLine2;
+
+    //! Object identification number of line 2, same as the one of line 1.
+    unsigned int objectIdentificationNumberLine2;
+
+    //! TLE Keplerian elements (indexed as in orbital_element_conversions; angles in degrees, true anomaly is not set).
+    double TLEKeplerianElements[ 6 ];
+
+    //! Mean anomaly, range between 0 and 360 degrees.
+    double meanAnomaly;
+
+    //! Mean motion, in revolutions per day.
+    double meanMotionInRevolutionsPerDay;
+
+    //! Revolution number of the object, range 0 to 99999.
+    unsigned int revolutionNumber;
+
+    //! Total revolution number calculated with mean motion.
+    int totalRevolutionNumber;
+
+    //! Modulo-10 checksum of line 2, as given in the TLE.
+    unsigned int modulo10CheckSumLine2;
+
+    //! Perigee of the object, calculated from the other TLE variables.
+    double perigee;
+
+    //! Apogee of the object, calculated from the other TLE variables.
+    double apogee;
+
+    //! Line number (starting at 1) in the input file of the first line of the TLE.
+    unsigned int firstLineNumber;
+
+    //! Number of lines of the TLE in the input file (2 or 3).
+    unsigned int numberOfLines;
+
+    //! Integrity errors detected in the TLE (combination of TwoLineElementIntegrityErrors flags; 0 if none).
+    unsigned int integrityErrors;
+};
+
+//! Function to parse a single TLE into a record.
+/*!
+ * Function to parse a single TLE into a record, directly from the characters in the lines (using the fixed column
+ * positions of the format) without creating any intermediate strings, and performing the same computations and
+ * integrity checks as the TwoLineElementsTextFileReader class.
+ * \param nameLine Pointer to first character of the line containing the object name (NULL for a two-line TLE).
+ * \param nameLineLength Length of the line containing the object name.
+ * \param line1 Pointer to first character of line 1 of the TLE.
+ * \param line1Length Length of line 1 of the TLE (must be at least 69).
+ * \param line2 Pointer to first character of line 2 of the TLE.
+ * \param line2Length Length of line 2 of the TLE (must be at least 69).
+ * \param currentYear Current year, used to compute the total revolution number.
+ * \param record Record that is to be filled (returned by reference).
+ */
+void parseTwoLineElementRecord( const char* nameLine, const unsigned int nameLineLength,
+                                const char* line1, const unsigned int line1Length,
+                                const char* line2, const unsigned int line2Length,
+                                const unsigned int currentYear,
+                                TwoLineElementRecord& record );
+
+//! Function to read a TLE catalog file into a list of records.
+/*!
+ * Function to read a TLE catalog file into a contiguous list of records. The file is read into memory in a single
+ * operation, after which each TLE is parsed directly from the file contents (see parseTwoLineElementRecord). Blank lines
+ * are ignored. Since the TLEs are independent, the parsing can be distributed over multiple threads, each parsing a
+ * contiguous chunk of the catalog (which is beneficial for large catalogs only). Corrupted TLEs are not removed from the
+ * list; they can be identified by their integrityErrors (see removeCorruptedTwoLineElementRecords).
+ * \param filePath Path of the TLE catalog file.
+ * \param currentYear Current year, used to compute the total revolution number.
+ * \param numberOfLinesPerTwoLineElementDatum Number of lines per TLE (2 or 3, where the first line of a three-line TLE
+ * contains the object name).
+ * \param numberOfThreads Number of threads that is to be used (if 0, the number of hardware threads is used).
+ * \return List of TLE records, in the order of the file.
+ */
+std::vector< TwoLineElementRecord > readTwoLineElementCatalog(
+        const std::string& filePath, const unsigned int currentYear,
+        const unsigned int numberOfLinesPerTwoLineElementDatum = 3,
+        const unsigned int numberOfThreads = 1 );
+
+//! Function to remove all corrupted TLEs from a list of records.
+/*!
+ * Function to remove all corrupted TLEs (i.e. with non-zero integrityErrors) from a list of records, retaining the
+ * order of the other records.
+ * \param twoLineElementRecords List of TLE records, from which corrupted records are removed (returned by reference).
+ * \return Number of removed records.
+ */
+unsigned int removeCorruptedTwoLineElementRecords( std::vector< TwoLineElementRecord >& twoLineElementRecords );
+
+//! Function to create a TwoLineElementData object from a TLE record.
+/*!
+ * Function to create a TwoLineElementData object from a TLE record, for use with existing code using this type. Note
+ * that the original strings of the TLE (TwoLineElementData::twoLineElementStrings) are not stored in the record,
+ * and are therefore not set.
+ * \param twoLineElementRecord TLE record.
+ * \return TwoLineElementData object with the data of the record.
+ */
+TwoLineElementData createTwoLineElementData( const TwoLineElementRecord& twoLineElementRecord );
+
+} // namespace input_output
+} // namespace tudat
+
+#endif // TUDAT_TWO_LINE_ELEMENT_CATALOG_H
@@ -64,6 +64,37 @@ void to_json( nlohmann::json& jsonObject, const boost::shared_ptr< AtmosphereSet
         // If not a NRLMSISE00AtmosphereSettings, it is a AtmosphereSettings with default space weather file.
         return;
     }
+    case tabulated_nrlmsise00:
+    {
+        boost::shared_ptr< TabulatedNRLMSISE00AtmosphereSettings > tabulatedNrlmsise00AtmosphereSettings =
+                boost::dynamic_pointer_cast< TabulatedNRLMSISE00AtmosphereSettings >( atmosphereSettings );
+        assertNonNullPointer( tabulatedNrlmsise00AtmosphereSettings );
+        if ( ! tabulatedNrlmsise00AtmosphereSettings->getSpaceWeatherFile( ).empty( ) )
+        {
+            jsonObject[ K::spaceWeatherFile ] =
+                    boost::filesystem::path( tabulatedNrlmsise00AtmosphereSettings->getSpaceWeatherFile( ) );
+        }
+        if ( ! tabulatedNrlmsise00AtmosphereSettings->getTableCacheFile( ).empty( ) )
+        {
+            jsonObject[ K::tableCacheFile ] =
+                    boost::filesystem::path( tabulatedNrlmsise00AtmosphereSettings->getTableCacheFile( ) );
+        }
+        jsonObject[ K::independentVariableGrid ] = tabulatedNrlmsise00AtmosphereSettings->getIndependentVariableGrid( );
+        jsonObject[ K::dayOfTheYear ] = tabulatedNrlmsise00AtmosphereSettings->getDayOfTheYear( );
+        assignIfNotNaN( jsonObject, K::maximumRelativeDensityError,
+                        tabulatedNrlmsise00AtmosphereSettings->getMaximumRelativeDensityError( ) );
+        return;
+    }
+    case multi_dimensional_tabulated_atmosphere:
+    {
+        boost::shared_ptr< MultiDimensionalTabulatedAtmosphereSettings > multiDimensionalAtmosphereSettings =
+                boost::dynamic_pointer_cast< MultiDimensionalTabulatedAtmosphereSettings >( atmosphereSettings );
+        assertNonNullPointer( multiDimensionalAtmosphereSettings );
+        jsonObject[ K::file ] = boost::filesystem::path( multiDimensionalAtmosphereSettings->getAtmosphereTableFile( ) );
+        jsonObject[ K::specificGasConstant ] = multiDimensionalAtmosphereSettings->getSpecificGasConstant( );
+        jsonObject[ K::ratioOfSpecificHeats ] = multiDimensionalAtmosphereSettings->getRatioOfSpecificHeats( );
+        return;
+    }
     default:
         handleUnimplementedEnumValue( atmosphereType, atmosphereTypes, unsupportedAtmosphereTypes );
     }
@@ -107,6 +138,29 @@ void from_json( const nlohmann::json& jsonObject, boost::shared_ptr< AtmosphereS
         }
         return;
     }
+    case tabulated_nrlmsise00:
+    {
+        TabulatedNRLMSISE00AtmosphereSettings defaults;
+        atmosphereSettings = boost::make_shared< TabulatedNRLMSISE00AtmosphereSettings >(
+                    getValue( jsonObject, K::spaceWeatherFile,
+                              boost::filesystem::path( defaults.getSpaceWeatherFile( ) ) ).string( ),
+                    getValue( jsonObject, K::tableCacheFile,
+                              boost::filesystem::path( defaults.getTableCacheFile( ) ) ).string( ),
+                    getValue( jsonObject, K::independentVariableGrid, defaults.getIndependentVariableGrid( ) ),
+                    getValue( jsonObject, K::dayOfTheYear, defaults.getDayOfTheYear( ) ),
+                    getValue( jsonObject, K::maximumRelativeDensityError,
+                              defaults.getMaximumRelativeDensityError( ) ) );
+        return;
+    }
+    case multi_dimensional_tabulated_atmosphere:
+    {
+        MultiDimensionalTabulatedAtmosphereSettings defaults( "" );
+        atmosphereSettings = boost::make_shared< MultiDimensionalTabulatedAtmosphereSettings >(
+                    getValue< boost::filesystem::path >( jsonObject, K::file ).string( ),
+                    getValue( jsonObject, K::specificGasConstant, defaults.getSpecificGasConstant( ) ),
+                    getValue( jsonObject, K::ratioOfSpecificHeats, defaults.getRatioOfSpecificHeats( ) ) );
+        return;
+    }
     default:
         handleUnimplementedEnumValue( atmosphereType, atmosphereTypes, unsupportedAtmosphereTypes );
     }
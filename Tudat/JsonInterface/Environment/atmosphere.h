@@ -26,7 +26,9 @@ static std::map< AtmosphereTypes, std::string > atmosphereTypes =
 {
     { exponential_atmosphere, "exponential" },
     { tabulated_atmosphere, "tabulated" },
-    { nrlmsise00, "nrlmsise00" }
+    { nrlmsise00, "nrlmsise00" },
+    { tabulated_nrlmsise00, "tabulatedNrlmsise00" },
+    { multi_dimensional_tabulated_atmosphere, "multiDimensionalTabulated" }
 };
 
 //! `AtmosphereTypes` not supported by `json_interface`.
@@ -46,6 +46,20 @@ void to_json( nlohmann::json& jsonObject, const boost::shared_ptr< RotationModel
     }
     case spice_rotation_model:
         return;
+#if USE_SOFA
+    case gcrs_to_itrs_rotation_model:
+    {
+        boost::shared_ptr< GcrsToItrsRotationModelSettings > gcrsToItrsRotationModelSettings =
+                boost::dynamic_pointer_cast< GcrsToItrsRotationModelSettings >( rotationModelSettings );
+        assertNonNullPointer( gcrsToItrsRotationModelSettings );
+        jsonObject[ K::nutationTheory ] = gcrsToItrsRotationModelSettings->getNutationTheory( );
+        jsonObject[ K::eopFile ] = gcrsToItrsRotationModelSettings->getEopFile( );
+        jsonObject[ K::inputTimeScale ] = gcrsToItrsRotationModelSettings->getInputTimeScale( );
+        assignIfNotNull( jsonObject, K::anglesInterpolation,
+                         gcrsToItrsRotationModelSettings->getAnglesInterpolationSettings( ) );
+        return;
+    }
+#endif
     default:
         handleUnimplementedEnumValue( rotationModelType, rotationModelTypes, unsupportedRotationModelTypes );
     }
@@ -94,6 +108,22 @@ void from_json( const nlohmann::json& jsonObject, boost::shared_ptr< RotationMod
                     rotationModelType, originalFrame, targetFrame );
         return;
     }
+#if USE_SOFA
+    case gcrs_to_itrs_rotation_model:
+    {
+        GcrsToItrsRotationModelSettings defaults;
+        rotationModelSettings = boost::make_shared< GcrsToItrsRotationModelSettings >(
+                    getValue( jsonObject, K::nutationTheory, defaults.getNutationTheory( ) ),
+                    getValue( jsonObject, K::eopFile, defaults.getEopFile( ) ),
+                    originalFrame,
+                    targetFrame,
+                    getValue( jsonObject, K::inputTimeScale, defaults.getInputTimeScale( ) ),
+                    defaults.getUt1CorrectionSettings( ),
+                    defaults.getPolarMotionCorrectionSettings( ),
+                    getValue( jsonObject, K::anglesInterpolation, defaults.getAnglesInterpolationSettings( ) ) );
+        return;
+    }
+#endif
     default:
         handleUnimplementedEnumValue( rotationModelType, rotationModelTypes, unsupportedRotationModelTypes );
     }
@@ -14,10 +14,59 @@
 #include "Tudat/SimulationSetup/EnvironmentSetup/createRotationModel.h"
 #include "Tudat/JsonInterface/Support/valueAccess.h"
 #include "Tudat/JsonInterface/Support/valueConversions.h"
+#include "Tudat/JsonInterface/Mathematics/interpolation.h"
 
 namespace tudat
 {
 
+namespace basic_astrodynamics
+{
+
+//! Map of `IAUConventions` string representations.
+static std::map< IAUConventions, std::string > iauConventions =
+{
+    { iau_2000_a, "iau2000a" },
+    { iau_2000_b, "iau2000b" },
+    { iau_2006, "iau2006" }
+};
+
+//! Convert `IAUConventions` to `json`.
+inline void to_json( nlohmann::json& jsonObject, const IAUConventions& iauConvention )
+{
+    jsonObject = json_interface::stringFromEnum( iauConvention, iauConventions );
+}
+
+//! Convert `json` to `IAUConventions`.
+inline void from_json( const nlohmann::json& jsonObject, IAUConventions& iauConvention )
+{
+    iauConvention = json_interface::enumFromString( jsonObject, iauConventions );
+}
+
+//! Map of `TimeScales` string representations.
+static std::map< TimeScales, std::string > timeScales =
+{
+    { tai_scale, "tai" },
+    { tt_scale, "tt" },
+    { tdb_scale, "tdb" },
+    { utc_scale, "utc" },
+    { ut1_scale, "ut1" }
+};
+
+//! Convert `TimeScales` to `json`.
+inline void to_json( nlohmann::json& jsonObject, const TimeScales& timeScale )
+{
+    jsonObject = json_interface::stringFromEnum( timeScale, timeScales );
+}
+
+//! Convert `json` to `TimeScales`.
+inline void from_json( const nlohmann::json& jsonObject, TimeScales& timeScale )
+{
+    timeScale = json_interface::enumFromString( jsonObject, timeScales );
+}
+
+} // namespace basic_astrodynamics
+
+
 namespace simulation_setup
 {
 
@@ -25,7 +74,8 @@ namespace simulation_setup
 static std::map< RotationModelType, std::string > rotationModelTypes =
 {
     { simple_rotation_model, "simple" },
-    { spice_rotation_model, "spice" }
+    { spice_rotation_model, "spice" },
+    { gcrs_to_itrs_rotation_model, "gcrsToItrs" }
 };
 
 //! `RotationModelType`s not supported by `json_interface`.
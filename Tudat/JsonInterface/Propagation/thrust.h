@@ -30,14 +30,16 @@ static std::map< ThrustDirectionGuidanceTypes, std::string > thrustDirectionType
     { colinear_with_state_segment_thrust_direction, "colinearWithStateSegment" },
     { thrust_direction_from_existing_body_orientation, "fromExistingBodyOrientation" },
     { custom_thrust_direction, "customDirection" },
-    { custom_thrust_orientation, "customOrientation" }
+    { custom_thrust_orientation, "customOrientation" },
+    { thrust_direction_from_segment_table, "fromSegmentTable" }
 };
 
 //! `ThrustDirectionGuidanceTypes` not supported by `json_interface`.
 static std::vector< ThrustDirectionGuidanceTypes > unsupportedThrustDirectionTypes =
 {
     custom_thrust_direction,
-    custom_thrust_orientation
+    custom_thrust_orientation,
+    thrust_direction_from_segment_table
 };
 
 //! Convert `ThrustDirectionGuidanceTypes` to `json`.
@@ -70,14 +72,16 @@ static std::map< ThrustMagnitudeTypes, std::string > thrustMagnitudeTypes =
     { constant_thrust_magnitude, "constant" },
     { from_engine_properties_thrust_magnitude, "fromEngineProperties" },
     { thrust_magnitude_from_time_function, "timeDependent" },
-    { thrust_magnitude_from_dependent_variables, "variableDependent" }
+    { thrust_magnitude_from_dependent_variables, "variableDependent" },
+    { thrust_magnitude_from_segment_table, "segmentTable" }
 };
 
 //! `ThrustMagnitudeTypes` not supported by `json_interface`.
 static std::vector< ThrustMagnitudeTypes > unsupportedThrustMagnitudeTypes =
 {
     thrust_magnitude_from_time_function,
-    thrust_magnitude_from_dependent_variables
+    thrust_magnitude_from_dependent_variables,
+    thrust_magnitude_from_segment_table
 };
 
 //! Convert `ThrustMagnitudeTypes` to `json`.
@@ -139,6 +139,11 @@ const std::string Keys::Body::Atmosphere::densityAtZeroAltitude = "densityAtZero
 const std::string Keys::Body::Atmosphere::specificGasConstant = "specificGasConstant";
 const std::string Keys::Body::Atmosphere::file = "file";
 const std::string Keys::Body::Atmosphere::spaceWeatherFile = "spaceWeatherFile";
+const std::string Keys::Body::Atmosphere::tableCacheFile = "tableCacheFile";
+const std::string Keys::Body::Atmosphere::independentVariableGrid = "independentVariableGrid";
+const std::string Keys::Body::Atmosphere::dayOfTheYear = "dayOfTheYear";
+const std::string Keys::Body::Atmosphere::maximumRelativeDensityError = "maximumRelativeDensityError";
+const std::string Keys::Body::Atmosphere::ratioOfSpecificHeats = "ratioOfSpecificHeats";
 
 // //  Body::Ephemeris
 const std::string Keys::Body::ephemeris = "ephemeris";
@@ -196,6 +201,10 @@ const std::string Keys::Body::RotationModel::targetFrame = "targetFrame";
 const std::string Keys::Body::RotationModel::initialOrientation = "initialOrientation";
 const std::string Keys::Body::RotationModel::initialTime = "initialTime";
 const std::string Keys::Body::RotationModel::rotationRate = "rotationRate";
+const std::string Keys::Body::RotationModel::nutationTheory = "nutationTheory";
+const std::string Keys::Body::RotationModel::eopFile = "eopFile";
+const std::string Keys::Body::RotationModel::inputTimeScale = "inputTimeScale";
+const std::string Keys::Body::RotationModel::anglesInterpolation = "anglesInterpolation";
 
 // //  Body::ShapeModel
 const std::string Keys::Body::shapeModel = "shapeModel";
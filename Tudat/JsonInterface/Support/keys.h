@@ -135,6 +135,11 @@ struct Keys
             static const std::string specificGasConstant;
             static const std::string file;
             static const std::string spaceWeatherFile;
+            static const std::string tableCacheFile;
+            static const std::string independentVariableGrid;
+            static const std::string dayOfTheYear;
+            static const std::string maximumRelativeDensityError;
+            static const std::string ratioOfSpecificHeats;
         };
 
         static const std::string ephemeris;
@@ -190,6 +195,10 @@ struct Keys
             static const std::string initialOrientation;
             static const std::string initialTime;
             static const std::string rotationRate;
+            static const std::string nutationTheory;
+            static const std::string eopFile;
+            static const std::string inputTimeScale;
+            static const std::string anglesInterpolation;
         };
 
         static const std::string shapeModel;
@@ -111,6 +111,51 @@ BOOST_AUTO_TEST_CASE( test_json_atmosphere_nrlmsise00_custom )
     BOOST_CHECK_EQUAL_JSON( fromFileSettings, manualSettings );
 }
 
+// Test 6: Tabulated NRLMSISE00 atmosphere
+BOOST_AUTO_TEST_CASE( test_json_atmosphere_tabulated_nrlmsise00 )
+{
+    using namespace simulation_setup;
+    using namespace json_interface;
+
+    // Create AtmosphereSettings from JSON file
+    const boost::shared_ptr< AtmosphereSettings > fromFileSettings =
+            parseJSONFile< boost::shared_ptr< AtmosphereSettings > >( INPUT( "tabulated_nrlmsise00" ) );
+
+    // Create AtmosphereSettings manually
+    const std::vector< std::vector< double > > independentVariableGrid =
+    {
+        { 100.0E3, 200.0E3, 300.0E3 },
+        { -1.0, 0.0, 1.0 },
+        { 0.0, 12.0, 24.0 },
+        { 100.0, 200.0 },
+        { 4.0, 40.0 }
+    };
+    const boost::shared_ptr< AtmosphereSettings > manualSettings =
+            boost::make_shared< TabulatedNRLMSISE00AtmosphereSettings >(
+                "spaceWeatherFile.foo", "tableCacheFile.foo", independentVariableGrid, 172, 0.05 );
+
+    // Compare
+    BOOST_CHECK_EQUAL_JSON( fromFileSettings, manualSettings );
+}
+
+// Test 7: Multi-dimensional tabulated atmosphere
+BOOST_AUTO_TEST_CASE( test_json_atmosphere_multi_dimensional_tabulated )
+{
+    using namespace simulation_setup;
+    using namespace json_interface;
+
+    // Create AtmosphereSettings from JSON file
+    const boost::shared_ptr< AtmosphereSettings > fromFileSettings =
+            parseJSONFile< boost::shared_ptr< AtmosphereSettings > >( INPUT( "multi_dimensional_tabulated" ) );
+
+    // Create AtmosphereSettings manually
+    const boost::shared_ptr< AtmosphereSettings > manualSettings =
+            boost::make_shared< MultiDimensionalTabulatedAtmosphereSettings >( "atmosphereTable.foo", 191.0, 1.33 );
+
+    // Compare
+    BOOST_CHECK_EQUAL_JSON( fromFileSettings, manualSettings );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
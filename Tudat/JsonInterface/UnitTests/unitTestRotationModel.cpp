@@ -86,6 +86,32 @@ BOOST_AUTO_TEST_CASE( test_json_rotationModel_spice )
     BOOST_CHECK_EQUAL_JSON( fromFileSettings, manualSettings );
 }
 
+#if USE_SOFA
+// Test 4: GCRS to ITRS rotation model with interpolated Earth orientation angles
+BOOST_AUTO_TEST_CASE( test_json_rotationModel_gcrsToItrs )
+{
+    using namespace simulation_setup;
+    using namespace json_interface;
+
+    // Create RotationModelSettings from JSON file
+    const boost::shared_ptr< RotationModelSettings > fromFileSettings =
+            parseJSONFile< boost::shared_ptr< RotationModelSettings > >( INPUT( "gcrsToItrs" ) );
+
+    // Create RotationModelSettings manually
+    GcrsToItrsRotationModelSettings defaults;
+    const boost::shared_ptr< RotationModelSettings > manualSettings =
+            boost::make_shared< GcrsToItrsRotationModelSettings >(
+                basic_astrodynamics::iau_2000_b, defaults.getEopFile( ), "GCRS", "ITRS",
+                basic_astrodynamics::utc_scale,
+                defaults.getUt1CorrectionSettings( ), defaults.getPolarMotionCorrectionSettings( ),
+                boost::make_shared< ModelInterpolationSettings >(
+                    0.0, 86400.0, 3600.0, boost::make_shared< interpolators::LagrangeInterpolatorSettings >( 8 ) ) );
+
+    // Compare
+    BOOST_CHECK_EQUAL_JSON( fromFileSettings, manualSettings );
+}
+#endif
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
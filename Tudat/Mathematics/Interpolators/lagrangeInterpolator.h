@@ -57,8 +57,6 @@ class LagrangeInterpolator : public OneDimensionalInterpolator< IndependentVaria
 public:
 
     //! Using statements to prevent having to put 'this' everywhere in the code.
-    using OneDimensionalInterpolator< IndependentVariableType, DependentVariableType >::dependentValues_;
-    using OneDimensionalInterpolator< IndependentVariableType, DependentVariableType >::independentValues_;
     using OneDimensionalInterpolator< IndependentVariableType, DependentVariableType >::lookUpScheme_;
     using Interpolator< IndependentVariableType, DependentVariableType >::interpolate;
 
@@ -83,7 +81,8 @@ public:
                           const AvailableLookupScheme selectedLookupScheme = huntingAlgorithm,
                           const LagrangeInterpolatorBoundaryHandling boundaryHandling =
             lagrange_cubic_spline_boundary_interpolation ):
-        numberOfStages_( numberOfStages ), boundaryHandling_( boundaryHandling )
+        numberOfStages_( numberOfStages ), selectedLookupScheme_( selectedLookupScheme ),
+        boundaryHandling_( boundaryHandling )
     {
         if( numberOfStages_ % 2 != 0 )
         {
@@ -92,25 +91,26 @@ public:
         }
 
         // Set data vectors.
-        independentValues_ = independentVariables;
-        dependentValues_ = dependentVariables;
-        numberOfIndependentValues_ = static_cast< int >( independentValues_.size( ) );
+        sharedIndependentValues_ =
+                boost::make_shared< const std::vector< IndependentVariableType > >( independentVariables );
+        sharedDependentValues_ = boost::make_shared< const std::vector< DependentVariableType > >( dependentVariables );
+        numberOfIndependentValues_ = static_cast< int >( independentVariables.size( ) );
 
         // Check if data is in ascending order
-        if( !std::is_sorted( independentValues_.begin( ), independentValues_.end( ) ) )
+        if( !std::is_sorted( independentVariables.begin( ), independentVariables.end( ) ) )
         {
             throw std::runtime_error( "Error when making lagrange interpolator, input vector with independent variables should be in ascending order" );
         }
 
         // Verify that the initialization variables are not empty.
-        if ( numberOfIndependentValues_ == 0 || dependentValues_.size( ) == 0 )
+        if ( numberOfIndependentValues_ == 0 || dependentVariables.size( ) == 0 )
         {
             throw std::runtime_error(
                 "Error: Vectors used in the Lagrange interpolator initialization are empty." );
         }
 
         // Check consistency of input data.
-        if( static_cast< int >( dependentValues_.size( ) ) != numberOfIndependentValues_ )
+        if( static_cast< int >( dependentVariables.size( ) ) != numberOfIndependentValues_ )
         {
             throw std::runtime_error(
                 "Error: indep. and dep. variables incompatible in Lagrange interpolator." );
@@ -125,12 +125,12 @@ public:
         }
 
         // Create lookup scheme from independent variable values.
-        this->makeLookupScheme( selectedLookupScheme );
+        this->makeLookupScheme( selectedLookupScheme_, sharedIndependentValues_ );
 
         // Calculate denominators for each interval, to prevent recalculations dueint each
         // interpolation call.
         initializeDenominators( );
-        initializeBoundaryInterpolators( selectedLookupScheme );
+        initializeBoundaryInterpolators( );
 
         // Pre-allocate cache vector for computational efficiency.
         independentVariableDifferenceCache.resize( 2 * offsetEntries_ + 2 );
@@ -156,7 +156,8 @@ public:
             const AvailableLookupScheme selectedLookupScheme = huntingAlgorithm,
             const LagrangeInterpolatorBoundaryHandling boundaryHandling =
             lagrange_cubic_spline_boundary_interpolation ):
-        numberOfStages_( numberOfStages ), boundaryHandling_( boundaryHandling )
+        numberOfStages_( numberOfStages ), selectedLookupScheme_( selectedLookupScheme ),
+        boundaryHandling_( boundaryHandling )
     {
         if( numberOfStages_ % 2 != 0 )
         {
@@ -174,15 +175,23 @@ public:
         }
 
         // Fill data vectors with data from map.
+        boost::shared_ptr< std::vector< IndependentVariableType > > independentValues =
+                boost::make_shared< std::vector< IndependentVariableType > >( );
+        boost::shared_ptr< std::vector< DependentVariableType > > dependentValues =
+                boost::make_shared< std::vector< DependentVariableType > >( );
+        independentValues->reserve( dataMap.size( ) );
+        dependentValues->reserve( dataMap.size( ) );
         for( typename std::map< IndependentVariableType, DependentVariableType >::const_iterator
              mapIterator = dataMap.begin( ); mapIterator != dataMap.end( ); mapIterator++ )
         {
-            independentValues_.push_back( mapIterator->first );
-            dependentValues_.push_back( mapIterator->second );
+            independentValues->push_back( mapIterator->first );
+            dependentValues->push_back( mapIterator->second );
         }
+        sharedIndependentValues_ = independentValues;
+        sharedDependentValues_ = dependentValues;
 
         // Define zero entry for dependent variable.
-        zeroEntry_ = dependentValues_[ 0 ] - dependentValues_[ 0 ];
+        zeroEntry_ = dependentValues->at( 0 ) - dependentValues->at( 0 );
         if( zeroEntry_ != zeroEntry_ )
         {
             throw std::runtime_error(
@@ -190,12 +199,12 @@ public:
         }
 
         // Create lookup scheme from independent variable data points.
-        this->makeLookupScheme( selectedLookupScheme );
+        this->makeLookupScheme( selectedLookupScheme_, sharedIndependentValues_ );
 
         // Calculate denominators for each interval, to prevent recalculations dueint each
         //interpolation call.
         initializeDenominators( );
-        initializeBoundaryInterpolators( selectedLookupScheme );
+        initializeBoundaryInterpolators( );
 
         independentVariableDifferenceCache.resize( 2 * offsetEntries_ + 2 );
     }
@@ -223,11 +232,15 @@ public:
     {
         using std::pow;
 
-        if( targetIndependentVariableValue < independentValues_.at( 0 ) ||
-                targetIndependentVariableValue > independentValues_.at( independentValues_.size( ) -1 ) )
+        const std::vector< IndependentVariableType >& independentValues = *sharedIndependentValues_;
+        const std::vector< DependentVariableType >& dependentValues = *sharedDependentValues_;
+        const std::vector< std::vector< ScalarType > >& denominators = *sharedDenominators_;
+
+        if( targetIndependentVariableValue < independentValues.at( 0 ) ||
+                targetIndependentVariableValue > independentValues.at( independentValues.size( ) -1 ) )
         {
             std::cout << "Warning in Lagrange interpolation, outside range " <<
-                       independentValues_.at( 0 ) << " " << independentValues_.at( independentValues_.size( ) -1 ) << " " <<
+                       independentValues.at( 0 ) << " " << independentValues.at( independentValues.size( ) -1 ) << " " <<
                        targetIndependentVariableValue << std::endl;
         }
         // Determine the lower entry in the table corresponding to the target independent variable
@@ -273,17 +286,17 @@ public:
                     mathematical_constants::getFloatingInteger< ScalarType >( 1 );
 
             // Check if requested independent variable is equal to data point
-            if( independentValues_[ lowerEntry ] == targetIndependentVariableValue )
+            if( independentValues[ lowerEntry ] == targetIndependentVariableValue )
             {
-                interpolatedValue = dependentValues_[ lowerEntry ];
+                interpolatedValue = dependentValues[ lowerEntry ];
             }
-            else if( independentValues_[ lowerEntry + 1 ] == targetIndependentVariableValue )
+            else if( independentValues[ lowerEntry + 1 ] == targetIndependentVariableValue )
             {
-                interpolatedValue = dependentValues_[ lowerEntry + 1 ];
+                interpolatedValue = dependentValues[ lowerEntry + 1 ];
             }
-            else if( independentValues_[ lowerEntry - 1 ] == targetIndependentVariableValue )
+            else if( independentValues[ lowerEntry - 1 ] == targetIndependentVariableValue )
             {
-                interpolatedValue = dependentValues_[ lowerEntry - 1 ];
+                interpolatedValue = dependentValues[ lowerEntry - 1 ];
             }
             else
             {
@@ -295,7 +308,7 @@ public:
                     j = i + lowerEntry - offsetEntries_;
                     independentVariableDifferenceCache[ i ] =
                             static_cast< ScalarType >(
-                                targetIndependentVariableValue - independentValues_[ j ] );
+                                targetIndependentVariableValue - independentValues[ j ] );
 
                     repeatedNumerator *= independentVariableDifferenceCache[ i ];
 
@@ -305,7 +318,7 @@ public:
                 for( int i = 0; i <=  2 *offsetEntries_ + 1; i++ )
                 {
                     j = i + lowerEntry - offsetEntries_;
-                    interpolatedValue += dependentValues_[ j ]  *
+                    interpolatedValue += dependentValues[ j ]  *
                             ( repeatedNumerator /
                               ( independentVariableDifferenceCache[ i ] *
                                 denominators[ lowerEntry ][ j - lowerEntry + offsetEntries_ ] ) );
@@ -326,6 +339,45 @@ public:
         return numberOfStages_;
     }
 
+    //! Function to return the vector with independent variables used by the interpolator.
+    /*!
+     *  Function to return the vector with independent variables used by the interpolator.
+     *  \return Independent variables used by the interpolator.
+     */
+    std::vector< IndependentVariableType > getIndependentValues( )
+    {
+        return *sharedIndependentValues_;
+    }
+
+    //! Function to return the vector with dependent variables used by the interpolator.
+    /*!
+     *  Function to return the vector with dependent variables used by the interpolator.
+     *  \return Dependent variables used by the interpolator.
+     */
+    std::vector< DependentVariableType > getDependentValues( )
+    {
+        return *sharedDependentValues_;
+    }
+
+    //! Function to create a copy of the interpolator that can be used independently of this object.
+    /*!
+     *  Function to create a copy of the interpolator that can be used independently of this object (e.g. on a different
+     *  thread). The independent and dependent variables, as well as the pre-computed denominators, are shared with
+     *  (not copied from) this object, as they are not modified after construction. Only the look-up scheme, the
+     *  (small) boundary interpolators and the evaluation cache are created anew for the copy.
+     *  \return Copy of the interpolator that can be used independently of this object.
+     */
+    boost::shared_ptr< OneDimensionalInterpolator< IndependentVariableType, DependentVariableType > >
+    createIndependentCopy( )
+    {
+        boost::shared_ptr< LagrangeInterpolator< IndependentVariableType, DependentVariableType, ScalarType > >
+                interpolatorCopy = boost::make_shared<
+                LagrangeInterpolator< IndependentVariableType, DependentVariableType, ScalarType > >( *this );
+        interpolatorCopy->makeLookupScheme( selectedLookupScheme_, sharedIndependentValues_ );
+        interpolatorCopy->initializeBoundaryInterpolators( );
+        return interpolatorCopy;
+    }
+
 
 protected:
 
@@ -355,8 +407,11 @@ private:
         offsetEntries_ = numberOfStages_ / 2 - 1;
 
         // Iterate over all intervals and calculate denominators
+        const std::vector< IndependentVariableType >& independentValues = *sharedIndependentValues_;
+        boost::shared_ptr< std::vector< std::vector< ScalarType > > > denominatorsPointer =
+                boost::make_shared< std::vector< std::vector< ScalarType > > >( numberOfIndependentValues_ );
+        std::vector< std::vector< ScalarType > >& denominators = *denominatorsPointer;
         int currentIterationStart;
-        denominators.resize( numberOfIndependentValues_ );
         for( int i = offsetEntries_; i <= numberOfIndependentValues_ - offsetEntries_; i++ )
         {
             // Determine start index in independent variables for current polynomial
@@ -375,12 +430,13 @@ private:
                     if( k != j )
                     {
                         denominators[ i ][ j ] *= static_cast< ScalarType >(
-                                    independentValues_[ j + currentIterationStart ] -
-                                    independentValues_[ k + currentIterationStart ] );
+                                    independentValues[ j + currentIterationStart ] -
+                                    independentValues[ k + currentIterationStart ] );
                     }
                 }
             }
         }
+        sharedDenominators_ = denominatorsPointer;
     }
 
     //! Function called at initialization which creates the interpolators used at the boundaries
@@ -392,11 +448,12 @@ private:
      *  can cause excessive interpolation errors, especially for higher order polynomials. In
      *  these regions, the interpolator applies any of a number of techniques, defined by the
      *  boundaryHandling_ variable.
-     *  \param selectedLookupScheme Selected lookup scheme does something.
      */
-    void initializeBoundaryInterpolators(
-            const AvailableLookupScheme selectedLookupScheme = huntingAlgorithm )
+    void initializeBoundaryInterpolators( )
     {
+        const std::vector< IndependentVariableType >& independentValues = *sharedIndependentValues_;
+        const std::vector< DependentVariableType >& dependentValues = *sharedDependentValues_;
+
         // Create interpolators
         if( boundaryHandling_ == lagrange_cubic_spline_boundary_interpolation )
         {
@@ -411,13 +468,13 @@ private:
             std::map< IndependentVariableType, DependentVariableType > startMap;
             for( int i = 0; i <= cubicSplineInputSize; i++ )
             {
-                startMap[ independentValues_[ i ] ] = dependentValues_[ i ];
+                startMap[ independentValues[ i ] ] = dependentValues[ i ];
             }
             std::map< IndependentVariableType, DependentVariableType > endMap;
             for( int i = numberOfIndependentValues_ - cubicSplineInputSize - 1;
                  i < numberOfIndependentValues_; i++ )
             {
-                endMap[ independentValues_[ i ] ] = dependentValues_[ i ];
+                endMap[ independentValues[ i ] ] = dependentValues[ i ];
             }
 
             // Create cubic spline interpolators
@@ -428,8 +485,14 @@ private:
         }
     }
 
-    //! Pre-computed denominators to be used in interpolation
-    std::vector< std::vector< ScalarType > > denominators;
+    //! Independent variable values, shared with copies created by createIndependentCopy.
+    boost::shared_ptr< const std::vector< IndependentVariableType > > sharedIndependentValues_;
+
+    //! Dependent variable values, shared with copies created by createIndependentCopy.
+    boost::shared_ptr< const std::vector< DependentVariableType > > sharedDependentValues_;
+
+    //! Pre-computed denominators to be used in interpolation, shared with copies created by createIndependentCopy.
+    boost::shared_ptr< const std::vector< std::vector< ScalarType > > > sharedDenominators_;
 
     //! Zero entry for dependent variables
     /*!
@@ -465,6 +528,9 @@ private:
     //! Size of (in)dependent variable vector
     int numberOfIndependentValues_;
 
+    //! Type of look-up scheme that is used.
+    AvailableLookupScheme selectedLookupScheme_;
+
     //! Method to be used for handling boundaries of the interpolation domain.
     /*!
      *  Method to be used for handling boundaries of the interpolation domain.
@@ -15,6 +15,7 @@
 #include <vector>
 
 #include <boost/shared_ptr.hpp>
+#include <boost/make_shared.hpp>
 
 #include "Tudat/Mathematics/BasicMathematics/nearestNeighbourSearch.h"
 
@@ -51,6 +52,18 @@ public:
      * lookup procedure.
      */
     LookUpScheme( const std::vector< IndependentVariableType >& independentVariableValues )
+        : independentVariableValues_(
+              boost::make_shared< const std::vector< IndependentVariableType > >( independentVariableValues ) )
+    { }
+
+    //! Constructor, used to set shared data vector.
+    /*!
+     * Constructor, used to set data vector that is shared with other objects (e.g. the lookup schemes of other
+     * interpolators using the same data), instead of being copied.
+     * \param independentVariableValues vector of independent variable values in which to perform
+     * lookup procedure.
+     */
+    LookUpScheme( const boost::shared_ptr< const std::vector< IndependentVariableType > >& independentVariableValues )
         : independentVariableValues_( independentVariableValues )
     { }
 
@@ -73,9 +86,9 @@ protected:
 
     //! Vector of independent variable values in which lookup is to be performed.
     /*!
-     * Vector of independent variable values in which lookup is to be performed.
+     * Vector of independent variable values in which lookup is to be performed (may be shared with other objects).
      */
-    std::vector< IndependentVariableType > independentVariableValues_;
+    boost::shared_ptr< const std::vector< IndependentVariableType > > independentVariableValues_;
 };
 
 //! Look-up scheme class for nearest left neighbour search using hunting algorithm.
@@ -103,6 +116,20 @@ public:
           previousNearestLowerIndex_( 0 )
     { }
 
+    //! Constructor, used to set shared data vector.
+    /*!
+     *  Constructor, used to set data vector that is shared with other objects. Initializes guess from 'previous'
+     *  request to 0.
+     * \param independentVariableValues vector of independent variable values in which to perform
+     * lookup procedure.
+     */
+    HuntingAlgorithmLookupScheme( const boost::shared_ptr< const std::vector< IndependentVariableType > >&
+                                  independentVariableValues )
+        : LookUpScheme< IndependentVariableType >( independentVariableValues ),
+          isFirstLookupDone( 0 ),
+          previousNearestLowerIndex_( 0 )
+    { }
+
     //! Default destructor
     /*!
      *  Default destructor
@@ -126,7 +153,7 @@ public:
         if ( !isFirstLookupDone )
         {
             newNearestLowerIndex = basic_mathematics::computeNearestLeftNeighborUsingBinarySearch
-                    < IndependentVariableType >( independentVariableValues_, valueToLookup );
+                    < IndependentVariableType >( *independentVariableValues_, valueToLookup );
             isFirstLookupDone = 1;
         }
 
@@ -134,7 +161,7 @@ public:
         {
             // If requested value is in same interval, return same value as previous time.
             if ( basic_mathematics::isIndependentVariableInInterval< IndependentVariableType >
-                 ( previousNearestLowerIndex_,  valueToLookup, independentVariableValues_ ) )
+                 ( previousNearestLowerIndex_,  valueToLookup, *independentVariableValues_ ) )
             {
                 newNearestLowerIndex = previousNearestLowerIndex_;
             }
@@ -145,7 +172,7 @@ public:
                 newNearestLowerIndex =
                         basic_mathematics::findNearestLeftNeighbourUsingHuntingAlgorithm<
                         IndependentVariableType >
-                        (  valueToLookup, previousNearestLowerIndex_, independentVariableValues_ );
+                        (  valueToLookup, previousNearestLowerIndex_, *independentVariableValues_ );
             }
         }
 
@@ -193,6 +220,17 @@ public:
         : LookUpScheme< IndependentVariableType >( independentVariableValues )
     { }
 
+    //! Constructor, used to set shared data vector.
+    /*!
+     * Constructor, used to set data vector that is shared with other objects.
+     * \param independentVariableValues vector of independent variable values in which to perform
+     * lookup procedure.
+     */
+    BinarySearchLookupScheme(
+            const boost::shared_ptr< const std::vector< IndependentVariableType > >& independentVariableValues )
+        : LookUpScheme< IndependentVariableType >( independentVariableValues )
+    { }
+
     //! Default destructor
     /*!
      *  Default destructor
@@ -209,7 +247,7 @@ public:
     int findNearestLowerNeighbour( const IndependentVariableType valueToLookup )
     {
         return basic_mathematics::computeNearestLeftNeighborUsingBinarySearch
-                < IndependentVariableType >( independentVariableValues_, valueToLookup );
+                < IndependentVariableType >( *independentVariableValues_, valueToLookup );
     }
 };
 
@@ -115,13 +115,7 @@ public:
             const std::vector< IndependentVariableType >& independentValuesToInterpolate )
     {
         // Determine the nearest lower neighbours.
-        std::vector< int > nearestLowerIndices;
-        nearestLowerIndices.resize( NumberOfDimensions );
-        for ( unsigned int i = 0; i < NumberOfDimensions; i++ )
-        {
-            nearestLowerIndices[ i ] = lookUpSchemes_[ i ]->findNearestLowerNeighbour(
-                    independentValuesToInterpolate[ i ] );
-        }
+        std::vector< int > nearestLowerIndices = findNearestLowerIndices( independentValuesToInterpolate );
 
         // Initialize function evaluation indices to -1 for debugging purposes.
         boost::array< int, NumberOfDimensions > interpolationIndices;
@@ -148,6 +142,41 @@ public:
         return NumberOfDimensions;
     }
 
+    //! Function to find the grid cell in which interpolation is performed.
+    /*!
+     *  Function to find the grid cell in which interpolation is performed, i.e. the indices of the nearest lower
+     *  data points of each of the independent variables. The dependent data at the 2^NumberOfDimensions corners of
+     *  this cell are used when calling interpolate with the same input.
+     *  \param independentValuesToInterpolate Vector of values of independent variables at which
+     *  the value of the dependent variable is to be determined.
+     *  \return Indices of nearest lower data point of each of the independent variables.
+     */
+    std::vector< int > findNearestLowerIndices(
+            const std::vector< IndependentVariableType >& independentValuesToInterpolate )
+    {
+        std::vector< int > nearestLowerIndices;
+        nearestLowerIndices.resize( NumberOfDimensions );
+        for ( unsigned int i = 0; i < NumberOfDimensions; i++ )
+        {
+            nearestLowerIndices[ i ] = lookUpSchemes_[ i ]->findNearestLowerNeighbour(
+                    independentValuesToInterpolate[ i ] );
+        }
+        return nearestLowerIndices;
+    }
+
+    //! Function to reset the dependent data at a single grid point.
+    /*!
+     *  Function to reset the dependent data at a single grid point, for instance when the dependent data is only
+     *  computed for those grid cells in which interpolation is actually performed.
+     *  \param dataPointIndices Indices of independent variables of the grid point that is to be reset.
+     *  \param dependentValue New value of the dependent variable at the grid point.
+     */
+    void resetDependentDataPoint( const boost::array< int, NumberOfDimensions >& dataPointIndices,
+                                  const DependentVariableType& dependentValue )
+    {
+        dependentData_( dataPointIndices ) = dependentValue;
+    }
+
 
 private:
 
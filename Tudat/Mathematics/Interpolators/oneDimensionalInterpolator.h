@@ -12,9 +12,11 @@
 #ifndef TUDAT_ONE_DIMENSIONAL_INTERPOLATOR_H
 #define TUDAT_ONE_DIMENSIONAL_INTERPOLATOR_H
 
+#include <stdexcept>
 #include <vector>
 
 #include <boost/shared_ptr.hpp>
+#include <boost/make_shared.hpp>
 
 #include "Tudat/Mathematics/Interpolators/lookupScheme.h"
 #include "Tudat/Mathematics/Interpolators/interpolator.h"
@@ -103,7 +105,7 @@ public:
      *  Function to return the ector with independent variables used by the interpolator.
      *  \return Independent variables used by the interpolator.
      */
-    std::vector< IndependentVariableType > getIndependentValues( )
+    virtual std::vector< IndependentVariableType > getIndependentValues( )
     {
         return independentValues_;
     }
@@ -113,11 +115,24 @@ public:
      *  Function to return the ector with dependent variables used by the interpolator.
      *  \return Dependent variables used by the interpolator.
      */
-    std::vector< DependentVariableType > getDependentValues( )
+    virtual std::vector< DependentVariableType > getDependentValues( )
     {
         return dependentValues_;
     }
 
+    //! Function to create a copy of the interpolator that can be used independently of this object.
+    /*!
+     *  Function to create a copy of the interpolator that can be used independently of this object (e.g. on a different
+     *  thread), sharing the (immutable) interpolation data, but with its own look-up state. By default, this function
+     *  throws an error; it is overridden by derived classes for which such a copy is supported.
+     *  \return Copy of the interpolator that can be used independently of this object.
+     */
+    virtual boost::shared_ptr< OneDimensionalInterpolator< IndependentVariableType, DependentVariableType > >
+    createIndependentCopy( )
+    {
+        throw std::runtime_error( "Error, creating an independent copy of this interpolator type is not supported." );
+    }
+
 protected:
 
     //! Make look-up scheme that is to be used.
@@ -129,6 +144,23 @@ protected:
      *  \param selectedScheme Type of look-up scheme that is to be used
      */
     void makeLookupScheme( const AvailableLookupScheme selectedScheme )
+    {
+        makeLookupScheme( selectedScheme,
+                          boost::make_shared< const std::vector< IndependentVariableType > >( independentValues_ ) );
+    }
+
+    //! Make look-up scheme that is to be used, from a shared vector of independent variables.
+    /*!
+     * This function creates the look-up scheme that is to be used in determining the interval of
+     * the independent variable grid where the interpolation is to be performed. It takes the type
+     * of lookup scheme as an enum and constructs the look-up scheme from a vector of independent variables that is
+     * shared with the look-up scheme, instead of being copied.
+     *  \param selectedScheme Type of look-up scheme that is to be used
+     *  \param independentValues Vector of independent variables, shared with the look-up scheme.
+     */
+    void makeLookupScheme(
+            const AvailableLookupScheme selectedScheme,
+            const boost::shared_ptr< const std::vector< IndependentVariableType > >& independentValues )
     {
         // Find which type of scheme is used.
         switch( selectedScheme )
@@ -138,7 +170,7 @@ protected:
             // Create binary search look up scheme.
             lookUpScheme_ = boost::shared_ptr< LookUpScheme< IndependentVariableType > >
                     ( new BinarySearchLookupScheme< IndependentVariableType >
-                      ( independentValues_ ) );
+                      ( independentValues ) );
             break;
 
         case huntingAlgorithm:
@@ -146,7 +178,7 @@ protected:
             // Create hunting scheme, which uses an intial guess from previous look-ups.
             lookUpScheme_ = boost::shared_ptr< LookUpScheme< IndependentVariableType > >
                     ( new HuntingAlgorithmLookupScheme< IndependentVariableType >
-                      ( independentValues_ ) );
+                      ( independentValues ) );
             break;
 
         default:
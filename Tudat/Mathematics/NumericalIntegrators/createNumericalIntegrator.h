@@ -73,6 +73,17 @@ public:
      */
     virtual ~IntegratorSettings( ) { }
 
+    //! Function to create a copy of the integrator settings.
+    /*!
+     *  Function to create a copy of the integrator settings (of the same derived type), which can be modified without
+     *  affecting this object.
+     *  \return Copy of the integrator settings.
+     */
+    virtual boost::shared_ptr< IntegratorSettings< TimeType > > clone( ) const
+    {
+        return boost::make_shared< IntegratorSettings< TimeType > >( *this );
+    }
+
     //! Type of numerical integrator
     /*!
      *  Type of numerical integrator, from enum of available integrators.
@@ -170,6 +181,16 @@ public:
      */
     ~RungeKuttaVariableStepSizeSettings( ){ }
 
+    //! Function to create a copy of the integrator settings.
+    /*!
+     *  Function to create a copy of the integrator settings, which can be modified without affecting this object.
+     *  \return Copy of the integrator settings.
+     */
+    boost::shared_ptr< IntegratorSettings< TimeType > > clone( ) const
+    {
+        return boost::make_shared< RungeKuttaVariableStepSizeSettings< TimeType > >( *this );
+    }
+
     //! Type of numerical integrator (must be an RK variable step type)
     numerical_integrators::RungeKuttaCoefficients::CoefficientSets coefficientSet_;
 
@@ -17,6 +17,7 @@
 #include <boost/test/unit_test.hpp>
 
 #include "Tudat/Mathematics/Statistics/basicStatistics.h"
+#include "Tudat/Mathematics/Statistics/randomSampling.h"
 
 namespace tudat
 {
@@ -79,6 +80,55 @@ BOOST_AUTO_TEST_CASE( testSampleVariance )
                                 std::numeric_limits< double >::epsilon( ) );
 }
 
+//! Test if sample statistics of samples stored in a matrix are computed correctly, for different numbers of threads.
+BOOST_AUTO_TEST_CASE( testSampleMatrixStatistics )
+{
+    // Generate correlated Gaussian samples.
+    std::vector< Eigen::VectorXd > sampleData = statistics::generateGaussianRandomSample(
+                1, 10001, Eigen::Vector3d( 1.0, -2.0, 0.5 ), Eigen::Vector3d( 0.5, 3.0, 1.0 ) );
+    for( unsigned int i = 0; i < sampleData.size( ); i++ )
+    {
+        sampleData[ i ]( 2 ) += 0.5 * sampleData[ i ]( 1 );
+    }
+    Eigen::MatrixXd sampleMatrix = statistics::convertSampleDataToMatrix( sampleData );
+    BOOST_CHECK_EQUAL( sampleMatrix.rows( ), 3 );
+    BOOST_CHECK_EQUAL( sampleMatrix.cols( ), 10001 );
+
+    // Compute expected statistics from vector of samples.
+    Eigen::VectorXd expectedMean = statistics::computeSampleMean( sampleData );
+    Eigen::VectorXd expectedVariance = statistics::computeSampleVariance( sampleData );
+    Eigen::MatrixXd expectedCovariance = Eigen::MatrixXd::Zero( 3, 3 );
+    for( unsigned int i = 0; i < sampleData.size( ); i++ )
+    {
+        expectedCovariance += ( sampleData[ i ] - expectedMean ) * ( sampleData[ i ] - expectedMean ).transpose( );
+    }
+    expectedCovariance /= static_cast< double >( sampleData.size( ) - 1 );
+
+    // Compare against statistics of sample matrix, for single and multiple threads.
+    std::vector< unsigned int > numbersOfThreads = { 1, 3, 0 };
+    for( unsigned int i = 0; i < numbersOfThreads.size( ); i++ )
+    {
+        Eigen::VectorXd computedMean = statistics::computeSampleMean( sampleMatrix, numbersOfThreads.at( i ) );
+        Eigen::VectorXd computedVariance = statistics::computeSampleVariance( sampleMatrix, numbersOfThreads.at( i ) );
+        Eigen::MatrixXd computedCovariance =
+                statistics::computeSampleCovariance( sampleMatrix, numbersOfThreads.at( i ) );
+        for( unsigned int j = 0; j < 3; j++ )
+        {
+            BOOST_CHECK_CLOSE_FRACTION( computedMean( j ), expectedMean( j ), 1.0E-12 );
+            BOOST_CHECK_CLOSE_FRACTION( computedVariance( j ), expectedVariance( j ), 1.0E-12 );
+            BOOST_CHECK_CLOSE_FRACTION( computedCovariance( j, j ), computedVariance( j ), 1.0E-14 );
+            for( unsigned int k = 0; k < 3; k++ )
+            {
+                BOOST_CHECK_CLOSE_FRACTION( computedCovariance( j, k ), expectedCovariance( j, k ), 1.0E-12 );
+            }
+        }
+    }
+
+    // Check that single sample is rejected for variance.
+    BOOST_CHECK_THROW( statistics::computeSampleVariance( sampleMatrix.leftCols( 1 ) ), std::runtime_error );
+    BOOST_CHECK_THROW( statistics::computeSampleMean( Eigen::MatrixXd::Zero( 3, 0 ) ), std::runtime_error );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
@@ -0,0 +1,120 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <algorithm>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include "Tudat/Mathematics/Statistics/basicStatistics.h"
+#include "Tudat/Mathematics/Statistics/kdTree.h"
+#include "Tudat/Mathematics/Statistics/randomSampling.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+BOOST_AUTO_TEST_SUITE( test_kd_tree )
+
+//! Test retrieval of points in ball and box from k-d tree, against brute-force search.
+BOOST_AUTO_TEST_CASE( testKdTreeRegionSearch )
+{
+    using namespace statistics;
+
+    Eigen::MatrixXd points = convertSampleDataToMatrix( generateGaussianRandomSample( 11, 3000, 4 ) );
+    Eigen::MatrixXd locations = convertSampleDataToMatrix( generateGaussianRandomSample( 12, 20, 4 ) );
+    KdTree tree( points, 8 );
+
+    // Check that sorted points are permutation of original points.
+    const Eigen::MatrixXd& sortedPoints = tree.getSortedPoints( );
+    std::vector< int > sortedPointIndices = tree.getSortedPointIndices( );
+    BOOST_CHECK_EQUAL( sortedPoints.cols( ), points.cols( ) );
+    for( int i = 0; i < points.cols( ); i++ )
+    {
+        BOOST_CHECK_EQUAL( sortedPoints.col( i ), points.col( sortedPointIndices.at( i ) ) );
+    }
+    std::sort( sortedPointIndices.begin( ), sortedPointIndices.end( ) );
+    for( int i = 0; i < points.cols( ); i++ )
+    {
+        BOOST_CHECK_EQUAL( sortedPointIndices.at( i ), i );
+    }
+
+    std::vector< std::pair< int, int > > pointRanges;
+    for( int i = 0; i < locations.cols( ); i++ )
+    {
+        for( unsigned int useBox = 0; useBox < 2; useBox++ )
+        {
+            const double regionSize = 1.0;
+            if( useBox )
+            {
+                tree.getPointRangesInBox( locations.col( i ), regionSize, pointRanges );
+            }
+            else
+            {
+                tree.getPointRangesWithinDistance( locations.col( i ), regionSize, pointRanges );
+            }
+
+            // Flag points in returned ranges, and check that ranges are sorted and not adjacent.
+            std::vector< bool > isPointInRanges( sortedPoints.cols( ), false );
+            int numberOfPointsInRanges = 0;
+            for( unsigned int j = 0; j < pointRanges.size( ); j++ )
+            {
+                BOOST_CHECK( pointRanges.at( j ).first < pointRanges.at( j ).second );
+                if( j > 0 )
+                {
+                    BOOST_CHECK( pointRanges.at( j ).first > pointRanges.at( j - 1 ).second );
+                }
+                for( int k = pointRanges.at( j ).first; k < pointRanges.at( j ).second; k++ )
+                {
+                    isPointInRanges[ k ] = true;
+                    numberOfPointsInRanges++;
+                }
+            }
+
+            // Check that all points inside region are in ranges.
+            int numberOfPointsInRegion = 0;
+            for( int j = 0; j < sortedPoints.cols( ); j++ )
+            {
+                const Eigen::VectorXd difference = sortedPoints.col( j ) - locations.col( i );
+                const double distance = useBox ? difference.cwiseAbs( ).maxCoeff( ) : difference.norm( );
+                if( distance <= regionSize )
+                {
+                    BOOST_CHECK( isPointInRanges[ j ] );
+                    numberOfPointsInRegion++;
+                }
+            }
+
+            // Check that ranges exclude most points outside region.
+            BOOST_CHECK( numberOfPointsInRanges < sortedPoints.cols( ) / 2 );
+            BOOST_CHECK( numberOfPointsInRanges >= numberOfPointsInRegion );
+        }
+    }
+
+    // Check that full set is returned for large region, and that errors are caught.
+    tree.getPointRangesWithinDistance( locations.col( 0 ), 100.0, pointRanges );
+    BOOST_CHECK_EQUAL( pointRanges.size( ), 1 );
+    BOOST_CHECK_EQUAL( pointRanges.at( 0 ).first, 0 );
+    BOOST_CHECK_EQUAL( pointRanges.at( 0 ).second, points.cols( ) );
+    BOOST_CHECK_THROW( tree.getPointRangesInBox( Eigen::Vector2d::Zero( ), 1.0, pointRanges ), std::runtime_error );
+    BOOST_CHECK_THROW( KdTree( points, 0 ), std::runtime_error );
+
+    KdTree emptyTree( Eigen::MatrixXd::Zero( 4, 0 ) );
+    emptyTree.getPointRangesInBox( locations.col( 0 ), 1.0, pointRanges );
+    BOOST_CHECK_EQUAL( pointRanges.size( ), 0 );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
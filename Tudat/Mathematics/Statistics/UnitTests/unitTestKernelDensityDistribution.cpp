@@ -21,7 +21,9 @@
 #include "Tudat/Basics/testMacros.h"
 #include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
 #include "Tudat/InputOutput/basicInputOutput.h"
+#include "Tudat/Mathematics/Statistics/basicStatistics.h"
 #include "Tudat/Mathematics/Statistics/kernelDensityDistribution.h"
+#include "Tudat/Mathematics/Statistics/randomSampling.h"
 
 
 namespace tudat
@@ -590,6 +592,56 @@ BOOST_AUTO_TEST_CASE( testProbabilityFunctionsUncorrelated2D )
     }
 }
 
+//! Test evaluation of kernel density at a set of points using k-d tree, against evaluation using all kernels.
+BOOST_AUTO_TEST_CASE( testKernelProbabilityDensityAtPoints )
+{
+    using namespace tudat::statistics;
+
+    // Generate samples, and points at which to evaluate the kernel density.
+    Eigen::Vector3d mean( 1.0, -2.0, 0.0 ), standardDeviation( 0.5, 3.0, 1.0E-2 );
+    std::vector< Eigen::VectorXd > samples = generateGaussianRandomSample( 5, 5000, mean, standardDeviation );
+    Eigen::MatrixXd points = convertSampleDataToMatrix(
+                generateGaussianRandomSample( 6, 50, mean, 1.5 * standardDeviation ) );
+
+    std::vector< KernelType > kernelTypes = { gaussian_kernel, epanechnikov_kernel };
+    for( unsigned int i = 0; i < kernelTypes.size( ); i++ )
+    {
+        KernelDensityDistribution distribution( samples, 1.0, kernelTypes.at( i ) );
+
+        // Epanechnikov kernels are evaluated exactly, truncated Gaussian kernels differ in low-density regions.
+        const double tolerance = ( kernelTypes.at( i ) == epanechnikov_kernel ) ? 1.0E-12 : 1.0E-6;
+        BOOST_CHECK_EQUAL( distribution.getSampleMatrix( ).cols( ), 5000 );
+        BOOST_CHECK_EQUAL( distribution.getSamples( ).at( 10 ), samples.at( 10 ) );
+
+        // Compare pdf from tree (single and multiple threads) with pdf from all kernels.
+        Eigen::VectorXd singleThreadDensities = distribution.evaluatePdfAtPoints( points );
+        Eigen::VectorXd multiThreadDensities = distribution.evaluatePdfAtPoints( points, 3 );
+        for( int j = 0; j < points.cols( ); j++ )
+        {
+            const double expectedDensity = distribution.evaluatePdf( points.col( j ) );
+            BOOST_CHECK_CLOSE_FRACTION( singleThreadDensities( j ), expectedDensity, tolerance );
+            BOOST_CHECK_EQUAL( multiThreadDensities( j ), singleThreadDensities( j ) );
+        }
+
+        // Check that tree is recomputed when bandwidth is changed.
+        distribution.setBandWidth( 2.0 * distribution.getBandWidth( ) );
+        Eigen::VectorXd rescaledDensities = distribution.evaluatePdfAtPoints( points, 0 );
+        for( int j = 0; j < points.cols( ); j++ )
+        {
+            BOOST_CHECK_CLOSE_FRACTION( rescaledDensities( j ), distribution.evaluatePdf( points.col( j ) ), tolerance );
+        }
+
+        BOOST_CHECK_THROW( distribution.evaluatePdfAtPoints( points.topRows( 2 ) ), std::runtime_error );
+    }
+
+    // Check that Gaussian kernels are truncated at given distance.
+    KernelDensityDistribution distribution( samples );
+    const double fullDensity = distribution.evaluatePdf( mean );
+    distribution.setGaussianKernelTruncationDistance( 0.0 );
+    BOOST_CHECK( distribution.evaluatePdfAtPoints( mean )( 0 ) < fullDensity );
+    distribution.setGaussianKernelTruncationDistance( 10.0 );
+    BOOST_CHECK_CLOSE_FRACTION( distribution.evaluatePdfAtPoints( mean )( 0 ), fullDensity, 1.0E-12 );
+}
 
 BOOST_AUTO_TEST_SUITE_END( )
 
@@ -0,0 +1,128 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include <boost/test/floating_point_comparison.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include "Tudat/Mathematics/Statistics/basicStatistics.h"
+#include "Tudat/Mathematics/Statistics/randomSampling.h"
+#include "Tudat/Mathematics/Statistics/streamingStatistics.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+BOOST_AUTO_TEST_SUITE( test_streaming_statistics )
+
+//! Test streaming mean, covariance and quantiles against statistics computed from full sample.
+BOOST_AUTO_TEST_CASE( testStreamingStatistics )
+{
+    using namespace statistics;
+
+    // Generate correlated Gaussian samples.
+    Eigen::Vector2d mean( 1.0, -2.0 ), standardDeviation( 0.5, 3.0 );
+    std::vector< Eigen::VectorXd > samples = generateGaussianRandomSample(
+                42, 20000, mean, standardDeviation );
+    for( unsigned int i = 0; i < samples.size( ); i++ )
+    {
+        samples[ i ]( 1 ) += 2.0 * samples[ i ]( 0 );
+    }
+
+    std::vector< double > quantileProbabilities = { 0.05, 0.5, 0.9 };
+    StreamingStatistics streamingStatistics( quantileProbabilities );
+    for( unsigned int i = 0; i < samples.size( ); i++ )
+    {
+        streamingStatistics.addSample( samples[ i ] );
+    }
+    BOOST_CHECK_EQUAL( streamingStatistics.getNumberOfSamples( ), samples.size( ) );
+
+    // Compare mean and covariance against direct computation.
+    Eigen::VectorXd expectedMean = computeSampleMean( samples );
+    Eigen::MatrixXd expectedCovariance = Eigen::MatrixXd::Zero( 2, 2 );
+    for( unsigned int i = 0; i < samples.size( ); i++ )
+    {
+        expectedCovariance += ( samples[ i ] - expectedMean ) * ( samples[ i ] - expectedMean ).transpose( );
+    }
+    expectedCovariance /= static_cast< double >( samples.size( ) - 1 );
+
+    Eigen::VectorXd computedMean = streamingStatistics.getSampleMean( );
+    Eigen::MatrixXd computedCovariance = streamingStatistics.getSampleCovariance( );
+    for( unsigned int i = 0; i < 2; i++ )
+    {
+        BOOST_CHECK_CLOSE_FRACTION( computedMean( i ), expectedMean( i ), 1.0E-12 );
+        for( unsigned int j = 0; j < 2; j++ )
+        {
+            BOOST_CHECK_CLOSE_FRACTION( computedCovariance( i, j ), expectedCovariance( i, j ), 1.0E-12 );
+        }
+    }
+    BOOST_CHECK_EQUAL( computedCovariance( 0, 1 ), computedCovariance( 1, 0 ) );
+
+    // Compare quantile estimates against quantiles of sorted samples.
+    for( unsigned int i = 0; i < 2; i++ )
+    {
+        std::vector< double > sortedEntries;
+        for( unsigned int k = 0; k < samples.size( ); k++ )
+        {
+            sortedEntries.push_back( samples[ k ]( i ) );
+        }
+        std::sort( sortedEntries.begin( ), sortedEntries.end( ) );
+        const double entryStandardDeviation = std::sqrt( expectedCovariance( i, i ) );
+
+        for( unsigned int j = 0; j < quantileProbabilities.size( ); j++ )
+        {
+            const double expectedQuantile = sortedEntries.at(
+                        static_cast< unsigned int >( quantileProbabilities.at( j ) * ( sortedEntries.size( ) - 1 ) ) );
+            BOOST_CHECK_SMALL( streamingStatistics.getQuantiles( j )( i ) - expectedQuantile,
+                               0.02 * entryStandardDeviation );
+        }
+    }
+}
+
+//! Test behaviour for small and inconsistent samples.
+BOOST_AUTO_TEST_CASE( testStreamingStatisticsSmallSamples )
+{
+    using namespace statistics;
+
+    // Quantiles of fewer than five values are computed exactly.
+    PSquareQuantileEstimator medianEstimator( 0.5 );
+    BOOST_CHECK( std::isnan( medianEstimator.getQuantile( ) ) );
+    medianEstimator.addValue( 3.0 );
+    medianEstimator.addValue( 1.0 );
+    medianEstimator.addValue( 2.0 );
+    BOOST_CHECK_EQUAL( medianEstimator.getQuantile( ), 2.0 );
+    medianEstimator.addValue( 10.0 );
+    BOOST_CHECK_CLOSE_FRACTION( medianEstimator.getQuantile( ), 2.5, std::numeric_limits< double >::epsilon( ) );
+    BOOST_CHECK_THROW( PSquareQuantileEstimator( 1.5 ), std::runtime_error );
+
+    StreamingStatistics streamingStatistics;
+    BOOST_CHECK_THROW( streamingStatistics.getSampleMean( ), std::runtime_error );
+    streamingStatistics.addSample( Eigen::Vector3d( 1.0, 2.0, 3.0 ) );
+    BOOST_CHECK_THROW( streamingStatistics.getSampleCovariance( ), std::runtime_error );
+    BOOST_CHECK_THROW( streamingStatistics.getQuantiles( 0 ), std::runtime_error );
+    BOOST_CHECK_THROW( streamingStatistics.addSample( Eigen::Vector2d( 1.0, 2.0 ) ), std::runtime_error );
+    streamingStatistics.addSample( Eigen::Vector3d( 3.0, 2.0, 1.0 ) );
+    BOOST_CHECK_EQUAL( streamingStatistics.getSampleMean( ), Eigen::Vector3d( 2.0, 2.0, 2.0 ) );
+    BOOST_CHECK_CLOSE_FRACTION( streamingStatistics.getSampleCovariance( )( 0, 2 ), -2.0,
+                                std::numeric_limits< double >::epsilon( ) );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
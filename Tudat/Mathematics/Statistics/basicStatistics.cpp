@@ -9,9 +9,16 @@
  *
  */
 
+#include <algorithm>
 #include <cmath>
 #include <numeric>
+#include <stdexcept>
+#include <string>
 
+#include <boost/bind.hpp>
+#include <boost/function.hpp>
+
+#include "Tudat/Basics/parallelLoops.h"
 #include "Tudat/Mathematics/Statistics/basicStatistics.h"
 #include "Tudat/Mathematics/BasicMathematics/basicMathematicsFunctions.h"
 
@@ -130,5 +137,129 @@ Eigen::VectorXd computeSampleVariance( const std::vector< Eigen::VectorXd >& sam
     return 1.0 / ( static_cast< double >( sampleData.size( ) ) - 1.0 ) * sumOfResidualsSquared_;
 }
 
+//! Function to store a sample of VectorXd in a single (contiguous) matrix.
+Eigen::MatrixXd convertSampleDataToMatrix( const std::vector< Eigen::VectorXd >& sampleData )
+{
+    if( sampleData.size( ) == 0 )
+    {
+        return Eigen::MatrixXd::Zero( 0, 0 );
+    }
+
+    Eigen::MatrixXd sampleMatrix( sampleData.at( 0 ).rows( ), sampleData.size( ) );
+    for( unsigned int i = 0; i < sampleData.size( ); i++ )
+    {
+        if( sampleData.at( i ).rows( ) != sampleMatrix.rows( ) )
+        {
+            throw std::runtime_error( "Error when converting sample data to matrix, size of sample " +
+                                      std::to_string( i ) + " is inconsistent" );
+        }
+        sampleMatrix.col( i ) = sampleData.at( i );
+    }
+    return sampleMatrix;
+}
+
+//! Function to compute the sum of (a function of) a contiguous block of samples.
+void computeSampleBlockSum(
+        const Eigen::MatrixXd& sampleData,
+        const boost::function< Eigen::MatrixXd( const Eigen::Ref< const Eigen::MatrixXd >& ) >& blockSumFunction,
+        std::vector< Eigen::MatrixXd >& blockSums,
+        const unsigned int blockIndex, const unsigned int startColumn, const unsigned int endColumn )
+{
+    blockSums.at( blockIndex ) = blockSumFunction( sampleData.middleCols( startColumn, endColumn - startColumn ) );
+}
+
+//! Function to compute the sum of (a function of) all samples, in contiguous blocks of samples on separate threads.
+Eigen::MatrixXd computeParallelSampleSum(
+        const Eigen::MatrixXd& sampleData, const unsigned int numberOfThreads,
+        const boost::function< Eigen::MatrixXd( const Eigen::Ref< const Eigen::MatrixXd >& ) >& blockSumFunction )
+{
+    // Sum blocks of samples, one block per thread.
+    const unsigned int numberOfSamples = sampleData.cols( );
+    const unsigned int numberOfBlocks = utilities::getNumberOfThreadsToUse( numberOfThreads, numberOfSamples );
+    std::vector< Eigen::MatrixXd > blockSums( numberOfBlocks );
+    utilities::parallelForBlocks(
+                numberOfSamples, numberOfBlocks,
+                boost::bind( &computeSampleBlockSum, boost::cref( sampleData ), boost::cref( blockSumFunction ),
+                             boost::ref( blockSums ), _1, _2, _3 ) );
+
+    // Add partial sums in fixed order, so that result is independent of thread scheduling.
+    Eigen::MatrixXd totalSum = blockSums.at( 0 );
+    for( unsigned int i = 1; i < blockSums.size( ); i++ )
+    {
+        totalSum += blockSums.at( i );
+    }
+    return totalSum;
+}
+
+//! Function to compute the sum of a block of samples
+Eigen::MatrixXd computeSumOfSamples( const Eigen::Ref< const Eigen::MatrixXd >& sampleBlock )
+{
+    return sampleBlock.rowwise( ).sum( );
+}
+
+//! Function to compute the sum of the squared deviations of a block of samples from the sample mean
+Eigen::MatrixXd computeSumOfSquaredDeviations(
+        const Eigen::Ref< const Eigen::MatrixXd >& sampleBlock, const Eigen::VectorXd& sampleMean )
+{
+    return ( sampleBlock.colwise( ) - sampleMean ).array( ).square( ).rowwise( ).sum( ).matrix( );
+}
+
+//! Function to compute the sum of the outer products of the deviations of a block of samples from the sample mean
+Eigen::MatrixXd computeSumOfDeviationProducts(
+        const Eigen::Ref< const Eigen::MatrixXd >& sampleBlock, const Eigen::VectorXd& sampleMean )
+{
+    // Accumulate products over sub-blocks of samples, so that only the deviations of a single sub-block are stored.
+    const int maximumSubBlockSize = 256;
+    Eigen::MatrixXd sumOfProducts = Eigen::MatrixXd::Zero( sampleMean.rows( ), sampleMean.rows( ) );
+    Eigen::MatrixXd deviations( sampleMean.rows( ), std::min< int >( maximumSubBlockSize, sampleBlock.cols( ) ) );
+    for( int i = 0; i < sampleBlock.cols( ); i += maximumSubBlockSize )
+    {
+        const int subBlockSize = std::min< int >( maximumSubBlockSize, sampleBlock.cols( ) - i );
+        deviations.leftCols( subBlockSize ) = sampleBlock.middleCols( i, subBlockSize ).colwise( ) - sampleMean;
+        sumOfProducts.selfadjointView< Eigen::Lower >( ).rankUpdate( deviations.leftCols( subBlockSize ) );
+    }
+    return sumOfProducts.selfadjointView< Eigen::Lower >( );
+}
+
+//! Compute sample mean for a sample stored as columns of a matrix.
+Eigen::VectorXd computeSampleMean( const Eigen::MatrixXd& sampleData, const unsigned int numberOfThreads )
+{
+    if( sampleData.cols( ) == 0 )
+    {
+        throw std::runtime_error( "Error when computing sample mean, no samples provided" );
+    }
+
+    return computeParallelSampleSum( sampleData, numberOfThreads, &computeSumOfSamples ) /
+            static_cast< double >( sampleData.cols( ) );
+}
+
+//! Compute sample variance for a sample stored as columns of a matrix.
+Eigen::VectorXd computeSampleVariance( const Eigen::MatrixXd& sampleData, const unsigned int numberOfThreads )
+{
+    if( sampleData.cols( ) < 2 )
+    {
+        throw std::runtime_error( "Error when computing sample variance, at least two samples are required" );
+    }
+
+    const Eigen::VectorXd sampleMean = computeSampleMean( sampleData, numberOfThreads );
+    return computeParallelSampleSum( sampleData, numberOfThreads,
+                                     boost::bind( &computeSumOfSquaredDeviations, _1, sampleMean ) ) /
+            ( static_cast< double >( sampleData.cols( ) ) - 1.0 );
+}
+
+//! Compute sample covariance for a sample stored as columns of a matrix.
+Eigen::MatrixXd computeSampleCovariance( const Eigen::MatrixXd& sampleData, const unsigned int numberOfThreads )
+{
+    if( sampleData.cols( ) < 2 )
+    {
+        throw std::runtime_error( "Error when computing sample covariance, at least two samples are required" );
+    }
+
+    const Eigen::VectorXd sampleMean = computeSampleMean( sampleData, numberOfThreads );
+    return computeParallelSampleSum( sampleData, numberOfThreads,
+                                     boost::bind( &computeSumOfDeviationProducts, _1, sampleMean ) ) /
+            ( static_cast< double >( sampleData.cols( ) ) - 1.0 );
+}
+
 } // namespace statistics
 } // namespace tudat
@@ -107,6 +107,48 @@ double computeSampleMedian( std::vector< double > sampleData );
  */
 Eigen::VectorXd computeSampleVariance( const std::vector< Eigen::VectorXd >& sampleData );
 
+//! Function to store a sample of VectorXd in a single (contiguous) matrix.
+/*!
+ * Function to store a sample of VectorXd in a single (contiguous) matrix, with each column containing one sample.
+ * \param sampleData Sample data (all entries must be of equal size).
+ * \return Matrix with sample data, with sample i in column i.
+ */
+Eigen::MatrixXd convertSampleDataToMatrix( const std::vector< Eigen::VectorXd >& sampleData );
+
+//! Compute sample mean for a sample stored as columns of a matrix.
+/*!
+ * Computes sample mean for a sample stored as columns of a matrix, using the same estimator as for a sample of
+ * VectorXd. The sum over the samples is computed in contiguous blocks of columns, each of which may be summed in a
+ * separate thread, after which the partial sums are added in a fixed order.
+ * \param sampleData Sample data, with each column containing one sample.
+ * \param numberOfThreads Number of threads that is to be used (0 to use number of hardware threads).
+ * \return Sample mean.
+ */
+Eigen::VectorXd computeSampleMean( const Eigen::MatrixXd& sampleData, const unsigned int numberOfThreads = 1 );
+
+//! Compute sample variance for a sample stored as columns of a matrix.
+/*!
+ * Computes sample variance (per entry) for a sample stored as columns of a matrix, using the same estimator as for a
+ * sample of VectorXd. The sums over the samples are computed in parallel, as in computeSampleMean.
+ * \param sampleData Sample data, with each column containing one sample.
+ * \param numberOfThreads Number of threads that is to be used (0 to use number of hardware threads).
+ * \return Sample variance.
+ */
+Eigen::VectorXd computeSampleVariance( const Eigen::MatrixXd& sampleData, const unsigned int numberOfThreads = 1 );
+
+//! Compute sample covariance for a sample stored as columns of a matrix.
+/*!
+ * Computes (unbiased) sample covariance for a sample stored as columns of a matrix:
+ * \f[
+ *      C_{s} = \frac{ 1 }{ N - 1 } * \sum_{i=1}^{N} ( X_{i} - \bar{ X } ) ( X_{i} - \bar{ X } )^{ T }
+ * \f]
+ * The sums over the samples are computed in parallel, as in computeSampleMean.
+ * \param sampleData Sample data, with each column containing one sample.
+ * \param numberOfThreads Number of threads that is to be used (0 to use number of hardware threads).
+ * \return Sample covariance.
+ */
+Eigen::MatrixXd computeSampleCovariance( const Eigen::MatrixXd& sampleData, const unsigned int numberOfThreads = 1 );
+
 } // namespace statistics
 } // namespace tudat
 
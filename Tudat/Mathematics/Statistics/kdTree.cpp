@@ -0,0 +1,203 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+#include "Tudat/Mathematics/Statistics/kdTree.h"
+
+namespace tudat
+{
+
+namespace statistics
+{
+
+//! Functor to compare two points (given by their column index in a matrix) by a single coordinate.
+struct KdTreePointComparator
+{
+    //! Constructor
+    KdTreePointComparator( const Eigen::MatrixXd& points, const int dimension ):
+        points_( points ), dimension_( dimension ){ }
+
+    //! Function to compare points with given column indices.
+    bool operator( )( const int firstIndex, const int secondIndex ) const
+    {
+        return points_( dimension_, firstIndex ) < points_( dimension_, secondIndex );
+    }
+
+    //! Points that are compared
+    const Eigen::MatrixXd& points_;
+
+    //! Dimension in which points are compared
+    int dimension_;
+};
+
+//! Constructor, builds the tree.
+KdTree::KdTree( const Eigen::MatrixXd& points, const int maximumLeafSize ):
+    maximumLeafSize_( maximumLeafSize ), sortedPoints_( points )
+{
+    if( maximumLeafSize_ < 1 )
+    {
+        throw std::runtime_error( "Error when creating k-d tree, maximum leaf size must be positive, but is " +
+                                  std::to_string( maximumLeafSize_ ) );
+    }
+
+    // Build tree, sorting indices of points.
+    sortedPointIndices_.resize( points.cols( ) );
+    for( int i = 0; i < points.cols( ); i++ )
+    {
+        sortedPointIndices_[ i ] = i;
+    }
+
+    std::vector< Eigen::VectorXd > nodeLowerBounds, nodeUpperBounds;
+    if( points.cols( ) > 0 )
+    {
+        createNode( 0, points.cols( ), nodeLowerBounds, nodeUpperBounds );
+    }
+
+    // Store bounding boxes of nodes contiguously.
+    nodeLowerBounds_.resize( points.rows( ), nodes_.size( ) );
+    nodeUpperBounds_.resize( points.rows( ), nodes_.size( ) );
+    for( unsigned int i = 0; i < nodes_.size( ); i++ )
+    {
+        nodeLowerBounds_.col( i ) = nodeLowerBounds[ i ];
+        nodeUpperBounds_.col( i ) = nodeUpperBounds[ i ];
+    }
+
+    // Store points contiguously in sorted order.
+    for( int i = 0; i < points.cols( ); i++ )
+    {
+        sortedPoints_.col( i ) = points.col( sortedPointIndices_[ i ] );
+    }
+}
+
+//! Function to create a node (and recursively, its children) for a range of points
+int KdTree::createNode( const int startIndex, const int endIndex,
+                        std::vector< Eigen::VectorXd >& nodeLowerBounds,
+                        std::vector< Eigen::VectorXd >& nodeUpperBounds )
+{
+    // Compute bounding box of points in node (sorted points are still in original order while building the tree).
+    const Eigen::MatrixXd& points = sortedPoints_;
+    Eigen::VectorXd lowerBounds = points.col( sortedPointIndices_[ startIndex ] );
+    Eigen::VectorXd upperBounds = lowerBounds;
+    for( int i = startIndex + 1; i < endIndex; i++ )
+    {
+        lowerBounds = lowerBounds.cwiseMin( points.col( sortedPointIndices_[ i ] ) );
+        upperBounds = upperBounds.cwiseMax( points.col( sortedPointIndices_[ i ] ) );
+    }
+
+    // Add node.
+    const int nodeIndex = static_cast< int >( nodes_.size( ) );
+    KdTreeNode node;
+    node.startIndex = startIndex;
+    node.endIndex = endIndex;
+    node.firstChildIndex = -1;
+    node.secondChildIndex = -1;
+    nodes_.push_back( node );
+    nodeLowerBounds.push_back( lowerBounds );
+    nodeUpperBounds.push_back( upperBounds );
+
+    // Split node at median of dimension with largest extent, if it contains too many points.
+    if( endIndex - startIndex > maximumLeafSize_ )
+    {
+        int splitDimension;
+        ( upperBounds - lowerBounds ).maxCoeff( &splitDimension );
+
+        const int splitIndex = ( startIndex + endIndex ) / 2;
+        std::nth_element( sortedPointIndices_.begin( ) + startIndex, sortedPointIndices_.begin( ) + splitIndex,
+                          sortedPointIndices_.begin( ) + endIndex,
+                          KdTreePointComparator( points, splitDimension ) );
+
+        const int firstChildIndex = createNode( startIndex, splitIndex, nodeLowerBounds, nodeUpperBounds );
+        const int secondChildIndex = createNode( splitIndex, endIndex, nodeLowerBounds, nodeUpperBounds );
+        nodes_[ nodeIndex ].firstChildIndex = firstChildIndex;
+        nodes_[ nodeIndex ].secondChildIndex = secondChildIndex;
+    }
+
+    return nodeIndex;
+}
+
+//! Function to retrieve the ranges of sorted points that contain all points in a region around a location.
+void KdTree::getPointRangesInRegion( const Eigen::VectorXd& location, const double size, const bool useBox,
+                                     std::vector< std::pair< int, int > >& pointRanges ) const
+{
+    pointRanges.clear( );
+    if( nodes_.size( ) == 0 )
+    {
+        return;
+    }
+    else if( location.rows( ) != sortedPoints_.rows( ) )
+    {
+        throw std::runtime_error( "Error when retrieving points from k-d tree, location has size " +
+                                  std::to_string( location.rows( ) ) + ", but points have size " +
+                                  std::to_string( sortedPoints_.rows( ) ) );
+    }
+
+    // Traverse tree depth-first, first child first, so that ranges are found in sorted order.
+    std::vector< int > nodesToVisit;
+    nodesToVisit.push_back( 0 );
+    while( nodesToVisit.size( ) > 0 )
+    {
+        const int nodeIndex = nodesToVisit.back( );
+        nodesToVisit.pop_back( );
+        const KdTreeNode& node = nodes_[ nodeIndex ];
+
+        // Compute minimum and maximum distance (per dimension) from location to bounding box of node.
+        double minimumDistance = 0.0, maximumDistance = 0.0;
+        for( int i = 0; i < location.rows( ); i++ )
+        {
+            const double distanceBelowBox = nodeLowerBounds_( i, nodeIndex ) - location( i );
+            const double distanceAboveBox = location( i ) - nodeUpperBounds_( i, nodeIndex );
+            const double currentMinimumDistance = std::max( std::max( distanceBelowBox, distanceAboveBox ), 0.0 );
+            const double currentMaximumDistance = std::max( std::fabs( distanceBelowBox ),
+                                                            std::fabs( distanceAboveBox ) );
+            if( useBox )
+            {
+                minimumDistance = std::max( minimumDistance, currentMinimumDistance );
+                maximumDistance = std::max( maximumDistance, currentMaximumDistance );
+            }
+            else
+            {
+                minimumDistance += currentMinimumDistance * currentMinimumDistance;
+                maximumDistance += currentMaximumDistance * currentMaximumDistance;
+            }
+        }
+        const double regionSize = useBox ? size : size * size;
+
+        // Skip nodes outside of region, and add nodes that are fully inside region, or leaves that intersect it.
+        if( minimumDistance > regionSize )
+        {
+            continue;
+        }
+        else if( maximumDistance <= regionSize || node.firstChildIndex < 0 )
+        {
+            if( pointRanges.size( ) > 0 && pointRanges.back( ).second == node.startIndex )
+            {
+                pointRanges.back( ).second = node.endIndex;
+            }
+            else
+            {
+                pointRanges.push_back( std::make_pair( node.startIndex, node.endIndex ) );
+            }
+        }
+        else
+        {
+            nodesToVisit.push_back( node.secondChildIndex );
+            nodesToVisit.push_back( node.firstChildIndex );
+        }
+    }
+}
+
+} // namespace statistics
+
+} // namespace tudat
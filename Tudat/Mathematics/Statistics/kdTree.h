@@ -0,0 +1,179 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Bentley, J.L. Multidimensional Binary Search Trees Used for Associative Searching,
+ *          Communications of the ACM, 18(9), 509-517, 1975.
+ *
+ */
+
+#ifndef TUDAT_KD_TREE_H
+#define TUDAT_KD_TREE_H
+
+#include <utility>
+#include <vector>
+
+#include <Eigen/Core>
+
+namespace tudat
+{
+
+namespace statistics
+{
+
+//! Class for a k-d tree of a set of points, for the fast retrieval of the points in a region around a given location.
+/*!
+ *  Class for a k-d tree (Bentley, 1975) of a set of points (e.g. random samples), which is used to retrieve the points
+ *  that are located within a given distance of a given location without iterating over all points. Each node of the
+ *  tree is split at the median of the points along the dimension in which the (tight) bounding box of the node is
+ *  largest, until a node contains no more than a given number of points. The points are stored contiguously in the
+ *  order of the leaves of the tree, so that the points in any node of the tree occupy a contiguous range of columns of
+ *  the sorted point matrix. The regions around a location are returned as such ranges, which may contain points that
+ *  lie (slightly) outside of the region, but contain all points that lie inside of it.
+ */
+class KdTree
+{
+public:
+
+    //! Constructor, builds the tree.
+    /*!
+     * Constructor, builds the tree.
+     * \param points Points from which the tree is to be built, with each column containing one point.
+     * \param maximumLeafSize Maximum number of points in a single leaf of the tree.
+     */
+    KdTree( const Eigen::MatrixXd& points, const int maximumLeafSize = 16 );
+
+    //! Function to retrieve the ranges of sorted points that contain all points within a given Euclidean distance.
+    /*!
+     * Function to retrieve the ranges of sorted points that contain all points within a given Euclidean distance
+     * of a given location. Adjacent ranges are merged.
+     * \param location Location around which the points are to be retrieved.
+     * \param distance Maximum Euclidean distance of the points from the location.
+     * \param pointRanges Ranges of columns [first, second) in sorted points (returned by reference, existing contents
+     * are cleared).
+     */
+    void getPointRangesWithinDistance( const Eigen::VectorXd& location, const double distance,
+                                       std::vector< std::pair< int, int > >& pointRanges ) const
+    {
+        getPointRangesInRegion( location, distance, false, pointRanges );
+    }
+
+    //! Function to retrieve the ranges of sorted points that contain all points in a box around a location.
+    /*!
+     * Function to retrieve the ranges of sorted points that contain all points in a box (i.e. within a given maximum
+     * distance in each dimension) around a given location. Adjacent ranges are merged.
+     * \param location Location at the center of the box.
+     * \param halfWidth Half of the width of the box (equal in all dimensions).
+     * \param pointRanges Ranges of columns [first, second) in sorted points (returned by reference, existing contents
+     * are cleared).
+     */
+    void getPointRangesInBox( const Eigen::VectorXd& location, const double halfWidth,
+                              std::vector< std::pair< int, int > >& pointRanges ) const
+    {
+        getPointRangesInRegion( location, halfWidth, true, pointRanges );
+    }
+
+    //! Function to retrieve the points, sorted in the order of the leaves of the tree.
+    /*!
+     * Function to retrieve the points, sorted in the order of the leaves of the tree.
+     * \return Sorted points, with each column containing one point.
+     */
+    const Eigen::MatrixXd& getSortedPoints( ) const
+    {
+        return sortedPoints_;
+    }
+
+    //! Function to retrieve the indices of the sorted points in the original set of points.
+    /*!
+     * Function to retrieve the indices of the sorted points in the original set of points.
+     * \return Indices of the sorted points in the original set of points (index i for column i of sorted points).
+     */
+    const std::vector< int >& getSortedPointIndices( ) const
+    {
+        return sortedPointIndices_;
+    }
+
+    //! Function to retrieve the number of nodes in the tree.
+    /*!
+     * Function to retrieve the number of nodes in the tree.
+     * \return Number of nodes in the tree.
+     */
+    int getNumberOfNodes( ) const
+    {
+        return static_cast< int >( nodes_.size( ) );
+    }
+
+private:
+
+    //! Node of the tree
+    struct KdTreeNode
+    {
+        //! Index of first sorted point in node
+        int startIndex;
+
+        //! Index one past the last sorted point in node
+        int endIndex;
+
+        //! Index of first child node (-1 for leaves)
+        int firstChildIndex;
+
+        //! Index of second child node (-1 for leaves)
+        int secondChildIndex;
+    };
+
+    //! Function to create a node (and recursively, its children) for a range of points
+    /*!
+     * Function to create a node (and recursively, its children) for a range of points, sorting the points in the range.
+     * \param startIndex Index of first point in node.
+     * \param endIndex Index one past the last point in node.
+     * \param nodeLowerBounds Lower bounds of bounding boxes of nodes, to which those of the new nodes are added.
+     * \param nodeUpperBounds Upper bounds of bounding boxes of nodes, to which those of the new nodes are added.
+     * \return Index of node that is created.
+     */
+    int createNode( const int startIndex, const int endIndex,
+                    std::vector< Eigen::VectorXd >& nodeLowerBounds,
+                    std::vector< Eigen::VectorXd >& nodeUpperBounds );
+
+    //! Function to retrieve the ranges of sorted points that contain all points in a region around a location.
+    /*!
+     * Function to retrieve the ranges of sorted points that contain all points in a region around a location, either
+     * a ball (Euclidean distance) or a box (maximum distance in any dimension).
+     * \param location Location at the center of the region.
+     * \param size Radius of ball, or half-width of box.
+     * \param useBox Boolean denoting whether the region is a box (true) or a ball (false).
+     * \param pointRanges Ranges of columns [first, second) in sorted points (returned by reference).
+     */
+    void getPointRangesInRegion( const Eigen::VectorXd& location, const double size, const bool useBox,
+                                 std::vector< std::pair< int, int > >& pointRanges ) const;
+
+    //! Maximum number of points in a single leaf of the tree.
+    int maximumLeafSize_;
+
+    //! Points, sorted in the order of the leaves of the tree.
+    Eigen::MatrixXd sortedPoints_;
+
+    //! Indices of the sorted points in the original set of points.
+    std::vector< int > sortedPointIndices_;
+
+    //! Nodes of the tree (root node at index 0).
+    std::vector< KdTreeNode > nodes_;
+
+    //! Lower bounds of the (tight) bounding boxes of the nodes (one column per node).
+    Eigen::MatrixXd nodeLowerBounds_;
+
+    //! Upper bounds of the (tight) bounding boxes of the nodes (one column per node).
+    Eigen::MatrixXd nodeUpperBounds_;
+
+};
+
+} // namespace statistics
+
+} // namespace tudat
+
+#endif // TUDAT_KD_TREE_H
@@ -8,6 +8,11 @@
  *    http://tudat.tudelft.nl/LICENSE.
  */
 
+#include <algorithm>
+
+#include <boost/bind.hpp>
+
+#include "Tudat/Basics/parallelLoops.h"
 #include "Tudat/Mathematics/Statistics/kernelDensityDistribution.h"
 #include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
 #include "Tudat/Mathematics/Statistics/basicStatistics.h"
@@ -60,9 +65,9 @@ KernelDensityDistribution::KernelDensityDistribution(
         const Eigen::VectorXd& manualBandwidth )
 {
     // Load data
-    dataSamples_ = samples;
-    dimensions_ = dataSamples_.at( 0 ).rows( );
+    dimensions_ = samples.at( 0 ).rows( );
     numberOfSamples_ = static_cast< int >( samples.size( ) );
+    gaussianKernelTruncationDistance_ = 7.0;
 
     // Check input consistency
     if( ( standardDeviation.rows( ) > 0 ) && ( standardDeviation.rows( ) != dimensions_  ) )
@@ -84,15 +89,16 @@ KernelDensityDistribution::KernelDensityDistribution(
 
     for( unsigned int i = 0; i < samples.size( ); i++ )
     {
-        if( dataSamples_.at( i ).rows( ) != dimensions_ )
+        if( samples.at( i ).rows( ) != dimensions_ )
         {
             std::string errorMessage = "Error when creating KernelDensityDistribution, samples size is inconsistent, should have size : " +
                     std::to_string( dimensions_ ) + "but entry " +
                     std::to_string( i ) + " has size " +
-                    std::to_string( dataSamples_.at( i ).rows( ) );
+                    std::to_string( samples.at( i ).rows( ) );
             throw std::runtime_error( errorMessage );
         }
     }
+    sampleMatrix_ = convertSampleDataToMatrix( samples );
 
     // Compute datasample properties
     computeSampleMean( );
@@ -118,17 +124,18 @@ KernelDensityDistribution::KernelDensityDistribution(
         bandWidth_ = optimalBandwidth_ * bandWidthFactor;
     }
 
-    // Construct kernel matrix rows: samples, cols: dimensions_
+    // Set kernels (kernel matrix rows: samples, cols: dimensions_), which are created when first needed.
     kernelType_ = kernelType;
 
-    generateKernelPointerMatrix( );
+    resetKernels( );
 }
 
-//! Function that generates the kernel density distribution based on the samples and kernel type that is provided
-void KernelDensityDistribution::generateKernelPointerMatrix( )
+//! Function to reset the kernels after a change of the bandwidth.
+void KernelDensityDistribution::resetKernels( )
 {
-    // Clear existing kernels.
+    // Clear existing kernels and tree.
     kernelPointersMatrix_.clear( );
+    sampleTree_.reset( );
 
     // Check for numerical problems with bandwidths.
     for( int i = 0; i < bandWidth_.rows( ); i++ )
@@ -142,15 +149,39 @@ void KernelDensityDistribution::generateKernelPointerMatrix( )
         }
     }
 
+    // Compute normalization factor of product of kernels of single sample.
+    if( kernelType_ == KernelType::epanechnikov_kernel )
+    {
+        kernelNormalizationFactor_ = std::pow( 0.75, dimensions_ ) / bandWidth_.prod( );
+    }
+    else if( kernelType_ == KernelType::gaussian_kernel )
+    {
+        kernelNormalizationFactor_ =
+                std::pow( 2.0 * mathematical_constants::PI, -0.5 * static_cast< double >( dimensions_ ) ) /
+                bandWidth_.prod( );
+    }
+    else
+    {
+        throw std::runtime_error( "Error when resetting probability kernels, kernel type not recognized" );
+    }
+}
+
+//! Function that generates the kernel density distribution based on the samples and kernel type that is provided
+void KernelDensityDistribution::generateKernelPointerMatrix( )
+{
+    // Clear existing kernels.
+    kernelPointersMatrix_.clear( );
+    kernelPointersMatrix_.reserve( numberOfSamples_ );
+
     // Fill kernel pointer matrix with distribution pointer objects
-    std::vector< boost::shared_ptr< ContinuousProbabilityDistribution< double > > > vector( dataSamples_[ 0 ].rows( ) );
+    std::vector< boost::shared_ptr< ContinuousProbabilityDistribution< double > > > vector( dimensions_ );
 
     // Iterate over all samples; create kernel for each entry in each sample
-    for( unsigned int i = 0; i < dataSamples_.size( ); i++ )
+    for( int i = 0; i < numberOfSamples_; i++ )
     {
         for( unsigned int j = 0; j < vector.size( ); j++ )
         {
-            vector[ j ] = constructKernel( dataSamples_[ i ]( j ), bandWidth_( j ) );
+            vector[ j ] = constructKernel( sampleMatrix_( j, i ), bandWidth_( j ) );
         }
         kernelPointersMatrix_.push_back( vector );
     }
@@ -160,9 +191,9 @@ void KernelDensityDistribution::generateKernelPointerMatrix( )
 void KernelDensityDistribution::computeSampleMean( )
 {
     sampleMean_ = Eigen::VectorXd::Zero( dimensions_ );
-    for( unsigned int i = 0; i < dataSamples_.size( ); i++ )
+    for( int i = 0; i < numberOfSamples_; i++ )
     {
-        sampleMean_ +=  dataSamples_[ i ];
+        sampleMean_ += sampleMatrix_.col( i );
     }
     sampleMean_ = sampleMean_ / static_cast< double >( numberOfSamples_ );
 }
@@ -171,9 +202,9 @@ void KernelDensityDistribution::computeSampleMean( )
 void KernelDensityDistribution::computeSampleVariance( )
 {
     sampleVariance_ = Eigen::VectorXd::Zero( dimensions_ );
-    for( unsigned int i = 0; i < dataSamples_.size( ); i++ )
+    for( int i = 0; i < numberOfSamples_; i++ )
     {
-        sampleVariance_ += ( dataSamples_[ i ] - sampleMean_ ).cwiseAbs2( );
+        sampleVariance_ += ( sampleMatrix_.col( i ) - sampleMean_ ).cwiseAbs2( );
     }
     sampleVariance_ = sampleVariance_ / ( static_cast< double >( numberOfSamples_ ) - 1.0 );
     sampleStandardDeviation_ = sampleVariance_.cwiseSqrt( );
@@ -183,11 +214,11 @@ void KernelDensityDistribution::computeSampleVariance( )
 void KernelDensityDistribution::scaleSamplesWithVariance(
         const Eigen::VectorXd& standardDeviation )
 {
-    for( unsigned int i = 0; i < dataSamples_.size( ); i++ )
+    for( int i = 0; i < numberOfSamples_; i++ )
     {
-        for( int j = 0; j < dataSamples_[ i ].rows( ); j++ )
+        for( int j = 0; j < dimensions_; j++ )
         {
-            dataSamples_[ i ]( j ) = dataSamples_[ i ]( j ) / sampleStandardDeviation_( j ) * standardDeviation( j );
+            sampleMatrix_( j, i ) = sampleMatrix_( j, i ) / sampleStandardDeviation_( j ) * standardDeviation( j );
         }
     }
 }
@@ -198,14 +229,9 @@ void KernelDensityDistribution::computeOptimalBandWidth( )
     optimalBandwidth_ = Eigen::VectorXd::Zero( dimensions_, 1);
 
     // Calculate sigma (median absolute deviation estimator)
-    Eigen::VectorXd medianOfSamples = getMedian( dataSamples_ );
+    Eigen::VectorXd medianOfSamples = getMedian( sampleMatrix_ );
 
-    std::vector< Eigen::VectorXd > dataSamples2( dataSamples_.size( ) );
-    for( unsigned int i = 0; i < dataSamples_.size( ); i++ )
-    {
-        dataSamples2[ i ] = dataSamples_[ i ] - medianOfSamples;
-        dataSamples2[ i ] = dataSamples2[ i ].cwiseAbs( );
-    }
+    Eigen::MatrixXd dataSamples2 = ( sampleMatrix_.colwise( ) - medianOfSamples ).cwiseAbs( );
 
     Eigen::VectorXd medianOfSamples2 = getMedian( dataSamples2 );
     Eigen::VectorXd sigma = medianOfSamples2 / 0.6745;
@@ -218,28 +244,20 @@ void KernelDensityDistribution::computeOptimalBandWidth( )
 
 //! Function to retrieve the sample set median
 Eigen::VectorXd KernelDensityDistribution::getMedian(
-        const std::vector< Eigen::VectorXd >& samples )
+        const Eigen::MatrixXd& samples )
 {
-    int sampleDimensions = samples[ 0 ].rows( );
-    std::vector< std::vector< double > > dataSamplesVectors( sampleDimensions );
+    int sampleDimensions = samples.rows( );
 
-    // Create vector of j^th entry from each sample
-    std::vector< double > data( 0 );
+    // Compute sample median for each entry of samples, from vector of i^th entry of each sample.
+    Eigen::VectorXd medianOfSamples( sampleDimensions );
+    std::vector< double > data( samples.cols( ) );
     for( int i = 0; i < sampleDimensions; i++ )
     {
-        for( unsigned int j = 0; j < samples.size( ); j++ )
+        for( int j = 0; j < samples.cols( ); j++ )
         {
-            data.push_back( samples[ j ]( i ) );
+            data[ j ] = samples( i, j );
         }
-        dataSamplesVectors[ i ] = data;
-        data.clear( );
-    }
-
-    // Compute sample median for each entry of samples.
-    Eigen::VectorXd medianOfSamples( sampleDimensions );
-    for( int i = 0; i < sampleDimensions; i++ )
-    {
-        medianOfSamples[ i ] = tudat::statistics::computeSampleMedian( dataSamplesVectors[ i ] );
+        medianOfSamples[ i ] = tudat::statistics::computeSampleMedian( data );
     }
     return medianOfSamples;
 }
@@ -247,6 +265,8 @@ Eigen::VectorXd KernelDensityDistribution::getMedian(
 //! Get probability density of the kernel density distribution
 double KernelDensityDistribution::evaluatePdf( const Eigen::VectorXd& independentVariables )
 {
+    initializeKernelPointerMatrix( );
+
     double propbabilityDensity = 0.0;
     double currentKernelPdf = 1.0;
 
@@ -268,9 +288,96 @@ double KernelDensityDistribution::evaluatePdf( const Eigen::VectorXd& independen
     return propbabilityDensity / static_cast< double >( numberOfSamples_ );
 }
 
+//! Function to evaluate pdf of distribution at a set of points, using a k-d tree of the samples.
+Eigen::VectorXd KernelDensityDistribution::evaluatePdfAtPoints(
+        const Eigen::MatrixXd& independentVariables, const unsigned int numberOfThreads )
+{
+    if( independentVariables.rows( ) != dimensions_ )
+    {
+        throw std::runtime_error( "Error when evaluating kernel density at set of points, points have size " +
+                                  std::to_string( independentVariables.rows( ) ) + ", but distribution has size " +
+                                  std::to_string( dimensions_ ) );
+    }
+
+    // Create tree of samples scaled by bandwidth (before starting threads, which only read from tree).
+    if( sampleTree_ == NULL )
+    {
+        sampleTree_ = boost::make_shared< KdTree >( bandWidth_.cwiseInverse( ).asDiagonal( ) * sampleMatrix_ );
+    }
+
+    // Evaluate pdf in contiguous blocks of points.
+    Eigen::VectorXd probabilityDensities = Eigen::VectorXd::Zero( independentVariables.cols( ) );
+    utilities::parallelForBlocks(
+                independentVariables.cols( ), numberOfThreads,
+                boost::bind( &KernelDensityDistribution::evaluatePdfBlockFromSampleTree, this,
+                             boost::cref( independentVariables ), _2, _3, boost::ref( probabilityDensities ) ) );
+
+    return probabilityDensities;
+}
+
+//! Function to evaluate the pdf at a contiguous block of points, using the k-d tree of the samples.
+void KernelDensityDistribution::evaluatePdfBlockFromSampleTree(
+        const Eigen::MatrixXd& independentVariables, const int startIndex, const int endIndex,
+        Eigen::VectorXd& probabilityDensities ) const
+{
+    std::vector< std::pair< int, int > > sampleRanges;
+    for( int i = startIndex; i < endIndex; i++ )
+    {
+        probabilityDensities( i ) = evaluatePdfFromSampleTree(
+                    independentVariables.col( i ).cwiseQuotient( bandWidth_ ), sampleRanges );
+    }
+}
+
+//! Function to evaluate the pdf at a single (scaled) point using the k-d tree of the samples.
+double KernelDensityDistribution::evaluatePdfFromSampleTree(
+        const Eigen::VectorXd& scaledIndependentVariables, std::vector< std::pair< int, int > >& sampleRanges ) const
+{
+    const Eigen::MatrixXd& scaledSamples = sampleTree_->getSortedPoints( );
+    double probabilityDensity = 0.0;
+
+    if( kernelType_ == KernelType::epanechnikov_kernel )
+    {
+        // Retrieve samples for which all one-dimensional kernels are non-zero.
+        sampleTree_->getPointRangesInBox( scaledIndependentVariables, 1.0, sampleRanges );
+        for( unsigned int i = 0; i < sampleRanges.size( ); i++ )
+        {
+            for( int j = sampleRanges[ i ].first; j < sampleRanges[ i ].second; j++ )
+            {
+                double currentKernelPdf = 1.0;
+                for( int currentDimension = 0; currentDimension < dimensions_; currentDimension++ )
+                {
+                    const double scaledDistance =
+                            scaledIndependentVariables( currentDimension ) - scaledSamples( currentDimension, j );
+                    currentKernelPdf *= std::max( 1.0 - scaledDistance * scaledDistance, 0.0 );
+                }
+                probabilityDensity += currentKernelPdf;
+            }
+        }
+    }
+    else
+    {
+        // Retrieve samples within truncation distance; product of Gaussian kernels only depends on scaled distance.
+        sampleTree_->getPointRangesWithinDistance(
+                    scaledIndependentVariables, gaussianKernelTruncationDistance_, sampleRanges );
+        for( unsigned int i = 0; i < sampleRanges.size( ); i++ )
+        {
+            for( int j = sampleRanges[ i ].first; j < sampleRanges[ i ].second; j++ )
+            {
+                probabilityDensity += std::exp(
+                            -0.5 * ( scaledIndependentVariables - scaledSamples.col( j ) ).squaredNorm( ) );
+            }
+        }
+    }
+
+    // Average over all kernels
+    return kernelNormalizationFactor_ * probabilityDensity / static_cast< double >( numberOfSamples_ );
+}
+
 //! Get cumulative probability of the kernel density distribution
 double KernelDensityDistribution::evaluateCdf( const Eigen::VectorXd& independentVariables )
 {
+    initializeKernelPointerMatrix( );
+
     double cumulativeProbability = 0.0;
     double currentKernelCdf = 1.0;
 
@@ -296,6 +403,8 @@ double KernelDensityDistribution::evaluateCdf( const Eigen::VectorXd& independen
 double KernelDensityDistribution::evaluateCumulativeMarginalProbability(
         const int marginalDimension, const double independentVariable )
 {
+    initializeKernelPointerMatrix( );
+
     // Compute cdf at independentVariable in marginalDimension, averaged over all samples
     double cumulativeProbability = 0.0;
     for( int i = 0; i < numberOfSamples_; i++ )
@@ -309,6 +418,8 @@ double KernelDensityDistribution::evaluateCumulativeMarginalProbability(
 double KernelDensityDistribution::evaluateMarginalProbabilityDensity(
         const std::vector< int >& marginalDimensions, const Eigen::VectorXd& independentVariables )
 {
+    initializeKernelPointerMatrix( );
+
     double probabilityDensity = 0.0;
     double marginalPdfOfCurrentKernel = 1.0;
 
@@ -334,6 +445,8 @@ double KernelDensityDistribution::evaluateMarginalProbabilityDensity(
 double KernelDensityDistribution::evaluateMarginalProbabilityDensity(
         const int marginalDimension, const double independentVariable )
 {
+    initializeKernelPointerMatrix( );
+
     double probabilityDensity = 0.0;
 
     // Compute pdf at independentVariable in marginalDimension, averaged over all samples
@@ -350,6 +463,8 @@ double KernelDensityDistribution::evaluateCumulativeConditionalMarginalProbabili
         const std::vector< double >& conditions,
         const int marginalDimension, const double independentVariable )
 {
+    initializeKernelPointerMatrix( );
+
     if( std::find( conditionDimensions.begin( ), conditionDimensions.end( ), marginalDimension ) !=
             conditionDimensions.end( ) )
     {
@@ -387,6 +502,8 @@ double KernelDensityDistribution::evaluateConditionalMarginalProbabilityDensity(
         const std::vector< double >& conditions,
         const int marginalDimension, const double independentVariable )
 {
+    initializeKernelPointerMatrix( );
+
     if( std::find( conditionDimensions.begin( ), conditionDimensions.end( ), marginalDimension ) !=
             conditionDimensions.end( ) )
     {
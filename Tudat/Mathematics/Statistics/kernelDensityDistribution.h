@@ -17,6 +17,7 @@
 
 #include "Tudat/Mathematics/Statistics/continuousProbabilityDistributions.h"
 #include "Tudat/Mathematics/Statistics/boostProbabilityDistributions.h"
+#include "Tudat/Mathematics/Statistics/kdTree.h"
 namespace tudat
 {
 
@@ -76,6 +77,10 @@ enum KernelType
  *  Class that uses random samples to generate a multivariate probability distribution using Kernel Density distribution.
  *  The bandwidth of the kernels may be supplied by the user, or an optimal distrubution may be computed by this class
  *  At present, the user has the choice of a Gaussian or Epanechnikov distribution for the kernels.
+ *  The samples are stored contiguously in a matrix. The objects for the individual kernels (used by the pdf, cdf and
+ *  marginal distribution functions) are only created when first needed. For large sample sets, the pdf may be evaluated
+ *  at many points at once using the evaluatePdfAtPoints function, which only evaluates the kernels close to each point
+ *  (retrieved from a k-d tree of the samples), and may use multiple threads.
  */
 class KernelDensityDistribution: public tudat::statistics::ContinuousProbabilityDistribution< Eigen::VectorXd >
 {
@@ -111,6 +116,21 @@ public:
      */
     double evaluatePdf( const Eigen::VectorXd& independentVariables );
 
+    //! Function to evaluate pdf of distribution at a set of points, using a k-d tree of the samples.
+    /*!
+     *  Function to evaluate probability distribution function at a set of points. For each point, only the kernels of
+     *  the samples close to the point are evaluated, which are retrieved from a k-d tree of the samples (scaled by the
+     *  bandwidth), which is created upon the first call of this function. For Epanechnikov kernels, this is exact, as
+     *  these kernels are zero beyond one bandwidth from their mean. For Gaussian kernels, the kernels are truncated at
+     *  a given (scaled) Euclidean distance from the point (see setGaussianKernelTruncationDistance). The points may be
+     *  distributed over multiple threads.
+     *  \param independentVariables Values of independent variables, with each column containing one point.
+     *  \param numberOfThreads Number of threads that is to be used (0 to use number of hardware threads).
+     *  \return Evaluated pdf at each of the points (entry i for column i of independentVariables).
+     */
+    Eigen::VectorXd evaluatePdfAtPoints( const Eigen::MatrixXd& independentVariables,
+                                         const unsigned int numberOfThreads = 1 );
+
     //! Function to evaluate cdf of distribution
     /*!
      *  Function to evaluate cumulative distribution function at given independentVariable value.
@@ -210,7 +230,22 @@ public:
      */
     std::vector< Eigen::VectorXd > getSamples( )
     {
-        return dataSamples_;
+        std::vector< Eigen::VectorXd > dataSamples( numberOfSamples_ );
+        for( int i = 0; i < numberOfSamples_; i++ )
+        {
+            dataSamples[ i ] = sampleMatrix_.col( i );
+        }
+        return dataSamples;
+    }
+
+    //! Function to retrieve the data samples used to generate kernel density distribution, stored in a matrix.
+    /*!
+     * Function to retrieve the data samples used to generate kernel density distribution, stored in a matrix.
+     * \return Data samples used to generate kernel density distribution, with each column containing one sample.
+     */
+    const Eigen::MatrixXd& getSampleMatrix( )
+    {
+        return sampleMatrix_;
     }
 
     //! Function to manually reset the bandwidth
@@ -221,7 +256,20 @@ public:
     void setBandWidth( const Eigen::VectorXd& bandWidth )
     {
         bandWidth_ = bandWidth;
-        generateKernelPointerMatrix( ); // Reset kernels
+        resetKernels( );
+    }
+
+    //! Function to reset the distance at which Gaussian kernels are truncated when evaluating the pdf at a set of points
+    /*!
+     * Function to reset the distance at which Gaussian kernels are truncated when evaluating the pdf at a set of points
+     * using evaluatePdfAtPoints. The distance is the Euclidean distance between the point and the sample, with each
+     * entry scaled by the bandwidth, so that the relative contribution of each neglected kernel is less than
+     * exp( -0.5 * truncationDistance^2 ) of its maximum value (default truncation distance is 7).
+     * \param truncationDistance New truncation distance.
+     */
+    void setGaussianKernelTruncationDistance( const double truncationDistance )
+    {
+        gaussianKernelTruncationDistance_ = truncationDistance;
     }
 
     //! Function to retrieve the sample mean.
@@ -306,6 +354,45 @@ private:
      */
     void generateKernelPointerMatrix( );
 
+    //! Function to reset the kernels after a change of the bandwidth.
+    /*!
+     *  Function to reset the kernels after a change of the bandwidth, checking the bandwidth, removing existing kernels and
+     *  k-d tree (so that these are recreated when next needed) and computing the normalization factor of the kernels.
+     */
+    void resetKernels( );
+
+    //! Function to create the kernels, if these have not yet been created.
+    void initializeKernelPointerMatrix( )
+    {
+        if( kernelPointersMatrix_.size( ) == 0 )
+        {
+            generateKernelPointerMatrix( );
+        }
+    }
+
+    //! Function to evaluate the pdf at a single (scaled) point using the k-d tree of the samples.
+    /*!
+     * Function to evaluate the pdf at a single point using the k-d tree of the samples.
+     * \param scaledIndependentVariables Values of independent variables, divided (per entry) by the bandwidth.
+     * \param sampleRanges Pre-allocated vector used for ranges of samples retrieved from tree (contents are replaced).
+     * \return Evaluated pdf
+     */
+    double evaluatePdfFromSampleTree( const Eigen::VectorXd& scaledIndependentVariables,
+                                      std::vector< std::pair< int, int > >& sampleRanges ) const;
+
+    //! Function to evaluate the pdf at a contiguous block of points, using the k-d tree of the samples.
+    /*!
+     * Function to evaluate the pdf at a contiguous block of points, using the k-d tree of the samples (called by
+     * evaluatePdfAtPoints for each thread).
+     * \param independentVariables Values of independent variables, with each column containing one point.
+     * \param startIndex Index of the first point at which the pdf is to be evaluated.
+     * \param endIndex Index one past the last point at which the pdf is to be evaluated.
+     * \param probabilityDensities Evaluated pdf at each of the points (entries in block modified by reference).
+     */
+    void evaluatePdfBlockFromSampleTree( const Eigen::MatrixXd& independentVariables,
+                                         const int startIndex, const int endIndex,
+                                         Eigen::VectorXd& probabilityDensities ) const;
+
     //! Function that computes and sets the sample mean.
     /*!
      *  Function that computes and sets the sample mean (sampleMean_ variable).
@@ -329,13 +416,13 @@ private:
     //! Function to retrieve the sample set median
     /*!
      * Function to retrieve the sample set median
-     * \param samples Set of samples from which the (per entry) median is to be computed.
+     * \param samples Set of samples from which the (per entry) median is to be computed (one sample per column).
      * \return Sample set median
      */
-    Eigen::VectorXd getMedian( const std::vector< Eigen::VectorXd >& samples );
+    Eigen::VectorXd getMedian( const Eigen::MatrixXd& samples );
 
-    //! Datasamples
-    std::vector< Eigen::VectorXd > dataSamples_;
+    //! Datasamples, with each column containing one sample.
+    Eigen::MatrixXd sampleMatrix_;
 
     //! Sample mean (per entry)
     Eigen::VectorXd sampleMean_;
@@ -364,6 +451,15 @@ private:
     //! Matrix (vector of vectors) of 1D kernel pointers that define full kernel density distribution.
     std::vector< std::vector< boost::shared_ptr< ContinuousProbabilityDistribution< double > > > > kernelPointersMatrix_;
 
+    //! K-d tree of the samples, divided (per entry) by the bandwidth (created when first needed).
+    boost::shared_ptr< KdTree > sampleTree_;
+
+    //! Normalization factor of the product of the one-dimensional kernels of a single sample.
+    double kernelNormalizationFactor_;
+
+    //! Scaled distance at which Gaussian kernels are truncated when using the k-d tree of the samples.
+    double gaussianKernelTruncationDistance_;
+
 };
 
 //! Pointer to Kernel Density distribution class
@@ -0,0 +1,245 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+#include "Tudat/Mathematics/Statistics/streamingStatistics.h"
+
+namespace tudat
+{
+
+namespace statistics
+{
+
+//! Constructor
+PSquareQuantileEstimator::PSquareQuantileEstimator( const double probability ):
+    probability_( probability ), numberOfValues_( 0 )
+{
+    if( !( probability >= 0.0 && probability <= 1.0 ) )
+    {
+        throw std::runtime_error( "Error when creating quantile estimator, probability " +
+                                  std::to_string( probability ) + " is not in range [0,1]" );
+    }
+
+    for( unsigned int i = 0; i < 5; i++ )
+    {
+        markerHeights_[ i ] = 0.0;
+        markerPositions_[ i ] = static_cast< double >( i + 1 );
+    }
+
+    desiredMarkerPositions_[ 0 ] = 1.0;
+    desiredMarkerPositions_[ 1 ] = 1.0 + 2.0 * probability_;
+    desiredMarkerPositions_[ 2 ] = 1.0 + 4.0 * probability_;
+    desiredMarkerPositions_[ 3 ] = 3.0 + 2.0 * probability_;
+    desiredMarkerPositions_[ 4 ] = 5.0;
+
+    desiredMarkerPositionIncrements_[ 0 ] = 0.0;
+    desiredMarkerPositionIncrements_[ 1 ] = probability_ / 2.0;
+    desiredMarkerPositionIncrements_[ 2 ] = probability_;
+    desiredMarkerPositionIncrements_[ 3 ] = ( 1.0 + probability_ ) / 2.0;
+    desiredMarkerPositionIncrements_[ 4 ] = 1.0;
+}
+
+//! Function to add a value to the stream
+void PSquareQuantileEstimator::addValue( const double value )
+{
+    // Store (sorted) first five values.
+    if( numberOfValues_ < 5 )
+    {
+        markerHeights_[ numberOfValues_ ] = value;
+        numberOfValues_++;
+        std::sort( markerHeights_, markerHeights_ + numberOfValues_ );
+        return;
+    }
+    numberOfValues_++;
+
+    // Find cell in which value is located, and update extreme markers if needed.
+    int cellIndex;
+    if( value < markerHeights_[ 0 ] )
+    {
+        markerHeights_[ 0 ] = value;
+        cellIndex = 0;
+    }
+    else if( value >= markerHeights_[ 4 ] )
+    {
+        markerHeights_[ 4 ] = value;
+        cellIndex = 3;
+    }
+    else
+    {
+        cellIndex = 0;
+        while( value >= markerHeights_[ cellIndex + 1 ] )
+        {
+            cellIndex++;
+        }
+    }
+
+    // Update marker positions.
+    for( int i = cellIndex + 1; i < 5; i++ )
+    {
+        markerPositions_[ i ] += 1.0;
+    }
+    for( int i = 0; i < 5; i++ )
+    {
+        desiredMarkerPositions_[ i ] += desiredMarkerPositionIncrements_[ i ];
+    }
+
+    // Adjust heights of middle markers, if they deviate from their desired positions.
+    for( int i = 1; i < 4; i++ )
+    {
+        const double positionDeviation = desiredMarkerPositions_[ i ] - markerPositions_[ i ];
+        if( ( positionDeviation >= 1.0 && markerPositions_[ i + 1 ] - markerPositions_[ i ] > 1.0 ) ||
+                ( positionDeviation <= -1.0 && markerPositions_[ i - 1 ] - markerPositions_[ i ] < -1.0 ) )
+        {
+            const double direction = ( positionDeviation > 0.0 ) ? 1.0 : -1.0;
+            const double parabolicHeight = computeParabolicPrediction( i, direction );
+            if( markerHeights_[ i - 1 ] < parabolicHeight && parabolicHeight < markerHeights_[ i + 1 ] )
+            {
+                markerHeights_[ i ] = parabolicHeight;
+            }
+            else
+            {
+                // Use linear prediction if parabolic prediction is not monotonic.
+                const int neighbourIndex = i + static_cast< int >( direction );
+                markerHeights_[ i ] += direction * ( markerHeights_[ neighbourIndex ] - markerHeights_[ i ] ) /
+                        ( markerPositions_[ neighbourIndex ] - markerPositions_[ i ] );
+            }
+            markerPositions_[ i ] += direction;
+        }
+    }
+}
+
+//! Function to retrieve the current estimate of the quantile
+double PSquareQuantileEstimator::getQuantile( ) const
+{
+    if( numberOfValues_ == 0 )
+    {
+        return TUDAT_NAN;
+    }
+    else if( numberOfValues_ <= 5 )
+    {
+        // Interpolate linearly between sorted values.
+        const double position = probability_ * static_cast< double >( numberOfValues_ - 1 );
+        const unsigned int lowerIndex = std::min( static_cast< unsigned int >( position ), numberOfValues_ - 1 );
+        const unsigned int upperIndex = std::min( lowerIndex + 1, numberOfValues_ - 1 );
+        return markerHeights_[ lowerIndex ] + ( position - static_cast< double >( lowerIndex ) ) *
+                ( markerHeights_[ upperIndex ] - markerHeights_[ lowerIndex ] );
+    }
+    else
+    {
+        return markerHeights_[ 2 ];
+    }
+}
+
+//! Function to compute the piecewise-parabolic prediction of the height of a marker
+double PSquareQuantileEstimator::computeParabolicPrediction( const int markerIndex, const double direction ) const
+{
+    const double previousPosition = markerPositions_[ markerIndex - 1 ];
+    const double currentPosition = markerPositions_[ markerIndex ];
+    const double nextPosition = markerPositions_[ markerIndex + 1 ];
+    return markerHeights_[ markerIndex ] + direction / ( nextPosition - previousPosition ) * (
+                ( currentPosition - previousPosition + direction ) *
+                ( markerHeights_[ markerIndex + 1 ] - markerHeights_[ markerIndex ] ) /
+                ( nextPosition - currentPosition ) +
+                ( nextPosition - currentPosition - direction ) *
+                ( markerHeights_[ markerIndex ] - markerHeights_[ markerIndex - 1 ] ) /
+                ( currentPosition - previousPosition ) );
+}
+
+//! Function to add a sample
+void StreamingStatistics::addSample( const Eigen::VectorXd& sample )
+{
+    // Initialize statistics upon first sample.
+    if( numberOfSamples_ == 0 )
+    {
+        sampleMean_ = Eigen::VectorXd::Zero( sample.rows( ) );
+        sumOfDeviationProducts_ = Eigen::MatrixXd::Zero( sample.rows( ), sample.rows( ) );
+
+        quantileEstimators_.clear( );
+        for( int i = 0; i < sample.rows( ); i++ )
+        {
+            quantileEstimators_.push_back( std::vector< PSquareQuantileEstimator >( ) );
+            for( unsigned int j = 0; j < quantileProbabilities_.size( ); j++ )
+            {
+                quantileEstimators_[ i ].push_back( PSquareQuantileEstimator( quantileProbabilities_.at( j ) ) );
+            }
+        }
+    }
+    else if( sample.rows( ) != sampleMean_.rows( ) )
+    {
+        throw std::runtime_error( "Error when adding sample to statistics, size " +
+                                  std::to_string( sample.rows( ) ) + " is inconsistent with previous size " +
+                                  std::to_string( sampleMean_.rows( ) ) );
+    }
+
+    // Update mean and covariance (Welford, 1962).
+    numberOfSamples_++;
+    const Eigen::VectorXd deviationFromPreviousMean = sample - sampleMean_;
+    sampleMean_ += deviationFromPreviousMean / static_cast< double >( numberOfSamples_ );
+    sumOfDeviationProducts_.noalias( ) += deviationFromPreviousMean * ( sample - sampleMean_ ).transpose( );
+
+    // Update quantile estimates.
+    for( int i = 0; i < sample.rows( ); i++ )
+    {
+        for( unsigned int j = 0; j < quantileEstimators_[ i ].size( ); j++ )
+        {
+            quantileEstimators_[ i ][ j ].addValue( sample( i ) );
+        }
+    }
+}
+
+//! Function to retrieve the sample mean
+Eigen::VectorXd StreamingStatistics::getSampleMean( ) const
+{
+    if( numberOfSamples_ == 0 )
+    {
+        throw std::runtime_error( "Error when retrieving sample mean, no samples have been added." );
+    }
+    return sampleMean_;
+}
+
+//! Function to retrieve the (unbiased) sample covariance
+Eigen::MatrixXd StreamingStatistics::getSampleCovariance( ) const
+{
+    if( numberOfSamples_ < 2 )
+    {
+        throw std::runtime_error( "Error when retrieving sample covariance, at least two samples are required." );
+    }
+
+    // Symmetrize, to remove round-off in the incremental update.
+    return ( sumOfDeviationProducts_ + sumOfDeviationProducts_.transpose( ) ) /
+            ( 2.0 * static_cast< double >( numberOfSamples_ - 1 ) );
+}
+
+//! Function to retrieve the estimated quantiles of each of the sample entries
+Eigen::VectorXd StreamingStatistics::getQuantiles( const unsigned int quantileIndex ) const
+{
+    if( quantileIndex >= quantileProbabilities_.size( ) )
+    {
+        throw std::runtime_error( "Error when retrieving quantiles, index " + std::to_string( quantileIndex ) +
+                                  " exceeds number of quantile probabilities." );
+    }
+
+    Eigen::VectorXd quantiles = Eigen::VectorXd::Constant( sampleMean_.rows( ), TUDAT_NAN );
+    for( unsigned int i = 0; i < quantileEstimators_.size( ); i++ )
+    {
+        quantiles( i ) = quantileEstimators_[ i ][ quantileIndex ].getQuantile( );
+    }
+    return quantiles;
+}
+
+} // namespace statistics
+
+} // namespace tudat
@@ -0,0 +1,196 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Welford, B.P. Note on a Method for Calculating Corrected Sums of Squares and Products,
+ *          Technometrics, 4(3), 419-420, 1962.
+ *      Jain, R. and Chlamtac, I. The P^2 Algorithm for Dynamic Calculation of Quantiles and
+ *          Histograms Without Storing Observations, Communications of the ACM, 28(10), 1076-1085, 1985.
+ *
+ */
+
+#ifndef TUDAT_STREAMING_STATISTICS_H
+#define TUDAT_STREAMING_STATISTICS_H
+
+#include <vector>
+
+#include <Eigen/Core>
+
+namespace tudat
+{
+
+namespace statistics
+{
+
+//! Class for the estimation of a quantile of a stream of values, without storing the values.
+/*!
+ *  Class for the estimation of a quantile of a stream of values, using the P^2 algorithm (Jain and Chlamtac, 1985).
+ *  Only five markers are stored, the heights of which are updated with each new value by piecewise-parabolic
+ *  interpolation, so that the memory use is independent of the number of values. The minimum and maximum of the values
+ *  are retrieved exactly. For fewer than five values, the quantile is computed exactly from the stored values.
+ */
+class PSquareQuantileEstimator
+{
+public:
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param probability Probability of the quantile that is to be estimated (between 0 and 1, e.g. 0.5 for median).
+     */
+    PSquareQuantileEstimator( const double probability );
+
+    //! Function to add a value to the stream
+    /*!
+     * Function to add a value to the stream, updating the marker heights and positions.
+     * \param value Value that is to be added.
+     */
+    void addValue( const double value );
+
+    //! Function to retrieve the current estimate of the quantile
+    /*!
+     * Function to retrieve the current estimate of the quantile (NaN if no values have been added).
+     * \return Current estimate of the quantile.
+     */
+    double getQuantile( ) const;
+
+    //! Function to retrieve the probability of the quantile that is estimated
+    /*!
+     * Function to retrieve the probability of the quantile that is estimated
+     * \return Probability of the quantile that is estimated
+     */
+    double getProbability( ) const
+    {
+        return probability_;
+    }
+
+private:
+
+    //! Function to compute the piecewise-parabolic prediction of the height of a marker
+    /*!
+     * Function to compute the piecewise-parabolic prediction of the height of a marker when moved by one position.
+     * \param markerIndex Index of the marker (1, 2 or 3).
+     * \param direction Direction in which the marker is moved (-1 or 1).
+     * \return Predicted height of the marker.
+     */
+    double computeParabolicPrediction( const int markerIndex, const double direction ) const;
+
+    //! Probability of the quantile that is estimated
+    double probability_;
+
+    //! Number of values that have been added
+    unsigned int numberOfValues_;
+
+    //! Heights of the markers (first values, sorted, while fewer than five values have been added).
+    double markerHeights_[ 5 ];
+
+    //! Actual positions of the markers
+    double markerPositions_[ 5 ];
+
+    //! Desired positions of the markers
+    double desiredMarkerPositions_[ 5 ];
+
+    //! Increments of the desired positions of the markers per added value
+    double desiredMarkerPositionIncrements_[ 5 ];
+};
+
+//! Class for the computation of statistics of a stream of vector-valued samples, without storing the samples.
+/*!
+ *  Class for the computation of the sample mean, sample covariance and (optionally) quantiles of a stream of
+ *  vector-valued samples, without storing the samples (e.g. for the statistics of the results of a large number of
+ *  Monte Carlo simulations). The mean and covariance are updated with each sample using Welford's (1962) algorithm,
+ *  and are equal to the results of computeSampleMean and computeSampleVariance (to within round-off), while the
+ *  quantiles of each of the sample entries are estimated using a PSquareQuantileEstimator. The size of the samples is
+ *  set by the first sample that is added.
+ */
+class StreamingStatistics
+{
+public:
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param quantileProbabilities Probabilities of the quantiles that are to be estimated for each of the sample
+     * entries (none by default).
+     */
+    StreamingStatistics( const std::vector< double >& quantileProbabilities = std::vector< double >( ) ):
+        quantileProbabilities_( quantileProbabilities ), numberOfSamples_( 0 ){ }
+
+    //! Function to add a sample
+    /*!
+     * Function to add a sample, updating the sample mean, covariance and quantile estimates.
+     * \param sample Sample that is to be added (size must be equal to that of the first sample).
+     */
+    void addSample( const Eigen::VectorXd& sample );
+
+    //! Function to retrieve the number of samples that have been added
+    /*!
+     * Function to retrieve the number of samples that have been added
+     * \return Number of samples that have been added
+     */
+    unsigned int getNumberOfSamples( ) const
+    {
+        return numberOfSamples_;
+    }
+
+    //! Function to retrieve the sample mean
+    /*!
+     * Function to retrieve the sample mean (error is thrown if no samples have been added).
+     * \return Sample mean
+     */
+    Eigen::VectorXd getSampleMean( ) const;
+
+    //! Function to retrieve the (unbiased) sample covariance
+    /*!
+     * Function to retrieve the (unbiased) sample covariance (error is thrown if fewer than two samples have been added).
+     * \return Sample covariance
+     */
+    Eigen::MatrixXd getSampleCovariance( ) const;
+
+    //! Function to retrieve the estimated quantiles of each of the sample entries
+    /*!
+     * Function to retrieve the estimated quantiles of each of the sample entries, for a single quantile probability.
+     * \param quantileIndex Index of the quantile probability (in the list provided to the constructor).
+     * \return Estimated quantiles of each of the sample entries.
+     */
+    Eigen::VectorXd getQuantiles( const unsigned int quantileIndex ) const;
+
+    //! Function to retrieve the probabilities of the quantiles that are estimated
+    /*!
+     * Function to retrieve the probabilities of the quantiles that are estimated
+     * \return Probabilities of the quantiles that are estimated
+     */
+    std::vector< double > getQuantileProbabilities( ) const
+    {
+        return quantileProbabilities_;
+    }
+
+private:
+
+    //! Probabilities of the quantiles that are estimated
+    std::vector< double > quantileProbabilities_;
+
+    //! Number of samples that have been added
+    unsigned int numberOfSamples_;
+
+    //! Current sample mean
+    Eigen::VectorXd sampleMean_;
+
+    //! Current sum of outer products of deviations from the sample mean
+    Eigen::MatrixXd sumOfDeviationProducts_;
+
+    //! Quantile estimators, for each sample entry (outer vector) and quantile probability (inner vector).
+    std::vector< std::vector< PSquareQuantileEstimator > > quantileEstimators_;
+};
+
+} // namespace statistics
+
+} // namespace tudat
+
+#endif // TUDAT_STREAMING_STATISTICS_H
@@ -8,6 +8,9 @@
  *    http://tudat.tudelft.nl/LICENSE.
  */
 
+#include <boost/bind.hpp>
+#include <boost/make_shared.hpp>
+
 #include "Tudat/SimulationSetup/EnvironmentSetup/body.h"
 
 namespace tudat
@@ -75,6 +78,79 @@ void Body::setTemplatedState( const Eigen::Matrix< long double, 6, 1 >& state )
     setLongState( state );
 }
 
+//! Function to create a copy of the body that can be used independently of this object.
+boost::shared_ptr< Body > Body::createIndependentCopy( )
+{
+    // Check whether all models can be copied.
+    if( gravityFieldVariationSet_ != NULL )
+    {
+        throw std::runtime_error( "Error when creating independent copy of body, gravity field variations are not supported." );
+    }
+
+    // Copy current state quantities, and share all other models.
+    boost::shared_ptr< Body > copiedBody = boost::make_shared< Body >( *this );
+
+    // Create copies of models that are modified when being evaluated.
+    if( bodyEphemeris_ != NULL )
+    {
+        copiedBody->bodyEphemeris_ = bodyEphemeris_->createIndependentCopy( );
+    }
+
+    if( rotationalEphemeris_ != NULL )
+    {
+        copiedBody->rotationalEphemeris_ = rotationalEphemeris_->createIndependentCopy( );
+    }
+
+    if( gravityFieldModel_ != NULL )
+    {
+        copiedBody->gravityFieldModel_ = gravityFieldModel_->createIndependentCopy( );
+    }
+
+    if( atmosphereModel_ != NULL )
+    {
+        copiedBody->atmosphereModel_ = atmosphereModel_->createIndependentCopy( );
+    }
+
+    if( aerodynamicCoefficientInterface_ != NULL )
+    {
+        copiedBody->aerodynamicCoefficientInterface_ = aerodynamicCoefficientInterface_->createIndependentCopy( );
+    }
+
+    for( std::map< std::string, boost::shared_ptr< electro_magnetism::RadiationPressureInterface > >::const_iterator
+         radiationPressureIterator = radiationPressureInterfaces_.begin( );
+         radiationPressureIterator != radiationPressureInterfaces_.end( ); radiationPressureIterator++ )
+    {
+        copiedBody->radiationPressureInterfaces_[ radiationPressureIterator->first ] =
+                radiationPressureIterator->second->createIndependentCopy( );
+    }
+    copiedBody->radiationPressureIterator_ = copiedBody->radiationPressureInterfaces_.end( );
+
+    // Create ground stations with pointing angles calculators that use the copied rotational ephemeris.
+    for( std::map< std::string, boost::shared_ptr< ground_stations::GroundStation > >::const_iterator stationIterator =
+         groundStationMap.begin( ); stationIterator != groundStationMap.end( ); stationIterator++ )
+    {
+        boost::shared_ptr< ground_stations::GroundStationState > stationState =
+                stationIterator->second->getNominalStationState( );
+        boost::shared_ptr< ground_stations::PointingAnglesCalculator > pointingAnglesCalculator;
+        if( copiedBody->rotationalEphemeris_ != NULL )
+        {
+            pointingAnglesCalculator = boost::make_shared< ground_stations::PointingAnglesCalculator >(
+                        boost::bind( &ephemerides::RotationalEphemeris::getRotationToTargetFrame,
+                                     copiedBody->rotationalEphemeris_, _1 ),
+                        boost::bind( &ground_stations::GroundStationState::getRotationFromBodyFixedToTopocentricFrame,
+                                     stationState, _1 ) );
+        }
+        copiedBody->groundStationMap[ stationIterator->first ] = boost::make_shared< ground_stations::GroundStation >(
+                    stationState, pointingAnglesCalculator, stationIterator->first );
+    }
+
+    // Reset models that are created during acceleration model setup.
+    copiedBody->aerodynamicFlightConditions_.reset( );
+    copiedBody->dependentOrientationCalculator_.reset( );
+
+    return copiedBody;
+}
+
 //! Function ot retrieve the common global translational state origin of the environment
 std::string getGlobalFrameOrigin( const NamedBodyMap& bodyMap )
 {
@@ -1129,6 +1129,23 @@ public:
         bodyIsGlobalFrameOrigin_ = bodyIsGlobalFrameOrigin;
     }
 
+    //! Function to create a copy of the body that can be used independently of this object.
+    /*!
+     * Function to create a copy of the body that can be used independently of this object, for instance to run a
+     * propagation concurrently with a propagation that uses this body. All current state quantities are copied, the
+     * ephemeris, rotational ephemeris, gravity field, atmosphere, aerodynamic coefficient interface and radiation
+     * pressure interfaces are copied using their createIndependentCopy functions (which throw an exception for model
+     * types that do not support this), and all models that are not modified during a propagation (shape, ground
+     * station states and vehicle systems) are shared with this body. The ground stations are recreated, so that their
+     * pointing angles calculators use the copied rotational ephemeris. The flight conditions and dependent orientation
+     * calculator are not copied, as these are created for the copied body when creating its acceleration models. The
+     * frame-to-base-frame state function and the position functions of the radiation pressure interfaces are copied as
+     * is, and must be reset if they depend on other bodies (see createIndependentBodyMapCopy). An exception is thrown
+     * if the body has gravity field variations, for which an independent copy is not supported.
+     * \return Copy of the body that can be used independently of this object.
+     */
+    boost::shared_ptr< Body > createIndependentCopy( );
+
 protected:
 
 private:
@@ -8,6 +8,8 @@
  *    http://tudat.tudelft.nl/LICENSE.
  */
 
+#include <mutex>
+
 #include <boost/lambda/lambda.hpp>
 
 #include "Tudat/SimulationSetup/EnvironmentSetup/createAerodynamicCoefficientInterface.h"
@@ -18,6 +20,25 @@ namespace tudat
 namespace simulation_setup
 {
 
+//! Function to evaluate a one-dimensional coefficient interpolator, serializing concurrent evaluations.
+/*!
+ *  Function to evaluate a one-dimensional coefficient interpolator, serializing concurrent evaluations. The look-up
+ *  scheme of the interpolator may be modified during interpolation, so that evaluations by independent copies of a
+ *  coefficient interface that share the interpolator (see AerodynamicCoefficientInterface::createIndependentCopy)
+ *  must not run concurrently.
+ *  \param interpolator Interpolator that is to be evaluated.
+ *  \param interpolatorMutex Mutex associated with the interpolator.
+ *  \param independentVariables Independent variables at which the interpolator is to be evaluated (size 1).
+ *  \return Interpolated coefficients.
+ */
+static Eigen::Vector3d interpolateCoefficientsWithLock(
+        const boost::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::Vector3d > > interpolator,
+        const boost::shared_ptr< std::mutex > interpolatorMutex,
+        const std::vector< double >& independentVariables )
+{
+    std::lock_guard< std::mutex > interpolatorLock( *interpolatorMutex );
+    return interpolator->interpolate( independentVariables );
+}
 
 //! Function to create aerodynamic coefficient settings fom coefficients stored in data files
 boost::shared_ptr< AerodynamicCoefficientSettings > readTabulatedAerodynamicCoefficientsFromFiles(
@@ -163,10 +184,10 @@ createUnivariateTabulatedCoefficientAerodynamicCoefficientInterface(
 
         // Create aerodynamic coefficient interface.
         return  boost::make_shared< aerodynamics::CustomAerodynamicCoefficientInterface >(
-                    boost::bind( &interpolators::Interpolator
-                                 < double, Eigen::Vector3d >::interpolate, forceInterpolator, _1 ),
-                    boost::bind( &interpolators::Interpolator
-                                 < double, Eigen::Vector3d >::interpolate, momentInterpolator, _1 ),
+                    boost::bind( &interpolateCoefficientsWithLock, forceInterpolator,
+                                 boost::make_shared< std::mutex >( ), _1 ),
+                    boost::bind( &interpolateCoefficientsWithLock, momentInterpolator,
+                                 boost::make_shared< std::mutex >( ), _1 ),
                     tabulatedCoefficientSettings->getReferenceLength( ),
                     tabulatedCoefficientSettings->getReferenceArea( ),
                     tabulatedCoefficientSettings->getReferenceLength( ),
@@ -380,17 +380,18 @@ createTabulatedControlSurfaceIncrementAerodynamicCoefficientInterface(
 
     }
 
-    // Create interpolators for coefficients.
+    // Create interpolators for coefficients. A binary search look-up is used, which (unlike the hunting algorithm)
+    // does not modify the interpolator, so that independent copies of the interface can share the interpolators.
     boost::shared_ptr< interpolators::MultiLinearInterpolator
             < double, Eigen::Vector3d, NumberOfDimensions > > forceInterpolator =
             boost::make_shared< interpolators::MultiLinearInterpolator
             < double, Eigen::Vector3d, NumberOfDimensions > >(
-                independentVariables, forceCoefficients );
+                independentVariables, forceCoefficients, interpolators::binarySearch );
     boost::shared_ptr< interpolators::MultiLinearInterpolator
             < double, Eigen::Vector3d, NumberOfDimensions > > momentInterpolator =
             boost::make_shared< interpolators::MultiLinearInterpolator
             < double, Eigen::Vector3d, NumberOfDimensions > >(
-                independentVariables, momentCoefficients );
+                independentVariables, momentCoefficients, interpolators::binarySearch );
 
     // Create aerodynamic coefficient interface.
     return  boost::make_shared< aerodynamics::CustomControlSurfaceIncrementAerodynamicInterface >(
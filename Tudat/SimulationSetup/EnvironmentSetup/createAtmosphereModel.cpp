@@ -8,17 +8,22 @@
  *    http://tudat.tudelft.nl/LICENSE.
  */
 
+#include <cmath>
+
 #include <boost/make_shared.hpp>
 #include <boost/bind.hpp>
 
 #include "Tudat/Astrodynamics/Aerodynamics/exponentialAtmosphere.h"
 #include "Tudat/Astrodynamics/Aerodynamics/tabulatedAtmosphere.h"
+#include "Tudat/Astrodynamics/Aerodynamics/multiDimensionalTabulatedAtmosphere.h"
 #if USE_NRLMSISE00
 #include "Tudat/Astrodynamics/Aerodynamics/nrlmsise00Atmosphere.h"
 #include "Tudat/Astrodynamics/Aerodynamics/nrlmsise00InputFunctions.h"
+#include "Tudat/Astrodynamics/Aerodynamics/tabulatedNRLMSISE00Atmosphere.h"
 #endif
 #include "Tudat/InputOutput/basicInputOutput.h"
 #include "Tudat/InputOutput/solarActivityData.h"
+#include "Tudat/InputOutput/solarActivityTable.h"
 #include "Tudat/SimulationSetup/EnvironmentSetup/createAtmosphereModel.h"
 
 namespace tudat
@@ -27,6 +32,27 @@ namespace tudat
 namespace simulation_setup
 {
 
+//! Function to retrieve the default grid on which the NRLMSISE00 model is tabulated for a tabulated_nrlmsise00 model
+std::vector< std::vector< double > > getDefaultNRLMSISE00TabulationGrid( )
+{
+    std::vector< std::vector< double > > independentVariableGrid( 5 );
+    for( unsigned int i = 0; i <= 100; i++ )
+    {
+        independentVariableGrid[ 0 ].push_back( static_cast< double >( i ) * 10.0E3 );
+    }
+    for( int i = -6; i <= 6; i++ )
+    {
+        independentVariableGrid[ 1 ].push_back( static_cast< double >( i ) * 15.0 * mathematical_constants::PI / 180.0 );
+    }
+    for( unsigned int i = 0; i <= 12; i++ )
+    {
+        independentVariableGrid[ 2 ].push_back( static_cast< double >( i ) * 2.0 );
+    }
+    independentVariableGrid[ 3 ] = { 65.0, 100.0, 150.0, 200.0, 250.0, 300.0 };
+    independentVariableGrid[ 4 ] = { 0.0, 4.0, 15.0, 50.0, 150.0, 400.0 };
+    return independentVariableGrid;
+}
+
 //! Function to create a wind model.
 boost::shared_ptr< aerodynamics::WindModel > createWindModel(
         const boost::shared_ptr< WindModelSettings > windSettings,
@@ -112,6 +138,26 @@ boost::shared_ptr< aerodynamics::AtmosphereModel > createAtmosphereModel(
         }
         break;
     }
+    case multi_dimensional_tabulated_atmosphere:
+    {
+        // Check whether settings for atmosphere are consistent with its type
+        boost::shared_ptr< MultiDimensionalTabulatedAtmosphereSettings > multiDimensionalAtmosphereSettings =
+                boost::dynamic_pointer_cast< MultiDimensionalTabulatedAtmosphereSettings >( atmosphereSettings );
+        if( multiDimensionalAtmosphereSettings == NULL )
+        {
+            throw std::runtime_error(
+                        "Error, expected multi-dimensional tabulated atmosphere settings for body " + body );
+        }
+        else
+        {
+            // Create multi-dimensional tabulated atmosphere model (data file is memory-mapped).
+            atmosphereModel = boost::make_shared< MultiDimensionalTabulatedAtmosphere >(
+                        multiDimensionalAtmosphereSettings->getAtmosphereTableFile( ),
+                        multiDimensionalAtmosphereSettings->getSpecificGasConstant( ),
+                        multiDimensionalAtmosphereSettings->getRatioOfSpecificHeats( ) );
+        }
+        break;
+    }
 #if USE_NRLMSISE00
     case nrlmsise00:
     {
@@ -129,13 +175,58 @@ boost::shared_ptr< aerodynamics::AtmosphereModel > createAtmosphereModel(
             spaceWeatherFilePath = nrlmsise00AtmosphereSettings->getSpaceWeatherFile( );
         }
 
-        tudat::input_output::solar_activity::SolarActivityDataMap solarActivityData =
-                tudat::input_output::solar_activity::readSolarActivityData( spaceWeatherFilePath ) ;
+        boost::shared_ptr< tudat::input_output::solar_activity::SolarActivityTable > solarActivityTable =
+                boost::make_shared< tudat::input_output::solar_activity::SolarActivityTable >(
+                    tudat::input_output::solar_activity::readSolarActivityTable( spaceWeatherFilePath ) );
+
+        // Create atmosphere model using NRLMISE00 input calculator (filling the model input in place)
+        atmosphereModel = boost::make_shared< aerodynamics::NRLMSISE00Atmosphere >(
+                    boost::make_shared< tudat::aerodynamics::NRLMSISE00InputCalculator >( solarActivityTable ), true );
+        break;
+    }
+    case tabulated_nrlmsise00:
+    {
+        boost::shared_ptr< TabulatedNRLMSISE00AtmosphereSettings > tabulatedNrlmsise00AtmosphereSettings =
+                boost::dynamic_pointer_cast< TabulatedNRLMSISE00AtmosphereSettings >( atmosphereSettings );
+        if( tabulatedNrlmsise00AtmosphereSettings == NULL )
+        {
+            throw std::runtime_error(
+                        "Error, expected tabulated NRLMSISE00 atmosphere settings for body " + body );
+        }
+
+        // Use default space weather file stored in tudatBundle, if none is specified by user.
+        std::string spaceWeatherFilePath = tabulatedNrlmsise00AtmosphereSettings->getSpaceWeatherFile( );
+        if( spaceWeatherFilePath == "" )
+        {
+            spaceWeatherFilePath = input_output::getSpaceWeatherDataPath( ) + "sw19571001.txt";
+        }
 
-        // Create atmosphere model using NRLMISE00 input function
-        boost::function< tudat::aerodynamics::NRLMSISE00Input (double,double,double,double) > inputFunction =
-                boost::bind(&tudat::aerodynamics::nrlmsiseInputFunction,_1,_2,_3,_4, solarActivityData , false , TUDAT_NAN );
-        atmosphereModel = boost::make_shared< aerodynamics::NRLMSISE00Atmosphere >( inputFunction );
+        boost::shared_ptr< tudat::input_output::solar_activity::SolarActivityTable > solarActivityTable =
+                boost::make_shared< tudat::input_output::solar_activity::SolarActivityTable >(
+                    tudat::input_output::solar_activity::readSolarActivityTable( spaceWeatherFilePath ) );
+
+        // Create tabulated atmosphere model, using NRLMISE00 input calculator for local solar time and solar activity
+        boost::shared_ptr< TabulatedNRLMSISE00Atmosphere > tabulatedNrlmsise00Atmosphere =
+                boost::make_shared< TabulatedNRLMSISE00Atmosphere >(
+                    boost::make_shared< tudat::aerodynamics::NRLMSISE00InputCalculator >( solarActivityTable ),
+                    tabulatedNrlmsise00AtmosphereSettings->getIndependentVariableGrid( ),
+                    tabulatedNrlmsise00AtmosphereSettings->getDayOfTheYear( ),
+                    tabulatedNrlmsise00AtmosphereSettings->getTableCacheFile( ) );
+
+        // Check error of tabulated model, if required (at every other cell in each dimension).
+        double maximumRelativeDensityError = tabulatedNrlmsise00AtmosphereSettings->getMaximumRelativeDensityError( );
+        if( !std::isnan( maximumRelativeDensityError ) )
+        {
+            double relativeDensityError = tabulatedNrlmsise00Atmosphere->computeMaximumRelativeDensityError( 2 );
+            if( relativeDensityError > maximumRelativeDensityError )
+            {
+                throw std::runtime_error(
+                            "Error when creating tabulated NRLMSISE00 atmosphere for body " + body +
+                            ", maximum relative density error (" + std::to_string( relativeDensityError ) +
+                            ") exceeds allowed value (" + std::to_string( maximumRelativeDensityError ) + ")." );
+            }
+        }
+        atmosphereModel = tabulatedNrlmsise00Atmosphere;
         break;
     }
 #endif
@@ -12,10 +12,13 @@
 #define TUDAT_CREATEATMOSPHEREMODEL_H
 
 #include <string>
+#include <vector>
 
 #include <boost/shared_ptr.hpp>
 
 #include "Tudat/Astrodynamics/Aerodynamics/atmosphereModel.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/physicalConstants.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
 
 namespace tudat
 {
@@ -125,7 +128,9 @@ enum AtmosphereTypes
 {
     exponential_atmosphere,
     tabulated_atmosphere,
-    nrlmsise00
+    nrlmsise00,
+    tabulated_nrlmsise00,
+    multi_dimensional_tabulated_atmosphere
 };
 
 //! Class for providing settings for atmosphere model.
@@ -282,6 +287,105 @@ private:
 };
 
 
+//! Function to retrieve the default grid on which the NRLMSISE00 model is tabulated for a tabulated_nrlmsise00 model
+/*!
+ *  Function to retrieve the default grid on which the NRLMSISE00 model is tabulated for a tabulated_nrlmsise00
+ *  atmosphere: altitudes from 0 to 1000 km (10 km steps), latitudes from -90 to 90 degrees (15 degree steps), local
+ *  solar times from 0 to 24 hours (2 hour steps), F10.7 flux values of 65, 100, 150, 200, 250 and 300 solar flux units,
+ *  and Ap index values of 0, 4, 15, 50, 150 and 400.
+ *  \return Default grid on which the NRLMSISE00 model is tabulated (altitude [m], latitude [rad],
+ *  local solar time [h], F10.7 flux, Ap index).
+ */
+std::vector< std::vector< double > > getDefaultNRLMSISE00TabulationGrid( );
+
+//! AtmosphereSettings for defining an NRLMSISE00 atmosphere that is pre-computed on a grid and interpolated.
+/*!
+ *  AtmosphereSettings for defining an NRLMSISE00 atmosphere that is pre-computed on a grid of altitude, latitude,
+ *  local solar time, F10.7 flux and Ap index, and (multi-linearly) interpolated during the simulation, as a fast
+ *  approximation of the NRLMSISE00 model (see aerodynamics::TabulatedNRLMSISE00Atmosphere).
+ */
+class TabulatedNRLMSISE00AtmosphereSettings: public AtmosphereSettings
+{
+public:
+
+    //! Constructor.
+    /*!
+     *  Constructor.
+     *  \param spaceWeatherFile File containing space weather data, as in
+     *  https://celestrak.com/SpaceData/sw19571001.txt (default file in tudatBundle is used if empty).
+     *  \param tableCacheFile Binary file from which tabulated atmosphere is retrieved, or to which it is written if
+     *  the file does not yet exist (no file is used if empty).
+     *  \param independentVariableGrid Grid on which the NRLMSISE00 model is tabulated (altitude [m],
+     *  latitude [rad], local solar time [h], F10.7 flux, Ap index).
+     *  \param dayOfTheYear Day of the year for which the NRLMSISE00 model is tabulated.
+     *  \param maximumRelativeDensityError Maximum allowed relative density error of the tabulated model w.r.t. the
+     *  NRLMSISE00 model, checked at the centres of a subset of the grid cells when creating the model (not checked
+     *  if NaN).
+     */
+    TabulatedNRLMSISE00AtmosphereSettings(
+            const std::string& spaceWeatherFile = "",
+            const std::string& tableCacheFile = "",
+            const std::vector< std::vector< double > >& independentVariableGrid =
+            getDefaultNRLMSISE00TabulationGrid( ),
+            const int dayOfTheYear = 80,
+            const double maximumRelativeDensityError = TUDAT_NAN ):
+        AtmosphereSettings( tabulated_nrlmsise00 ), spaceWeatherFile_( spaceWeatherFile ),
+        tableCacheFile_( tableCacheFile ), independentVariableGrid_( independentVariableGrid ),
+        dayOfTheYear_( dayOfTheYear ), maximumRelativeDensityError_( maximumRelativeDensityError ){ }
+
+    //! Function to return file containing space weather data.
+    /*!
+     *  Function to return file containing space weather data.
+     *  \return Filename containing space weather data (default file is used if empty).
+     */
+    std::string getSpaceWeatherFile( ){ return spaceWeatherFile_; }
+
+    //! Function to return binary file from/to which the tabulated atmosphere is read/written.
+    /*!
+     *  Function to return binary file from/to which the tabulated atmosphere is read/written.
+     *  \return Binary file from/to which the tabulated atmosphere is read/written (no file is used if empty).
+     */
+    std::string getTableCacheFile( ){ return tableCacheFile_; }
+
+    //! Function to return grid on which the NRLMSISE00 model is tabulated.
+    /*!
+     *  Function to return grid on which the NRLMSISE00 model is tabulated.
+     *  \return Grid on which the NRLMSISE00 model is tabulated.
+     */
+    std::vector< std::vector< double > > getIndependentVariableGrid( ){ return independentVariableGrid_; }
+
+    //! Function to return day of the year for which the NRLMSISE00 model is tabulated.
+    /*!
+     *  Function to return day of the year for which the NRLMSISE00 model is tabulated.
+     *  \return Day of the year for which the NRLMSISE00 model is tabulated.
+     */
+    int getDayOfTheYear( ){ return dayOfTheYear_; }
+
+    //! Function to return maximum allowed relative density error of the tabulated model.
+    /*!
+     *  Function to return maximum allowed relative density error of the tabulated model.
+     *  \return Maximum allowed relative density error of the tabulated model (not checked if NaN).
+     */
+    double getMaximumRelativeDensityError( ){ return maximumRelativeDensityError_; }
+
+private:
+
+    //! File containing space weather data (default file is used if empty).
+    std::string spaceWeatherFile_;
+
+    //! Binary file from/to which the tabulated atmosphere is read/written (no file is used if empty).
+    std::string tableCacheFile_;
+
+    //! Grid on which the NRLMSISE00 model is tabulated.
+    std::vector< std::vector< double > > independentVariableGrid_;
+
+    //! Day of the year for which the NRLMSISE00 model is tabulated.
+    int dayOfTheYear_;
+
+    //! Maximum allowed relative density error of the tabulated model (not checked if NaN).
+    double maximumRelativeDensityError_;
+};
+
 //! AtmosphereSettings for defining an atmosphere with tabulated data from file.
 class TabulatedAtmosphereSettings: public AtmosphereSettings
 {
@@ -315,6 +419,59 @@ private:
     std::string atmosphereFile_;
 };
 
+//! AtmosphereSettings for defining an atmosphere tabulated on a uniform grid of altitude, latitude and longitude.
+class MultiDimensionalTabulatedAtmosphereSettings: public AtmosphereSettings
+{
+public:
+
+    //! Constructor.
+    /*!
+     *  Constructor.
+     *  \param atmosphereTableFile Binary file containing the tabulated atmosphere, as created by
+     *  aerodynamics::writeMultiDimensionalTabulatedAtmosphereFile.
+     *  \param specificGasConstant The constant specific gas constant of the atmosphere.
+     *  \param ratioOfSpecificHeats The constant ratio of specific heats of the atmosphere.
+     */
+    MultiDimensionalTabulatedAtmosphereSettings(
+            const std::string& atmosphereTableFile,
+            const double specificGasConstant = physical_constants::SPECIFIC_GAS_CONSTANT_AIR,
+            const double ratioOfSpecificHeats = 1.4 ):
+        AtmosphereSettings( multi_dimensional_tabulated_atmosphere ), atmosphereTableFile_( atmosphereTableFile ),
+        specificGasConstant_( specificGasConstant ), ratioOfSpecificHeats_( ratioOfSpecificHeats ){ }
+
+    //! Function to return file containing the tabulated atmosphere.
+    /*!
+     *  Function to return file containing the tabulated atmosphere.
+     *  \return Filename containing the tabulated atmosphere.
+     */
+    std::string getAtmosphereTableFile( ){ return atmosphereTableFile_; }
+
+    //! Function to return the specific gas constant of the atmosphere.
+    /*!
+     *  Function to return the specific gas constant of the atmosphere.
+     *  \return Specific gas constant of the atmosphere.
+     */
+    double getSpecificGasConstant( ){ return specificGasConstant_; }
+
+    //! Function to return the ratio of specific heats of the atmosphere.
+    /*!
+     *  Function to return the ratio of specific heats of the atmosphere.
+     *  \return Ratio of specific heats of the atmosphere.
+     */
+    double getRatioOfSpecificHeats( ){ return ratioOfSpecificHeats_; }
+
+private:
+
+    //! Binary file containing the tabulated atmosphere.
+    std::string atmosphereTableFile_;
+
+    //! Specific gas constant of the atmosphere.
+    double specificGasConstant_;
+
+    //! Ratio of specific heats of the atmosphere.
+    double ratioOfSpecificHeats_;
+};
+
 //! Function to create a wind model.
 /*!
  *  Function to create a wind model based on model-specific settings for the wind model.
@@ -312,6 +312,75 @@ void setGlobalFrameBodyEphemerides( const NamedBodyMap& bodyMap,
 
 }
 
+//! Function to create a copy of a list of bodies that can be used independently of the original bodies
+/*!
+ * Function to create a copy of a list of bodies that can be used independently of the original bodies, for instance to
+ * run a propagation concurrently with a propagation that uses the original bodies. Each body is copied using its
+ * Body::createIndependentCopy function, so that models that are not modified during a propagation are shared between
+ * the two lists. The position functions of the copied radiation pressure interfaces are reset to use the copied
+ * bodies. The global frame origin is retrieved from the original bodies, after which the
+ * setGlobalFrameBodyEphemerides function is called for the copied bodies, so that the copied bodies' states are
+ * computed from one another only.
+ * \param bodyMap List of body objects that is to be copied (global frame origin must have been set).
+ * \param globalFrameOrientation Global reference frame orientation.
+ * \return Copy of the list of bodies that can be used independently of the original bodies.
+ */
+template< typename StateScalarType = double, typename TimeType = double >
+NamedBodyMap createIndependentBodyMapCopy( const NamedBodyMap& bodyMap,
+                                           const std::string& globalFrameOrientation )
+{
+    std::string globalFrameOrigin = getGlobalFrameOrigin( bodyMap );
+
+    NamedBodyMap copiedBodyMap;
+    for( NamedBodyMap::const_iterator bodyIterator = bodyMap.begin( );
+         bodyIterator != bodyMap.end( ); bodyIterator++ )
+    {
+        copiedBodyMap[ bodyIterator->first ] = bodyIterator->second->createIndependentCopy( );
+    }
+
+    // Let radiation pressure interfaces of copied bodies retrieve positions from copied bodies.
+    for( NamedBodyMap::const_iterator bodyIterator = copiedBodyMap.begin( );
+         bodyIterator != copiedBodyMap.end( ); bodyIterator++ )
+    {
+        std::map< std::string, boost::shared_ptr< electro_magnetism::RadiationPressureInterface > >
+                radiationPressureInterfaces = bodyIterator->second->getRadiationPressureInterfaces( );
+        for( std::map< std::string, boost::shared_ptr< electro_magnetism::RadiationPressureInterface > >::const_iterator
+             radiationPressureIterator = radiationPressureInterfaces.begin( );
+             radiationPressureIterator != radiationPressureInterfaces.end( ); radiationPressureIterator++ )
+        {
+            std::vector< std::string > occultingBodyNames =
+                    radiationPressureIterator->second->getOccultingBodyNames( );
+            if( copiedBodyMap.count( radiationPressureIterator->first ) == 0 ||
+                    occultingBodyNames.size( ) != radiationPressureIterator->second->getOccultingBodyPositions( ).size( ) )
+            {
+                throw std::runtime_error( "Error when creating independent copy of body map, bodies involved in radiation "
+                                          "pressure interface of " + bodyIterator->first + " due to " +
+                                          radiationPressureIterator->first + " could not be identified." );
+            }
+
+            std::vector< boost::function< Eigen::Vector3d( ) > > occultingBodyPositions;
+            for( unsigned int i = 0; i < occultingBodyNames.size( ); i++ )
+            {
+                if( copiedBodyMap.count( occultingBodyNames.at( i ) ) == 0 )
+                {
+                    throw std::runtime_error( "Error when creating independent copy of body map, occulting body " +
+                                              occultingBodyNames.at( i ) + " not found." );
+                }
+                occultingBodyPositions.push_back(
+                            boost::bind( &Body::getPosition, copiedBodyMap.at( occultingBodyNames.at( i ) ) ) );
+            }
+
+            radiationPressureIterator->second->resetPositionFunctions(
+                        boost::bind( &Body::getPosition, copiedBodyMap.at( radiationPressureIterator->first ) ),
+                        boost::bind( &Body::getPosition, bodyIterator->second ), occultingBodyPositions );
+        }
+    }
+
+    setGlobalFrameBodyEphemerides< StateScalarType, TimeType >(
+                copiedBodyMap, globalFrameOrigin, globalFrameOrientation );
+    return copiedBodyMap;
+}
+
 } // namespace simulation_setup
 
 } // namespace tudat
@@ -133,7 +133,7 @@ boost::shared_ptr< electro_magnetism::RadiationPressureInterface > createRadiati
                     boost::bind( &Body::getPosition, bodyMap.at( bodyName ) ),
                     cannonBallSettings->getRadiationPressureCoefficient( ),
                     cannonBallSettings->getArea( ), occultingBodyPositions, occultingBodyRadii,
-                    sourceRadius );
+                    sourceRadius, occultingBodies );
         break;
 
     }
@@ -135,8 +135,39 @@ boost::shared_ptr< ephemerides::RotationalEphemeris > createRotationModel(
             boost::shared_ptr< earth_orientation::EarthOrientationAnglesCalculator > earthOrientationCalculator =
                     boost::make_shared< earth_orientation::EarthOrientationAnglesCalculator >(
                         polarMotionCalculator, precessionNutationCalculator, terrestrialTimeScaleConverter );
-            rotationalEphemeris = boost::make_shared< ephemerides::GcrsToItrsRotationModel >(
-                        earthOrientationCalculator, gcrsToItrsRotationSettings->getInputTimeScale( ) );
+            boost::shared_ptr< ModelInterpolationSettings > anglesInterpolationSettings =
+                    gcrsToItrsRotationSettings->getAnglesInterpolationSettings( );
+            if( anglesInterpolationSettings == NULL )
+            {
+                rotationalEphemeris = boost::make_shared< ephemerides::GcrsToItrsRotationModel >(
+                            earthOrientationCalculator, gcrsToItrsRotationSettings->getInputTimeScale( ) );
+            }
+            else
+            {
+                if( !( anglesInterpolationSettings->timeStep_ > 0.0 ) ||
+                        !( anglesInterpolationSettings->finalTime_ > anglesInterpolationSettings->initialTime_ ) )
+                {
+                    throw std::runtime_error(
+                                "Error when creating interpolated GCRS to ITRS rotation model for " + body +
+                                ", interpolation time step or interval is invalid" );
+                }
+
+                // Pre-compute earth orientation angles over requested interval (final time included), and create
+                // rotation model from resulting interpolators.
+                std::pair< boost::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::Vector5d > >,
+                        boost::shared_ptr< interpolators::OneDimensionalInterpolator< double, double > > >
+                        earthOrientationInterpolators =
+                        earth_orientation::createInterpolatorsForItrsToGcrsAngles< double >(
+                            anglesInterpolationSettings->initialTime_,
+                            anglesInterpolationSettings->finalTime_ + anglesInterpolationSettings->timeStep_,
+                            anglesInterpolationSettings->timeStep_,
+                            gcrsToItrsRotationSettings->getInputTimeScale( ),
+                            earthOrientationCalculator,
+                            anglesInterpolationSettings->interpolatorSettings_ );
+                rotationalEphemeris = boost::make_shared< ephemerides::GcrsToItrsRotationModel >(
+                            earthOrientationInterpolators.first, earthOrientationInterpolators.second,
+                            gcrsToItrsRotationSettings->getInputTimeScale( ) );
+            }
 
             break;
         }
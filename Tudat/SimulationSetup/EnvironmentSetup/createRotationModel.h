@@ -18,6 +18,7 @@
 
 #include "Tudat/InputOutput/basicInputOutput.h"
 #include "Tudat/SimulationSetup/EnvironmentSetup/body.h"
+#include "Tudat/SimulationSetup/EnvironmentSetup/createGravityFieldVariations.h"
 #include "Tudat/Astrodynamics/Ephemerides/rotationalEphemeris.h"
 #include "Tudat/Astrodynamics/BasicAstrodynamics/physicalConstants.h"
 #include "Tudat/Astrodynamics/BasicAstrodynamics/unitConversions.h"
@@ -223,6 +224,9 @@ public:
      * \param eopFileFormat Identifier for file format that is provided
      * \param ut1CorrectionSettings Settings for short-period UT1-UTC variations
      * \param polarMotionCorrectionSettings Settings for short-period polar motion variations
+     * \param anglesInterpolationSettings Settings for pre-tabulating the earth orientation angles and UT1 over a given
+     * time span, and interpolating them during the simulation (instead of evaluating the full earth orientation model at
+     * each call). Angles are computed directly if NULL (default).
      */
     GcrsToItrsRotationModelSettings(
             const basic_astrodynamics::IAUConventions nutationTheory = basic_astrodynamics::iau_2006,
@@ -251,11 +255,14 @@ public:
                     input_output::getEarthOrientationDataFilesPath( ) +
                     "polarMotionLibrationFundamentalArgumentMultipliersQuasiDiurnalOnly.txt",
                     input_output::getEarthOrientationDataFilesPath( ) +
-                    "polarMotionOceanTidesFundamentalArgumentMultipliers.txt" } ) ):
+                    "polarMotionOceanTidesFundamentalArgumentMultipliers.txt" } ),
+            const boost::shared_ptr< ModelInterpolationSettings > anglesInterpolationSettings =
+            boost::shared_ptr< ModelInterpolationSettings >( ) ):
         RotationModelSettings( gcrs_to_itrs_rotation_model, baseFrameName, targetFrameName ),
         inputTimeScale_( inputTimeScale ), nutationTheory_( nutationTheory ), eopFile_( eopFile ),
         eopFileFormat_( "C04" ), ut1CorrectionSettings_( ut1CorrectionSettings ),
-        polarMotionCorrectionSettings_( polarMotionCorrectionSettings ){ }
+        polarMotionCorrectionSettings_( polarMotionCorrectionSettings ),
+        anglesInterpolationSettings_( anglesInterpolationSettings ){ }
 
     //! Destructor
     ~GcrsToItrsRotationModelSettings( ){ }
@@ -319,6 +326,16 @@ public:
         return polarMotionCorrectionSettings_;
     }
 
+    //! Function to retrieve the settings for interpolating the earth orientation angles
+    /*!
+     * Function to retrieve the settings for interpolating the earth orientation angles
+     * \return Settings for interpolating the earth orientation angles (NULL if angles are computed directly)
+     */
+    boost::shared_ptr< ModelInterpolationSettings > getAnglesInterpolationSettings( )
+    {
+        return anglesInterpolationSettings_;
+    }
+
 private:
 
     //! Time scale in which input to the rotation model class is provided
@@ -339,6 +356,9 @@ private:
     //! Settings for short-period polar motion variations
     boost::shared_ptr< EopCorrectionSettings > polarMotionCorrectionSettings_;
 
+    //! Settings for interpolating the earth orientation angles (NULL if angles are computed directly)
+    boost::shared_ptr< ModelInterpolationSettings > anglesInterpolationSettings_;
+
 };
 #endif
 
@@ -29,7 +29,9 @@
 #include "Tudat/Astrodynamics/ObservationModels/positionObservationModel.h"
 #include "Tudat/Astrodynamics/ObservationModels/observationSimulator.h"
 #include "Tudat/Astrodynamics/ObservationModels/observationViabilityCalculator.h"
+#include "Tudat/Astrodynamics/ObservationModels/simulateObservations.h"
 #include "Tudat/SimulationSetup/EnvironmentSetup/body.h"
+#include "Tudat/SimulationSetup/EnvironmentSetup/createBodies.h"
 #include "Tudat/SimulationSetup/EstimationSetup/createLightTimeCalculator.h"
 
 
@@ -1397,6 +1399,83 @@ createObservationViabilityCalculators(
         const std::map< ObservableType, std::vector< LinkEnds > > linkEndsPerObservable,
         const std::vector< boost::shared_ptr< ObservationViabilitySettings > >& observationViabilitySettings );
 
+//! Function to simulate observations (optionally with reproducible random noise) using multiple threads.
+/*!
+ *  Function to simulate observations, optionally with reproducible random noise, from set of observables, link ends and
+ *  observation time settings, with the combinations of observable and link ends distributed over a number of threads. Since
+ *  the environment models used by the observation models are modified when being evaluated, each thread uses its own
+ *  observation simulators and viability calculators, created from its own independent copy of the environment (see
+ *  createIndependentBodyMapCopy); the first thread uses bodyMap itself. Consequently, an exception is thrown if the
+ *  environment contains models for which no such copy can be created. The noise of each combination of observable and link
+ *  ends is drawn from its own random number generator (see createObservationNoiseGenerators), so that the simulated
+ *  observations are independent of the number of threads.
+ *  \param observationsToSimulate List of observation time settings per link end set per observable type.
+ *  \param observationSettingsMap Settings for the observation models, per observable type and link ends.
+ *  \param bodyMap Map of Body objects that comprise the environment (global frame origin must have been set).
+ *  \param globalFrameOrientation Global reference frame orientation of the environment.
+ *  \param numberOfThreads Number of threads to use (if 0, the number of concurrent threads supported by the hardware is used)
+ *  \param observationViabilitySettings List of viability settings from which viability check objects are to be created
+ *  (default none).
+ *  \param noiseDistributions Distribution type and distribution parameters (see
+ *  statistics::createBoostContinuousRandomVariableGeneratorFunction) of the noise, per observable type (default none, in which
+ *  case no noise is added).
+ *  \param noiseSeed Base seed of noise simulation (default 0).
+ *  \return Simulated observation values and associated times for requested observable types and link end sets.
+ */
+template< typename ObservationScalarType = double, typename TimeType = double >
+std::map< ObservableType, std::map< LinkEnds, std::pair< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >,
+std::pair< std::vector< TimeType >, LinkEndType > > > >
+simulateObservationsConcurrently(
+        const std::map< ObservableType, std::map< LinkEnds,
+        boost::shared_ptr< ObservationSimulationTimeSettings< TimeType > > > >& observationsToSimulate,
+        const observation_models::ObservationSettingsMap& observationSettingsMap,
+        const simulation_setup::NamedBodyMap& bodyMap,
+        const std::string& globalFrameOrientation,
+        const unsigned int numberOfThreads,
+        const ObservationViabilitySettingsList& observationViabilitySettings = ObservationViabilitySettingsList( ),
+        const std::map< ObservableType, std::pair< statistics::ContinuousBoostStatisticalDistributions,
+        std::vector< double > > >& noiseDistributions =
+        ( std::map< ObservableType, std::pair< statistics::ContinuousBoostStatisticalDistributions,
+          std::vector< double > > >( ) ),
+        const double noiseSeed = 0.0 )
+{
+    // Retrieve link ends for which observations are to be simulated
+    std::map< ObservableType, std::vector< LinkEnds > > linkEndsPerObservable;
+    std::vector< std::pair< ObservableType, LinkEnds > > observationSetList = getObservationSetList( observationsToSimulate );
+    for( unsigned int i = 0; i < observationSetList.size( ); i++ )
+    {
+        linkEndsPerObservable[ observationSetList.at( i ).first ].push_back( observationSetList.at( i ).second );
+    }
+
+    // Create observation simulators and viability calculators for each thread, each using its own environment
+    const unsigned int numberOfThreadsToUse =
+            utilities::getNumberOfThreadsToUse( numberOfThreads, observationSetList.size( ) );
+    std::vector< std::map< ObservableType, boost::shared_ptr< ObservationSimulatorBase< ObservationScalarType, TimeType > > > >
+            observationSimulatorsPerThread;
+    std::vector< PerObservableObservationViabilityCalculatorList > viabilityCalculatorListPerThread;
+    for( unsigned int i = 0; i < numberOfThreadsToUse; i++ )
+    {
+        simulation_setup::NamedBodyMap threadBodyMap = ( i == 0 ) ? bodyMap :
+              simulation_setup::createIndependentBodyMapCopy< ObservationScalarType, TimeType >(
+                                                              bodyMap, globalFrameOrientation );
+        observationSimulatorsPerThread.push_back(
+                    createObservationSimulators< ObservationScalarType, TimeType >( observationSettingsMap, threadBodyMap ) );
+        viabilityCalculatorListPerThread.push_back(
+                    createObservationViabilityCalculators(
+                        threadBodyMap, linkEndsPerObservable, observationViabilitySettings ) );
+    }
+
+    // Create noise generators, if required
+    std::vector< boost::function< double( ) > > noiseGenerators;
+    if( noiseDistributions.size( ) > 0 )
+    {
+        noiseGenerators = createObservationNoiseGenerators( observationsToSimulate, noiseDistributions, noiseSeed );
+    }
+
+    return simulateObservationSetsConcurrently< ObservationScalarType, TimeType >(
+                observationsToSimulate, observationSimulatorsPerThread, viabilityCalculatorListPerThread, noiseGenerators );
+}
+
 } // namespace observation_models
 
 } // namespace tudat
@@ -162,6 +162,24 @@ boost::shared_ptr< propulsion::BodyFixedForceDirectionGuidance  > createThrustGu
         }
         break;
     }
+    case thrust_direction_from_segment_table:
+    {
+        // Check input consistency
+        boost::shared_ptr< SegmentTableThrustDirectionSettings > segmentTableThrustDirectionSettings =
+                boost::dynamic_pointer_cast< SegmentTableThrustDirectionSettings >( thrustDirectionGuidanceSettings );
+        if( segmentTableThrustDirectionSettings == NULL )
+        {
+            throw std::runtime_error( "Error when getting thrust guidance with thrust_direction_from_segment_table, input is inconsistent" );
+        }
+        else
+        {
+            // Create direction guidance
+            thrustGuidance =  boost::make_shared< propulsion::SegmentTableForceGuidance >(
+                        segmentTableThrustDirectionSettings->thrustSegmentTable_,
+                        segmentTableThrustDirectionSettings->relativeBody_, bodyFixedThrustOrientation );
+        }
+        break;
+    }
     default:
         throw std::runtime_error( "Error, could not find thrust guidance type when creating thrust guidance." );
     }
@@ -307,6 +325,21 @@ boost::function< Eigen::Vector3d( ) > getBodyFixedThrustDirection(
         }
         break;
     }
+    case thrust_magnitude_from_segment_table:
+    {
+        // Check input consistency
+        boost::shared_ptr< SegmentTableThrustEngineSettings > segmentTableThrustMagnitudeSettings =
+                boost::dynamic_pointer_cast< SegmentTableThrustEngineSettings >( thrustMagnitudeSettings );
+        if( segmentTableThrustMagnitudeSettings == NULL )
+        {
+            throw std::runtime_error( "Error when creating body-fixed thrust direction of type thrust_magnitude_from_segment_table, input is inconsistent" );
+        }
+        else
+        {
+            thrustDirectionFunction = boost::lambda::constant( segmentTableThrustMagnitudeSettings->bodyFixedThrustDirection_ );
+        }
+        break;
+    }
     default:
         throw std::runtime_error( "Error when creating body-fixed thrust direction, type not identified" );
     }
@@ -434,6 +467,21 @@ boost::shared_ptr< propulsion::ThrustMagnitudeWrapper > createThrustMagnitudeWra
 
         break;
 
+    }
+    case thrust_magnitude_from_segment_table:
+    {
+        // Check input consistency
+        boost::shared_ptr< SegmentTableThrustEngineSettings > segmentTableThrustMagnitudeSettings =
+                boost::dynamic_pointer_cast< SegmentTableThrustEngineSettings >( thrustMagnitudeSettings );
+        if( segmentTableThrustMagnitudeSettings == NULL )
+        {
+            throw std::runtime_error( "Error when creating segment table thrust magnitude wrapper, input is inconsistent" );
+        }
+
+        thrustMagnitudeWrapper = boost::make_shared< propulsion::SegmentTableThrustMagnitudeWrapper >(
+                    segmentTableThrustMagnitudeSettings->thrustSegmentTable_ );
+        break;
+
     }
     default:
         throw std::runtime_error( "Error when creating thrust magnitude wrapper, type not identified" );
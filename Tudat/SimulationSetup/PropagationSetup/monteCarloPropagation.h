@@ -0,0 +1,252 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_MONTECARLOPROPAGATION_H
+#define TUDAT_MONTECARLOPROPAGATION_H
+
+#include <algorithm>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <boost/bind.hpp>
+#include <boost/function.hpp>
+#include <boost/make_shared.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Basics/parallelLoops.h"
+#include "Tudat/Mathematics/Statistics/streamingStatistics.h"
+#include "Tudat/SimulationSetup/EnvironmentSetup/createBodies.h"
+#include "Tudat/SimulationSetup/PropagationSetup/dynamicsSimulator.h"
+
+namespace tudat
+{
+
+namespace propagators
+{
+
+//! Function to retrieve the final propagated state of a single Monte Carlo sample.
+/*!
+ * Function to retrieve the final propagated state of a single Monte Carlo sample, for use as the default sample output
+ * function of the MonteCarloPropagation class.
+ * \param stateHistory Numerically propagated state history of the sample.
+ * \param dependentVariableHistory Dependent variable history of the sample (unused).
+ * \return Final propagated state of the sample.
+ */
+template< typename StateScalarType = double, typename TimeType = double >
+Eigen::VectorXd getFinalPropagatedState(
+        const std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >& stateHistory,
+        const std::map< TimeType, Eigen::VectorXd >& dependentVariableHistory )
+{
+    if( stateHistory.size( ) == 0 )
+    {
+        throw std::runtime_error( "Error when retrieving final propagated state of Monte Carlo sample, no state history "
+                                  "found." );
+    }
+    return stateHistory.rbegin( )->second.template cast< double >( );
+}
+
+//! Class for running a Monte Carlo analysis of single-arc propagations, with statistics of the sample outputs.
+/*!
+ * Class for running a Monte Carlo analysis of (a large number of) perturbed single-arc propagations. The environment is
+ * provided as a template body map, of which an independent copy is created once per thread (see
+ * simulation_setup::createIndependentBodyMapCopy), and reused for all samples that are run by that thread. For each
+ * sample, the propagator and integrator settings are created by user-defined functions of the sample index (e.g. with an
+ * initial state perturbed by the sample's entry in a pre-generated random sample, see generateGaussianRandomSample),
+ * after which the sample is propagated, and a user-defined output vector (by default the final propagated state) is
+ * retrieved. The state histories are not stored; instead, the outputs are added (in order of sample index, so that the
+ * results are independent of the number of threads) to a StreamingStatistics object, from which the sample mean,
+ * covariance and quantiles are retrieved. Samples are run in batches, distributed over the threads, so that only the
+ * outputs of the current batch are kept in memory.
+ *
+ * Since the propagations of different threads run concurrently, the user-defined propagator settings, integrator
+ * settings and sample output functions are called concurrently (for different samples) if more than one thread is
+ * used, and must therefore be thread-safe: they must not modify data that is shared between calls (other than through
+ * the body map provided to the propagator settings function), and any data they read must not be modified during the
+ * analysis.
+ * Similarly, models that are shared between the copies of the template body map must be safe to evaluate concurrently
+ * (e.g. Spice ephemerides, as the Spice library is not thread-safe, should not be used if more than one thread is used).
+ */
+template< typename StateScalarType = double, typename TimeType = double >
+class MonteCarloPropagation
+{
+public:
+
+    //! Typedef for function creating the propagator settings of a sample, from the body map and sample index.
+    typedef boost::function< boost::shared_ptr< SingleArcPropagatorSettings< StateScalarType > >(
+            const simulation_setup::NamedBodyMap&, const unsigned int ) > PropagatorSettingsFunction;
+
+    //! Typedef for function creating the integrator settings of a sample, from the sample index.
+    typedef boost::function< boost::shared_ptr< numerical_integrators::IntegratorSettings< TimeType > >(
+            const unsigned int ) > IntegratorSettingsFunction;
+
+    //! Typedef for function computing the output of a sample, from the state and dependent variable history.
+    typedef boost::function< Eigen::VectorXd(
+            const std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >&,
+            const std::map< TimeType, Eigen::VectorXd >& ) > SampleOutputFunction;
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param templateBodyMap Environment of the propagations (global frame origin must have been set). An independent
+     * copy is created for each thread that is used, so that the template itself is not modified by the analysis.
+     * \param globalFrameOrientation Global reference frame orientation of the environment.
+     * \param propagatorSettingsFunction Function creating the propagator settings of a sample, from the body map of the
+     * thread that runs the sample and the sample index (acceleration models etc. must be created from this body map).
+     * Called concurrently by different threads, and must therefore be thread-safe.
+     * \param integratorSettingsFunction Function creating the integrator settings of a sample, from the sample index. A
+     * new object is to be returned for each call, since the settings are modified during propagation. Called
+     * concurrently by different threads, and must therefore be thread-safe.
+     * \param sampleOutputFunction Function computing the output of a sample, of which the statistics are computed.
+     * Called concurrently by different threads, and must therefore be thread-safe.
+     * \param quantileProbabilities Probabilities of the quantiles of the sample outputs that are to be estimated.
+     * \param numberOfThreads Number of threads that is to be used (if 0, the number of hardware threads is used).
+     * \param numberOfSamplesPerBatch Number of samples that are run before their outputs are added to the statistics.
+     */
+    MonteCarloPropagation(
+            const simulation_setup::NamedBodyMap& templateBodyMap,
+            const std::string& globalFrameOrientation,
+            const PropagatorSettingsFunction propagatorSettingsFunction,
+            const IntegratorSettingsFunction integratorSettingsFunction,
+            const SampleOutputFunction sampleOutputFunction = &getFinalPropagatedState< StateScalarType, TimeType >,
+            const std::vector< double >& quantileProbabilities = std::vector< double >( ),
+            const unsigned int numberOfThreads = 1,
+            const unsigned int numberOfSamplesPerBatch = 256 ):
+        propagatorSettingsFunction_( propagatorSettingsFunction ),
+        integratorSettingsFunction_( integratorSettingsFunction ),
+        sampleOutputFunction_( sampleOutputFunction ),
+        numberOfSamplesPerBatch_( std::max( numberOfSamplesPerBatch, 1U ) ),
+        numberOfSamplesRun_( 0 )
+    {
+        numberOfThreads_ = utilities::getNumberOfThreadsToUse( numberOfThreads, numberOfSamplesPerBatch_ );
+        sampleStatistics_ = boost::make_shared< statistics::StreamingStatistics >( quantileProbabilities );
+
+        // Create environment of each thread.
+        for( unsigned int i = 0; i < numberOfThreads_; i++ )
+        {
+            threadBodyMaps_.push_back( simulation_setup::createIndependentBodyMapCopy< StateScalarType, TimeType >(
+                                           templateBodyMap, globalFrameOrientation ) );
+        }
+    }
+
+    //! Function to run a number of samples, and add their outputs to the statistics.
+    /*!
+     * Function to run a number of samples, and add their outputs to the statistics. The sample indices continue from
+     * those of any previous call, so that a Monte Carlo analysis may be extended until the statistics have converged.
+     * Any exception thrown during the propagation of a sample is forwarded to the calling thread.
+     * \param numberOfSamples Number of samples that are to be run.
+     */
+    void runSamples( const unsigned int numberOfSamples )
+    {
+        const unsigned int finalSampleIndex = numberOfSamplesRun_ + numberOfSamples;
+        std::vector< Eigen::VectorXd > batchOutputs;
+        while( numberOfSamplesRun_ < finalSampleIndex )
+        {
+            const unsigned int batchStartIndex = numberOfSamplesRun_;
+            const unsigned int numberOfBatchSamples =
+                    std::min( numberOfSamplesPerBatch_, finalSampleIndex - batchStartIndex );
+            batchOutputs.resize( numberOfBatchSamples );
+
+            // Run samples of batch in contiguous blocks, one block per thread.
+            utilities::parallelForBlocks(
+                        numberOfBatchSamples, numberOfThreads_,
+                        boost::bind( &MonteCarloPropagation< StateScalarType, TimeType >::runSamplesInRange, this,
+                                     _1, batchStartIndex, _2, _3, boost::ref( batchOutputs ) ) );
+
+            // Add outputs to statistics, in order of sample index.
+            for( unsigned int i = 0; i < numberOfBatchSamples; i++ )
+            {
+                sampleStatistics_->addSample( batchOutputs.at( i ) );
+            }
+            numberOfSamplesRun_ += numberOfBatchSamples;
+        }
+    }
+
+    //! Function to retrieve the statistics of the sample outputs
+    /*!
+     * Function to retrieve the statistics of the outputs of all samples that have been run.
+     * \return Statistics of the sample outputs
+     */
+    boost::shared_ptr< statistics::StreamingStatistics > getSampleStatistics( )
+    {
+        return sampleStatistics_;
+    }
+
+    //! Function to retrieve the number of samples that have been run
+    /*!
+     * Function to retrieve the number of samples that have been run
+     * \return Number of samples that have been run
+     */
+    unsigned int getNumberOfSamplesRun( )
+    {
+        return numberOfSamplesRun_;
+    }
+
+private:
+
+    //! Function to run a range of samples in a batch, using the body map of a single thread.
+    /*!
+     * Function to run a range of samples in a batch, using the body map of a single thread.
+     * \param threadIndex Index of the thread (and body map) that is used.
+     * \param batchStartIndex Index of the first sample of the batch.
+     * \param startIndex Index in batch of first sample that is to be run.
+     * \param endIndex Index in batch after last sample that is to be run.
+     * \param batchOutputs Outputs of the samples in the batch (entries in range modified by reference).
+     */
+    void runSamplesInRange( const unsigned int threadIndex, const unsigned int batchStartIndex,
+                            const unsigned int startIndex, const unsigned int endIndex,
+                            std::vector< Eigen::VectorXd >& batchOutputs )
+    {
+        const simulation_setup::NamedBodyMap& bodyMap = threadBodyMaps_.at( threadIndex );
+        for( unsigned int i = startIndex; i < endIndex; i++ )
+        {
+            const unsigned int sampleIndex = batchStartIndex + i;
+            SingleArcDynamicsSimulator< StateScalarType, TimeType > dynamicsSimulator(
+                        bodyMap, integratorSettingsFunction_( sampleIndex ),
+                        propagatorSettingsFunction_( bodyMap, sampleIndex ), true, false, false );
+            batchOutputs[ i ] = sampleOutputFunction_(
+                        dynamicsSimulator.getEquationsOfMotionNumericalSolution( ),
+                        dynamicsSimulator.getDependentVariableHistory( ) );
+        }
+    }
+
+    //! Function creating the propagator settings of a sample.
+    PropagatorSettingsFunction propagatorSettingsFunction_;
+
+    //! Function creating the integrator settings of a sample.
+    IntegratorSettingsFunction integratorSettingsFunction_;
+
+    //! Function computing the output of a sample.
+    SampleOutputFunction sampleOutputFunction_;
+
+    //! Number of threads that is used.
+    unsigned int numberOfThreads_;
+
+    //! Number of samples that are run before their outputs are added to the statistics.
+    unsigned int numberOfSamplesPerBatch_;
+
+    //! Number of samples that have been run.
+    unsigned int numberOfSamplesRun_;
+
+    //! Environments of each of the threads (independent copies of the template body map).
+    std::vector< simulation_setup::NamedBodyMap > threadBodyMaps_;
+
+    //! Statistics of the sample outputs.
+    boost::shared_ptr< statistics::StreamingStatistics > sampleStatistics_;
+};
+
+} // namespace propagators
+
+} // namespace tudat
+
+#endif // TUDAT_MONTECARLOPROPAGATION_H
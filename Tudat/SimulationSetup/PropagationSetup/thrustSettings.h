@@ -35,7 +35,8 @@ enum ThrustDirectionGuidanceTypes
     colinear_with_state_segment_thrust_direction,
     thrust_direction_from_existing_body_orientation,
     custom_thrust_direction,
-    custom_thrust_orientation
+    custom_thrust_orientation,
+    thrust_direction_from_segment_table
 
 }; 
 
@@ -171,6 +172,36 @@ public:
     boost::function< Eigen::Quaterniond( const double ) > thrustOrientationFunction_ ;
 };
 
+//! Class for defining thrust direction from a piecewise constant profile, stored in a segment table.
+/*!
+ *  Class for defining thrust direction from a piecewise constant profile, stored in a segment table (which must contain
+ *  the thrust direction of each segment). The same table object is typically also used for the thrust magnitude
+ *  (see SegmentTableThrustEngineSettings), so that a re-parameterization of the table is directly used by the thrust
+ *  acceleration model created from these settings.
+ */
+class SegmentTableThrustDirectionSettings: public ThrustDirectionGuidanceSettings
+{
+public:
+
+    //! Constructor.
+    /*!
+     * Constructor
+     * \param thrustSegmentTable Table defining the piecewise constant thrust profile.
+     * \param relativeBody Body relative to which thrust direction is defined (empty by default).
+     */
+    SegmentTableThrustDirectionSettings(
+            const boost::shared_ptr< propulsion::ThrustSegmentTable > thrustSegmentTable,
+            const std::string& relativeBody = "" ):
+        ThrustDirectionGuidanceSettings( thrust_direction_from_segment_table, relativeBody ),
+        thrustSegmentTable_( thrustSegmentTable ){ }
+
+    //! Destructor.
+    ~SegmentTableThrustDirectionSettings( ){ }
+
+    //! Table defining the piecewise constant thrust profile.
+    boost::shared_ptr< propulsion::ThrustSegmentTable > thrustSegmentTable_;
+};
+
 //! Function to create the object determining the direction of the thrust acceleration.
 /*!
  * Function to create the object determining the direction of the thrust acceleration.
@@ -195,7 +226,8 @@ enum ThrustMagnitudeTypes
     constant_thrust_magnitude,
     from_engine_properties_thrust_magnitude,
     thrust_magnitude_from_time_function,
-    thrust_magnitude_from_dependent_variables
+    thrust_magnitude_from_dependent_variables,
+    thrust_magnitude_from_segment_table
 };
 
 //! Class defining settings for the thrust magnitude
@@ -342,6 +374,42 @@ public:
     boost::function< void( const double ) > customThrustResetFunction_;
 };
 
+//! Class to define settings for thrust magnitude/specific impulse from a piecewise constant profile.
+/*!
+ * Class to define settings for thrust magnitude/specific impulse from a piecewise constant profile, stored in a segment
+ * table. Compared to defining the same profile through FromFunctionThrustEngineSettings, the mass rate of each segment is
+ * precomputed, and the active segment is found directly from the table. The switching times of the table can be used to
+ * stop the numerical integration exactly at each discontinuity, and the table can be re-parameterized (see
+ * ThrustSegmentTable::resetSegmentValues and ThrustSegmentTable::resetSwitchingTimes) without recreating the
+ * acceleration models.
+ */
+class SegmentTableThrustEngineSettings: public ThrustEngineSettings
+{
+public:
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param thrustSegmentTable Table defining the piecewise constant thrust profile.
+     * \param bodyFixedThrustDirection Direction of thrust force in body-fixed frame (along longitudinal axis by default).
+     */
+    SegmentTableThrustEngineSettings(
+            const boost::shared_ptr< propulsion::ThrustSegmentTable > thrustSegmentTable,
+            const Eigen::Vector3d bodyFixedThrustDirection = Eigen::Vector3d::UnitX( ) ):
+        ThrustEngineSettings( thrust_magnitude_from_segment_table, "" ),
+        thrustSegmentTable_( thrustSegmentTable ),
+        bodyFixedThrustDirection_( bodyFixedThrustDirection ){ }
+
+    //! Destructor.
+    ~SegmentTableThrustEngineSettings( ){ }
+
+    //! Table defining the piecewise constant thrust profile.
+    boost::shared_ptr< propulsion::ThrustSegmentTable > thrustSegmentTable_;
+
+    //! Direction of thrust force in body-fixed frame
+    Eigen::Vector3d bodyFixedThrustDirection_;
+};
+
 //! Interface function to multiply a maximum thrust by a multiplier to obtain the actual thrust
 /*!
  * Interface function to multiply a maximum thrust by a multiplier to obtain the actual thrust
@@ -11,6 +11,10 @@
 #ifndef TUDAT_VARIATIONALEQUATIONSSOLVER_H
 #define TUDAT_VARIATIONALEQUATIONSSOLVER_H
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
 #include <boost/make_shared.hpp>
 #include <boost/tuple/tuple.hpp>
 #include <boost/tuple/tuple_comparison.hpp>
@@ -113,9 +117,13 @@ public:
      *  in parametersToEstimate_ member.
      *  \param areVariationalEquationsToBeIntegrated Boolean defining whether the variational equations are to be
      *  reintegrated with the new parameter values.
+     *  \param forceReintegration Boolean defining whether the equations are to be reintegrated, even if only parameters
+     *  that influence just the observation models have been modified (e.g. if the environment has been modified
+     *  directly). If false (default), the current solution is retained in that case.
      */
     virtual void resetParameterEstimate( const Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > newParameterEstimate,
-                                         const bool areVariationalEquationsToBeIntegrated = true ) = 0;
+                                         const bool areVariationalEquationsToBeIntegrated = true,
+                                         const bool forceReintegration = false ) = 0;
 
     //! Function to get the state transition matric interface object.
     /*!
@@ -138,6 +146,66 @@ public:
 
 protected:
 
+    //! Function to determine whether the equations need to be re-integrated after the parameter values have been reset.
+    /*!
+     *  Function to determine whether the equations need to be re-integrated after the parameter values have been reset.
+     *  Re-integration is not required if all parameters that have been modified since the current solution was computed
+     *  (by resetParameterEstimate) influence only the observation models (e.g. observation biases), in which case the
+     *  current numerical solution remains valid.
+     *  \param areVariationalEquationsToBeIntegrated Boolean defining whether the variational equations are requested
+     *  \return True if the equations need to be re-integrated.
+     */
+    bool isReintegrationRequired( const bool areVariationalEquationsToBeIntegrated )
+    {
+        const std::vector< int >& referenceModificationCounters =
+                ( areVariationalEquationsToBeIntegrated ? parameterModificationCountersOfVariationalSolution_ :
+                                                          parameterModificationCountersOfDynamicsSolution_ );
+
+        // Check if there is a solution that is consistent with known parameter values.
+        if( referenceModificationCounters.size( ) == 0 )
+        {
+            return true;
+        }
+
+        // Check whether any parameter influencing the dynamics has been modified.
+        std::vector< estimatable_parameters::EstimatebleParameterIdentifier > modifiedParameters =
+                parametersToEstimate_->getParametersModifiedSince( referenceModificationCounters );
+        for( unsigned int i = 0; i < modifiedParameters.size( ); i++ )
+        {
+            if( !estimatable_parameters::isParameterObservationModelOnlyProperty( modifiedParameters.at( i ).first ) )
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    //! Function to set the parameter modification counters for which the current numerical solution is valid.
+    /*!
+     *  Function to set the parameter modification counters for which the current numerical solution is valid, to be called
+     *  after a re-integration with the current parameter values.
+     *  \param areVariationalEquationsIntegrated Boolean defining whether the variational equations were integrated
+     */
+    void setParameterModificationCountersOfSolution( const bool areVariationalEquationsIntegrated )
+    {
+        parameterModificationCountersOfDynamicsSolution_ = parametersToEstimate_->getParameterModificationCounters( );
+        if( areVariationalEquationsIntegrated )
+        {
+            parameterModificationCountersOfVariationalSolution_ = parameterModificationCountersOfDynamicsSolution_;
+        }
+        else
+        {
+            parameterModificationCountersOfVariationalSolution_.clear( );
+        }
+    }
+
+    //! Function to signal that the current numerical solution is not known to be consistent with the parameter values.
+    void resetParameterModificationCountersOfSolution( )
+    {
+        parameterModificationCountersOfDynamicsSolution_.clear( );
+        parameterModificationCountersOfVariationalSolution_.clear( );
+    }
+
 
     //! Create initial matrix of numerical soluation to variational + dynamical equations.
     /*!
@@ -202,6 +270,21 @@ protected:
 
     //! Object used for interpolating numerical results of state transition and sensitivity matrix.
     boost::shared_ptr< CombinedStateTransitionAndSensitivityMatrixInterface > stateTransitionInterface_;
+
+    //! Parameter modification counters at the time the current equations of motion solution was computed.
+    /*!
+     *  Parameter modification counters (see EstimatableParameterSet::getParameterModificationCounters) at the time the
+     *  current equations of motion solution was computed by resetParameterEstimate. Empty if the consistency of the
+     *  current solution with the parameter values is not known.
+     */
+    std::vector< int > parameterModificationCountersOfDynamicsSolution_;
+
+    //! Parameter modification counters at the time the current variational equations solution was computed.
+    /*!
+     *  Parameter modification counters at the time the current variational equations solution was computed by
+     *  resetParameterEstimate. Empty if the consistency of the current solution with the parameter values is not known.
+     */
+    std::vector< int > parameterModificationCountersOfVariationalSolution_;
 };
 
 //! Function to separate the time histories of the sensitivity and state transition matrices from a full numerical solution.
@@ -513,6 +596,8 @@ public:
      *  (default true) after propagation and resetting of state transition interface.
      *  \param integrateEquationsOnCreation Boolean to denote whether equations should be integrated immediately at the
      *  end of this contructor.
+     *  \param stateTransitionMatrixStorageSettings Settings for compressed storage of the state transition and
+     *  sensitivity matrix history. If NULL (default), the full matrices are stored and interpolated.
      */
     SingleArcVariationalEquationsSolver(
             const simulation_setup::NamedBodyMap& bodyMap,
@@ -523,12 +608,16 @@ public:
             const boost::shared_ptr< numerical_integrators::IntegratorSettings< double > > variationalOnlyIntegratorSettings
             = boost::shared_ptr< numerical_integrators::IntegratorSettings< double > >( ),
             const bool clearNumericalSolution = 1,
-            const bool integrateEquationsOnCreation = 1 ):
+            const bool integrateEquationsOnCreation = 1,
+            const boost::shared_ptr< StateTransitionMatrixStorageSettings > stateTransitionMatrixStorageSettings =
+            boost::shared_ptr< StateTransitionMatrixStorageSettings >( ) ):
         VariationalEquationsSolver< StateScalarType, TimeType >(
             bodyMap, parametersToEstimate, clearNumericalSolution ),
         integratorSettings_( integratorSettings ),
         propagatorSettings_( boost::dynamic_pointer_cast< SingleArcPropagatorSettings< StateScalarType > >(propagatorSettings ) ),
-        variationalOnlyIntegratorSettings_( variationalOnlyIntegratorSettings )
+        variationalOnlyIntegratorSettings_( variationalOnlyIntegratorSettings ),
+        stateTransitionMatrixStorageSettings_( stateTransitionMatrixStorageSettings ),
+        lastIntegrationWasConcurrent_( true )
     {
         if( boost::dynamic_pointer_cast< SingleArcPropagatorSettings< StateScalarType >  >( propagatorSettings ) == NULL )
         {
@@ -593,6 +682,8 @@ public:
     void integrateDynamicalEquationsOfMotionOnly(
             const Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >& initialStateEstimate )
     {
+        this->resetParameterModificationCountersOfSolution( );
+
         dynamicsStateDerivative_->setPropagationSettings( std::vector< IntegratedStateType >( ), 1, 0 );
         dynamicsSimulator_->integrateEquationsOfMotion( initialStateEstimate );
     }
@@ -610,8 +701,12 @@ public:
     void integrateVariationalAndDynamicalEquations(
             const VectorType& initialStateEstimate, const bool integrateEquationsConcurrently )
     {
+        this->resetParameterModificationCountersOfSolution( );
+
         variationalEquationsSolution_[ 0 ].clear( );
         variationalEquationsSolution_[ 1 ].clear( );
+        checkpointEquationsOfMotionSolution_.clear( );
+        lastIntegrationWasConcurrent_ = integrateEquationsConcurrently;
 
 
         if( integrateEquationsConcurrently )
@@ -646,6 +741,26 @@ public:
                         rawNumericalSolution, equationsOfMotionNumericalSolutionRaw,
                         std::make_pair( 0, parameterVectorSize_ ), stateTransitionMatrixSize_ );
 
+            // Retain propagated states at checkpoints, from which to restart integration between checkpoints if needed
+            if( stateTransitionMatrixStorageSettings_ != NULL &&
+                    stateTransitionMatrixStorageSettings_->checkpointInterval_ > 1 )
+            {
+                int numberOfEpochs = equationsOfMotionNumericalSolutionRaw.size( );
+                int currentEpochIndex = 0;
+                for( typename std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >::const_iterator
+                     stateIterator = equationsOfMotionNumericalSolutionRaw.begin( );
+                     stateIterator != equationsOfMotionNumericalSolutionRaw.end( ); stateIterator++ )
+                {
+                    if( isMatrixHistoryCheckpointEpoch(
+                            currentEpochIndex, numberOfEpochs, stateTransitionMatrixStorageSettings_->checkpointInterval_ ) )
+                    {
+                        checkpointEquationsOfMotionSolution_[ static_cast< double >( stateIterator->first ) ] =
+                                stateIterator->second;
+                    }
+                    currentEpochIndex++;
+                }
+            }
+
             convertNumericalStateSolutionsToOutputSolutions(
                         equationsOfMotionNumericalSolution, equationsOfMotionNumericalSolutionRaw, dynamicsStateDerivative_ );
             dynamicsSimulator_->manuallySetAndProcessRawNumericalEquationsOfMotionSolution(
@@ -664,7 +779,7 @@ public:
             dynamicsSimulator_->integrateEquationsOfMotion( initialStateEstimate );
 
             // Integrate variational equations.
-            dynamicsStateDerivative_->setPropagationSettings( boost::assign::list_of( transational_state ), 0, 1 );
+            dynamicsStateDerivative_->setPropagationSettings( getPropagatedStateTypes( ), 0, 1 );
             Eigen::MatrixXd initialVariationalState = this->createInitialVariationalEquationsSolution( );
             std::map< double, Eigen::MatrixXd > rawNumericalSolution;
             std::map< double, Eigen::VectorXd > dependentVariableHistory;
@@ -728,12 +843,22 @@ public:
      *  in parametersToEstimate_ member.
      *  \param areVariationalEquationsToBeIntegrated Boolean defining whether the variational equations are to be
      *  reintegrated with the new parameter values.
+     *  \param forceReintegration Boolean defining whether the equations are to be reintegrated, even if only parameters
+     *  that influence just the observation models have been modified.
      */
     void resetParameterEstimate( const Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > newParameterEstimate,
-                                 const bool areVariationalEquationsToBeIntegrated = true )
+                                 const bool areVariationalEquationsToBeIntegrated = true,
+                                 const bool forceReintegration = false )
     {
         // Reset values of parameters.
         parametersToEstimate_->template resetParameterValues< StateScalarType >( newParameterEstimate );
+
+        // Retain current solution if only observation model parameters have been modified, and no reintegration is forced.
+        if( !forceReintegration && !this->isReintegrationRequired( areVariationalEquationsToBeIntegrated ) )
+        {
+            return;
+        }
+
         propagatorSettings_->resetInitialStates(
                     estimatable_parameters::getInitialStateVectorOfBodiesToEstimate( parametersToEstimate_ ) );
 
@@ -750,6 +875,7 @@ public:
         {
             this->integrateDynamicalEquationsOfMotionOnly( propagatorSettings_->getInitialStates( ) );
         }
+        this->setParameterModificationCountersOfSolution( areVariationalEquationsToBeIntegrated );
     }
 
 protected:
@@ -769,6 +895,13 @@ private:
         using namespace interpolators;
         using namespace utilities;
 
+        // Use compressed storage, if requested
+        if( stateTransitionMatrixStorageSettings_ != NULL )
+        {
+            resetCompressedStateTransitionMatrixInterface( );
+            return;
+        }
+
         // Create interpolators.
         boost::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::MatrixXd > >
                 stateTransitionMatrixInterpolator;
@@ -793,6 +926,231 @@ private:
         }
     }
 
+    //! Reset compressed storage of the solution of the variational equations.
+    /*!
+     *  Reset compressed storage of the solution of the variational equations, as defined by the
+     *  stateTransitionMatrixStorageSettings_, from the numerical integration results (in variationalEquationsSolution_).
+     */
+    void resetCompressedStateTransitionMatrixInterface( )
+    {
+        std::vector< int > columnsToStore = stateTransitionMatrixStorageSettings_->columnsToStore_;
+        int checkpointInterval = stateTransitionMatrixStorageSettings_->checkpointInterval_;
+        int interpolationOrder = stateTransitionMatrixStorageSettings_->interpolationOrder_;
+        bool integrateSegmentsForwards = lastIntegrationWasConcurrent_ ?
+                    ( integratorSettings_->initialTimeStep_ > 0.0 ) :
+                    ( variationalOnlyIntegratorSettings_->initialTimeStep_ > 0.0 );
+
+        // Create function to re-integrate between checkpoints
+        boost::function< std::vector< std::map< double, Eigen::MatrixXd > >(
+                    const double, const Eigen::MatrixXd&, const double ) > segmentIntegrationFunction;
+        if( checkpointInterval > 1 )
+        {
+            segmentIntegrationFunction = boost::bind(
+                        &SingleArcVariationalEquationsSolver< StateScalarType, TimeType >::
+                        integrateVariationalEquationsBetweenCheckpoints, this, _1, _2, _3 );
+        }
+
+        // Create (if non-existent) or reset state transition matrix interface
+        if( stateTransitionMatrixStorageSettings_->useSinglePrecision_ )
+        {
+            if( stateTransitionInterface_ == NULL )
+            {
+                stateTransitionInterface_ = boost::make_shared<
+                        CompressedSingleArcCombinedStateTransitionAndSensitivityMatrixInterface< float > >(
+                            variationalEquationsSolution_, propagatorSettings_->getStateSize( ), parameterVectorSize_,
+                            columnsToStore, checkpointInterval, segmentIntegrationFunction, interpolationOrder,
+                            integrateSegmentsForwards );
+            }
+            else
+            {
+                boost::dynamic_pointer_cast<
+                        CompressedSingleArcCombinedStateTransitionAndSensitivityMatrixInterface< float > >(
+                            stateTransitionInterface_ )->updateMatrixHistory(
+                            variationalEquationsSolution_, integrateSegmentsForwards );
+            }
+        }
+        else
+        {
+            if( stateTransitionInterface_ == NULL )
+            {
+                stateTransitionInterface_ = boost::make_shared<
+                        CompressedSingleArcCombinedStateTransitionAndSensitivityMatrixInterface< double > >(
+                            variationalEquationsSolution_, propagatorSettings_->getStateSize( ), parameterVectorSize_,
+                            columnsToStore, checkpointInterval, segmentIntegrationFunction, interpolationOrder,
+                            integrateSegmentsForwards );
+            }
+            else
+            {
+                boost::dynamic_pointer_cast<
+                        CompressedSingleArcCombinedStateTransitionAndSensitivityMatrixInterface< double > >(
+                            stateTransitionInterface_ )->updateMatrixHistory(
+                            variationalEquationsSolution_, integrateSegmentsForwards );
+            }
+        }
+
+        if( this->clearNumericalSolution_ )
+        {
+            variationalEquationsSolution_[ 0 ].clear( );
+            variationalEquationsSolution_[ 1 ].clear( );
+        }
+    }
+
+    //! Function to re-integrate the variational equations between two checkpoints of the compressed solution storage.
+    /*!
+     *  Function to re-integrate the variational equations between two checkpoints of the compressed solution storage.
+     *  The equations are integrated in the same manner (concurrently with equations of motion or not) as the most recent
+     *  full integration. In the concurrent case, the state at the first checkpoint is taken from the retained propagated
+     *  state history.
+     *  \param segmentStartTime Time of first checkpoint, from which to start the integration.
+     *  \param initialCombinedMatrix Combined state transition and sensitivity matrix at segmentStartTime.
+     *  \param segmentEndTime Time of second checkpoint, at which to terminate the integration.
+     *  \return Vector of state transition matrix history (first vector entry) and sensitivity matrix history (second
+     *  vector entry) between the two checkpoints.
+     */
+    std::vector< std::map< double, Eigen::MatrixXd > > integrateVariationalEquationsBetweenCheckpoints(
+            const double segmentStartTime, const Eigen::MatrixXd& initialCombinedMatrix, const double segmentEndTime )
+    {
+        std::vector< std::map< double, Eigen::MatrixXd > > segmentSolution;
+
+        if( lastIntegrationWasConcurrent_ )
+        {
+            // Set combined initial state of variational equations and equations of motion.
+            MatrixType initialVariationalState = MatrixType::Zero( stateTransitionMatrixSize_, parameterVectorSize_ + 1 );
+            initialVariationalState.block( 0, 0, stateTransitionMatrixSize_, parameterVectorSize_ ) =
+                    initialCombinedMatrix.template cast< StateScalarType >( );
+            initialVariationalState.block( 0, parameterVectorSize_, stateTransitionMatrixSize_, 1 ) =
+                    checkpointEquationsOfMotionSolution_.at( segmentStartTime );
+
+            // Integrate variational and state equations from checkpoint.
+            dynamicsStateDerivative_->setPropagationSettings( std::vector< IntegratedStateType >( ), 1, 1 );
+            std::map< TimeType, MatrixType > rawNumericalSolution;
+            integrateSegmentBetweenCheckpoints< MatrixType, TimeType >(
+                        dynamicsSimulator_->getStateDerivativeFunction( ), initialVariationalState, integratorSettings_,
+                        segmentStartTime, segmentEndTime, rawNumericalSolution );
+
+            setVariationalEquationsSolution< TimeType, StateScalarType >(
+                        rawNumericalSolution, segmentSolution,
+                        std::make_pair( 0, 0 ), std::make_pair( 0, stateTransitionMatrixSize_ ),
+                        stateTransitionMatrixSize_, parameterVectorSize_ );
+        }
+        else
+        {
+            // Integrate variational equations only from checkpoint, retrieving the propagated states from the
+            // environment.
+            dynamicsStateDerivative_->setPropagationSettings( getPropagatedStateTypes( ), 0, 1 );
+            std::map< double, Eigen::MatrixXd > rawNumericalSolution;
+            integrateSegmentBetweenCheckpoints< Eigen::MatrixXd, double >(
+                        dynamicsSimulator_->getDoubleStateDerivativeFunction( ), initialCombinedMatrix,
+                        variationalOnlyIntegratorSettings_, segmentStartTime, segmentEndTime, rawNumericalSolution );
+
+            setVariationalEquationsSolution< double, double >(
+                        rawNumericalSolution, segmentSolution, std::make_pair( 0, 0 ),
+                        std::make_pair( 0, stateTransitionMatrixSize_ ),
+                        stateTransitionMatrixSize_, parameterVectorSize_ );
+        }
+
+        return segmentSolution;
+    }
+
+    //! Function to numerically integrate a set of equations between two checkpoints of the compressed solution storage.
+    /*!
+     *  Function to numerically integrate a set of equations between two checkpoints of the compressed solution storage,
+     *  using a local copy of the integrator settings (so that the settings of this object are not modified). For
+     *  variable step-size integrators, the integration is terminated exactly at the second checkpoint: any epoch beyond
+     *  it is removed, after which the integration is restarted from the last retained epoch, with the remaining time to
+     *  the checkpoint as initial time step, until the checkpoint is reached.
+     *  \param stateDerivativeFunction Function returning the state derivative from current time and state.
+     *  \param initialState State at segmentStartTime.
+     *  \param integratorSettings Settings for the numerical integrator (initial time is reset to segmentStartTime).
+     *  \param segmentStartTime Time of first checkpoint, from which to start the integration.
+     *  \param segmentEndTime Time of second checkpoint, at which to terminate the integration.
+     *  \param segmentNumericalSolution Numerical solution between the checkpoints (returned by reference).
+     */
+    template< typename SegmentStateType, typename SegmentTimeType >
+    void integrateSegmentBetweenCheckpoints(
+            const boost::function< SegmentStateType( const SegmentTimeType, const SegmentStateType& ) >
+            stateDerivativeFunction,
+            const SegmentStateType& initialState,
+            const boost::shared_ptr< numerical_integrators::IntegratorSettings< SegmentTimeType > > integratorSettings,
+            const double segmentStartTime, const double segmentEndTime,
+            std::map< SegmentTimeType, SegmentStateType >& segmentNumericalSolution )
+    {
+        boost::shared_ptr< numerical_integrators::IntegratorSettings< SegmentTimeType > > segmentIntegratorSettings =
+                integratorSettings->clone( );
+        segmentIntegratorSettings->initialTime_ = segmentStartTime;
+
+        bool integrateForwards = ( segmentEndTime >= segmentStartTime );
+        boost::shared_ptr< PropagationTerminationCondition > segmentTerminationCondition =
+                boost::make_shared< FixedTimePropagationTerminationCondition >( segmentEndTime, integrateForwards );
+        boost::function< bool( const double, const double ) > stopPropagationFunction =
+                boost::bind( &PropagationTerminationCondition::checkStopCondition, segmentTerminationCondition, _1, _2 );
+
+        std::map< SegmentTimeType, Eigen::VectorXd > dependentVariableHistory;
+        std::map< SegmentTimeType, double > cummulativeComputationTimeHistory;
+        EquationIntegrationInterface< SegmentStateType, SegmentTimeType >::integrateEquations(
+                    stateDerivativeFunction, segmentNumericalSolution, initialState, segmentIntegratorSettings,
+                    stopPropagationFunction, dependentVariableHistory, cummulativeComputationTimeHistory );
+
+        if( segmentIntegratorSettings->integratorType_ == numerical_integrators::rungeKuttaVariableStepSize )
+        {
+            double finalTimeTolerance = 10.0 * std::numeric_limits< double >::epsilon( ) *
+                    std::max( std::fabs( segmentStartTime ), std::fabs( segmentEndTime ) );
+            std::map< SegmentTimeType, SegmentStateType > restartedNumericalSolution;
+            while( std::fabs( static_cast< double >( segmentNumericalSolution.rbegin( )->first ) - segmentEndTime ) >
+                   finalTimeTolerance )
+            {
+                // Remove last epoch if it is beyond the checkpoint, or restart integration from it otherwise.
+                double timeToCheckpoint =
+                        segmentEndTime - static_cast< double >( segmentNumericalSolution.rbegin( )->first );
+                if( ( timeToCheckpoint < 0.0 ) == integrateForwards )
+                {
+                    if( segmentNumericalSolution.size( ) == 1 )
+                    {
+                        throw std::runtime_error(
+                                    "Error when integrating variational equations between checkpoints, checkpoint not reached." );
+                    }
+                    segmentNumericalSolution.erase( segmentNumericalSolution.rbegin( )->first );
+                }
+                else
+                {
+                    segmentIntegratorSettings->initialTime_ = segmentNumericalSolution.rbegin( )->first;
+                    segmentIntegratorSettings->initialTimeStep_ = timeToCheckpoint;
+                    EquationIntegrationInterface< SegmentStateType, SegmentTimeType >::integrateEquations(
+                                stateDerivativeFunction, restartedNumericalSolution,
+                                segmentNumericalSolution.rbegin( )->second, segmentIntegratorSettings,
+                                stopPropagationFunction, dependentVariableHistory, cummulativeComputationTimeHistory );
+                    if( restartedNumericalSolution.size( ) < 2 )
+                    {
+                        throw std::runtime_error(
+                                    "Error when integrating variational equations between checkpoints, integration failed." );
+                    }
+                    segmentNumericalSolution.insert(
+                                restartedNumericalSolution.begin( ), restartedNumericalSolution.end( ) );
+                }
+            }
+        }
+    }
+
+    //! Function to retrieve the types of dynamics that are propagated.
+    /*!
+     *  Function to retrieve the types of dynamics that are propagated, as defined by the propagator settings.
+     *  \return Types of dynamics that are propagated.
+     */
+    std::vector< IntegratedStateType > getPropagatedStateTypes( )
+    {
+        std::map< IntegratedStateType, std::vector< std::pair< std::string, std::string > > > integratedStateList =
+                getIntegratedTypeAndBodyList< StateScalarType >( propagatorSettings_ );
+
+        std::vector< IntegratedStateType > propagatedStateTypes;
+        for( typename std::map< IntegratedStateType, std::vector< std::pair< std::string, std::string > > >::
+             const_iterator stateTypeIterator = integratedStateList.begin( );
+             stateTypeIterator != integratedStateList.end( ); stateTypeIterator++ )
+        {
+            propagatedStateTypes.push_back( stateTypeIterator->first );
+        }
+        return propagatedStateTypes;
+    }
+
     //! Object used for numerically propagating and managing the solution of the equations of motion.
     boost::shared_ptr< SingleArcDynamicsSimulator< StateScalarType, TimeType > > dynamicsSimulator_;
 
@@ -823,6 +1181,15 @@ private:
      *  either full or separate propagation of equations.
      */
     boost::shared_ptr< DynamicsStateDerivativeModel< TimeType, StateScalarType > > dynamicsStateDerivative_;
+
+    //! Settings for compressed storage of the state transition and sensitivity matrix history (NULL if not used).
+    boost::shared_ptr< StateTransitionMatrixStorageSettings > stateTransitionMatrixStorageSettings_;
+
+    //! Boolean denoting whether the most recent integration of the variational equations was concurrent with the dynamics
+    bool lastIntegrationWasConcurrent_;
+
+    //! History of propagated states (in propagation formulation), retained for re-integration between checkpoints.
+    std::map< double, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > checkpointEquationsOfMotionSolution_;
 };
 
 //! Function to transfer the initial multi-arc states from propagator settings to associated initial state estimation parameters.
@@ -1011,6 +1378,8 @@ public:
     void integrateDynamicalEquationsOfMotionOnly(
             const Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >& initialStateEstimate )
     {
+        this->resetParameterModificationCountersOfSolution( );
+
         for( int i = 0; i < numberOfArcs_; i++ )
         {
             dynamicsStateDerivatives_.at( i )->setPropagationSettings( std::vector< IntegratedStateType >( ), 1, 0 );
@@ -1029,6 +1398,8 @@ public:
     void integrateDynamicalEquationsOfMotionOnly(
             const std::vector< Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >& initialStateEstimate )
     {
+        this->resetParameterModificationCountersOfSolution( );
+
         for( int i = 0; i < numberOfArcs_; i++ )
         {
             dynamicsStateDerivatives_.at( i )->setPropagationSettings( std::vector< IntegratedStateType >( ), 1, 0 );
@@ -1082,6 +1453,8 @@ public:
     void integrateVariationalAndDynamicalEquations(
             const std::vector< VectorType >& initialStateEstimate, const bool integrateEquationsConcurrently )
     {
+        this->resetParameterModificationCountersOfSolution( );
+
         bool updateInitialStates = false;
         std::vector< VectorType > arcInitialStates;
 
@@ -1299,12 +1672,22 @@ public:
      *  in parametersToEstimate_ member.
      *  \param areVariationalEquationsToBeIntegrated Boolean defining whether the variational equations are to be
      *  reintegrated with the new parameter values.
+     *  \param forceReintegration Boolean defining whether the equations are to be reintegrated, even if only parameters
+     *  that influence just the observation models have been modified.
      */
     void resetParameterEstimate( const Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > newParameterEstimate,
-                                 const bool areVariationalEquationsToBeIntegrated = true )
+                                 const bool areVariationalEquationsToBeIntegrated = true,
+                                 const bool forceReintegration = false )
     {
         // Reset values of parameters.
         parametersToEstimate_->template resetParameterValues< StateScalarType >( newParameterEstimate );
+
+        // Retain current solution if only observation model parameters have been modified, and no reintegration is forced.
+        if( !forceReintegration && !this->isReintegrationRequired( areVariationalEquationsToBeIntegrated ) )
+        {
+            return;
+        }
+
         propagatorSettings_->resetInitialStates(
                     estimatable_parameters::getInitialStateVectorOfBodiesToEstimate( parametersToEstimate_ ) );
 
@@ -1320,6 +1703,7 @@ public:
         {
             this->integrateDynamicalEquationsOfMotionOnly( propagatorSettings_->getInitialStates( ) );
         }
+        this->setParameterModificationCountersOfSolution( areVariationalEquationsToBeIntegrated );
     }
 
     //! Function to return the numerical solution history of integrated variational equations, per arc.
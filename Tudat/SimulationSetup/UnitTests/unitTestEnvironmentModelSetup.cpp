@@ -10,13 +10,17 @@
 
 #define BOOST_TEST_MAIN
 
+#include <cmath>
 #include <limits>
 
 #include <boost/test/unit_test.hpp>
+#include <boost/bind.hpp>
 #include <boost/make_shared.hpp>
+#include <boost/lambda/lambda.hpp>
 
 #include <Eigen/Core>
 
+#include "Tudat/Astrodynamics/Aerodynamics/customAerodynamicCoefficientInterface.h"
 #include "Tudat/Astrodynamics/Aerodynamics/exponentialAtmosphere.h"
 
 #if USE_NRLMSISE00
@@ -28,6 +32,8 @@
 #include "Tudat/Astrodynamics/BasicAstrodynamics/unitConversions.h"
 #include "Tudat/Astrodynamics/BasicAstrodynamics/geodeticCoordinateConversions.h"
 #include "Tudat/Astrodynamics/Ephemerides/approximatePlanetPositions.h"
+#include "Tudat/Astrodynamics/Ephemerides/constantEphemeris.h"
+#include "Tudat/Astrodynamics/Ephemerides/keplerEphemeris.h"
 #include "Tudat/Astrodynamics/Ephemerides/tabulatedEphemeris.h"
 #include "Tudat/Astrodynamics/Ephemerides/simpleRotationalEphemeris.h"
 #include "Tudat/Astrodynamics/Ephemerides/itrsToGcrsRotationModel.h"
@@ -41,17 +47,23 @@
 #include "Tudat/External/SpiceInterface/spiceEphemeris.h"
 #endif
 #include "Tudat/Astrodynamics/Gravitation/triAxialEllipsoidGravity.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/sphericalBodyShapeModel.h"
+#include "Tudat/Basics/parallelLoops.h"
 #include "Tudat/InputOutput/basicInputOutput.h"
 #include "Tudat/InputOutput/matrixTextFileReader.h"
 #include "Tudat/InputOutput/solarActivityData.h"
 #include "Tudat/InputOutput/parseSolarActivityData.h"
 #include "Tudat/Mathematics/BasicMathematics/coordinateConversions.h"
 #include "Tudat/Mathematics/Interpolators/lagrangeInterpolator.h"
+#include "Tudat/SimulationSetup/EnvironmentSetup/createAerodynamicCoefficientInterface.h"
 #include "Tudat/SimulationSetup/EnvironmentSetup/createAtmosphereModel.h"
+#include "Tudat/SimulationSetup/EnvironmentSetup/createBodies.h"
 #include "Tudat/SimulationSetup/EnvironmentSetup/createEphemeris.h"
 #include "Tudat/SimulationSetup/EnvironmentSetup/createGravityField.h"
 #include "Tudat/SimulationSetup/EnvironmentSetup/createRotationModel.h"
 #include "Tudat/SimulationSetup/EnvironmentSetup/defaultBodies.h"
+#include "Tudat/SimulationSetup/PropagationSetup/createAccelerationModels.h"
+#include "Tudat/SimulationSetup/PropagationSetup/dynamicsSimulator.h"
 
 namespace tudat
 {
@@ -820,6 +832,56 @@ BOOST_AUTO_TEST_CASE( test_earthRotationModelSetup )
         }
     }
 }
+
+//! Test set up of GCRS<->ITRS rotation model with interpolated Earth orientation angles
+BOOST_AUTO_TEST_CASE( test_interpolatedEarthRotationModelSetup )
+{
+    // Create rotation model with directly computed, and interpolated, Earth orientation angles
+    double initialTime = 5.0E7;
+    double finalTime = 5.0E7 + 2.0 * 86400.0;
+    boost::shared_ptr< tudat::ephemerides::RotationalEphemeris > earthRotationModel =
+            createRotationModel( boost::make_shared< GcrsToItrsRotationModelSettings >( ), "Earth" );
+
+    boost::shared_ptr< GcrsToItrsRotationModelSettings > interpolatedRotationSettings =
+            boost::make_shared< GcrsToItrsRotationModelSettings >( );
+    interpolatedRotationSettings = boost::make_shared< GcrsToItrsRotationModelSettings >(
+                basic_astrodynamics::iau_2006, interpolatedRotationSettings->getEopFile( ), "GCRS", "ITRS",
+                basic_astrodynamics::tdb_scale, interpolatedRotationSettings->getUt1CorrectionSettings( ),
+                interpolatedRotationSettings->getPolarMotionCorrectionSettings( ),
+                boost::make_shared< ModelInterpolationSettings >( initialTime, finalTime, 600.0 ) );
+    boost::shared_ptr< tudat::ephemerides::RotationalEphemeris > interpolatedEarthRotationModel =
+            createRotationModel( interpolatedRotationSettings, "Earth" );
+
+    BOOST_CHECK( boost::dynamic_pointer_cast< ephemerides::GcrsToItrsRotationModel >(
+                     interpolatedEarthRotationModel )->getAnglesInterpolator( ) != NULL );
+
+    // Compare rotation matrices (and derivatives) over interpolation interval, at times not on interpolation grid
+    for( double testTime = initialTime + 123.0; testTime < finalTime; testTime += 3456.0 )
+    {
+        Eigen::Matrix3d matrixDeviation =
+                interpolatedEarthRotationModel->getRotationToBaseFrame( testTime ).toRotationMatrix( ) -
+                earthRotationModel->getRotationToBaseFrame( testTime ).toRotationMatrix( );
+        Eigen::Matrix3d matrixDerivativeDeviation =
+                interpolatedEarthRotationModel->getDerivativeOfRotationToBaseFrame( testTime ) -
+                earthRotationModel->getDerivativeOfRotationToBaseFrame( testTime );
+        for( unsigned int i = 0; i < 3; i++ )
+        {
+            for( unsigned int j = 0; j < 3; j++ )
+            {
+                BOOST_CHECK_SMALL( std::fabs( matrixDeviation( i, j ) ), 1.0E-10 );
+                BOOST_CHECK_SMALL( std::fabs( matrixDerivativeDeviation( i, j ) ), 1.0E-14 );
+            }
+        }
+    }
+
+    // Check that invalid interpolation settings are rejected
+    interpolatedRotationSettings = boost::make_shared< GcrsToItrsRotationModelSettings >(
+                basic_astrodynamics::iau_2006, interpolatedRotationSettings->getEopFile( ), "GCRS", "ITRS",
+                basic_astrodynamics::tdb_scale, interpolatedRotationSettings->getUt1CorrectionSettings( ),
+                interpolatedRotationSettings->getPolarMotionCorrectionSettings( ),
+                boost::make_shared< ModelInterpolationSettings >( finalTime, initialTime, 600.0 ) );
+    BOOST_CHECK_THROW( createRotationModel( interpolatedRotationSettings, "Earth" ), std::runtime_error );
+}
 #endif
 
 #if USE_CSPICE
@@ -1070,6 +1132,250 @@ BOOST_AUTO_TEST_CASE( test_groundStationCreation )
     }
 }
 
+//! Test creation of a copy of a list of bodies that can be used independently of the original bodies.
+BOOST_AUTO_TEST_CASE( test_independentBodyMapCopy )
+{
+    using namespace ephemerides;
+
+    // Create bodies, with ephemeris origins that depend on one another.
+    NamedBodyMap bodyMap;
+    bodyMap[ "Sun" ] = boost::make_shared< Body >( );
+    bodyMap[ "Sun" ]->setEphemeris( boost::make_shared< ConstantEphemeris >(
+                                        Eigen::Vector6d( Eigen::Vector6d::Constant( 1.0E6 ) ), "SSB", "J2000" ) );
+    bodyMap[ "Earth" ] = boost::make_shared< Body >( );
+    bodyMap[ "Earth" ]->setEphemeris( boost::make_shared< ApproximatePlanetPositions >(
+                                          ApproximatePlanetPositionsBase::earthMoonBarycenter ) );
+    bodyMap[ "Earth" ]->setGravityFieldModel( boost::make_shared< gravitation::GravityFieldModel >( 3.986004418E14 ) );
+    bodyMap[ "Earth" ]->setRotationalEphemeris( boost::make_shared< SimpleRotationalEphemeris >(
+                                                    Eigen::Quaterniond( Eigen::Matrix3d::Identity( ) ),
+                                                    7.292115E-5, 0.0, "J2000", "IAU_Earth" ) );
+    Eigen::Vector6d vehicleKeplerElements;
+    vehicleKeplerElements << 7.0E6, 0.01, 0.5, 1.0, 2.0, 3.0;
+    bodyMap[ "Vehicle" ] = boost::make_shared< Body >( );
+    bodyMap[ "Vehicle" ]->setEphemeris( boost::make_shared< KeplerEphemeris >(
+                                            vehicleKeplerElements, 0.0, 3.986004418E14, "Earth", "J2000" ) );
+    setGlobalFrameBodyEphemerides( bodyMap, "SSB", "J2000" );
+
+    NamedBodyMap copiedBodyMap = createIndependentBodyMapCopy( bodyMap, "J2000" );
+    BOOST_CHECK_EQUAL( copiedBodyMap.size( ), bodyMap.size( ) );
+
+    // Check which models are copied, and which are shared.
+    for( NamedBodyMap::const_iterator bodyIterator = bodyMap.begin( ); bodyIterator != bodyMap.end( ); bodyIterator++ )
+    {
+        boost::shared_ptr< Body > copiedBody = copiedBodyMap.at( bodyIterator->first );
+        BOOST_CHECK( copiedBody != bodyIterator->second );
+        BOOST_CHECK( copiedBody->getEphemeris( ) != bodyIterator->second->getEphemeris( ) );
+        BOOST_CHECK_EQUAL( copiedBody->getIsBodyGlobalFrameOrigin( ), 0 );
+    }
+    BOOST_CHECK( copiedBodyMap.at( "Earth" )->getGravityFieldModel( ) !=
+                 bodyMap.at( "Earth" )->getGravityFieldModel( ) );
+    BOOST_CHECK_EQUAL( copiedBodyMap.at( "Earth" )->getGravityFieldModel( )->getGravitationalParameter( ),
+                       bodyMap.at( "Earth" )->getGravityFieldModel( )->getGravitationalParameter( ) );
+    BOOST_CHECK( copiedBodyMap.at( "Earth" )->getRotationalEphemeris( ) !=
+                 bodyMap.at( "Earth" )->getRotationalEphemeris( ) );
+    BOOST_CHECK( copiedBodyMap.at( "Vehicle" )->getEphemerisFrameToBaseFrame( ) !=
+                 bodyMap.at( "Vehicle" )->getEphemerisFrameToBaseFrame( ) );
+
+    // Check that copied bodies produce identical states.
+    for( unsigned int i = 1; i < 5; i++ )
+    {
+        double testTime = static_cast< double >( i ) * 1.0E6;
+        Eigen::Vector6d expectedVehicleState =
+                bodyMap.at( "Vehicle" )->getStateInBaseFrameFromEphemeris( testTime );
+        Eigen::Vector6d copiedVehicleState =
+                copiedBodyMap.at( "Vehicle" )->getStateInBaseFrameFromEphemeris( testTime );
+        for( unsigned int j = 0; j < 6; j++ )
+        {
+            BOOST_CHECK_EQUAL( copiedVehicleState( j ), expectedVehicleState( j ) );
+        }
+    }
+
+    // Check that updating the copied bodies does not modify the state of the original bodies.
+    bodyMap.at( "Earth" )->recomputeStateOnNextCall( );
+    bodyMap.at( "Earth" )->setStateFromEphemeris( 0.0 );
+    Eigen::Vector6d originalEarthState = bodyMap.at( "Earth" )->getState( );
+    copiedBodyMap.at( "Earth" )->setStateFromEphemeris( 1.0E7 );
+    copiedBodyMap.at( "Earth" )->setCurrentRotationToLocalFrameFromEphemeris( 1.0E7 );
+    for( unsigned int j = 0; j < 6; j++ )
+    {
+        BOOST_CHECK_EQUAL( bodyMap.at( "Earth" )->getState( )( j ), originalEarthState( j ) );
+    }
+    BOOST_CHECK( copiedBodyMap.at( "Earth" )->getState( ) != originalEarthState );
+
+    // Add aerodynamic coefficients and radiation pressure (occulted by Earth) to vehicle, and copy bodies again.
+    bodyMap.at( "Sun" )->setShapeModel( boost::make_shared< SphericalBodyShapeModel >( 6.96E8 ) );
+    bodyMap.at( "Earth" )->setShapeModel( boost::make_shared< SphericalBodyShapeModel >( 6378137.0 ) );
+    bodyMap.at( "Vehicle" )->setAerodynamicCoefficientInterface(
+                createConstantCoefficientAerodynamicCoefficientInterface(
+                    ( Eigen::Vector3d( ) << 2.2, 0.0, 0.0 ).finished( ), Eigen::Vector3d::Zero( ), 1.0, 4.0, 1.0,
+                    Eigen::Vector3d::Zero( ), true, true ) );
+    bodyMap.at( "Vehicle" )->setRadiationPressureInterface(
+                "Sun", createRadiationPressureInterface(
+                    boost::make_shared< CannonBallRadiationPressureInterfaceSettings >(
+                        "Sun", 4.0, 1.2, std::vector< std::string >( { "Earth" } ) ), "Vehicle", bodyMap ) );
+    copiedBodyMap = createIndependentBodyMapCopy( bodyMap, "J2000" );
+
+    BOOST_CHECK( copiedBodyMap.at( "Vehicle" )->getAerodynamicCoefficientInterface( ) !=
+                 bodyMap.at( "Vehicle" )->getAerodynamicCoefficientInterface( ) );
+    for( unsigned int j = 0; j < 3; j++ )
+    {
+        BOOST_CHECK_EQUAL(
+                    copiedBodyMap.at( "Vehicle" )->getAerodynamicCoefficientInterface( )->getCurrentForceCoefficients( )( j ),
+                    bodyMap.at( "Vehicle" )->getAerodynamicCoefficientInterface( )->getCurrentForceCoefficients( )( j ) );
+    }
+
+    boost::shared_ptr< electro_magnetism::RadiationPressureInterface > radiationPressureInterface =
+            bodyMap.at( "Vehicle" )->getRadiationPressureInterfaces( ).at( "Sun" );
+    boost::shared_ptr< electro_magnetism::RadiationPressureInterface > copiedRadiationPressureInterface =
+            copiedBodyMap.at( "Vehicle" )->getRadiationPressureInterfaces( ).at( "Sun" );
+    BOOST_CHECK( copiedRadiationPressureInterface != radiationPressureInterface );
+
+    // Check that copied radiation pressure interface uses the states of the copied bodies only.
+    double testTime = 2.0E6;
+    std::vector< std::string > bodyNames = { "Sun", "Earth", "Vehicle" };
+    for( unsigned int i = 0; i < bodyNames.size( ); i++ )
+    {
+        copiedBodyMap.at( bodyNames.at( i ) )->setStateFromEphemeris( testTime );
+        bodyMap.at( bodyNames.at( i ) )->setStateFromEphemeris( 0.0 );
+    }
+    copiedRadiationPressureInterface->updateInterface( testTime );
+
+    Eigen::Vector3d expectedSolarVector = copiedBodyMap.at( "Sun" )->getPosition( ) -
+            copiedBodyMap.at( "Vehicle" )->getPosition( );
+    for( unsigned int j = 0; j < 3; j++ )
+    {
+        BOOST_CHECK_EQUAL( copiedRadiationPressureInterface->getSourcePositionFunction( )( )( j ),
+                           copiedBodyMap.at( "Sun" )->getPosition( )( j ) );
+        BOOST_CHECK_EQUAL( copiedRadiationPressureInterface->getTargetPositionFunction( )( )( j ),
+                           copiedBodyMap.at( "Vehicle" )->getPosition( )( j ) );
+        BOOST_CHECK_EQUAL( copiedRadiationPressureInterface->getOccultingBodyPositions( ).at( 0 )( )( j ),
+                           copiedBodyMap.at( "Earth" )->getPosition( )( j ) );
+        BOOST_CHECK_CLOSE_FRACTION( copiedRadiationPressureInterface->getCurrentSolarVector( )( j ),
+                                    expectedSolarVector( j ), 1.0E-15 );
+    }
+    BOOST_CHECK( std::isnan( radiationPressureInterface->getCurrentRadiationPressure( ) ) );
+    BOOST_CHECK( !std::isnan( copiedRadiationPressureInterface->getCurrentRadiationPressure( ) ) );
+}
+
+//! Function to propagate a vehicle about the Earth (spherical harmonic gravity and drag) in one of a list of
+//! environments.
+void propagateVehicleInBodyMap( const unsigned int propagationIndex, const std::vector< NamedBodyMap >& bodyMaps,
+                                const std::vector< Eigen::VectorXd >& initialStates,
+                                std::vector< Eigen::VectorXd >& finalStates )
+{
+    using namespace propagators;
+    using namespace numerical_integrators;
+
+    const NamedBodyMap& bodyMap = bodyMaps.at( propagationIndex );
+
+    // Set accelerations.
+    SelectedAccelerationMap accelerationMap;
+    accelerationMap[ "Vehicle" ][ "Earth" ].push_back(
+                boost::make_shared< SphericalHarmonicAccelerationSettings >( 2, 2 ) );
+    accelerationMap[ "Vehicle" ][ "Earth" ].push_back( boost::make_shared< AccelerationSettings >( aerodynamic ) );
+    std::vector< std::string > bodiesToPropagate = { "Vehicle" };
+    std::vector< std::string > centralBodies = { "Earth" };
+    AccelerationMap accelerationModelMap = createAccelerationModelsMap(
+                bodyMap, accelerationMap, bodiesToPropagate, centralBodies );
+
+    // Propagate vehicle, and retrieve final state.
+    boost::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+            boost::make_shared< TranslationalStatePropagatorSettings< double > >(
+                centralBodies, accelerationModelMap, bodiesToPropagate, initialStates.at( propagationIndex ), 7200.0 );
+    boost::shared_ptr< IntegratorSettings< > > integratorSettings =
+            boost::make_shared< IntegratorSettings< > >( rungeKutta4, 0.0, 10.0 );
+    SingleArcDynamicsSimulator< > dynamicsSimulator(
+                bodyMap, integratorSettings, propagatorSettings, true, false, false );
+    finalStates[ propagationIndex ] = dynamicsSimulator.getEquationsOfMotionNumericalSolution( ).rbegin( )->second;
+}
+
+//! Test concurrent propagation in independent copies of a list of bodies with a gravity field and atmosphere.
+BOOST_AUTO_TEST_CASE( test_independentBodyMapCopyConcurrentPropagation )
+{
+    using namespace ephemerides;
+
+    // Create Earth with spherical harmonic gravity field and tabulated atmosphere, and vehicle.
+    Eigen::MatrixXd cosineCoefficients = Eigen::MatrixXd::Zero( 3, 3 );
+    Eigen::MatrixXd sineCoefficients = Eigen::MatrixXd::Zero( 3, 3 );
+    cosineCoefficients( 0, 0 ) = 1.0;
+    cosineCoefficients( 2, 0 ) = -4.841651437908150E-4;
+    cosineCoefficients( 2, 2 ) = 2.439383573283130E-6;
+    sineCoefficients( 2, 2 ) = -1.400273703859340E-6;
+
+    NamedBodyMap bodyMap;
+    bodyMap[ "Earth" ] = boost::make_shared< Body >( );
+    bodyMap[ "Earth" ]->setEphemeris( boost::make_shared< ConstantEphemeris >(
+                                          Eigen::Vector6d( Eigen::Vector6d::Zero( ) ), "SSB", "J2000" ) );
+    bodyMap[ "Earth" ]->setRotationalEphemeris( boost::make_shared< SimpleRotationalEphemeris >(
+                                                    Eigen::Quaterniond( Eigen::Matrix3d::Identity( ) ),
+                                                    7.292115E-5, 0.0, "J2000", "IAU_Earth" ) );
+    bodyMap[ "Earth" ]->setGravityFieldModel( boost::make_shared< gravitation::SphericalHarmonicsGravityField >(
+                                                  3.986004418E14, 6378137.0, cosineCoefficients, sineCoefficients,
+                                                  "IAU_Earth" ) );
+    bodyMap[ "Earth" ]->setShapeModel( boost::make_shared< SphericalBodyShapeModel >( 6378137.0 ) );
+    bodyMap[ "Earth" ]->setAtmosphereModel( boost::make_shared< aerodynamics::TabulatedAtmosphere >(
+                input_output::getAtmosphereTablesPath( ) + "USSA1976Until100kmPer100mUntil1000kmPer1000m.dat" ) );
+    bodyMap[ "Vehicle" ] = boost::make_shared< Body >( );
+    bodyMap[ "Vehicle" ]->setConstantBodyMass( 400.0 );
+    bodyMap[ "Vehicle" ]->setAerodynamicCoefficientInterface(
+                createConstantCoefficientAerodynamicCoefficientInterface(
+                    ( Eigen::Vector3d( ) << 2.2, 0.0, 0.0 ).finished( ), Eigen::Vector3d::Zero( ), 1.0, 4.0, 1.0,
+                    Eigen::Vector3d::Zero( ), true, true ) );
+    setGlobalFrameBodyEphemerides( bodyMap, "SSB", "J2000" );
+
+    // Set two different low Earth orbits.
+    std::vector< Eigen::VectorXd > initialStates;
+    for( unsigned int i = 0; i < 2; i++ )
+    {
+        double orbitalRadius = 6378137.0 + 250.0E3 + static_cast< double >( i ) * 50.0E3;
+        double orbitalVelocity = std::sqrt( 3.986004418E14 / orbitalRadius );
+        double inclination = 0.3 + static_cast< double >( i ) * 0.6;
+        initialStates.push_back( ( Eigen::VectorXd( 6 ) << orbitalRadius, 0.0, 0.0, 0.0,
+                                   orbitalVelocity * std::cos( inclination ),
+                                   orbitalVelocity * std::sin( inclination ) ).finished( ) );
+    }
+
+    // Propagate orbits serially, and concurrently, each time in new copies of the bodies.
+    std::vector< Eigen::VectorXd > serialFinalStates( 2 ), concurrentFinalStates( 2 );
+    for( unsigned int i = 0; i < 2; i++ )
+    {
+        std::vector< NamedBodyMap > bodyMapCopies;
+        for( unsigned int j = 0; j < 2; j++ )
+        {
+            bodyMapCopies.push_back( createIndependentBodyMapCopy( bodyMap, "J2000" ) );
+            BOOST_CHECK( bodyMapCopies.at( j ).at( "Earth" )->getGravityFieldModel( ) !=
+                         bodyMap.at( "Earth" )->getGravityFieldModel( ) );
+            BOOST_CHECK( bodyMapCopies.at( j ).at( "Earth" )->getAtmosphereModel( ) !=
+                         bodyMap.at( "Earth" )->getAtmosphereModel( ) );
+            BOOST_CHECK( bodyMapCopies.at( j ).at( "Vehicle" )->getAerodynamicCoefficientInterface( ) !=
+                         bodyMap.at( "Vehicle" )->getAerodynamicCoefficientInterface( ) );
+        }
+
+        if( i == 0 )
+        {
+            for( unsigned int j = 0; j < 2; j++ )
+            {
+                propagateVehicleInBodyMap( j, bodyMapCopies, initialStates, serialFinalStates );
+            }
+        }
+        else
+        {
+            utilities::runOnParallelThreads(
+                        2, boost::bind( &propagateVehicleInBodyMap, _1, boost::cref( bodyMapCopies ),
+                                        boost::cref( initialStates ), boost::ref( concurrentFinalStates ) ) );
+        }
+    }
+
+    // Check that results are independent of concurrent evaluation.
+    for( unsigned int i = 0; i < 2; i++ )
+    {
+        for( unsigned int j = 0; j < 6; j++ )
+        {
+            BOOST_CHECK_EQUAL( concurrentFinalStates.at( i )( j ), serialFinalStates.at( i )( j ) );
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests